@@ -2080,12 +2080,15 @@ int export_handle_export_index(
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
+	libesedb_record_t *records[ EXPORT_HANDLE_INDEX_RECORDS_BATCH_SIZE ];
+
 	system_character_t *item_filename = NULL;
-	libesedb_record_t *record         = NULL;
 	FILE *index_file_stream           = NULL;
 	static char *function             = "export_handle_export_index";
+	int batch_iterator                = 0;
 	int known_index                   = 0;
 	size_t item_filename_size         = 0;
+	int number_of_batch_records       = 0;
 	int number_of_records             = 0;
 	int record_iterator               = 0;
 	int result                        = 0;
@@ -2112,6 +2115,20 @@ int export_handle_export_index(
 
 		return( -1 );
 	}
+	if( memory_set(
+	     records,
+	     0,
+	     sizeof( libesedb_record_t * ) * EXPORT_HANDLE_INDEX_RECORDS_BATCH_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear records.",
+		 function );
+
+		return( -1 );
+	}
 	if( export_handle_create_item_filename(
 	     export_handle,
 	     index_iterator,
@@ -2330,59 +2347,77 @@ int export_handle_export_index(
 
 		goto on_error;
 	}
+	/* Retrieve the records in batches, the index resolves the records
+	 * of a batch in primary key order which reduces random table page reads
+	 */
 	for( record_iterator = 0;
 	     record_iterator < number_of_records;
-	     record_iterator++ )
+	     record_iterator += number_of_batch_records )
 	{
-		if( libesedb_index_get_record(
+		number_of_batch_records = number_of_records - record_iterator;
+
+		if( number_of_batch_records > EXPORT_HANDLE_INDEX_RECORDS_BATCH_SIZE )
+		{
+			number_of_batch_records = EXPORT_HANDLE_INDEX_RECORDS_BATCH_SIZE;
+		}
+		if( libesedb_index_get_records(
 		     index,
 		     record_iterator,
-		     &record,
+		     records,
+		     number_of_batch_records,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record: %d.",
+			 "%s: unable to retrieve records: %d - %d.",
 			 function,
-			 record_iterator );
+			 record_iterator,
+			 record_iterator + number_of_batch_records - 1 );
 
 			goto on_error;
 		}
-		known_index = 0;
-
-		if( known_index == 0 )
+		for( batch_iterator = 0;
+		     batch_iterator < number_of_batch_records;
+		     batch_iterator++ )
 		{
-			result = export_handle_export_record(
-			          record,
-			          index_file_stream,
-			          log_handle,
-			          error );
-		}
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record.",
-			 function );
+			known_index = 0;
 
-			goto on_error;
-		}
-		if( libesedb_record_free(
-		     &record,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record.",
-			 function );
+			if( known_index == 0 )
+			{
+				result = export_handle_export_record(
+				          records[ batch_iterator ],
+				          index_file_stream,
+				          log_handle,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export record: %d.",
+				 function,
+				 record_iterator + batch_iterator );
 
-			goto on_error;
+				goto on_error;
+			}
+			if( libesedb_record_free(
+			     &( records[ batch_iterator ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record: %d.",
+				 function,
+				 record_iterator + batch_iterator );
+
+				goto on_error;
+			}
 		}
 	}
 	if( file_stream_close(
@@ -2402,11 +2437,16 @@ int export_handle_export_index(
 	return( 1 );
 
 on_error:
-	if( record != NULL )
+	for( batch_iterator = 0;
+	     batch_iterator < EXPORT_HANDLE_INDEX_RECORDS_BATCH_SIZE;
+	     batch_iterator++ )
 	{
-		libesedb_record_free(
-		 &record,
-		 NULL );
+		if( records[ batch_iterator ] != NULL )
+		{
+			libesedb_record_free(
+			 &( records[ batch_iterator ] ),
+			 NULL );
+		}
 	}
 #ifdef TODO
 	if( value_string != NULL )
@@ -3735,6 +3775,7 @@ int export_handle_export_long_record_value(
 	static char *function             = "export_handle_export_long_record_value";
 	size64_t value_data_size          = 0;
 	size_t value_string_size          = 0;
+	ssize_t read_count                = 0;
 	uint32_t column_identifier        = 0;
 	uint32_t column_type              = 0;
 	uint8_t value_data_flags          = 0;
@@ -3979,60 +4020,37 @@ int export_handle_export_long_record_value(
 			break;
 
 		default:
-			if( libesedb_long_value_get_data_size(
-			     long_value,
-			     &value_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value: %d data size.",
-				 function,
-				 record_value_entry );
+			value_data = (uint8_t *) memory_allocate(
+			                          sizeof( uint8_t ) * EXPORT_HANDLE_LONG_VALUE_BUFFER_SIZE );
 
-				goto on_error;
-			}
-			if( value_data_size > (size64_t) SSIZE_MAX )
-			{	
+			if( value_data == NULL )
+			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid value: %d data size value out of bounds.",
-				 function,
-				 record_value_entry );
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create value data.",
+				 function );
 
 				goto on_error;
 			}
-			if( value_data_size > 0 )
+			/* Stream the long value data so that large values are not read into memory at once
+			 */
+			do
 			{
-				value_data = (uint8_t *) memory_allocate(
-				                          sizeof( uint8_t ) * value_data_size );
+				read_count = libesedb_long_value_read_buffer(
+				              long_value,
+				              value_data,
+				              EXPORT_HANDLE_LONG_VALUE_BUFFER_SIZE,
+				              error );
 
-				if( value_data == NULL )
+				if( read_count < 0 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-					 "%s: unable to create value data.",
-					 function );
-
-					goto on_error;
-				}
-				if( libesedb_long_value_get_data(
-				     long_value,
-				     value_data,
-				     (size_t) value_data_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve value: %d data.",
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read value: %d data.",
 					 function,
 					 record_value_entry );
 
@@ -4040,14 +4058,16 @@ int export_handle_export_long_record_value(
 				}
 				export_binary_data(
 				 value_data,
-				 value_data_size,
+				 (size_t) read_count,
 				 record_file_stream );
+			}
+			while( read_count > 0 );
 
-				memory_free(
-				 value_data );
+			memory_free(
+			 value_data );
+
+			value_data = NULL;
 
-				value_data = NULL;
-			}
 			break;
 	}
 	if( libesedb_long_value_free(
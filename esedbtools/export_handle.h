@@ -41,6 +41,14 @@ enum EXPORT_MODES
 	EXPORT_MODE_TABLES		= (int) 't'
 };
 
+/* The number of index records that are retrieved at once
+ */
+#define EXPORT_HANDLE_INDEX_RECORDS_BATCH_SIZE	256
+
+/* The size of the buffer used to read long values
+ */
+#define EXPORT_HANDLE_LONG_VALUE_BUFFER_SIZE	65536
+
 typedef struct export_handle export_handle_t;
 
 struct export_handle
@@ -0,0 +1,168 @@
+/*
+ * The catalog cache definition of an Extensible Storage Engine (ESE) Database File (EDB)
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ESEDB_CATALOG_CACHE_H )
+#define _ESEDB_CATALOG_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The catalog cache is not part of the ESE database format
+ * it is a sidecar file written by the library
+ */
+typedef struct esedb_catalog_cache_header esedb_catalog_cache_header_t;
+
+struct esedb_catalog_cache_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Consists of: "esedbcat"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The checksum
+	 * A XOR-32 checksum calculated over the bytes
+	 * from offset 12 to the end of the catalog cache
+	 * with an initial value of 0x89abcdef
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The size of the database file
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The checksum of the database file header
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_header_checksum[ 4 ];
+
+	/* The page size of the database file
+	 * Consists of 4 bytes
+	 */
+	uint8_t page_size[ 4 ];
+
+	/* The database time of the database file header
+	 * Consists of 8 bytes
+	 */
+	uint8_t database_time[ 8 ];
+
+	/* The database signature of the database file header
+	 * Consists of 28 bytes
+	 */
+	uint8_t database_signature[ 28 ];
+
+	/* The number of entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_entries[ 4 ];
+};
+
+typedef struct esedb_catalog_cache_entry esedb_catalog_cache_entry_t;
+
+struct esedb_catalog_cache_entry
+{
+	/* The number of the catalog (leaf) page that contains the table catalog definition
+	 * Consists of 4 bytes
+	 */
+	uint8_t catalog_page_number[ 4 ];
+
+	/* The index of the catalog page value that contains the table catalog definition
+	 * Consists of 2 bytes
+	 */
+	uint8_t catalog_page_value_index[ 2 ];
+
+	/* The catalog definition type
+	 * Consists of 2 bytes
+	 */
+	uint8_t type[ 2 ];
+
+	/* The father data page (FDP) object identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t father_data_page_object_identifier[ 4 ];
+
+	/* The identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t identifier[ 4 ];
+
+	/* The father data page (FDP) number
+	 * Consists of 4 bytes
+	 */
+	uint8_t father_data_page_number[ 4 ];
+
+	/* The size (or space usage)
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+
+	/* The codepage
+	 * Consists of 4 bytes
+	 */
+	uint8_t codepage[ 4 ];
+
+	/* The LCMAP flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t lcmap_flags[ 4 ];
+
+	/* The name size
+	 * Consists of 2 bytes
+	 */
+	uint8_t name_size[ 2 ];
+
+	/* The template name size
+	 * Consists of 2 bytes
+	 */
+	uint8_t template_name_size[ 2 ];
+
+	/* The default value size
+	 * Consists of 2 bytes
+	 */
+	uint8_t default_value_size[ 2 ];
+
+	/* The key field identifiers size
+	 * Consists of 2 bytes
+	 */
+	uint8_t key_field_identifiers_size[ 2 ];
+
+	/* The name, template name, default value and key field identifiers data
+	 * follow directly after the entry
+	 */
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ESEDB_CATALOG_CACHE_H ) */
+
@@ -28,6 +28,7 @@
 #include "libesedb_definitions.h"
 #include "libesedb_catalog.h"
 #include "libesedb_catalog_definition.h"
+#include "libesedb_hash_table.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
@@ -193,6 +194,22 @@ int libesedb_catalog_free(
 
 			result = -1;
 		}
+		if( ( *catalog )->table_definition_hash_table != NULL )
+		{
+			if( libesedb_hash_table_free(
+			     &( ( *catalog )->table_definition_hash_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free table definition hash table.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcdata_list_free(
 		     &( ( *catalog )->table_definition_list ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_table_definition_free,
@@ -508,6 +525,7 @@ int libesedb_catalog_read_values_from_page(
 	static char *function                       = "libesedb_catalog_read_values_from_page";
 	uint32_t child_page_number                  = 0;
 	uint32_t page_flags                         = 0;
+	uint16_t catalog_definition_type            = 0;
 	uint16_t number_of_page_values              = 0;
 	uint16_t page_value_index                   = 0;
 
@@ -699,22 +717,57 @@ int libesedb_catalog_read_values_from_page(
 		}
 		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
 		{
-			if( libesedb_catalog_read_value_data(
-			     catalog,
+			if( libesedb_catalog_definition_read_type(
 			     page_tree_value->data,
 			     page_tree_value->data_size,
-			     table_definition,
+			     &catalog_definition_type,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read catalog value.",
-				 function );
+				 "%s: unable to read catalog value: %" PRIu16 " definition type.",
+				 function,
+				 page_value_index );
 
 				goto on_error;
 			}
+			/* Only the table catalog definitions are read here, the other catalog
+			 * definitions of a table are read when the table is first used
+			 */
+			if( catalog_definition_type == LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
+			{
+				if( libesedb_catalog_read_value_data(
+				     catalog,
+				     page_tree_value->data,
+				     page_tree_value->data_size,
+				     table_definition,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read catalog value.",
+					 function );
+
+					goto on_error;
+				}
+				if( *table_definition == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing table definition.",
+					 function );
+
+					goto on_error;
+				}
+				( *table_definition )->catalog_page_number      = page->page_number;
+				( *table_definition )->catalog_page_value_index = page_value_index;
+			}
 			*leaf_value_index += 1;
 		}
 		else
@@ -1017,6 +1070,19 @@ int libesedb_catalog_read_file_io_handle(
 
 		goto on_error;
 	}
+	if( libesedb_catalog_build_table_definition_hash_table(
+	     catalog,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build table definition hash table.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfcache_cache_free(
 	     &root_page_cache,
 	     error ) != 1 )
@@ -1042,54 +1108,28 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the number of table definitions
- * Returns 1 if successful or -1 on error
- */
-int libesedb_catalog_get_number_of_table_definitions(
-     libesedb_catalog_t *catalog,
-     int *number_of_table_definitions,
-     libcerror_error_t **error )
-{
-	static char *function = "libesedb_catalog_get_number_of_table_definitions";
-
-	if( catalog == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid catalog.",
-		 function );
-
-		return( -1 );
-	}
-	if( libcdata_list_get_number_of_elements(
-	     catalog->table_definition_list,
-	     number_of_table_definitions,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of table definitions.",
-		 function );
-
-		return( -1 );
-	}
-	return( 1 );
-}
-
-/* Retrieves the table definition for the specific index
+/* Reads the column, index, long value and callback catalog definitions of a table definition
+ * These catalog definitions directly follow the table catalog definition in the catalog
  * Returns 1 if successful or -1 on error
  */
-int libesedb_catalog_get_table_definition_by_index(
+int libesedb_catalog_read_table_definition_values(
      libesedb_catalog_t *catalog,
-     int table_definition_index,
-     libesedb_table_definition_t **table_definition,
+     libbfio_handle_t *file_io_handle,
+     libesedb_table_definition_t *table_definition,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_catalog_get_table_definition_by_index";
+	libesedb_page_t *page                       = NULL;
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	libfcache_cache_t *page_cache               = NULL;
+	static char *function                       = "libesedb_catalog_read_table_definition_values";
+	uint32_t catalog_page_number                = 0;
+	uint32_t number_of_pages                    = 0;
+	uint32_t page_flags                         = 0;
+	uint32_t page_number                        = 0;
+	uint16_t catalog_definition_type            = 0;
+	uint16_t number_of_page_values              = 0;
+	uint16_t page_value_index                   = 0;
 
 	if( catalog == NULL )
 	{
@@ -1102,80 +1142,24 @@ int libesedb_catalog_get_table_definition_by_index(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_value_by_index(
-	     catalog->table_definition_list,
-	     table_definition_index,
-	     (intptr_t **) table_definition,
-	     error ) != 1 )
+	if( catalog->page_tree == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve table definition: %d.",
-		 function,
-		 table_definition_index );
-
-		return( -1 );
-	}
-	return( 1 );
-}
-
-/* Retrieves the table definition for the specific name
- * Returns 1 if successful, 0 if no corresponding table definition was found or -1 on error
- */
-int libesedb_catalog_get_table_definition_by_name(
-     libesedb_catalog_t *catalog,
-     const uint8_t *table_name,
-     size_t table_name_size,
-     libesedb_table_definition_t **table_definition,
-     libcerror_error_t **error )
-{
-	libcdata_list_element_t *list_element = NULL;
-	static char *function                 = "libesedb_catalog_get_table_definition_by_name";
-	int element_index                     = 0;
-	int number_of_elements                = 0;
-
-	if( catalog == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid catalog.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - missing page tree.",
 		 function );
 
 		return( -1 );
 	}
-	if( catalog->table_definition_list == NULL )
+	if( catalog->page_tree->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid catalog - missing table definition list.",
-		 function );
-
-		return( -1 );
-	}
-	if( table_name == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table name.",
-		 function );
-
-		return( -1 );
-	}
-	if( table_name_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid table name size value exceeds maximum.",
+		 "%s: invalid catalog - invalid page tree - missing IO handle.",
 		 function );
 
 		return( -1 );
@@ -1191,115 +1175,807 @@ int libesedb_catalog_get_table_definition_by_name(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     catalog->table_definition_list,
-	     &list_element,
-	     error ) != 1 )
+	if( table_definition->catalog_page_number == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first element of table definition list.",
-		 function );
-
-		return( -1 );
+		return( 1 );
 	}
-	if( libcdata_list_get_number_of_elements(
-	     catalog->table_definition_list,
-	     &number_of_elements,
+	catalog_page_number = table_definition->catalog_page_number;
+
+        /* Use a local cache to prevent cache invalidation of the catalog page
+         * while reading the catalog definitions.
+         */
+	if( libfcache_cache_initialize(
+	     &page_cache,
+	     1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in table definition list.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page cache.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	for( element_index = 0;
-	     element_index < number_of_elements;
-	     element_index++ )
+	page_number      = catalog_page_number;
+	page_value_index = table_definition->catalog_page_value_index + 1;
+
+	while( page_number != 0 )
 	{
-		if( libcdata_list_element_get_value(
-		     list_element,
-		     (intptr_t **) table_definition,
+		/* Protect against a loop in the leaf page list
+		 */
+		if( number_of_pages >= catalog->page_tree->io_handle->last_page_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of pages value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_pages++;
+
+#if ( SIZEOF_INT <= 4 )
+		if( page_number > (uint32_t) INT_MAX )
+#else
+		if( (int) page_number > INT_MAX )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page number value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfdata_vector_get_element_value_by_index(
+		     catalog->page_tree->pages_vector,
+		     (intptr_t *) file_io_handle,
+		     (libfdata_cache_t *) page_cache,
+		     (int) page_number - 1,
+		     (intptr_t **) &page,
+		     0,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from element: %d.",
+			 "%s: unable to retrieve page: %" PRIu32 ".",
 			 function,
-			 element_index );
+			 page_number );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( *table_definition == NULL )
+		if( libesedb_page_validate_page(
+		     page,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing table definition: %d.",
-			 function,
-			 element_index );
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported page.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( ( *table_definition )->table_catalog_definition == NULL )
+		if( libesedb_page_get_flags(
+		     page,
+		     &page_flags,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid table definition: %d - missing table catalog definition.",
-			 function,
-			 element_index );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page flags.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( ( *table_definition )->table_catalog_definition->name == NULL )
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid table catalog definition: %d - missing name.",
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported page: %" PRIu32 " - not a leaf page.",
 			 function,
-			 element_index );
+			 page_number );
 
-			return( -1 );
-		}
-		if( table_name_size == ( *table_definition )->table_catalog_definition->name_size )
-		{
-			if( memory_compare(
-			     ( *table_definition )->table_catalog_definition->name,
-			     table_name,
-			     table_name_size ) == 0 )
-			{
-				return( 1 );
-			}
+			goto on_error;
 		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
+		if( libesedb_page_get_number_of_values(
+		     page,
+		     &number_of_page_values,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next element of element: %d.",
-			 function,
-			 element_index );
+			 "%s: unable to retrieve number of page values.",
+			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+		while( page_value_index < number_of_page_values )
+		{
+			if( libesedb_page_get_value_by_index(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( page_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			page_value_index++;
+
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+			{
+				continue;
+			}
+			if( libesedb_page_tree_value_initialize(
+			     &page_tree_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create page tree value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_tree_value_read_data(
+			     page_tree_value,
+			     page_value->data,
+			     (size_t) page_value->size,
+			     page_value->flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read page tree value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_catalog_definition_read_type(
+			     page_tree_value->data,
+			     page_tree_value->data_size,
+			     &catalog_definition_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalog definition type.",
+				 function );
+
+				goto on_error;
+			}
+			/* The next table catalog definition marks the end of the catalog
+			 * definitions of the table
+			 */
+			if( catalog_definition_type == LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
+			{
+				page_number = 0;
+
+				break;
+			}
+			if( libesedb_catalog_read_value_data(
+			     catalog,
+			     page_tree_value->data,
+			     page_tree_value->data_size,
+			     &table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalog value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_tree_value_free(
+			     &page_tree_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free page tree value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( page_tree_value != NULL )
+		{
+			if( libesedb_page_tree_value_free(
+			     &page_tree_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free page tree value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( page_number != 0 )
+		{
+			if( libesedb_page_get_next_page_number(
+			     page,
+			     &page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next page number.",
+				 function );
+
+				goto on_error;
+			}
+			page_value_index = 1;
+		}
+	}
+	if( libfcache_cache_free(
+	     &page_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page cache.",
+		 function );
+
+		goto on_error;
+	}
+	table_definition->catalog_page_number = 0;
+
+	return( 1 );
+
+on_error:
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	if( page_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &page_cache,
+		 NULL );
+	}
+	/* Remove the catalog definitions that were read before the error
+	 * and mark the table definition values as not read, so that a next
+	 * call reads them again
+	 */
+	libesedb_table_definition_empty(
+	 table_definition,
+	 NULL );
+
+	table_definition->catalog_page_number = catalog_page_number;
+
+	return( -1 );
+}
+
+/* Builds the table definition hash table
+ * The table definitions are hashed by name so that a table definition can be
+ * retrieved by name without comparing the names of all table definitions
+ * The names are decoded using codepage 1252, like in the table name comparisons
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_build_table_definition_hash_table(
+     libesedb_catalog_t *catalog,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element         = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	static char *function                         = "libesedb_catalog_build_table_definition_hash_table";
+	uint32_t name_hash                            = 0;
+	int element_index                             = 0;
+	int number_of_elements                        = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog->table_definition_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - missing table definition list.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog->table_definition_hash_table != NULL )
+	{
+		if( libesedb_hash_table_free(
+		     &( catalog->table_definition_hash_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table definition hash table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_list_get_first_element(
+	     catalog->table_definition_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first element of table definition list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_list_get_number_of_elements(
+	     catalog->table_definition_list,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements in table definition list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_hash_table_initialize(
+	     &( catalog->table_definition_hash_table ),
+	     number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table definition hash table.",
+		 function );
+
+		goto on_error;
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from element: %d.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		if( table_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing table definition: %d.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		if( table_definition->table_catalog_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid table definition: %d - missing table catalog definition.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		if( table_definition->table_catalog_definition->name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid table catalog definition: %d - missing name.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		if( libesedb_hash_table_get_name_hash_from_byte_stream(
+		     table_definition->table_catalog_definition->name,
+		     table_definition->table_catalog_definition->name_size,
+		     LIBUNA_CODEPAGE_WINDOWS_1252,
+		     &name_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve name hash of table catalog definition: %d.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		if( libesedb_hash_table_insert_value(
+		     catalog->table_definition_hash_table,
+		     name_hash,
+		     (intptr_t *) table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert table definition: %d into hash table.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next element of element: %d.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( catalog->table_definition_hash_table != NULL )
+	{
+		libesedb_hash_table_free(
+		 &( catalog->table_definition_hash_table ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of table definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_get_number_of_table_definitions(
+     libesedb_catalog_t *catalog,
+     int *number_of_table_definitions,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_get_number_of_table_definitions";
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_number_of_elements(
+	     catalog->table_definition_list,
+	     number_of_table_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of table definitions.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the table definition for the specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_get_table_definition_by_index(
+     libesedb_catalog_t *catalog,
+     int table_definition_index,
+     libesedb_table_definition_t **table_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_get_table_definition_by_index";
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_value_by_index(
+	     catalog->table_definition_list,
+	     table_definition_index,
+	     (intptr_t **) table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table definition: %d.",
+		 function,
+		 table_definition_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the table definition for the specific name
+ * Returns 1 if successful, 0 if no corresponding table definition was found or -1 on error
+ */
+int libesedb_catalog_get_table_definition_by_name(
+     libesedb_catalog_t *catalog,
+     const uint8_t *table_name,
+     size_t table_name_size,
+     libesedb_table_definition_t **table_definition,
+     libcerror_error_t **error )
+{
+	static char *function      = "libesedb_catalog_get_table_definition_by_name";
+	uint32_t name_hash         = 0;
+	int entry_index            = 0;
+	int result                 = 0;
+	int table_definition_index = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog->table_definition_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - missing table definition list.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table name.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid table name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog->table_definition_hash_table == NULL )
+	{
+		if( libesedb_catalog_build_table_definition_hash_table(
+		     catalog,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build table definition hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_hash_table_get_name_hash_from_byte_stream(
+	     table_name,
+	     table_name_size,
+	     LIBUNA_CODEPAGE_WINDOWS_1252,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* Table definitions with a different name can have the same hash
+	 */
+	entry_index = -1;
+
+	do
+	{
+		result = libesedb_hash_table_get_next_value_by_hash(
+		          catalog->table_definition_hash_table,
+		          name_hash,
+		          &entry_index,
+		          &table_definition_index,
+		          (intptr_t **) table_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table definition from hash table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( *table_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing table definition: %d.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		if( ( *table_definition )->table_catalog_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid table definition: %d - missing table catalog definition.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		if( ( *table_definition )->table_catalog_definition->name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid table catalog definition: %d - missing name.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		if( table_name_size != ( *table_definition )->table_catalog_definition->name_size )
+		{
+			continue;
+		}
+		if( memory_compare(
+		     ( *table_definition )->table_catalog_definition->name,
+		     table_name,
+		     table_name_size ) == 0 )
+		{
+			return( 1 );
 		}
 	}
+	while( result != 0 );
+
 	*table_definition = NULL;
 
 	return( 0 );
@@ -1315,11 +1991,12 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
      libesedb_table_definition_t **table_definition,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *list_element = NULL;
-	static char *function                 = "libesedb_catalog_get_table_definition_by_utf8_name";
-	int element_index                     = 0;
-	int number_of_elements                = 0;
-	int result                            = 0;
+	static char *function      = "libesedb_catalog_get_table_definition_by_utf8_name";
+	uint32_t name_hash         = 0;
+	int compare_result         = 0;
+	int entry_index            = 0;
+	int result                 = 0;
+	int table_definition_index = 0;
 
 	if( catalog == NULL )
 	{
@@ -1376,53 +2053,66 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     catalog->table_definition_list,
-	     &list_element,
-	     error ) != 1 )
+	if( catalog->table_definition_hash_table == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first element of table definition list.",
-		 function );
+		if( libesedb_catalog_build_table_definition_hash_table(
+		     catalog,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build table definition hash table.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
-	if( libcdata_list_get_number_of_elements(
-	     catalog->table_definition_list,
-	     &number_of_elements,
+	if( libesedb_hash_table_get_name_hash_from_utf8_string(
+	     utf8_string,
+	     utf8_string_length,
+	     &name_hash,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in table definition list.",
+		 "%s: unable to retrieve name hash of UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	for( element_index = 0;
-	     element_index < number_of_elements;
-	     element_index++ )
+	/* Table definitions with a different name can have the same hash
+	 */
+	entry_index = -1;
+
+	do
 	{
-		if( libcdata_list_element_get_value(
-		     list_element,
-		     (intptr_t **) table_definition,
-		     error ) != 1 )
+		result = libesedb_hash_table_get_next_value_by_hash(
+		          catalog->table_definition_hash_table,
+		          name_hash,
+		          &entry_index,
+		          &table_definition_index,
+		          (intptr_t **) table_definition,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from element: %d.",
-			 function,
-			 element_index );
+			 "%s: unable to retrieve table definition from hash table.",
+			 function );
 
 			return( -1 );
 		}
+		else if( result == 0 )
+		{
+			break;
+		}
 		if( *table_definition == NULL )
 		{
 			libcerror_error_set(
@@ -1431,7 +2121,7 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: missing table definition: %d.",
 			 function,
-			 element_index );
+			 table_definition_index );
 
 			return( -1 );
 		}
@@ -1443,7 +2133,7 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: invalid table definition: %d - missing table catalog definition.",
 			 function,
-			 element_index );
+			 table_definition_index );
 
 			return( -1 );
 		}
@@ -1455,19 +2145,19 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: invalid table catalog definition: %d - missing name.",
 			 function,
-			 element_index );
+			 table_definition_index );
 
 			return( -1 );
 		}
-		result = libuna_utf8_string_compare_with_byte_stream(
-			  utf8_string,
-			  utf8_string_length,
-			  ( *table_definition )->table_catalog_definition->name,
-			  ( *table_definition )->table_catalog_definition->name_size,
-			  LIBUNA_CODEPAGE_WINDOWS_1252,
-			  error );
-
-		if( result == -1 )
+		compare_result = libuna_utf8_string_compare_with_byte_stream(
+		                  utf8_string,
+		                  utf8_string_length,
+		                  ( *table_definition )->table_catalog_definition->name,
+		                  ( *table_definition )->table_catalog_definition->name_size,
+		                  LIBUNA_CODEPAGE_WINDOWS_1252,
+		                  error );
+
+		if( compare_result == -1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1475,30 +2165,17 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: unable to compare UTF-8 string with table catalog definition: %d name.",
 			 function,
-			 element_index );
+			 table_definition_index );
 
 			return( -1 );
 		}
-		else if( result == LIBUNA_COMPARE_EQUAL )
+		else if( compare_result == LIBUNA_COMPARE_EQUAL )
 		{
 			return( 1 );
 		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next element of element: %d.",
-			 function,
-			 element_index );
-
-			return( -1 );
-		}
 	}
+	while( result != 0 );
+
 	*table_definition = NULL;
 
 	return( 0 );
@@ -1514,11 +2191,12 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
      libesedb_table_definition_t **table_definition,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *list_element = NULL;
-	static char *function                 = "libesedb_catalog_get_table_definition_by_utf16_name";
-	int element_index                     = 0;
-	int number_of_elements                = 0;
-	int result                            = 0;
+	static char *function      = "libesedb_catalog_get_table_definition_by_utf16_name";
+	uint32_t name_hash         = 0;
+	int compare_result         = 0;
+	int entry_index            = 0;
+	int result                 = 0;
+	int table_definition_index = 0;
 
 	if( catalog == NULL )
 	{
@@ -1575,53 +2253,66 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     catalog->table_definition_list,
-	     &list_element,
-	     error ) != 1 )
+	if( catalog->table_definition_hash_table == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first element of table definition list.",
-		 function );
+		if( libesedb_catalog_build_table_definition_hash_table(
+		     catalog,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build table definition hash table.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
-	if( libcdata_list_get_number_of_elements(
-	     catalog->table_definition_list,
-	     &number_of_elements,
+	if( libesedb_hash_table_get_name_hash_from_utf16_string(
+	     utf16_string,
+	     utf16_string_length,
+	     &name_hash,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in table definition list.",
+		 "%s: unable to retrieve name hash of UTF-16 string.",
 		 function );
 
 		return( -1 );
 	}
-	for( element_index = 0;
-	     element_index < number_of_elements;
-	     element_index++ )
+	/* Table definitions with a different name can have the same hash
+	 */
+	entry_index = -1;
+
+	do
 	{
-		if( libcdata_list_element_get_value(
-		     list_element,
-		     (intptr_t **) table_definition,
-		     error ) != 1 )
+		result = libesedb_hash_table_get_next_value_by_hash(
+		          catalog->table_definition_hash_table,
+		          name_hash,
+		          &entry_index,
+		          &table_definition_index,
+		          (intptr_t **) table_definition,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from element: %d.",
-			 function,
-			 element_index );
+			 "%s: unable to retrieve table definition from hash table.",
+			 function );
 
 			return( -1 );
 		}
+		else if( result == 0 )
+		{
+			break;
+		}
 		if( *table_definition == NULL )
 		{
 			libcerror_error_set(
@@ -1630,7 +2321,7 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: missing table definition: %d.",
 			 function,
-			 element_index );
+			 table_definition_index );
 
 			return( -1 );
 		}
@@ -1642,7 +2333,7 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: invalid table definition: %d - missing table catalog definition.",
 			 function,
-			 element_index );
+			 table_definition_index );
 
 			return( -1 );
 		}
@@ -1654,19 +2345,19 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: invalid table catalog definition: %d - missing name.",
 			 function,
-			 element_index );
+			 table_definition_index );
 
 			return( -1 );
 		}
-		result = libuna_utf16_string_compare_with_byte_stream(
-			  utf16_string,
-			  utf16_string_length,
-			  ( *table_definition )->table_catalog_definition->name,
-			  ( *table_definition )->table_catalog_definition->name_size,
-			  LIBUNA_CODEPAGE_WINDOWS_1252,
-			  error );
-
-		if( result == -1 )
+		compare_result = libuna_utf16_string_compare_with_byte_stream(
+		                  utf16_string,
+		                  utf16_string_length,
+		                  ( *table_definition )->table_catalog_definition->name,
+		                  ( *table_definition )->table_catalog_definition->name_size,
+		                  LIBUNA_CODEPAGE_WINDOWS_1252,
+		                  error );
+
+		if( compare_result == -1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1674,30 +2365,17 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: unable to compare UTF-16 string with table catalog definition: %d name.",
 			 function,
-			 element_index );
+			 table_definition_index );
 
 			return( -1 );
 		}
-		else if( result == LIBUNA_COMPARE_EQUAL )
+		else if( compare_result == LIBUNA_COMPARE_EQUAL )
 		{
 			return( 1 );
 		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next element of element: %d.",
-			 function,
-			 element_index );
-
-			return( -1 );
-		}
 	}
+	while( result != 0 );
+
 	*table_definition = NULL;
 
 	return( 0 );
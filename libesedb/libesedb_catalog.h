@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_hash_table.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
@@ -49,6 +50,11 @@ struct libesedb_catalog
 	/* The table definition list
 	 */
 	libcdata_list_t *table_definition_list;
+
+	/* The table definition hash table
+	 * The table definitions are hashed by name
+	 */
+	libesedb_hash_table_t *table_definition_hash_table;
 };
 
 int libesedb_catalog_initialize(
@@ -84,6 +90,16 @@ int libesedb_catalog_read_file_io_handle(
      uint32_t page_number,
      libcerror_error_t **error );
 
+int libesedb_catalog_read_table_definition_values(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libesedb_table_definition_t *table_definition,
+     libcerror_error_t **error );
+
+int libesedb_catalog_build_table_definition_hash_table(
+     libesedb_catalog_t *catalog,
+     libcerror_error_t **error );
+
 int libesedb_catalog_get_number_of_table_definitions(
      libesedb_catalog_t *catalog,
      int *number_of_table_definitions,
@@ -0,0 +1,1600 @@
+/*
+ * Catalog cache functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_catalog.h"
+#include "libesedb_catalog_cache.h"
+#include "libesedb_catalog_definition.h"
+#include "libesedb_checksum.h"
+#include "libesedb_definitions.h"
+#include "libesedb_file_header.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libcnotify.h"
+#include "libesedb_table_definition.h"
+
+#include "esedb_catalog_cache.h"
+
+const uint8_t esedb_catalog_cache_signature[ 8 ] = { 'e', 's', 'e', 'd', 'b', 'c', 'a', 't' };
+
+/* Creates a catalog cache
+ * Make sure the value catalog_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_cache_initialize(
+     libesedb_catalog_cache_t **catalog_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_cache_initialize";
+
+	if( catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalog_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalog cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*catalog_cache = memory_allocate_structure(
+	                  libesedb_catalog_cache_t );
+
+	if( *catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create catalog cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *catalog_cache,
+	     0,
+	     sizeof( libesedb_catalog_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear catalog cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *catalog_cache != NULL )
+	{
+		memory_free(
+		 *catalog_cache );
+
+		*catalog_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a catalog cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_cache_free(
+     libesedb_catalog_cache_t **catalog_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_cache_free";
+
+	if( catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalog_cache != NULL )
+	{
+		memory_free(
+		 *catalog_cache );
+
+		*catalog_cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the database file values the catalog cache is keyed by
+ * A catalog cache is only used when these values match the database file
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_cache_set_file_header_values(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_file_header_t *file_header,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_cache_set_file_header_values";
+
+	if( catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     catalog_cache->database_signature,
+	     file_header->database_signature,
+	     28 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database signature.",
+		 function );
+
+		return( -1 );
+	}
+	catalog_cache->file_size            = file_size;
+	catalog_cache->file_header_checksum = file_header->checksum;
+	catalog_cache->page_size            = file_header->page_size;
+	catalog_cache->database_time        = file_header->database_time;
+
+	return( 1 );
+}
+
+/* Reads a catalog cache entry and appends the corresponding table definition to the catalog
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_cache_read_entry_data(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_catalog_t *catalog,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *entry_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *catalog_definition = NULL;
+	libesedb_table_definition_t *table_definition     = NULL;
+	static char *function                             = "libesedb_catalog_cache_read_entry_data";
+	size_t data_offset                                = 0;
+	size_t variable_data_size                         = 0;
+	uint32_t catalog_page_number                      = 0;
+	uint16_t catalog_page_value_index                 = 0;
+	uint16_t default_value_size                       = 0;
+	uint16_t key_field_identifiers_size               = 0;
+	uint16_t name_size                                = 0;
+	uint16_t template_name_size                       = 0;
+	uint16_t type                                     = 0;
+
+	if( catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( catalog->page_tree == NULL )
+	 || ( catalog->page_tree->io_handle == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( esedb_catalog_cache_entry_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry data size.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_entry_t *) data )->catalog_page_number,
+	 catalog_page_number );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (esedb_catalog_cache_entry_t *) data )->catalog_page_value_index,
+	 catalog_page_value_index );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (esedb_catalog_cache_entry_t *) data )->type,
+	 type );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (esedb_catalog_cache_entry_t *) data )->name_size,
+	 name_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (esedb_catalog_cache_entry_t *) data )->template_name_size,
+	 template_name_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (esedb_catalog_cache_entry_t *) data )->default_value_size,
+	 default_value_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (esedb_catalog_cache_entry_t *) data )->key_field_identifiers_size,
+	 key_field_identifiers_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: catalog page number\t\t\t: %" PRIu32 "\n",
+		 function,
+		 catalog_page_number );
+
+		libcnotify_printf(
+		 "%s: catalog page value index\t\t: %" PRIu16 "\n",
+		 function,
+		 catalog_page_value_index );
+
+		libcnotify_printf(
+		 "%s: type\t\t\t\t\t: %" PRIu16 "\n",
+		 function,
+		 type );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( ( catalog_page_number == 0 )
+	 || ( catalog_page_number > catalog->page_tree->io_handle->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid catalog page number value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( catalog_page_value_index == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid catalog page value index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( type != LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported catalog definition type: %" PRIu16 ".",
+		 function,
+		 type );
+
+		goto on_error;
+	}
+	variable_data_size = (size_t) name_size + (size_t) template_name_size
+	                   + (size_t) default_value_size + (size_t) key_field_identifiers_size;
+
+	if( ( name_size == 0 )
+	 || ( variable_data_size > ( data_size - sizeof( esedb_catalog_cache_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid variable data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_catalog_definition_initialize(
+	     &catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create catalog definition.",
+		 function );
+
+		goto on_error;
+	}
+	catalog_definition->type = type;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_entry_t *) data )->father_data_page_object_identifier,
+	 catalog_definition->father_data_page_object_identifier );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_entry_t *) data )->identifier,
+	 catalog_definition->identifier );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_entry_t *) data )->father_data_page_number,
+	 catalog_definition->father_data_page_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_entry_t *) data )->size,
+	 catalog_definition->size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_entry_t *) data )->codepage,
+	 catalog_definition->codepage );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_entry_t *) data )->lcmap_flags,
+	 catalog_definition->lcmap_flags );
+
+	data_offset = sizeof( esedb_catalog_cache_entry_t );
+
+	catalog_definition->name = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * name_size );
+
+	if( catalog_definition->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+	catalog_definition->name_size = (size_t) name_size;
+
+	if( memory_copy(
+	     catalog_definition->name,
+	     &( data[ data_offset ] ),
+	     catalog_definition->name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset += catalog_definition->name_size;
+
+	if( template_name_size > 0 )
+	{
+		catalog_definition->template_name = (uint8_t *) memory_allocate(
+		                                                 sizeof( uint8_t ) * template_name_size );
+
+		if( catalog_definition->template_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create template name.",
+			 function );
+
+			goto on_error;
+		}
+		catalog_definition->template_name_size = (size_t) template_name_size;
+
+		if( memory_copy(
+		     catalog_definition->template_name,
+		     &( data[ data_offset ] ),
+		     catalog_definition->template_name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy template name.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += catalog_definition->template_name_size;
+	}
+	if( default_value_size > 0 )
+	{
+		catalog_definition->default_value = (uint8_t *) memory_allocate(
+		                                                 sizeof( uint8_t ) * default_value_size );
+
+		if( catalog_definition->default_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create default value.",
+			 function );
+
+			goto on_error;
+		}
+		catalog_definition->default_value_size = (size_t) default_value_size;
+
+		if( memory_copy(
+		     catalog_definition->default_value,
+		     &( data[ data_offset ] ),
+		     catalog_definition->default_value_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy default value.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += catalog_definition->default_value_size;
+	}
+	if( key_field_identifiers_size > 0 )
+	{
+		catalog_definition->key_field_identifiers = (uint8_t *) memory_allocate(
+		                                                         sizeof( uint8_t ) * key_field_identifiers_size );
+
+		if( catalog_definition->key_field_identifiers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create key field identifiers.",
+			 function );
+
+			goto on_error;
+		}
+		catalog_definition->key_field_identifiers_size = (size_t) key_field_identifiers_size;
+
+		if( memory_copy(
+		     catalog_definition->key_field_identifiers,
+		     &( data[ data_offset ] ),
+		     catalog_definition->key_field_identifiers_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key field identifiers.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += catalog_definition->key_field_identifiers_size;
+	}
+	if( libesedb_table_definition_initialize(
+	     &table_definition,
+	     catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table definition.",
+		 function );
+
+		goto on_error;
+	}
+	catalog_definition = NULL;
+
+	/* The column, index, long value and callback catalog definitions
+	 * are read from the catalog when the table is first used
+	 */
+	table_definition->catalog_page_number      = catalog_page_number;
+	table_definition->catalog_page_value_index = catalog_page_value_index;
+
+	if( libcdata_list_append_value(
+	     catalog->table_definition_list,
+	     (intptr_t *) table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append table definition to table definition list.",
+		 function );
+
+		goto on_error;
+	}
+	*entry_data_size = data_offset;
+
+	return( 1 );
+
+on_error:
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &catalog_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the catalog cache data
+ * Returns 1 if successful, 0 if the catalog cache does not match the database file or -1 on error
+ */
+int libesedb_catalog_cache_read_data(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_catalog_t *catalog,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "libesedb_catalog_cache_read_data";
+	size64_t file_size                 = 0;
+	size_t data_offset                 = 0;
+	size_t entry_data_size             = 0;
+	uint64_t database_time             = 0;
+	uint32_t calculated_xor32_checksum = 0;
+	uint32_t entry_index               = 0;
+	uint32_t file_header_checksum      = 0;
+	uint32_t format_version            = 0;
+	uint32_t number_of_entries         = 0;
+	uint32_t page_size                 = 0;
+	uint32_t stored_xor32_checksum     = 0;
+	int number_of_table_definitions    = 0;
+
+	if( catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_get_number_of_table_definitions(
+	     catalog,
+	     &number_of_table_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of table definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_table_definitions != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalog - table definitions already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* A catalog cache that is too small or has an unsupported signature, format version
+	 * or checksum is ignored, like one that was written for another database file
+	 */
+	if( data_size < sizeof( esedb_catalog_cache_header_t ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     ( (esedb_catalog_cache_header_t *) data )->signature,
+	     esedb_catalog_cache_signature,
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->format_version,
+	 format_version );
+
+	if( format_version != 1 )
+	{
+		return( 0 );
+	}
+	if( libesedb_checksum_calculate_little_endian_xor32(
+	     &calculated_xor32_checksum,
+	     &( data[ 12 ] ),
+	     data_size - 12,
+	     0x89abcdef,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->checksum,
+	 stored_xor32_checksum );
+
+	if( stored_xor32_checksum != calculated_xor32_checksum )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in catalog cache checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 stored_xor32_checksum,
+			 calculated_xor32_checksum );
+		}
+#endif
+		return( 0 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->file_size,
+	 file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->file_header_checksum,
+	 file_header_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->page_size,
+	 page_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->database_time,
+	 database_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->number_of_entries,
+	 number_of_entries );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: file size\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 file_size );
+
+		libcnotify_printf(
+		 "%s: file header checksum\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 file_header_checksum );
+
+		libcnotify_printf(
+		 "%s: page size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 page_size );
+
+		libcnotify_printf(
+		 "%s: database time\t\t\t\t: 0x%016" PRIx64 "\n",
+		 function,
+		 database_time );
+
+		libcnotify_printf(
+		 "%s: number of entries\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_entries );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( ( file_size != catalog_cache->file_size )
+	 || ( file_header_checksum != catalog_cache->file_header_checksum )
+	 || ( page_size != catalog_cache->page_size )
+	 || ( database_time != catalog_cache->database_time ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     ( (esedb_catalog_cache_header_t *) data )->database_signature,
+	     catalog_cache->database_signature,
+	     28 ) != 0 )
+	{
+		return( 0 );
+	}
+	data_offset = sizeof( esedb_catalog_cache_header_t );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( data_offset >= data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry: %" PRIu32 " data offset value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( libesedb_catalog_cache_read_entry_data(
+		     catalog_cache,
+		     catalog,
+		     &( data[ data_offset ] ),
+		     data_size - data_offset,
+		     &entry_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read entry: %" PRIu32 ".",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		data_offset += entry_data_size;
+	}
+	if( libesedb_catalog_build_table_definition_hash_table(
+	     catalog,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build table definition hash table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the catalog cache
+ * Returns 1 if successful, 0 if the catalog cache does not match the database file or -1 on error
+ */
+int libesedb_catalog_cache_read_file_io_handle(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "libesedb_catalog_cache_read_file_io_handle";
+	size64_t data_size    = 0;
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve catalog cache size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( data_size < (size64_t) sizeof( esedb_catalog_cache_header_t ) )
+	 || ( data_size > (size64_t) LIBESEDB_MAXIMUM_CATALOG_CACHE_SIZE ) )
+	{
+		return( 0 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * (size_t) data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create catalog cache data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek catalog cache offset: 0.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              data,
+	              (size_t) data_size,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog cache data.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_catalog_cache_read_data(
+	          catalog_cache,
+	          catalog,
+	          data,
+	          (size_t) data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog cache.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( result );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size of the catalog cache data of a catalog
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_cache_get_data_size(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_catalog_t *catalog,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *table_catalog_definition = NULL;
+	libesedb_table_definition_t *table_definition           = NULL;
+	static char *function                                   = "libesedb_catalog_cache_get_data_size";
+	size_t safe_data_size                                   = 0;
+	int number_of_table_definitions                         = 0;
+	int table_definition_index                              = 0;
+
+	if( catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_get_number_of_table_definitions(
+	     catalog,
+	     &number_of_table_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of table definitions.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_size = sizeof( esedb_catalog_cache_header_t );
+
+	for( table_definition_index = 0;
+	     table_definition_index < number_of_table_definitions;
+	     table_definition_index++ )
+	{
+		if( libesedb_catalog_get_table_definition_by_index(
+		     catalog,
+		     table_definition_index,
+		     &table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table definition: %d.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		if( ( table_definition == NULL )
+		 || ( table_definition->table_catalog_definition == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid table definition: %d.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		table_catalog_definition = table_definition->table_catalog_definition;
+
+		if( ( table_catalog_definition->name_size > (size_t) UINT16_MAX )
+		 || ( table_catalog_definition->template_name_size > (size_t) UINT16_MAX )
+		 || ( table_catalog_definition->default_value_size > (size_t) UINT16_MAX )
+		 || ( table_catalog_definition->key_field_identifiers_size > (size_t) UINT16_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid table definition: %d - variable data size value out of bounds.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		safe_data_size += sizeof( esedb_catalog_cache_entry_t )
+		                + table_catalog_definition->name_size
+		                + table_catalog_definition->template_name_size
+		                + table_catalog_definition->default_value_size
+		                + table_catalog_definition->key_field_identifiers_size;
+	}
+	if( safe_data_size > (size_t) LIBESEDB_MAXIMUM_CATALOG_CACHE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = safe_data_size;
+
+	return( 1 );
+}
+
+/* Writes the catalog cache data of a catalog
+ * The table definitions must not have read their column, index, long value and callback catalog definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_cache_write_data(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_catalog_t *catalog,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	esedb_catalog_cache_entry_t *catalog_cache_entry        = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition = NULL;
+	libesedb_table_definition_t *table_definition           = NULL;
+	static char *function                                   = "libesedb_catalog_cache_write_data";
+	size_t data_offset                                      = 0;
+	size_t entry_data_size                                  = 0;
+	uint32_t calculated_xor32_checksum                      = 0;
+	int number_of_table_definitions                         = 0;
+	int table_definition_index                              = 0;
+
+	if( catalog_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( esedb_catalog_cache_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_get_number_of_table_definitions(
+	     catalog,
+	     &number_of_table_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of table definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( (esedb_catalog_cache_header_t *) data )->signature,
+	     esedb_catalog_cache_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->format_version,
+	 1 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->file_size,
+	 catalog_cache->file_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->file_header_checksum,
+	 catalog_cache->file_header_checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->page_size,
+	 catalog_cache->page_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->database_time,
+	 catalog_cache->database_time );
+
+	if( memory_copy(
+	     ( (esedb_catalog_cache_header_t *) data )->database_signature,
+	     catalog_cache->database_signature,
+	     28 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->number_of_entries,
+	 (uint32_t) number_of_table_definitions );
+
+	data_offset = sizeof( esedb_catalog_cache_header_t );
+
+	for( table_definition_index = 0;
+	     table_definition_index < number_of_table_definitions;
+	     table_definition_index++ )
+	{
+		if( libesedb_catalog_get_table_definition_by_index(
+		     catalog,
+		     table_definition_index,
+		     &table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table definition: %d.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		if( ( table_definition == NULL )
+		 || ( table_definition->table_catalog_definition == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid table definition: %d.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		if( table_definition->catalog_page_number == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid table definition: %d - catalog page number value out of bounds.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		table_catalog_definition = table_definition->table_catalog_definition;
+
+		entry_data_size = sizeof( esedb_catalog_cache_entry_t )
+		                + table_catalog_definition->name_size
+		                + table_catalog_definition->template_name_size
+		                + table_catalog_definition->default_value_size
+		                + table_catalog_definition->key_field_identifiers_size;
+
+		if( entry_data_size > ( data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		catalog_cache_entry = (esedb_catalog_cache_entry_t *) &( data[ data_offset ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 catalog_cache_entry->catalog_page_number,
+		 table_definition->catalog_page_number );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 catalog_cache_entry->catalog_page_value_index,
+		 table_definition->catalog_page_value_index );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 catalog_cache_entry->type,
+		 table_catalog_definition->type );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 catalog_cache_entry->father_data_page_object_identifier,
+		 table_catalog_definition->father_data_page_object_identifier );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 catalog_cache_entry->identifier,
+		 table_catalog_definition->identifier );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 catalog_cache_entry->father_data_page_number,
+		 table_catalog_definition->father_data_page_number );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 catalog_cache_entry->size,
+		 table_catalog_definition->size );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 catalog_cache_entry->codepage,
+		 table_catalog_definition->codepage );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 catalog_cache_entry->lcmap_flags,
+		 table_catalog_definition->lcmap_flags );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 catalog_cache_entry->name_size,
+		 (uint16_t) table_catalog_definition->name_size );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 catalog_cache_entry->template_name_size,
+		 (uint16_t) table_catalog_definition->template_name_size );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 catalog_cache_entry->default_value_size,
+		 (uint16_t) table_catalog_definition->default_value_size );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 catalog_cache_entry->key_field_identifiers_size,
+		 (uint16_t) table_catalog_definition->key_field_identifiers_size );
+
+		data_offset += sizeof( esedb_catalog_cache_entry_t );
+
+		if( table_catalog_definition->name_size > 0 )
+		{
+			if( memory_copy(
+			     &( data[ data_offset ] ),
+			     table_catalog_definition->name,
+			     table_catalog_definition->name_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy name.",
+				 function );
+
+				return( -1 );
+			}
+			data_offset += table_catalog_definition->name_size;
+		}
+		if( table_catalog_definition->template_name_size > 0 )
+		{
+			if( memory_copy(
+			     &( data[ data_offset ] ),
+			     table_catalog_definition->template_name,
+			     table_catalog_definition->template_name_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy template name.",
+				 function );
+
+				return( -1 );
+			}
+			data_offset += table_catalog_definition->template_name_size;
+		}
+		if( table_catalog_definition->default_value_size > 0 )
+		{
+			if( memory_copy(
+			     &( data[ data_offset ] ),
+			     table_catalog_definition->default_value,
+			     table_catalog_definition->default_value_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy default value.",
+				 function );
+
+				return( -1 );
+			}
+			data_offset += table_catalog_definition->default_value_size;
+		}
+		if( table_catalog_definition->key_field_identifiers_size > 0 )
+		{
+			if( memory_copy(
+			     &( data[ data_offset ] ),
+			     table_catalog_definition->key_field_identifiers,
+			     table_catalog_definition->key_field_identifiers_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy key field identifiers.",
+				 function );
+
+				return( -1 );
+			}
+			data_offset += table_catalog_definition->key_field_identifiers_size;
+		}
+	}
+	if( libesedb_checksum_calculate_little_endian_xor32(
+	     &calculated_xor32_checksum,
+	     &( data[ 12 ] ),
+	     data_offset - 12,
+	     0x89abcdef,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->checksum,
+	 calculated_xor32_checksum );
+
+	return( 1 );
+}
+
+/* Writes the catalog cache of a catalog
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_cache_write_file_io_handle(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "libesedb_catalog_cache_write_file_io_handle";
+	size_t data_size      = 0;
+	ssize_t write_count   = 0;
+
+	if( libesedb_catalog_cache_get_data_size(
+	     catalog_cache,
+	     catalog,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve catalog cache data size.",
+		 function );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create catalog cache data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_catalog_cache_write_data(
+	     catalog_cache,
+	     catalog,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write catalog cache data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek catalog cache offset: 0.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               data,
+	               data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write catalog cache.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,123 @@
+/*
+ * Catalog cache functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_CATALOG_CACHE_H )
+#define _LIBESEDB_CATALOG_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_catalog.h"
+#include "libesedb_file_header.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern const uint8_t esedb_catalog_cache_signature[ 8 ];
+
+typedef struct libesedb_catalog_cache libesedb_catalog_cache_t;
+
+struct libesedb_catalog_cache
+{
+	/* The size of the database file
+	 */
+	size64_t file_size;
+
+	/* The checksum of the database file header
+	 */
+	uint32_t file_header_checksum;
+
+	/* The page size of the database file
+	 */
+	uint32_t page_size;
+
+	/* The database time of the database file header
+	 */
+	uint64_t database_time;
+
+	/* The database signature of the database file header
+	 */
+	uint8_t database_signature[ 28 ];
+};
+
+int libesedb_catalog_cache_initialize(
+     libesedb_catalog_cache_t **catalog_cache,
+     libcerror_error_t **error );
+
+int libesedb_catalog_cache_free(
+     libesedb_catalog_cache_t **catalog_cache,
+     libcerror_error_t **error );
+
+int libesedb_catalog_cache_set_file_header_values(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_file_header_t *file_header,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+int libesedb_catalog_cache_read_entry_data(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_catalog_t *catalog,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *entry_data_size,
+     libcerror_error_t **error );
+
+int libesedb_catalog_cache_read_data(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_catalog_t *catalog,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libesedb_catalog_cache_read_file_io_handle(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libesedb_catalog_cache_get_data_size(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_catalog_t *catalog,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libesedb_catalog_cache_write_data(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_catalog_t *catalog,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libesedb_catalog_cache_write_file_io_handle(
+     libesedb_catalog_cache_t *catalog_cache,
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_CATALOG_CACHE_H ) */
+
@@ -165,6 +165,11 @@ int libesedb_catalog_definition_free(
 			memory_free(
 			 ( *catalog_definition )->default_value );
 		}
+		if( ( *catalog_definition )->key_field_identifiers != NULL )
+		{
+			memory_free(
+			 ( *catalog_definition )->key_field_identifiers );
+		}
 		memory_free(
 		 *catalog_definition );
 
@@ -1044,33 +1049,75 @@ int libesedb_catalog_definition_read_data(
 #endif
 					break;
 
-#if defined( HAVE_DEBUG_OUTPUT )
 				case 132:
-					if( libcnotify_verbose != 0 )
+					/* The MSB signifies that the variable size data type is empty
+					 */
+					if( ( variable_size_data_type_size & 0x8000 ) == 0 )
 					{
-						/* The MSB signifies that the variable size data type is empty
-						 */
-						if( ( variable_size_data_type_size & 0x8000 ) == 0 )
+						catalog_definition->key_field_identifiers_size = (size_t) ( variable_size_data_type_size - previous_variable_size_data_type_size );
+
+						catalog_definition->key_field_identifiers = (uint8_t *) memory_allocate(
+						                                             sizeof( uint8_t ) * catalog_definition->key_field_identifiers_size );
+
+						if( catalog_definition->key_field_identifiers == NULL )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_MEMORY,
+							 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+							 "%s: unable to create key field identifiers.",
+							 function );
+
+							catalog_definition->key_field_identifiers_size = 0;
+
+							return( -1 );
+						}
+						if( memory_copy(
+						     catalog_definition->key_field_identifiers,
+						     &( variable_size_data_type_value_data[ previous_variable_size_data_type_size ] ),
+						     catalog_definition->key_field_identifiers_size ) == NULL )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_MEMORY,
+							 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+							 "%s: unable to set key field identifiers.",
+							 function );
+
+							memory_free(
+							 catalog_definition->key_field_identifiers );
+
+							catalog_definition->key_field_identifiers      = NULL;
+							catalog_definition->key_field_identifiers_size = 0;
+
+							return( -1 );
+						}
+#if defined( HAVE_DEBUG_OUTPUT )
+						if( libcnotify_verbose != 0 )
 						{
 							libcnotify_printf(
 							 "%s: (%03" PRIu8 ") KeyFldIDs:\n",
 							 function,
 							 data_type_number );
 							libcnotify_print_data(
-							 &( variable_size_data_type_value_data[ previous_variable_size_data_type_size ] ),
-							 variable_size_data_type_size - previous_variable_size_data_type_size,
+							 catalog_definition->key_field_identifiers,
+							 catalog_definition->key_field_identifiers_size,
 							 0 );
 						}
-						else
-						{
-							libcnotify_printf(
-							 "%s: (%03" PRIu8 ") KeyFldIDs\t\t\t\t: <NULL>\n",
-							 function,
-							 data_type_number );
-						}
+#endif
 					}
+#if defined( HAVE_DEBUG_OUTPUT )
+					else if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: (%03" PRIu8 ") KeyFldIDs\t\t\t\t: <NULL>\n",
+						 function,
+						 data_type_number );
+					}
+#endif
 					break;
 
+#if defined( HAVE_DEBUG_OUTPUT )
 				case 133:
 					if( libcnotify_verbose != 0 )
 					{
@@ -1223,6 +1270,81 @@ int libesedb_catalog_definition_read_data(
 	return( 1 );
 }
 
+/* Reads the catalog definition type from the data without reading the rest of the definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_definition_read_type(
+     const uint8_t *data,
+     size_t data_size,
+     uint16_t *type,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_definition_read_type";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+	/* The type is stored in the second fixed size data type
+	 */
+	if( data_size < ( sizeof( esedb_data_definition_header_t ) + 6 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: data too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (esedb_data_definition_header_t *) data )->last_fixed_size_data_type < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: last fixed size data type too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (esedb_data_definition_t *) &( data[ sizeof( esedb_data_definition_header_t ) ] ) )->type,
+	 *type );
+
+	return( 1 );
+}
+
 /* Retrieves the catalog definition identifier
  * Returns 1 if successful or -1 on error
  */
@@ -99,6 +99,14 @@ struct libesedb_catalog_definition
 	/* The default value size
 	 */
 	size_t default_value_size;
+
+	/* The key field identifiers (KeyFldIDs)
+	 */
+	uint8_t *key_field_identifiers;
+
+	/* The key field identifiers size
+	 */
+	size_t key_field_identifiers_size;
 };
 
 int libesedb_catalog_definition_initialize(
@@ -116,6 +124,12 @@ int libesedb_catalog_definition_read_data(
      int ascii_codepage,
      libcerror_error_t **error );
 
+int libesedb_catalog_definition_read_type(
+     const uint8_t *data,
+     size_t data_size,
+     uint16_t *type,
+     libcerror_error_t **error );
+
 int libesedb_catalog_definition_get_identifier(
      libesedb_catalog_definition_t *catalog_definition,
      uint32_t *identifier,
@@ -27,8 +27,8 @@
 #include "libesedb_compression.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
-#include "libesedb_libfwnt.h"
 #include "libesedb_libuna.h"
+#include "libesedb_utf8_string.h"
 
 /* Retrieves the uncompressed size of the 7-bit compressed data
  * Returns 1 on success or -1 on error
@@ -115,6 +115,8 @@ int libesedb_compression_7bit_decompress(
 	static char *function          = "libesedb_compression_7bit_decompress";
 	size_t compressed_data_index   = 0;
 	size_t uncompressed_data_index = 0;
+	uint64_t value_64bit           = 0;
+	uint32_t value_32bit           = 0;
 	uint16_t value_16bit           = 0;
 	uint8_t bit_index              = 0;
 
@@ -196,9 +198,39 @@ int libesedb_compression_7bit_decompress(
 
 		return( -1 );
 	}
-	for( compressed_data_index = 1;
-	     compressed_data_index < compressed_data_size;
-	     compressed_data_index++ )
+	compressed_data_index = 1;
+
+	/* Unpack groups of 7 compressed bytes into 8 uncompressed bytes at a time
+	 */
+	while( ( compressed_data_size - compressed_data_index ) >= 7 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ compressed_data_index ] ),
+		 value_32bit );
+
+		value_64bit = value_32bit;
+
+		byte_stream_copy_to_uint24_little_endian(
+		 &( compressed_data[ compressed_data_index + 4 ] ),
+		 value_32bit );
+
+		value_64bit |= (uint64_t) value_32bit << 32;
+
+		uncompressed_data[ uncompressed_data_index ]     = (uint8_t) ( value_64bit & 0x7f );
+		uncompressed_data[ uncompressed_data_index + 1 ] = (uint8_t) ( ( value_64bit >> 7 ) & 0x7f );
+		uncompressed_data[ uncompressed_data_index + 2 ] = (uint8_t) ( ( value_64bit >> 14 ) & 0x7f );
+		uncompressed_data[ uncompressed_data_index + 3 ] = (uint8_t) ( ( value_64bit >> 21 ) & 0x7f );
+		uncompressed_data[ uncompressed_data_index + 4 ] = (uint8_t) ( ( value_64bit >> 28 ) & 0x7f );
+		uncompressed_data[ uncompressed_data_index + 5 ] = (uint8_t) ( ( value_64bit >> 35 ) & 0x7f );
+		uncompressed_data[ uncompressed_data_index + 6 ] = (uint8_t) ( ( value_64bit >> 42 ) & 0x7f );
+		uncompressed_data[ uncompressed_data_index + 7 ] = (uint8_t) ( value_64bit >> 49 );
+
+		compressed_data_index   += 7;
+		uncompressed_data_index += 8;
+	}
+	/* Unpack the remaining compressed bytes one at a time
+	 */
+	while( compressed_data_index < compressed_data_size )
 	{
 		value_16bit |= (uint16_t) compressed_data[ compressed_data_index ] << bit_index;
 
@@ -216,6 +248,7 @@ int libesedb_compression_7bit_decompress(
 
 			bit_index = 0;
 		}
+		compressed_data_index++;
 	}
 	if( value_16bit != 0 )
 	{
@@ -232,6 +265,372 @@ int libesedb_compression_7bit_decompress(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 string size of 7-bit compressed data
+ * The characters are decoded directly from the compressed data without an intermediate buffer
+ * The leading byte of the compressed data indicates if the uncompressed data can be UTF-16 encoded
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_7bit_decompress_get_utf8_string_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libesedb_compression_7bit_decompress_get_utf8_string_size";
+	size_t compressed_data_index  = 0;
+	size_t number_of_characters   = 0;
+	size_t safe_utf8_string_size  = 0;
+	uint32_t value_32bit          = 0;
+	uint16_t unicode_character    = 0;
+	uint8_t bit_count             = 0;
+	uint8_t number_of_unused_bits = 0;
+	uint8_t utf16_encoded         = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data[ 0 ] == 0x18 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported leading byte: 0x%02" PRIx8 ".",
+		 function,
+		 compressed_data[ 0 ] );
+
+		return( -1 );
+	}
+	number_of_characters  = ( ( compressed_data_size - 1 ) * 8 ) / 7;
+	number_of_unused_bits = (uint8_t) ( ( ( compressed_data_size - 1 ) * 8 ) % 7 );
+
+	/* The unused bits of the last compressed byte must be 0
+	 */
+	if( ( number_of_unused_bits > 0 )
+	 && ( ( compressed_data[ compressed_data_size - 1 ] >> ( 8 - number_of_unused_bits ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported remainder: 0x%02" PRIx8 ".",
+		 function,
+		 compressed_data[ compressed_data_size - 1 ] >> ( 8 - number_of_unused_bits ) );
+
+		return( -1 );
+	}
+	if( ( ( number_of_characters % 2 ) == 0 )
+	 && ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) )
+	{
+		utf16_encoded = 1;
+	}
+	compressed_data_index = 1;
+
+	while( number_of_characters > 0 )
+	{
+		if( bit_count < 7 )
+		{
+			value_32bit |= (uint32_t) compressed_data[ compressed_data_index++ ] << bit_count;
+			bit_count   += 8;
+		}
+		unicode_character = (uint16_t) ( value_32bit & 0x7f );
+
+		value_32bit >>= 7;
+		bit_count    -= 7;
+
+		number_of_characters--;
+
+		if( utf16_encoded != 0 )
+		{
+			if( bit_count < 7 )
+			{
+				value_32bit |= (uint32_t) compressed_data[ compressed_data_index++ ] << bit_count;
+				bit_count   += 8;
+			}
+			unicode_character |= (uint16_t) ( value_32bit & 0x7f ) << 8;
+
+			value_32bit >>= 7;
+			bit_count    -= 7;
+
+			number_of_characters--;
+		}
+		if( unicode_character < 0x0080 )
+		{
+			safe_utf8_string_size += 1;
+		}
+		else if( unicode_character < 0x0800 )
+		{
+			safe_utf8_string_size += 2;
+		}
+		else
+		{
+			safe_utf8_string_size += 3;
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+	}
+	/* Add the end of string character if the string is not terminated
+	 */
+	if( ( safe_utf8_string_size == 0 )
+	 || ( unicode_character != 0 ) )
+	{
+		safe_utf8_string_size += 1;
+	}
+	*utf8_string_size = safe_utf8_string_size;
+
+	return( 1 );
+}
+
+/* Copies 7-bit compressed data to an UTF-8 string
+ * The characters are decoded directly from the compressed data without an intermediate buffer
+ * The leading byte of the compressed data indicates if the uncompressed data can be UTF-16 encoded
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_7bit_decompress_to_utf8_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libesedb_compression_7bit_decompress_to_utf8_string";
+	size_t compressed_data_index  = 0;
+	size_t number_of_characters   = 0;
+	size_t utf8_string_index      = 0;
+	uint32_t value_32bit          = 0;
+	uint16_t unicode_character    = 0;
+	uint8_t bit_count             = 0;
+	uint8_t character_size        = 0;
+	uint8_t number_of_unused_bits = 0;
+	uint8_t utf16_encoded         = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data[ 0 ] == 0x18 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported leading byte: 0x%02" PRIx8 ".",
+		 function,
+		 compressed_data[ 0 ] );
+
+		return( -1 );
+	}
+	number_of_characters  = ( ( compressed_data_size - 1 ) * 8 ) / 7;
+	number_of_unused_bits = (uint8_t) ( ( ( compressed_data_size - 1 ) * 8 ) % 7 );
+
+	/* The unused bits of the last compressed byte must be 0
+	 */
+	if( ( number_of_unused_bits > 0 )
+	 && ( ( compressed_data[ compressed_data_size - 1 ] >> ( 8 - number_of_unused_bits ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported remainder: 0x%02" PRIx8 ".",
+		 function,
+		 compressed_data[ compressed_data_size - 1 ] >> ( 8 - number_of_unused_bits ) );
+
+		return( -1 );
+	}
+	if( ( ( number_of_characters % 2 ) == 0 )
+	 && ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) )
+	{
+		utf16_encoded = 1;
+	}
+	compressed_data_index = 1;
+
+	while( number_of_characters > 0 )
+	{
+		if( bit_count < 7 )
+		{
+			value_32bit |= (uint32_t) compressed_data[ compressed_data_index++ ] << bit_count;
+			bit_count   += 8;
+		}
+		unicode_character = (uint16_t) ( value_32bit & 0x7f );
+
+		value_32bit >>= 7;
+		bit_count    -= 7;
+
+		number_of_characters--;
+
+		if( utf16_encoded != 0 )
+		{
+			if( bit_count < 7 )
+			{
+				value_32bit |= (uint32_t) compressed_data[ compressed_data_index++ ] << bit_count;
+				bit_count   += 8;
+			}
+			unicode_character |= (uint16_t) ( value_32bit & 0x7f ) << 8;
+
+			value_32bit >>= 7;
+			bit_count    -= 7;
+
+			number_of_characters--;
+		}
+		if( unicode_character < 0x0080 )
+		{
+			character_size = 1;
+		}
+		else if( unicode_character < 0x0800 )
+		{
+			character_size = 2;
+		}
+		else
+		{
+			character_size = 3;
+		}
+		if( character_size > ( utf8_string_size - utf8_string_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( character_size == 1 )
+		{
+			utf8_string[ utf8_string_index++ ] = (uint8_t) unicode_character;
+		}
+		else if( character_size == 2 )
+		{
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xc0 | ( unicode_character >> 6 ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+		}
+		else
+		{
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xe0 | ( unicode_character >> 12 ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+	}
+	/* Add the end of string character if the string is not terminated
+	 */
+	if( ( utf8_string_index == 0 )
+	 || ( unicode_character != 0 ) )
+	{
+		if( utf8_string_index >= utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ utf8_string_index ] = 0;
+	}
+	return( 1 );
+}
+
 /* Retrieves the uncompressed size of LZXPRESS compressed data
  * Returns 1 on success or -1 on error
  */
@@ -307,6 +706,8 @@ int libesedb_compression_lzxpress_decompress_get_size(
 }
 
 /* Decompresses LZXPRESS compressed data
+ * The data is decompressed in a single pass without intermediate buffers,
+ * runs of 8 literals and matches that do not overlap within 8 bytes are copied 8 bytes at a time
  * Returns 1 on success or -1 on error
  */
 int libesedb_compression_lzxpress_decompress(
@@ -316,7 +717,17 @@ int libesedb_compression_lzxpress_decompress(
      size_t uncompressed_data_size,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_compression_lzxpress_decompress";
+	static char *function           = "libesedb_compression_lzxpress_decompress";
+	size_t compressed_data_offset   = 0;
+	size_t compression_offset       = 0;
+	size_t compression_size         = 0;
+	size_t nibble_offset            = 0;
+	size_t uncompressed_data_offset = 0;
+	uint32_t indicator              = 0;
+	uint32_t value_32bit            = 0;
+	uint16_t compression_tuple      = 0;
+	uint8_t indicator_bit_index     = 0;
+	uint8_t has_nibble              = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -329,6 +740,17 @@ int libesedb_compression_lzxpress_decompress(
 
 		return( -1 );
 	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
 	if( compressed_data_size < 3 )
 	{
 		libcerror_error_set(
@@ -340,6 +762,28 @@ int libesedb_compression_lzxpress_decompress(
 
 		return( -1 );
 	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
 	if( compressed_data[ 0 ] != 0x18 )
 	{
 		libcerror_error_set(
@@ -350,23 +794,239 @@ int libesedb_compression_lzxpress_decompress(
 		 function,
 		 compressed_data[ 0 ] );
 
-		return( -1 );
-	}
-	if( libfwnt_lzxpress_decompress(
-	     &( compressed_data[ 3 ] ),
-	     compressed_data_size - 3,
-	     uncompressed_data,
-	     &uncompressed_data_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-		 "%s: unable to decompress LZXPRESS compressed data.",
-		 function );
+		return( -1 );
+	}
+	/* Skip the leading byte and the uncompressed data size
+	 */
+	compressed_data_offset = 3;
+
+	while( compressed_data_offset < compressed_data_size )
+	{
+		if( indicator_bit_index == 0 )
+		{
+			if( ( compressed_data_size - compressed_data_offset ) < 4 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: compressed data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 indicator );
+
+			compressed_data_offset += 4;
+			indicator_bit_index     = 32;
+
+			continue;
+		}
+		/* Copy 8 literals at once if none of the next 8 indicator bits are set
+		 */
+		if( ( indicator_bit_index >= 8 )
+		 && ( ( ( indicator >> ( indicator_bit_index - 8 ) ) & 0x000000ffUL ) == 0 )
+		 && ( ( compressed_data_size - compressed_data_offset ) >= 8 )
+		 && ( ( uncompressed_data_size - uncompressed_data_offset ) >= 8 ) )
+		{
+			memory_copy(
+			 &( uncompressed_data[ uncompressed_data_offset ] ),
+			 &( compressed_data[ compressed_data_offset ] ),
+			 8 );
+
+			compressed_data_offset   += 8;
+			uncompressed_data_offset += 8;
+			indicator_bit_index      -= 8;
+
+			continue;
+		}
+		indicator_bit_index--;
+
+		if( ( indicator & ( (uint32_t) 1 << indicator_bit_index ) ) == 0 )
+		{
+			if( uncompressed_data_offset >= uncompressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: uncompressed data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			uncompressed_data[ uncompressed_data_offset++ ] = compressed_data[ compressed_data_offset++ ];
+
+			continue;
+		}
+		if( ( compressed_data_size - compressed_data_offset ) < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 compression_tuple );
+
+		compressed_data_offset += 2;
+
+		compression_offset = (size_t) ( compression_tuple >> 3 ) + 1;
+		compression_size   = (size_t) ( compression_tuple & 0x0007 );
+
+		if( compression_size == 7 )
+		{
+			/* The extended size is stored in the lower and upper nibble of a shared byte
+			 */
+			if( has_nibble == 0 )
+			{
+				if( compressed_data_offset >= compressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: compressed data size value too small.",
+					 function );
+
+					return( -1 );
+				}
+				nibble_offset    = compressed_data_offset++;
+				compression_size = (size_t) ( compressed_data[ nibble_offset ] & 0x0f );
+				has_nibble       = 1;
+			}
+			else
+			{
+				compression_size = (size_t) ( compressed_data[ nibble_offset ] >> 4 );
+				has_nibble       = 0;
+			}
+			if( compression_size == 15 )
+			{
+				if( compressed_data_offset >= compressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: compressed data size value too small.",
+					 function );
+
+					return( -1 );
+				}
+				compression_size = (size_t) compressed_data[ compressed_data_offset++ ];
+
+				if( compression_size == 255 )
+				{
+					if( ( compressed_data_size - compressed_data_offset ) < 2 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: compressed data size value too small.",
+						 function );
+
+						return( -1 );
+					}
+					byte_stream_copy_to_uint16_little_endian(
+					 &( compressed_data[ compressed_data_offset ] ),
+					 compression_tuple );
+
+					compressed_data_offset += 2;
+
+					compression_size = (size_t) compression_tuple;
+
+					if( compression_size == 0 )
+					{
+						if( ( compressed_data_size - compressed_data_offset ) < 4 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: compressed data size value too small.",
+							 function );
+
+							return( -1 );
+						}
+						byte_stream_copy_to_uint32_little_endian(
+						 &( compressed_data[ compressed_data_offset ] ),
+						 value_32bit );
+
+						compressed_data_offset += 4;
+
+						compression_size = (size_t) value_32bit;
+					}
+					if( compression_size < ( 15 + 7 ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid compression size value out of bounds.",
+						 function );
+
+						return( -1 );
+					}
+					compression_size -= 15 + 7;
+				}
+				compression_size += 15;
+			}
+			compression_size += 7;
+		}
+		compression_size += 3;
+
+		if( compression_offset > uncompressed_data_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid compression offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( compression_size > ( uncompressed_data_size - uncompressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid compression size value out of bounds.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
+		/* A match that starts at least 8 bytes back does not overlap itself within 8 bytes
+		 */
+		if( compression_offset >= 8 )
+		{
+			while( compression_size >= 8 )
+			{
+				memory_copy(
+				 &( uncompressed_data[ uncompressed_data_offset ] ),
+				 &( uncompressed_data[ uncompressed_data_offset - compression_offset ] ),
+				 8 );
+
+				uncompressed_data_offset += 8;
+				compression_size         -= 8;
+			}
+		}
+		while( compression_size > 0 )
+		{
+			uncompressed_data[ uncompressed_data_offset ] = uncompressed_data[ uncompressed_data_offset - compression_offset ];
+
+			uncompressed_data_offset++;
+			compression_size--;
+		}
 	}
 	return( 1 );
 }
@@ -524,6 +1184,105 @@ int libesedb_compression_decompress(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 string size of uncompressed data
+ * The leading byte of the compressed data indicates if the uncompressed data can be UTF-16 encoded
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t leading_byte,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_get_utf8_string_size_from_uncompressed_data";
+	int result            = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( uncompressed_data_size % 2 ) == 0 )
+	 && ( ( leading_byte == 0x18 )
+	  ||  ( ( leading_byte & 0x10 ) == 0 ) ) )
+	{
+		result = libesedb_utf8_string_size_from_utf16_stream(
+			  uncompressed_data,
+			  uncompressed_data_size,
+			  utf8_string_size,
+			  error );
+
+		if( result == 0 )
+		{
+			result = libuna_utf8_string_size_from_utf16_stream(
+				  uncompressed_data,
+				  uncompressed_data_size,
+				  LIBUNA_ENDIAN_LITTLE,
+				  utf8_string_size,
+				  error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-8 string size of UTF-16 stream.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+	if( result != 1 )
+	{
+		result = libuna_utf8_string_size_from_utf8_stream(
+			  uncompressed_data,
+			  uncompressed_data_size,
+			  utf8_string_size,
+			  error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-8 string size of UTF-8 stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
 /* Retrieves the UTF-8 string size of compressed data
  * Returns 1 on success or -1 on error
  */
@@ -571,22 +1330,31 @@ int libesedb_compression_get_utf8_string_size(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	else
+	if( compressed_data[ 0 ] != 0x18 )
 	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		if( libesedb_compression_7bit_decompress_get_utf8_string_size(
+		     compressed_data,
+		     compressed_data_size,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-8 string size of 7-bit compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
 	}
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -612,24 +1380,13 @@ int libesedb_compression_get_utf8_string_size(
 
 		goto on_error;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
+	result = libesedb_compression_lzxpress_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -641,26 +1398,103 @@ int libesedb_compression_get_utf8_string_size(
 
 		goto on_error;
 	}
-	result = 0;
+	if( libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     compressed_data[ 0 ],
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size of uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
+/* Copies uncompressed data to an UTF-8 string
+ * The leading byte of the compressed data indicates if the uncompressed data can be UTF-16 encoded
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_copy_uncompressed_data_to_utf8_string(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t leading_byte,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_copy_uncompressed_data_to_utf8_string";
+	int result            = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
 
+		return( -1 );
+	}
 	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	 && ( ( leading_byte == 0x18 )
+	  ||  ( ( leading_byte & 0x10 ) == 0 ) ) )
 	{
-		result = libuna_utf8_string_size_from_utf16_stream(
+		result = libesedb_utf8_string_copy_from_utf16_stream(
+			  utf8_string,
+			  utf8_string_size,
 			  uncompressed_data,
 			  uncompressed_data_size,
-			  LIBUNA_ENDIAN_LITTLE,
-			  utf8_string_size,
 			  error );
 
+		if( result == 0 )
+		{
+			result = libuna_utf8_string_copy_from_utf16_stream(
+				  utf8_string,
+				  utf8_string_size,
+				  uncompressed_data,
+				  uncompressed_data_size,
+				  LIBUNA_ENDIAN_LITTLE,
+				  error );
+		}
 		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine UTF-8 string size of UTF-16 stream.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
 			 function );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -677,10 +1511,11 @@ int libesedb_compression_get_utf8_string_size(
 	}
 	if( result != 1 )
 	{
-		result = libuna_utf8_string_size_from_utf8_stream(
+		result = libuna_utf8_string_copy_from_utf8_stream(
+			  utf8_string,
+			  utf8_string_size,
 			  uncompressed_data,
 			  uncompressed_data_size,
-			  utf8_string_size,
 			  error );
 
 		if( result != 1 )
@@ -688,27 +1523,14 @@ int libesedb_compression_get_utf8_string_size(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine UTF-8 string size of UTF-8 stream.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 stream to UTF-8 string.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	memory_free(
-	 uncompressed_data );
-
-	uncompressed_data = NULL;
-
 	return( 1 );
-
-on_error:
-	if( uncompressed_data != NULL )
-	{
-		memory_free(
-		 uncompressed_data );
-	}
-	return( -1 );
 }
 
 /* Copies compressed data to an UTF-8 string
@@ -759,22 +1581,32 @@ int libesedb_compression_copy_to_utf8_string(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	else
+	if( compressed_data[ 0 ] != 0x18 )
 	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		if( libesedb_compression_7bit_decompress_to_utf8_string(
+		     compressed_data,
+		     compressed_data_size,
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy 7-bit compressed data to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
 	}
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -800,24 +1632,13 @@ int libesedb_compression_copy_to_utf8_string(
 
 		goto on_error;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
+	result = libesedb_compression_lzxpress_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -829,18 +1650,84 @@ int libesedb_compression_copy_to_utf8_string(
 
 		goto on_error;
 	}
-	result = 0;
+	if( libesedb_compression_copy_uncompressed_data_to_utf8_string(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     compressed_data[ 0 ],
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy uncompressed data to UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the UTF-16 string size of uncompressed data
+ * The leading byte of the compressed data indicates if the uncompressed data can be UTF-16 encoded
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t leading_byte,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_get_utf16_string_size_from_uncompressed_data";
+	int result            = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
 
+		return( -1 );
+	}
 	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	 && ( ( leading_byte == 0x18 )
+	  ||  ( ( leading_byte & 0x10 ) == 0 ) ) )
 	{
-		result = libuna_utf8_string_copy_from_utf16_stream(
-			  utf8_string,
-			  utf8_string_size,
+		result = libuna_utf16_string_size_from_utf16_stream(
 			  uncompressed_data,
 			  uncompressed_data_size,
 			  LIBUNA_ENDIAN_LITTLE,
+			  utf16_string_size,
 			  error );
 
 		if( result != 1 )
@@ -848,8 +1735,8 @@ int libesedb_compression_copy_to_utf8_string(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-16 string size of UTF-16 stream.",
 			 function );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -866,11 +1753,10 @@ int libesedb_compression_copy_to_utf8_string(
 	}
 	if( result != 1 )
 	{
-		result = libuna_utf8_string_copy_from_utf8_stream(
-			  utf8_string,
-			  utf8_string_size,
+		result = libuna_utf16_string_size_from_utf8_stream(
 			  uncompressed_data,
 			  uncompressed_data_size,
+			  utf16_string_size,
 			  error );
 
 		if( result != 1 )
@@ -878,27 +1764,14 @@ int libesedb_compression_copy_to_utf8_string(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy UTF-8 stream to UTF-8 string.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-16 string size of UTF-8 stream.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	memory_free(
-	 uncompressed_data );
-
-	uncompressed_data = NULL;
-
 	return( 1 );
-
-on_error:
-	if( uncompressed_data != NULL )
-	{
-		memory_free(
-		 uncompressed_data );
-	}
-	return( -1 );
 }
 
 /* Retrieves the UTF-16 string size of compressed data
@@ -1018,17 +1891,85 @@ int libesedb_compression_get_utf16_string_size(
 
 		goto on_error;
 	}
-	result = 0;
+	if( libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     compressed_data[ 0 ],
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-16 string size of uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
+/* Copies uncompressed data to an UTF-16 string
+ * The leading byte of the compressed data indicates if the uncompressed data can be UTF-16 encoded
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_copy_uncompressed_data_to_utf16_string(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t leading_byte,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_copy_uncompressed_data_to_utf16_string";
+	int result            = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
 
+		return( -1 );
+	}
 	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	 && ( ( leading_byte == 0x18 )
+	  ||  ( ( leading_byte & 0x10 ) == 0 ) ) )
 	{
-		result = libuna_utf16_string_size_from_utf16_stream(
+		result = libuna_utf16_string_copy_from_utf16_stream(
+			  utf16_string,
+			  utf16_string_size,
 			  uncompressed_data,
 			  uncompressed_data_size,
 			  LIBUNA_ENDIAN_LITTLE,
-			  utf16_string_size,
 			  error );
 
 		if( result != 1 )
@@ -1036,8 +1977,8 @@ int libesedb_compression_get_utf16_string_size(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine UTF-16 string size of UTF-16 stream.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 stream to UTF-16 string.",
 			 function );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1054,10 +1995,11 @@ int libesedb_compression_get_utf16_string_size(
 	}
 	if( result != 1 )
 	{
-		result = libuna_utf16_string_size_from_utf8_stream(
+		result = libuna_utf16_string_copy_from_utf8_stream(
+			  utf16_string,
+			  utf16_string_size,
 			  uncompressed_data,
 			  uncompressed_data_size,
-			  utf16_string_size,
 			  error );
 
 		if( result != 1 )
@@ -1065,27 +2007,14 @@ int libesedb_compression_get_utf16_string_size(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine UTF-16 string size of UTF-8 stream.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	memory_free(
-	 uncompressed_data );
-
-	uncompressed_data = NULL;
-
 	return( 1 );
-
-on_error:
-	if( uncompressed_data != NULL )
-	{
-		memory_free(
-		 uncompressed_data );
-	}
-	return( -1 );
 }
 
 /* Copies compressed data to an UTF-16 string
@@ -1206,61 +2135,22 @@ int libesedb_compression_copy_to_utf16_string(
 
 		goto on_error;
 	}
-	result = 0;
-
-	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
-	{
-		result = libuna_utf16_string_copy_from_utf16_stream(
-			  utf16_string,
-			  utf16_string_size,
-			  uncompressed_data,
-			  uncompressed_data_size,
-			  LIBUNA_ENDIAN_LITTLE,
-			  error );
-
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy UTF-16 stream to UTF-16 string.",
-			 function );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-#endif
-			libcerror_error_free(
-			 error );
-		}
-	}
-	if( result != 1 )
+	if( libesedb_compression_copy_uncompressed_data_to_utf16_string(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     compressed_data[ 0 ],
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
 	{
-		result = libuna_utf16_string_copy_from_utf8_stream(
-			  utf16_string,
-			  utf16_string_size,
-			  uncompressed_data,
-			  uncompressed_data_size,
-			  error );
-
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy uncompressed data to UTF-16 string.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
 	memory_free(
 	 uncompressed_data );
@@ -44,6 +44,19 @@ int libesedb_compression_7bit_decompress(
      size_t uncompressed_data_size,
      libcerror_error_t **error );
 
+int libesedb_compression_7bit_decompress_get_utf8_string_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libesedb_compression_7bit_decompress_to_utf8_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_lzxpress_decompress_get_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -70,12 +83,27 @@ int libesedb_compression_decompress(
      size_t uncompressed_data_size,
      libcerror_error_t **error );
 
+int libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t leading_byte,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_get_utf8_string_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *utf8_string_size,
      libcerror_error_t **error );
 
+int libesedb_compression_copy_uncompressed_data_to_utf8_string(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t leading_byte,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_copy_to_utf8_string(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -83,12 +111,27 @@ int libesedb_compression_copy_to_utf8_string(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+int libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t leading_byte,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_get_utf16_string_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *utf16_string_size,
      libcerror_error_t **error );
 
+int libesedb_compression_copy_uncompressed_data_to_utf16_string(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t leading_byte,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_copy_to_utf16_string(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
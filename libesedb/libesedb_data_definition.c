@@ -38,6 +38,7 @@
 #include "libesedb_libfdata.h"
 #include "libesedb_libfvalue.h"
 #include "libesedb_page.h"
+#include "libesedb_predicate.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_value_data_handle.h"
 
@@ -1538,6 +1539,1119 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the data of a specific tagged data type from the tagged data types data
+ * In the index format the tagged data type offsets array is sorted by identifier
+ * and is searched using a binary search
+ * Returns 1 if successful, 0 if the tagged data type is not present or -1 on error
+ */
+int libesedb_data_definition_get_tagged_data_type(
+     const uint8_t *tagged_data_types_data,
+     size_t tagged_data_types_data_size,
+     libesedb_io_handle_t *io_handle,
+     uint16_t tagged_data_type_identifier,
+     uint8_t *tagged_data_type_flags,
+     const uint8_t **tagged_data_type_data,
+     size_t *tagged_data_type_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                          = "libesedb_data_definition_get_tagged_data_type";
+	size_t data_offset                             = 0;
+	size_t data_size                               = 0;
+	size_t next_data_offset                        = 0;
+	uint16_t current_tagged_data_type_identifier   = 0;
+	uint16_t number_of_tagged_data_types           = 0;
+	uint16_t tagged_data_type_offset               = 0;
+	uint16_t tagged_data_type_offset_bitmask       = 0x3fff;
+	uint16_t tagged_data_type_offsets_size         = 0;
+	uint16_t tagged_data_type_size                 = 0;
+	uint8_t has_flags                              = 0;
+	uint8_t tagged_data_types_format               = LIBESEDB_TAGGED_DATA_TYPES_FORMAT_INDEX;
+	int lower_index                                = 0;
+	int middle_index                               = 0;
+	int upper_index                                = 0;
+
+	if( tagged_data_types_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tagged data types data.",
+		 function );
+
+		return( -1 );
+	}
+	if( tagged_data_types_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid tagged data types data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( tagged_data_type_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tagged data type flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( tagged_data_type_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tagged data type data.",
+		 function );
+
+		return( -1 );
+	}
+	if( tagged_data_type_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tagged data type data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->format_version == 0x620 )
+	 && ( io_handle->format_revision <= 2 ) )
+	{
+		tagged_data_types_format = LIBESEDB_TAGGED_DATA_TYPES_FORMAT_LINEAR;
+	}
+	if( tagged_data_types_format == LIBESEDB_TAGGED_DATA_TYPES_FORMAT_LINEAR )
+	{
+		/* In the linear format the tagged data types are stored as identifier, size and data
+		 * and can only be walked sequentially
+		 */
+		while( ( tagged_data_types_data_size - data_offset ) >= 4 )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( tagged_data_types_data[ data_offset ] ),
+			 current_tagged_data_type_identifier );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 &( tagged_data_types_data[ data_offset + 2 ] ),
+			 tagged_data_type_size );
+
+			data_offset += 4;
+
+			has_flags = (uint8_t) ( ( tagged_data_type_size & 0x8000 ) != 0 );
+
+			if( has_flags != 0 )
+			{
+				tagged_data_type_size &= 0x5fff;
+			}
+			if( (size_t) tagged_data_type_size > ( tagged_data_types_data_size - data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid tagged data type: %" PRIu16 " size value out of bounds.",
+				 function,
+				 current_tagged_data_type_identifier );
+
+				return( -1 );
+			}
+			if( current_tagged_data_type_identifier == tagged_data_type_identifier )
+			{
+				data_size = (size_t) tagged_data_type_size;
+
+				break;
+			}
+			/* The tagged data types are stored in ascending order of identifier
+			 */
+			if( current_tagged_data_type_identifier > tagged_data_type_identifier )
+			{
+				return( 0 );
+			}
+			data_offset += (size_t) tagged_data_type_size;
+		}
+		if( current_tagged_data_type_identifier != tagged_data_type_identifier )
+		{
+			return( 0 );
+		}
+	}
+	else
+	{
+		if( tagged_data_types_data_size < 4 )
+		{
+			return( 0 );
+		}
+		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+		 && ( io_handle->page_size >= 16384 ) )
+		{
+			tagged_data_type_offset_bitmask = 0x7fff;
+		}
+		/* The offset of the first tagged data type value corresponds with the size
+		 * of the tagged data type offsets array
+		 */
+		byte_stream_copy_to_uint16_little_endian(
+		 &( tagged_data_types_data[ 2 ] ),
+		 tagged_data_type_offset );
+
+		tagged_data_type_offsets_size = tagged_data_type_offset & 0x3fff;
+
+		if( ( tagged_data_type_offsets_size < 4 )
+		 || ( ( tagged_data_type_offsets_size % 4 ) != 0 )
+		 || ( (size_t) tagged_data_type_offsets_size > tagged_data_types_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid tagged data type offsets size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_tagged_data_types = tagged_data_type_offsets_size / 4;
+
+		lower_index = 0;
+		upper_index = (int) number_of_tagged_data_types - 1;
+
+		while( lower_index <= upper_index )
+		{
+			middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 &( tagged_data_types_data[ middle_index * 4 ] ),
+			 current_tagged_data_type_identifier );
+
+			if( current_tagged_data_type_identifier == tagged_data_type_identifier )
+			{
+				break;
+			}
+			else if( current_tagged_data_type_identifier < tagged_data_type_identifier )
+			{
+				lower_index = middle_index + 1;
+			}
+			else
+			{
+				upper_index = middle_index - 1;
+			}
+		}
+		if( lower_index > upper_index )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( tagged_data_types_data[ ( middle_index * 4 ) + 2 ] ),
+		 tagged_data_type_offset );
+
+		data_offset = (size_t) ( tagged_data_type_offset & tagged_data_type_offset_bitmask );
+
+		if( middle_index < (int) ( number_of_tagged_data_types - 1 ) )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( tagged_data_types_data[ ( middle_index * 4 ) + 6 ] ),
+			 tagged_data_type_size );
+
+			next_data_offset = (size_t) ( tagged_data_type_size & tagged_data_type_offset_bitmask );
+		}
+		else
+		{
+			next_data_offset = tagged_data_types_data_size;
+		}
+		if( ( data_offset < (size_t) tagged_data_type_offsets_size )
+		 || ( data_offset > next_data_offset )
+		 || ( next_data_offset > tagged_data_types_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid tagged data type: %" PRIu16 " offset value out of bounds.",
+			 function,
+			 tagged_data_type_identifier );
+
+			return( -1 );
+		}
+		data_size = next_data_offset - data_offset;
+
+		if( ( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+		  &&  ( io_handle->page_size >= 16384 ) )
+		 || ( ( tagged_data_type_offset & 0x4000 ) != 0 ) )
+		{
+			has_flags = 1;
+		}
+	}
+	*tagged_data_type_flags = 0;
+
+	if( ( has_flags != 0 )
+	 && ( data_size > 0 ) )
+	{
+		*tagged_data_type_flags = tagged_data_types_data[ data_offset ];
+
+		data_offset += 1;
+		data_size   -= 1;
+	}
+	if( data_size == 0 )
+	{
+		*tagged_data_type_data      = NULL;
+		*tagged_data_type_data_size = 0;
+	}
+	else
+	{
+		*tagged_data_type_data      = &( tagged_data_types_data[ data_offset ] );
+		*tagged_data_type_data_size = data_size;
+	}
+	return( 1 );
+}
+
+/* Retrieves the data of a specific column from the record data
+ * The column catalog definition is set if the column is defined by the (template) table
+ * The column data flags are only set for tagged columns
+ * Returns 1 if successful, 0 if the column has no data or -1 on error
+ */
+int libesedb_data_definition_get_column_data(
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libesedb_io_handle_t *io_handle,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     uint32_t column_identifier,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     uint8_t *column_data_flags,
+     const uint8_t **column_data,
+     size_t *column_data_size,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *column_catalog_definition_list_element = NULL;
+	libcdata_list_t *column_catalog_definition_list                 = NULL;
+	libesedb_catalog_definition_t *safe_column_catalog_definition   = NULL;
+	static char *function                                           = "libesedb_data_definition_get_column_data";
+	size_t fixed_size_data_type_value_offset                        = 0;
+	size_t tagged_data_types_offset                                 = 0;
+	size_t variable_size_data_type_value_offset                     = 0;
+	uint16_t previous_variable_size_data_type_size                  = 0;
+	uint16_t last_variable_size_data_type_size                      = 0;
+	uint16_t variable_size_data_type_offset                         = 0;
+	uint16_t variable_size_data_type_size                           = 0;
+	uint16_t variable_size_data_types_offset                        = 0;
+	uint8_t current_variable_size_data_type                         = 0;
+	uint8_t last_fixed_size_data_type                               = 0;
+	uint8_t last_variable_size_data_type                            = 0;
+	uint8_t number_of_variable_size_data_types                      = 0;
+	int result                                                      = 0;
+
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_data_size < sizeof( esedb_data_definition_header_t ) )
+	 || ( record_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_data_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column data flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column data.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_identifier > (uint32_t) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column identifier value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*column_data_flags = 0;
+
+	/* In a table that uses a template table the fixed and variable size columns
+	 * are defined by the template table and the tagged columns by the table
+	 */
+	if( ( column_identifier <= 255 )
+	 && ( template_table_definition != NULL )
+	 && ( template_table_definition->column_catalog_definition_list != NULL ) )
+	{
+		column_catalog_definition_list = template_table_definition->column_catalog_definition_list;
+	}
+	else
+	{
+		column_catalog_definition_list = table_definition->column_catalog_definition_list;
+	}
+	last_fixed_size_data_type    = ( (esedb_data_definition_header_t *) record_data )->last_fixed_size_data_type;
+	last_variable_size_data_type = ( (esedb_data_definition_header_t *) record_data )->last_variable_size_data_type;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (esedb_data_definition_header_t *) record_data )->variable_size_data_types_offset,
+	 variable_size_data_types_offset );
+
+	if( (size_t) variable_size_data_types_offset > record_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid variable size data types offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( column_catalog_definition_list != NULL )
+	{
+		if( libcdata_list_get_first_element(
+		     column_catalog_definition_list,
+		     &column_catalog_definition_list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first column catalog definition list element.",
+			 function );
+
+			return( -1 );
+		}
+		fixed_size_data_type_value_offset = sizeof( esedb_data_definition_header_t );
+
+		while( column_catalog_definition_list_element != NULL )
+		{
+			if( libcdata_list_element_get_value(
+			     column_catalog_definition_list_element,
+			     (intptr_t **) &safe_column_catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column catalog definition from list element.",
+				 function );
+
+				return( -1 );
+			}
+			if( safe_column_catalog_definition == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing column catalog definition.",
+				 function );
+
+				return( -1 );
+			}
+			if( safe_column_catalog_definition->identifier == column_identifier )
+			{
+				break;
+			}
+			if( ( safe_column_catalog_definition->identifier <= 127 )
+			 && ( safe_column_catalog_definition->identifier <= last_fixed_size_data_type ) )
+			{
+				fixed_size_data_type_value_offset += (size_t) safe_column_catalog_definition->size;
+			}
+			if( libcdata_list_element_get_next_element(
+			     column_catalog_definition_list_element,
+			     &column_catalog_definition_list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next column catalog definition list element.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( column_catalog_definition_list_element != NULL )
+		{
+			break;
+		}
+		/* Tagged columns can also be defined by the template table
+		 */
+		if( ( column_identifier > 255 )
+		 && ( template_table_definition != NULL )
+		 && ( column_catalog_definition_list != template_table_definition->column_catalog_definition_list ) )
+		{
+			column_catalog_definition_list = template_table_definition->column_catalog_definition_list;
+		}
+		else
+		{
+			column_catalog_definition_list = NULL;
+		}
+	}
+	if( column_catalog_definition_list_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing column catalog definition for column: %" PRIu32 ".",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	*column_catalog_definition = safe_column_catalog_definition;
+
+	if( column_identifier <= 127 )
+	{
+		if( column_identifier > last_fixed_size_data_type )
+		{
+			return( 0 );
+		}
+		if( ( (size_t) safe_column_catalog_definition->size > record_data_size )
+		 || ( fixed_size_data_type_value_offset > ( record_data_size - safe_column_catalog_definition->size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid fixed size data type: %" PRIu32 " value out of bounds.",
+			 function,
+			 column_identifier );
+
+			return( -1 );
+		}
+		*column_data      = &( record_data[ fixed_size_data_type_value_offset ] );
+		*column_data_size = (size_t) safe_column_catalog_definition->size;
+
+		return( 1 );
+	}
+	if( last_variable_size_data_type > 127 )
+	{
+		number_of_variable_size_data_types = last_variable_size_data_type - 127;
+	}
+	variable_size_data_type_offset       = variable_size_data_types_offset;
+	variable_size_data_type_value_offset = (size_t) variable_size_data_types_offset + ( number_of_variable_size_data_types * 2 );
+
+	if( variable_size_data_type_value_offset > record_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid variable size data types value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_identifier > 255 )
+	{
+		/* The tagged data types are stored after the data of the last non-empty variable size data type
+		 */
+		for( current_variable_size_data_type = 0;
+		     current_variable_size_data_type < number_of_variable_size_data_types;
+		     current_variable_size_data_type++ )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( record_data[ variable_size_data_type_offset ] ),
+			 variable_size_data_type_size );
+
+			variable_size_data_type_offset += 2;
+
+			if( ( variable_size_data_type_size & 0x8000 ) == 0 )
+			{
+				last_variable_size_data_type_size = variable_size_data_type_size;
+			}
+		}
+		if( (size_t) last_variable_size_data_type_size > ( record_data_size - variable_size_data_type_value_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid last variable size data type size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		tagged_data_types_offset = variable_size_data_type_value_offset + last_variable_size_data_type_size;
+
+		result = libesedb_data_definition_get_tagged_data_type(
+		          &( record_data[ tagged_data_types_offset ] ),
+		          record_data_size - tagged_data_types_offset,
+		          io_handle,
+		          (uint16_t) column_identifier,
+		          column_data_flags,
+		          column_data,
+		          column_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve tagged data type: %" PRIu32 ".",
+			 function,
+			 column_identifier );
+
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      || ( *column_data == NULL ) )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	if( column_identifier > last_variable_size_data_type )
+	{
+		return( 0 );
+	}
+	for( current_variable_size_data_type = 128;
+	     current_variable_size_data_type <= (uint8_t) column_identifier;
+	     current_variable_size_data_type++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( record_data[ variable_size_data_type_offset ] ),
+		 variable_size_data_type_size );
+
+		variable_size_data_type_offset += 2;
+
+		if( current_variable_size_data_type == (uint8_t) column_identifier )
+		{
+			break;
+		}
+		/* The MSB signifies that the variable size data type is empty
+		 */
+		if( ( variable_size_data_type_size & 0x8000 ) == 0 )
+		{
+			previous_variable_size_data_type_size = variable_size_data_type_size;
+		}
+	}
+	if( ( variable_size_data_type_size & 0x8000 ) != 0 )
+	{
+		return( 0 );
+	}
+	if( ( variable_size_data_type_size < previous_variable_size_data_type_size )
+	 || ( (size_t) variable_size_data_type_size > ( record_data_size - variable_size_data_type_value_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid variable size data type: %" PRIu32 " size value out of bounds.",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	*column_data      = &( record_data[ variable_size_data_type_value_offset + previous_variable_size_data_type_size ] );
+	*column_data_size = (size_t) ( variable_size_data_type_size - previous_variable_size_data_type_size );
+
+	return( 1 );
+}
+
+/* Retrieves the offset of a specific fixed size column in the record data
+ * The offset only depends on the column catalog definitions and is the same for every record of the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_definition_get_fixed_size_column_offset(
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     uint32_t column_identifier,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     size_t *column_offset,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *column_catalog_definition_list_element = NULL;
+	libcdata_list_t *column_catalog_definition_list                 = NULL;
+	libesedb_catalog_definition_t *safe_column_catalog_definition   = NULL;
+	static char *function                                           = "libesedb_data_definition_get_fixed_size_column_offset";
+	size_t safe_column_offset                                       = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_identifier == 0 )
+	 || ( column_identifier > 127 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column identifier: %" PRIu32 " only fixed size columns are supported.",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* In a table that uses a template table the fixed size columns
+	 * are defined by the template table
+	 */
+	if( ( template_table_definition != NULL )
+	 && ( template_table_definition->column_catalog_definition_list != NULL ) )
+	{
+		column_catalog_definition_list = template_table_definition->column_catalog_definition_list;
+	}
+	else
+	{
+		column_catalog_definition_list = table_definition->column_catalog_definition_list;
+	}
+	if( libcdata_list_get_first_element(
+	     column_catalog_definition_list,
+	     &column_catalog_definition_list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first column catalog definition list element.",
+		 function );
+
+		return( -1 );
+	}
+	safe_column_offset = sizeof( esedb_data_definition_header_t );
+
+	while( column_catalog_definition_list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     column_catalog_definition_list_element,
+		     (intptr_t **) &safe_column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from list element.",
+			 function );
+
+			return( -1 );
+		}
+		if( safe_column_catalog_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column catalog definition.",
+			 function );
+
+			return( -1 );
+		}
+		/* The fixed size columns are stored in ascending order of identifier
+		 */
+		if( safe_column_catalog_definition->identifier >= column_identifier )
+		{
+			break;
+		}
+		safe_column_offset += (size_t) safe_column_catalog_definition->size;
+
+		if( libcdata_list_element_get_next_element(
+		     column_catalog_definition_list_element,
+		     &column_catalog_definition_list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next column catalog definition list element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( column_catalog_definition_list_element == NULL )
+	 || ( safe_column_catalog_definition->identifier != column_identifier ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing column catalog definition for column: %" PRIu32 ".",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	*column_catalog_definition = safe_column_catalog_definition;
+	*column_offset             = safe_column_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the data of a fixed size column at a specific offset in the record data
+ * Use libesedb_data_definition_get_fixed_size_column_offset to determine the column offset
+ * Returns 1 if successful, 0 if the column has no data or -1 on error
+ */
+int libesedb_data_definition_get_fixed_size_column_data(
+     libesedb_data_definition_t *data_definition,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     uint32_t column_identifier,
+     size_t column_offset,
+     size_t column_size,
+     const uint8_t **column_data,
+     libcerror_error_t **error )
+{
+	uint8_t *record_data    = NULL;
+	static char *function   = "libesedb_data_definition_get_fixed_size_column_data";
+	size_t record_data_size = 0;
+
+	if( column_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_read_data(
+	     data_definition,
+	     file_io_handle,
+	     io_handle,
+	     pages_vector,
+	     pages_cache,
+	     &record_data,
+	     &record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data_size < sizeof( esedb_data_definition_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_identifier > (uint32_t) ( (esedb_data_definition_header_t *) record_data )->last_fixed_size_data_type )
+	{
+		return( 0 );
+	}
+	if( ( column_size > record_data_size )
+	 || ( column_offset > ( record_data_size - column_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid fixed size data type: %" PRIu32 " value out of bounds.",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	*column_data = &( record_data[ column_offset ] );
+
+	return( 1 );
+}
+
+/* Evaluates predicates against the record
+ * The predicates are evaluated on the raw column data before any record values are created
+ * Returns 1 if the record matches all predicates, 0 if not or -1 on error
+ */
+int libesedb_data_definition_evaluate_predicates(
+     libesedb_data_definition_t *data_definition,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libcdata_array_t *predicates_array,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_predicate_t *predicate                          = NULL;
+	const uint8_t *column_data                               = NULL;
+	uint8_t *record_data                                     = NULL;
+	static char *function                                    = "libesedb_data_definition_evaluate_predicates";
+	size_t column_data_size                                  = 0;
+	size_t record_data_size                                  = 0;
+	int number_of_predicates                                 = 0;
+	uint8_t column_data_flags                                = 0;
+	int predicate_index                                      = 0;
+	int result                                               = 0;
+
+	if( libcdata_array_get_number_of_entries(
+	     predicates_array,
+	     &number_of_predicates,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of predicates.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_predicates == 0 )
+	{
+		return( 1 );
+	}
+	if( libesedb_data_definition_read_data(
+	     data_definition,
+	     file_io_handle,
+	     io_handle,
+	     pages_vector,
+	     pages_cache,
+	     &record_data,
+	     &record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record data.",
+		 function );
+
+		return( -1 );
+	}
+	for( predicate_index = 0;
+	     predicate_index < number_of_predicates;
+	     predicate_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     predicates_array,
+		     predicate_index,
+		     (intptr_t **) &predicate,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve predicate: %d.",
+			 function,
+			 predicate_index );
+
+			return( -1 );
+		}
+		if( predicate == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing predicate: %d.",
+			 function,
+			 predicate_index );
+
+			return( -1 );
+		}
+		column_data      = NULL;
+		column_data_size = 0;
+
+		result = libesedb_data_definition_get_column_data(
+		          record_data,
+		          record_data_size,
+		          io_handle,
+		          table_definition,
+		          template_table_definition,
+		          predicate->column_identifier,
+		          &column_catalog_definition,
+		          &column_data_flags,
+		          &column_data,
+		          &column_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data of column: %" PRIu32 ".",
+			 function,
+			 predicate->column_identifier );
+
+			return( -1 );
+		}
+		/* Compressed, long and multi values cannot be compared on the raw column data
+		 */
+		if( ( column_data_flags & ( LIBESEDB_VALUE_FLAG_COMPRESSED | LIBESEDB_VALUE_FLAG_LONG_VALUE | LIBESEDB_VALUE_FLAG_MULTI_VALUE ) ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported data flags: 0x%02" PRIx8 " of column: %" PRIu32 ".",
+			 function,
+			 column_data_flags,
+			 predicate->column_identifier );
+
+			return( -1 );
+		}
+		result = libesedb_predicate_compare_data(
+		          predicate,
+		          column_catalog_definition->column_type,
+		          column_data,
+		          column_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare data of column: %" PRIu32 ".",
+			 function,
+			 predicate->column_identifier );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
 /* Reads the long value
  * Returns 1 if successful or -1 on error
  */
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_catalog_definition.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
@@ -92,6 +93,60 @@ int libesedb_data_definition_read_record(
      uint8_t *record_flags,
      libcerror_error_t **error );
 
+int libesedb_data_definition_get_tagged_data_type(
+     const uint8_t *tagged_data_types_data,
+     size_t tagged_data_types_data_size,
+     libesedb_io_handle_t *io_handle,
+     uint16_t tagged_data_type_identifier,
+     uint8_t *tagged_data_type_flags,
+     const uint8_t **tagged_data_type_data,
+     size_t *tagged_data_type_data_size,
+     libcerror_error_t **error );
+
+int libesedb_data_definition_get_column_data(
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libesedb_io_handle_t *io_handle,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     uint32_t column_identifier,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     uint8_t *column_data_flags,
+     const uint8_t **column_data,
+     size_t *column_data_size,
+     libcerror_error_t **error );
+
+int libesedb_data_definition_get_fixed_size_column_offset(
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     uint32_t column_identifier,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     size_t *column_offset,
+     libcerror_error_t **error );
+
+int libesedb_data_definition_get_fixed_size_column_data(
+     libesedb_data_definition_t *data_definition,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     uint32_t column_identifier,
+     size_t column_offset,
+     size_t column_size,
+     const uint8_t **column_data,
+     libcerror_error_t **error );
+
+int libesedb_data_definition_evaluate_predicates(
+     libesedb_data_definition_t *data_definition,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libcdata_array_t *predicates_array,
+     libcerror_error_t **error );
+
 int libesedb_data_definition_read_long_value(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
@@ -26,6 +26,7 @@
 #include <wide_string.h>
 
 #include "libesedb_catalog.h"
+#include "libesedb_catalog_cache.h"
 #include "libesedb_database.h"
 #include "libesedb_debug.h"
 #include "libesedb_definitions.h"
@@ -207,6 +208,22 @@ int libesedb_file_free(
 
 			result = -1;
 		}
+		if( internal_file->catalog_cache_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( internal_file->catalog_cache_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free catalog cache file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_file );
 	}
@@ -532,6 +549,232 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+/* Sets the catalog cache filename
+ * The catalog cache is read when the file is opened and written when it does not match the file
+ * This function needs to be used before one of the open functions
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_catalog_cache_filename(
+     libesedb_file_t *file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_catalog_cache_filename";
+	size_t filename_length                  = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create catalog cache file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in catalog cache file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( internal_file->catalog_cache_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->catalog_cache_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free catalog cache file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->catalog_cache_file_io_handle = file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the catalog cache filename
+ * The catalog cache is read when the file is opened and written when it does not match the file
+ * This function needs to be used before one of the open functions
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_catalog_cache_filename_wide(
+     libesedb_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_catalog_cache_filename_wide";
+	size_t filename_length                  = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create catalog cache file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in catalog cache file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( internal_file->catalog_cache_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->catalog_cache_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free catalog cache file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->catalog_cache_file_io_handle = file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 /* Opens a file using a Basic File IO (bfio) handle
  * Returns 1 if successful or -1 on error
  */
@@ -792,6 +1035,19 @@ int libesedb_file_close(
 
 		result = -1;
 	}
+	if( libfcache_cache_free(
+	     &( internal_file->branch_pages_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free branch pages cache.",
+		 function );
+
+		result = -1;
+	}
 	if( libesedb_database_free(
 	     &( internal_file->database ),
 	     error ) != 1 )
@@ -831,6 +1087,8 @@ int libesedb_file_close(
 
 		result = -1;
 	}
+	internal_file->use_backup_catalog = 0;
+
 	return( result );
 }
 
@@ -842,12 +1100,13 @@ int libesedb_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libesedb_file_header_t *file_header = NULL;
-	static char *function               = "libesedb_file_open_read";
-	size64_t file_size                  = 0;
-	off64_t file_offset                 = 0;
-	int result                          = 0;
-	int segment_index                   = 0;
+	libesedb_catalog_cache_t *catalog_cache = NULL;
+	libesedb_file_header_t *file_header     = NULL;
+	static char *function                   = "libesedb_file_open_read";
+	size64_t file_size                      = 0;
+	off64_t file_offset                     = 0;
+	int result                              = 0;
+	int segment_index                       = 0;
 
 	if( internal_file == NULL )
 	{
@@ -893,6 +1152,17 @@ int libesedb_file_open_read(
 
 		return( -1 );
 	}
+	if( internal_file->branch_pages_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - branch pages cache already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_file->database != NULL )
 	{
 		libcerror_error_set(
@@ -983,6 +1253,38 @@ int libesedb_file_open_read(
 	internal_file->io_handle->creation_format_version  = file_header->creation_format_version;
 	internal_file->io_handle->creation_format_revision = file_header->creation_format_revision;
 
+	if( internal_file->catalog_cache_file_io_handle != NULL )
+	{
+		if( libesedb_catalog_cache_initialize(
+		     &catalog_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create catalog cache.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_catalog_cache_set_file_header_values(
+		     catalog_cache,
+		     file_header,
+		     file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set file header values in catalog cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+
 	if( libesedb_file_header_free(
 	     &file_header,
 	     error ) != 1 )
@@ -1269,7 +1571,23 @@ int libesedb_file_open_read(
 
 		goto on_error;
 	}
-	if( internal_file->io_handle->file_type == LIBESEDB_FILE_TYPE_DATABASE )
+	if( libfcache_cache_initialize(
+	     &( internal_file->branch_pages_cache ),
+	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_BRANCH_PAGES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create branch pages cache.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->branch_pages_cache = internal_file->branch_pages_cache;
+
+	if( internal_file->io_handle->file_type == LIBESEDB_FILE_TYPE_DATABASE )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -1331,72 +1649,190 @@ int libesedb_file_open_read(
 
 			goto on_error;
 		}
-		if( libesedb_catalog_read_file_io_handle(
-		     internal_file->catalog,
-		     file_io_handle,
-		     LIBESEDB_PAGE_NUMBER_CATALOG,
-		     error ) != 1 )
+		result = 0;
+
+		if( catalog_cache != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read catalog.",
-			 function );
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading the catalog cache:\n" );
+			}
+#endif
+			result = libesedb_file_read_catalog_cache(
+			          internal_file,
+			          catalog_cache,
+			          error );
 
-			goto on_error;
-		}
+			if( result == -1 )
+			{
+				/* A catalog cache that cannot be read is ignored
+				 */
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading the backup catalog:\n" );
-		}
+				if( ( libcnotify_verbose != 0 )
+				 && ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
 #endif
-		if( libesedb_catalog_initialize(
-		     &( internal_file->backup_catalog ),
-		     internal_file->io_handle,
-		     internal_file->pages_vector,
-		     internal_file->pages_cache,
-		     error ) != 1 )
+				libcerror_error_free(
+				 error );
+
+				/* Discard the table definitions read from the catalog cache
+				 */
+				if( libesedb_catalog_free(
+				     &( internal_file->catalog ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free catalog.",
+					 function );
+
+					goto on_error;
+				}
+				if( libesedb_catalog_initialize(
+				     &( internal_file->catalog ),
+				     internal_file->io_handle,
+				     internal_file->pages_vector,
+				     internal_file->pages_cache,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create catalog.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( result != 1 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create backup catalog.",
-			 function );
+			result = libesedb_catalog_read_file_io_handle(
+			          internal_file->catalog,
+			          file_io_handle,
+			          LIBESEDB_PAGE_NUMBER_CATALOG,
+			          error );
 
-			goto on_error;
+			if( result != 1 )
+			{
+				/* The backup catalog is only read when the catalog cannot be read
+				 */
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( ( libcnotify_verbose != 0 )
+				 && ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+#endif
+				libcerror_error_free(
+				 error );
+
+				if( libesedb_catalog_free(
+				     &( internal_file->catalog ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free catalog.",
+					 function );
+
+					goto on_error;
+				}
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "Reading the backup catalog:\n" );
+				}
+#endif
+				if( libesedb_file_read_backup_catalog(
+				     internal_file,
+				     file_io_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read catalog and backup catalog.",
+					 function );
+
+					goto on_error;
+				}
+				internal_file->use_backup_catalog = 1;
+			}
+			else if( catalog_cache != NULL )
+			{
+				if( libesedb_file_write_catalog_cache(
+				     internal_file,
+				     catalog_cache,
+				     error ) != 1 )
+				{
+					/* A catalog cache that cannot be written is ignored
+					 */
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( ( libcnotify_verbose != 0 )
+					 && ( error != NULL )
+					 && ( *error != NULL ) )
+					{
+						libcnotify_print_error_backtrace(
+						 *error );
+					}
+#endif
+					libcerror_error_free(
+					 error );
+				}
+			}
 		}
-		if( libesedb_catalog_read_file_io_handle(
-		     internal_file->backup_catalog,
-		     file_io_handle,
-		     LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP,
+	}
+	if( catalog_cache != NULL )
+	{
+		if( libesedb_catalog_cache_free(
+		     &catalog_cache,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read backup catalog.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free catalog cache.",
 			 function );
 
 			goto on_error;
 		}
-/* TODO compare contents of catalogs ? */
 	}
 	internal_file->io_handle->abort = 0;
 
 	return( 1 );
 
 on_error:
+	if( catalog_cache != NULL )
+	{
+		libesedb_catalog_cache_free(
+		 &catalog_cache,
+		 NULL );
+	}
 	if( internal_file->backup_catalog != NULL )
 	{
 		libesedb_catalog_free(
 		 &( internal_file->backup_catalog ),
 		 NULL );
 	}
+	internal_file->use_backup_catalog = 0;
+
 	if( internal_file->catalog != NULL )
 	{
 		libesedb_catalog_free(
@@ -1409,6 +1845,14 @@ on_error:
 		 &( internal_file->database ),
 		 NULL );
 	}
+	if( internal_file->branch_pages_cache != NULL )
+	{
+		internal_file->io_handle->branch_pages_cache = NULL;
+
+		libfcache_cache_free(
+		 &( internal_file->branch_pages_cache ),
+		 NULL );
+	}
 	if( internal_file->pages_cache != NULL )
 	{
 		libfcache_cache_free(
@@ -1432,6 +1876,285 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the backup catalog
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_read_backup_catalog(
+     libesedb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_file_read_backup_catalog";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->backup_catalog != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - backup catalog already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_initialize(
+	     &( internal_file->backup_catalog ),
+	     internal_file->io_handle,
+	     internal_file->pages_vector,
+	     internal_file->pages_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create backup catalog.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_catalog_read_file_io_handle(
+	     internal_file->backup_catalog,
+	     file_io_handle,
+	     LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read backup catalog.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_file->backup_catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &( internal_file->backup_catalog ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the catalog from the catalog cache
+ * Returns 1 if successful, 0 if no catalog cache is available or it does not match the file or -1 on error
+ */
+int libesedb_file_read_catalog_cache(
+     libesedb_internal_file_t *internal_file,
+     libesedb_catalog_cache_t *catalog_cache,
+     libcerror_error_t **error )
+{
+	static char *function         = "libesedb_file_read_catalog_cache";
+	uint8_t catalog_cache_is_open = 0;
+	int result                    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->catalog_cache_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing catalog cache file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          internal_file->catalog_cache_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine if catalog cache exists.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libbfio_handle_open(
+	     internal_file->catalog_cache_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open catalog cache.",
+		 function );
+
+		goto on_error;
+	}
+	catalog_cache_is_open = 1;
+
+	result = libesedb_catalog_cache_read_file_io_handle(
+	          catalog_cache,
+	          internal_file->catalog,
+	          internal_file->catalog_cache_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog cache.",
+		 function );
+
+		goto on_error;
+	}
+	catalog_cache_is_open = 0;
+
+	if( libbfio_handle_close(
+	     internal_file->catalog_cache_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close catalog cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( catalog_cache_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 internal_file->catalog_cache_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the catalog to the catalog cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_write_catalog_cache(
+     libesedb_internal_file_t *internal_file,
+     libesedb_catalog_cache_t *catalog_cache,
+     libcerror_error_t **error )
+{
+	static char *function         = "libesedb_file_write_catalog_cache";
+	uint8_t catalog_cache_is_open = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->catalog_cache_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing catalog cache file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     internal_file->catalog_cache_file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open catalog cache.",
+		 function );
+
+		goto on_error;
+	}
+	catalog_cache_is_open = 1;
+
+	if( libesedb_catalog_cache_write_file_io_handle(
+	     catalog_cache,
+	     internal_file->catalog,
+	     internal_file->catalog_cache_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write catalog cache.",
+		 function );
+
+		goto on_error;
+	}
+	catalog_cache_is_open = 0;
+
+	if( libbfio_handle_close(
+	     internal_file->catalog_cache_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close catalog cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( catalog_cache_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 internal_file->catalog_cache_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Retrieves the file type
  * Returns 1 if successful or -1 on error
  */
@@ -1662,6 +2385,85 @@ int libesedb_file_get_page_size(
 	return( 1 );
 }
 
+/* Uses the backup catalog (MSysObjectsShadow) to retrieve tables
+ * The backup catalog is read on first use
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_use_backup_catalog(
+     libesedb_file_t *file,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_use_backup_catalog";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->file_type != LIBESEDB_FILE_TYPE_DATABASE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->backup_catalog == NULL )
+	{
+		if( libesedb_file_read_backup_catalog(
+		     internal_file,
+		     internal_file->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read backup catalog.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_file->use_backup_catalog = 1;
+
+	return( 1 );
+}
+
 /* Retrieves the number of tables
  * Returns 1 if successful or -1 on error
  */
@@ -1670,6 +2472,7 @@ int libesedb_file_get_number_of_tables(
      int *number_of_tables,
      libcerror_error_t **error )
 {
+	libesedb_catalog_t *catalog             = NULL;
 	libesedb_internal_file_t *internal_file = NULL;
 	static char *function                   = "libesedb_file_get_number_of_tables";
 
@@ -1686,7 +2489,15 @@ int libesedb_file_get_number_of_tables(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
-	if( internal_file->catalog == NULL )
+	if( internal_file->use_backup_catalog != 0 )
+	{
+		catalog = internal_file->backup_catalog;
+	}
+	else
+	{
+		catalog = internal_file->catalog;
+	}
+	if( catalog == NULL )
 	{
 		if( number_of_tables == NULL )
 		{
@@ -1704,7 +2515,7 @@ int libesedb_file_get_number_of_tables(
 	else
 	{
 		if( libesedb_catalog_get_number_of_table_definitions(
-		     internal_file->catalog,
+		     catalog,
 		     number_of_tables,
 		     error ) != 1 )
 		{
@@ -1730,6 +2541,7 @@ int libesedb_file_get_table(
      libesedb_table_t **table,
      libcerror_error_t **error )
 {
+	libesedb_catalog_t *catalog                            = NULL;
 	libesedb_internal_file_t *internal_file                = NULL;
 	libesedb_table_definition_t *table_definition          = NULL;
 	libesedb_table_definition_t *template_table_definition = NULL;
@@ -1748,6 +2560,14 @@ int libesedb_file_get_table(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
+	if( internal_file->use_backup_catalog != 0 )
+	{
+		catalog = internal_file->backup_catalog;
+	}
+	else
+	{
+		catalog = internal_file->catalog;
+	}
 	if( table == NULL )
 	{
 		libcerror_error_set(
@@ -1771,7 +2591,7 @@ int libesedb_file_get_table(
 		return( -1 );
 	}
 	if( libesedb_catalog_get_table_definition_by_index(
-	     internal_file->catalog,
+	     catalog,
 	     table_entry,
 	     &table_definition,
 	     error ) != 1 )
@@ -1811,7 +2631,7 @@ int libesedb_file_get_table(
 	if( table_definition->table_catalog_definition->template_name != NULL )
 	{
 		if( libesedb_catalog_get_table_definition_by_utf8_name(
-		     internal_file->catalog,
+		     catalog,
 		     table_definition->table_catalog_definition->template_name,
 		     table_definition->table_catalog_definition->template_name_size,
 		     &template_table_definition,
@@ -1826,6 +2646,36 @@ int libesedb_file_get_table(
 
 			return( -1 );
 		}
+		if( libesedb_catalog_read_table_definition_values(
+		     catalog,
+		     internal_file->file_io_handle,
+		     template_table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read template table catalog definitions.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_catalog_read_table_definition_values(
+	     catalog,
+	     internal_file->file_io_handle,
+	     table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read table catalog definitions.",
+		 function );
+
+		return( -1 );
 	}
 	if( libesedb_table_initialize(
 	     table,
@@ -1857,6 +2707,7 @@ int libesedb_file_get_table_by_utf8_name(
      libesedb_table_t **table,
      libcerror_error_t **error )
 {
+	libesedb_catalog_t *catalog                            = NULL;
 	libesedb_internal_file_t *internal_file                = NULL;
 	libesedb_table_definition_t *table_definition          = NULL;
 	libesedb_table_definition_t *template_table_definition = NULL;
@@ -1876,6 +2727,14 @@ int libesedb_file_get_table_by_utf8_name(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
+	if( internal_file->use_backup_catalog != 0 )
+	{
+		catalog = internal_file->backup_catalog;
+	}
+	else
+	{
+		catalog = internal_file->catalog;
+	}
 	if( table == NULL )
 	{
 		libcerror_error_set(
@@ -1899,7 +2758,7 @@ int libesedb_file_get_table_by_utf8_name(
 		return( -1 );
 	}
 	result = libesedb_catalog_get_table_definition_by_utf8_name(
-	          internal_file->catalog,
+	          catalog,
 	          utf8_string,
 	          utf8_string_length,
 	          &table_definition,
@@ -1943,7 +2802,7 @@ int libesedb_file_get_table_by_utf8_name(
 		if( table_definition->table_catalog_definition->template_name != NULL )
 		{
 			if( libesedb_catalog_get_table_definition_by_name(
-			     internal_file->catalog,
+			     catalog,
 			     table_definition->table_catalog_definition->template_name,
 			     table_definition->table_catalog_definition->template_name_size,
 			     &template_table_definition,
@@ -1958,6 +2817,36 @@ int libesedb_file_get_table_by_utf8_name(
 
 				return( -1 );
 			}
+			if( libesedb_catalog_read_table_definition_values(
+			     catalog,
+			     internal_file->file_io_handle,
+			     template_table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read template table catalog definitions.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libesedb_catalog_read_table_definition_values(
+		     catalog,
+		     internal_file->file_io_handle,
+		     table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read table catalog definitions.",
+			 function );
+
+			return( -1 );
 		}
 		if( libesedb_table_initialize(
 		     table,
@@ -1990,6 +2879,7 @@ int libesedb_file_get_table_by_utf16_name(
      libesedb_table_t **table,
      libcerror_error_t **error )
 {
+	libesedb_catalog_t *catalog                            = NULL;
 	libesedb_internal_file_t *internal_file                = NULL;
 	libesedb_table_definition_t *table_definition          = NULL;
 	libesedb_table_definition_t *template_table_definition = NULL;
@@ -2009,6 +2899,14 @@ int libesedb_file_get_table_by_utf16_name(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
+	if( internal_file->use_backup_catalog != 0 )
+	{
+		catalog = internal_file->backup_catalog;
+	}
+	else
+	{
+		catalog = internal_file->catalog;
+	}
 	if( table == NULL )
 	{
 		libcerror_error_set(
@@ -2032,7 +2930,7 @@ int libesedb_file_get_table_by_utf16_name(
 		return( -1 );
 	}
 	result = libesedb_catalog_get_table_definition_by_utf16_name(
-	          internal_file->catalog,
+	          catalog,
 	          utf16_string,
 	          utf16_string_length,
 	          &table_definition,
@@ -2076,7 +2974,7 @@ int libesedb_file_get_table_by_utf16_name(
 		if( table_definition->table_catalog_definition->template_name != NULL )
 		{
 			if( libesedb_catalog_get_table_definition_by_name(
-			     internal_file->catalog,
+			     catalog,
 			     table_definition->table_catalog_definition->template_name,
 			     table_definition->table_catalog_definition->template_name_size,
 			     &template_table_definition,
@@ -2091,6 +2989,36 @@ int libesedb_file_get_table_by_utf16_name(
 
 				return( -1 );
 			}
+			if( libesedb_catalog_read_table_definition_values(
+			     catalog,
+			     internal_file->file_io_handle,
+			     template_table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read template table catalog definitions.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libesedb_catalog_read_table_definition_values(
+		     catalog,
+		     internal_file->file_io_handle,
+		     table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read table catalog definitions.",
+			 function );
+
+			return( -1 );
 		}
 		if( libesedb_table_initialize(
 		     table,
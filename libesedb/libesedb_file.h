@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libesedb_catalog.h"
+#include "libesedb_catalog_cache.h"
 #include "libesedb_database.h"
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
@@ -66,6 +67,10 @@ struct libesedb_internal_file
 	 */
 	libfcache_cache_t *pages_cache;
 
+	/* The branch pages cache
+	 */
+	libfcache_cache_t *branch_pages_cache;
+
 	/* The database
 	 */
 	libesedb_database_t *database;
@@ -75,8 +80,18 @@ struct libesedb_internal_file
 	libesedb_catalog_t *catalog;
 
 	/* The backup catalog
+	 * The backup catalog is only read when the catalog cannot be read
+	 * or when it is requested by libesedb_file_use_backup_catalog
 	 */
 	libesedb_catalog_t *backup_catalog;
+
+	/* Value to indicate the backup catalog is used to retrieve tables
+	 */
+	uint8_t use_backup_catalog;
+	/* The catalog cache file IO handle
+	 * The catalog cache is only used when a catalog cache filename was set
+	 */
+	libbfio_handle_t *catalog_cache_file_io_handle;
 };
 
 LIBESEDB_EXTERN \
@@ -112,6 +127,22 @@ int libesedb_file_open_wide(
 
 #endif
 
+LIBESEDB_EXTERN \
+int libesedb_file_set_catalog_cache_filename(
+     libesedb_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_catalog_cache_filename_wide(
+     libesedb_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif
+
 LIBESEDB_EXTERN \
 int libesedb_file_open_file_io_handle(
      libesedb_file_t *file,
@@ -129,6 +160,21 @@ int libesedb_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libesedb_file_read_backup_catalog(
+     libesedb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libesedb_file_read_catalog_cache(
+     libesedb_internal_file_t *internal_file,
+     libesedb_catalog_cache_t *catalog_cache,
+     libcerror_error_t **error );
+
+int libesedb_file_write_catalog_cache(
+     libesedb_internal_file_t *internal_file,
+     libesedb_catalog_cache_t *catalog_cache,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_file_get_type(
      libesedb_file_t *file,
@@ -155,6 +201,11 @@ int libesedb_file_get_page_size(
      uint32_t *page_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_file_use_backup_catalog(
+     libesedb_file_t *file,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_file_get_number_of_tables(
      libesedb_file_t *file,
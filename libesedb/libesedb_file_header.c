@@ -256,6 +256,8 @@ int libesedb_file_header_read_data(
 
 		return( -1 );
 	}
+	file_header->checksum = stored_xor32_checksum;
+
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (esedb_file_header_t *) data )->format_version,
 	 file_header->format_version );
@@ -278,6 +280,25 @@ int libesedb_file_header_read_data(
 	 ( (esedb_file_header_t *) data )->creation_format_revision,
 	 file_header->creation_format_revision );
 
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_file_header_t *) data )->database_time,
+	 file_header->database_time );
+
+	if( memory_copy(
+	     file_header->database_signature,
+	     ( (esedb_file_header_t *) data )->database_signature,
+	     28 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database signature.",
+		 function );
+
+		return( -1 );
+	}
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -36,6 +36,10 @@ typedef struct libesedb_file_header libesedb_file_header_t;
 
 struct libesedb_file_header
 {
+	/* The checksum
+	 */
+	uint32_t checksum;
+
 	/* The file type
 	 */
 	uint32_t file_type;
@@ -59,6 +63,14 @@ struct libesedb_file_header
 	/* The page size
 	 */
 	uint32_t page_size;
+
+	/* The database time
+	 */
+	uint64_t database_time;
+
+	/* The database signature
+	 */
+	uint8_t database_signature[ 28 ];
 };
 
 int libesedb_file_header_initialize(
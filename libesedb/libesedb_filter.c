@@ -0,0 +1,286 @@
+/*
+ * Filter functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_filter.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_predicate.h"
+#include "libesedb_types.h"
+
+/* Creates a filter
+ * Make sure the value filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_initialize(
+     libesedb_filter_t **filter,
+     libcerror_error_t **error )
+{
+	libesedb_internal_filter_t *internal_filter = NULL;
+	static char *function                       = "libesedb_filter_initialize";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = memory_allocate_structure(
+	                   libesedb_internal_filter_t );
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_filter,
+	     0,
+	     sizeof( libesedb_internal_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear filter.",
+		 function );
+
+		memory_free(
+		 internal_filter );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_filter->predicates_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create predicates array.",
+		 function );
+
+		goto on_error;
+	}
+	*filter = (libesedb_filter_t *) internal_filter;
+
+	return( 1 );
+
+on_error:
+	if( internal_filter != NULL )
+	{
+		memory_free(
+		 internal_filter );
+	}
+	return( -1 );
+}
+
+/* Frees a filter
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_free(
+     libesedb_filter_t **filter,
+     libcerror_error_t **error )
+{
+	libesedb_internal_filter_t *internal_filter = NULL;
+	static char *function                       = "libesedb_filter_free";
+	int result                                  = 1;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		internal_filter = (libesedb_internal_filter_t *) *filter;
+		*filter         = NULL;
+
+		if( libcdata_array_free(
+		     &( internal_filter->predicates_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_predicate_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free predicates array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_filter );
+	}
+	return( result );
+}
+
+/* Retrieves the number of predicates
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_get_number_of_predicates(
+     libesedb_filter_t *filter,
+     int *number_of_predicates,
+     libcerror_error_t **error )
+{
+	libesedb_internal_filter_t *internal_filter = NULL;
+	static char *function                       = "libesedb_filter_get_number_of_predicates";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libesedb_internal_filter_t *) filter;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_filter->predicates_array,
+	     number_of_predicates,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of predicates.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a predicate
+ * The predicates of a filter are combined using a logical AND
+ * The value data must be stored in the same format as the column data in the database,
+ * e.g. a 32-bit integer as 4 bytes in little-endian
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_filter_append_predicate(
+     libesedb_filter_t *filter,
+     uint32_t column_identifier,
+     int comparison_operator,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_filter_t *internal_filter = NULL;
+	libesedb_predicate_t *predicate             = NULL;
+	static char *function                       = "libesedb_filter_append_predicate";
+	int entry_index                             = 0;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libesedb_internal_filter_t *) filter;
+
+	if( libesedb_predicate_initialize(
+	     &predicate,
+	     column_identifier,
+	     comparison_operator,
+	     value_data,
+	     value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create predicate.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     internal_filter->predicates_array,
+	     &entry_index,
+	     (intptr_t *) predicate,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append predicate to array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( predicate != NULL )
+	{
+		libesedb_predicate_free(
+		 &predicate,
+		 NULL );
+	}
+	return( -1 );
+}
+
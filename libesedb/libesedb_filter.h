@@ -0,0 +1,76 @@
+/*
+ * Filter functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_FILTER_H )
+#define _LIBESEDB_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_extern.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_internal_filter libesedb_internal_filter_t;
+
+struct libesedb_internal_filter
+{
+	/* The predicates array
+	 */
+	libcdata_array_t *predicates_array;
+};
+
+LIBESEDB_EXTERN \
+int libesedb_filter_initialize(
+     libesedb_filter_t **filter,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_filter_free(
+     libesedb_filter_t **filter,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_filter_get_number_of_predicates(
+     libesedb_filter_t *filter,
+     int *number_of_predicates,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_filter_append_predicate(
+     libesedb_filter_t *filter,
+     uint32_t column_identifier,
+     int comparison_operator,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_FILTER_H ) */
+
@@ -0,0 +1,712 @@
+/*
+ * Hash table functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_hash_table.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libuna.h"
+
+/* Creates a hash table
+ * Make sure the value hash_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hash_table_initialize(
+     libesedb_hash_table_t **hash_table,
+     int maximum_number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_hash_table_initialize";
+	size_t entries_size   = 0;
+	int number_of_entries = 16;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_values < 0 )
+	 || ( maximum_number_of_values > ( INT_MAX / 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the load factor at most 50 percent so that probing stays short
+	 * and there always is an unused entry to terminate a probe sequence
+	 */
+	while( number_of_entries < ( maximum_number_of_values * 2 ) )
+	{
+		number_of_entries *= 2;
+	}
+	entries_size = (size_t) number_of_entries;
+
+	*hash_table = memory_allocate_structure(
+	               libesedb_hash_table_t );
+
+	if( *hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *hash_table,
+	     0,
+	     sizeof( libesedb_hash_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		memory_free(
+		 *hash_table );
+
+		*hash_table = NULL;
+
+		return( -1 );
+	}
+	( *hash_table )->hashes = (uint32_t *) memory_allocate(
+	                                        sizeof( uint32_t ) * entries_size );
+
+	if( ( *hash_table )->hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hashes.",
+		 function );
+
+		goto on_error;
+	}
+	( *hash_table )->values = (intptr_t **) memory_allocate(
+	                                         sizeof( intptr_t * ) * entries_size );
+
+	if( ( *hash_table )->values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create values.",
+		 function );
+
+		goto on_error;
+	}
+	( *hash_table )->value_indexes = (int *) memory_allocate(
+	                                          sizeof( int ) * entries_size );
+
+	if( ( *hash_table )->value_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value indexes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *hash_table )->hashes,
+	     0,
+	     sizeof( uint32_t ) * entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hashes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *hash_table )->values,
+	     0,
+	     sizeof( intptr_t * ) * entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear values.",
+		 function );
+
+		goto on_error;
+	}
+	( *hash_table )->number_of_entries        = number_of_entries;
+	( *hash_table )->maximum_number_of_values = maximum_number_of_values;
+
+	return( 1 );
+
+on_error:
+	if( *hash_table != NULL )
+	{
+		if( ( *hash_table )->value_indexes != NULL )
+		{
+			memory_free(
+			 ( *hash_table )->value_indexes );
+		}
+		if( ( *hash_table )->values != NULL )
+		{
+			memory_free(
+			 ( *hash_table )->values );
+		}
+		if( ( *hash_table )->hashes != NULL )
+		{
+			memory_free(
+			 ( *hash_table )->hashes );
+		}
+		memory_free(
+		 *hash_table );
+
+		*hash_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a hash table
+ * The values are not freed, they are owned by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hash_table_free(
+     libesedb_hash_table_t **hash_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_hash_table_free";
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_table != NULL )
+	{
+		if( ( *hash_table )->value_indexes != NULL )
+		{
+			memory_free(
+			 ( *hash_table )->value_indexes );
+		}
+		if( ( *hash_table )->values != NULL )
+		{
+			memory_free(
+			 ( *hash_table )->values );
+		}
+		if( ( *hash_table )->hashes != NULL )
+		{
+			memory_free(
+			 ( *hash_table )->hashes );
+		}
+		memory_free(
+		 *hash_table );
+
+		*hash_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Inserts a value into the hash table
+ * Values with the same hash are returned in order of insertion
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hash_table_insert_value(
+     libesedb_hash_table_t *hash_table,
+     uint32_t hash,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_hash_table_insert_value";
+	int entry_index       = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_table->hashes == NULL )
+	 || ( hash_table->values == NULL )
+	 || ( hash_table->value_indexes == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hash table - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_table->number_of_values >= hash_table->maximum_number_of_values )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash table - maximum number of values reached.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = (int) ( hash & (uint32_t) ( hash_table->number_of_entries - 1 ) );
+
+	while( hash_table->values[ entry_index ] != NULL )
+	{
+		entry_index = ( entry_index + 1 ) & ( hash_table->number_of_entries - 1 );
+	}
+	hash_table->hashes[ entry_index ]        = hash;
+	hash_table->values[ entry_index ]        = value;
+	hash_table->value_indexes[ entry_index ] = hash_table->number_of_values;
+
+	hash_table->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the next value with a specific hash and its value index
+ * The entry index should be set to -1 to retrieve the first value with the hash
+ * and is updated to continue with the next value on a subsequent call
+ * Returns 1 if successful, 0 if no more values with the hash were found or -1 on error
+ */
+int libesedb_hash_table_get_next_value_by_hash(
+     libesedb_hash_table_t *hash_table,
+     uint32_t hash,
+     int *entry_index,
+     int *value_index,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_hash_table_get_next_value_by_hash";
+	int number_of_probes  = 0;
+	int safe_entry_index  = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_table->hashes == NULL )
+	 || ( hash_table->values == NULL )
+	 || ( hash_table->value_indexes == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hash table - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *entry_index < -1 )
+	 || ( *entry_index >= hash_table->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry_index == -1 )
+	{
+		safe_entry_index = (int) ( hash & (uint32_t) ( hash_table->number_of_entries - 1 ) );
+	}
+	else
+	{
+		safe_entry_index = ( *entry_index + 1 ) & ( hash_table->number_of_entries - 1 );
+	}
+	/* A probe sequence ends at the first unused entry
+	 */
+	for( number_of_probes = 0;
+	     number_of_probes < hash_table->number_of_entries;
+	     number_of_probes++ )
+	{
+		if( hash_table->values[ safe_entry_index ] == NULL )
+		{
+			break;
+		}
+		if( hash_table->hashes[ safe_entry_index ] == hash )
+		{
+			*entry_index = safe_entry_index;
+			*value_index = hash_table->value_indexes[ safe_entry_index ];
+			*value       = hash_table->values[ safe_entry_index ];
+
+			return( 1 );
+		}
+		safe_entry_index = ( safe_entry_index + 1 ) & ( hash_table->number_of_entries - 1 );
+	}
+	*entry_index = safe_entry_index;
+	*value_index = -1;
+	*value       = NULL;
+
+	return( 0 );
+}
+
+/* Retrieves the name hash of a byte stream in an ASCII compatible codepage
+ * The hash is case-insensitive for ASCII characters, like name comparison in ESE
+ * The characters are decoded to Unicode code points, so that names stored
+ * in a codepage hash the same as their UTF-8 and UTF-16 equivalents
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hash_table_get_name_hash_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libesedb_hash_table_get_name_hash_from_byte_stream";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t byte_stream_index                     = 0;
+	uint32_t safe_name_hash                      = LIBESEDB_HASH_TABLE_NAME_HASH_INITIAL_VALUE;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( byte_stream_index < byte_stream_size )
+	{
+		if( libuna_unicode_character_copy_from_byte_stream(
+		     &unicode_character,
+		     byte_stream,
+		     byte_stream_size,
+		     &byte_stream_index,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to copy Unicode character from byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		else if( ( unicode_character >= (libuna_unicode_character_t) 'a' )
+		      && ( unicode_character <= (libuna_unicode_character_t) 'z' ) )
+		{
+			unicode_character -= (libuna_unicode_character_t) 'a' - (libuna_unicode_character_t) 'A';
+		}
+		safe_name_hash ^= (uint32_t) unicode_character;
+		safe_name_hash *= 0x01000193UL;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Retrieves the name hash of an UTF-8 string
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hash_table_get_name_hash_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libesedb_hash_table_get_name_hash_from_utf8_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf8_string_index                     = 0;
+	uint32_t safe_name_hash                      = LIBESEDB_HASH_TABLE_NAME_HASH_INITIAL_VALUE;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     (libuna_utf8_character_t *) utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to copy Unicode character from UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		else if( ( unicode_character >= (libuna_unicode_character_t) 'a' )
+		      && ( unicode_character <= (libuna_unicode_character_t) 'z' ) )
+		{
+			unicode_character -= (libuna_unicode_character_t) 'a' - (libuna_unicode_character_t) 'A';
+		}
+		safe_name_hash ^= (uint32_t) unicode_character;
+		safe_name_hash *= 0x01000193UL;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Retrieves the name hash of an UTF-16 string
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_hash_table_get_name_hash_from_utf16_string(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libesedb_hash_table_get_name_hash_from_utf16_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_string_index                    = 0;
+	uint32_t safe_name_hash                      = LIBESEDB_HASH_TABLE_NAME_HASH_INITIAL_VALUE;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf16_string_index < utf16_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     (libuna_utf16_character_t *) utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to copy Unicode character from UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		else if( ( unicode_character >= (libuna_unicode_character_t) 'a' )
+		      && ( unicode_character <= (libuna_unicode_character_t) 'z' ) )
+		{
+			unicode_character -= (libuna_unicode_character_t) 'a' - (libuna_unicode_character_t) 'A';
+		}
+		safe_name_hash ^= (uint32_t) unicode_character;
+		safe_name_hash *= 0x01000193UL;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
@@ -0,0 +1,119 @@
+/*
+ * Hash table functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBESEDB_HASH_TABLE_H )
+#define _LIBESEDB_HASH_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+#include "libesedb_libuna.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial value of the name hash (32-bit FNV-1a offset basis)
+ */
+#define LIBESEDB_HASH_TABLE_NAME_HASH_INITIAL_VALUE	0x811c9dc5UL
+
+typedef struct libesedb_hash_table libesedb_hash_table_t;
+
+struct libesedb_hash_table
+{
+	/* The number of entries
+	 * This is a power of 2 and larger than the maximum number of values
+	 */
+	int number_of_entries;
+
+	/* The maximum number of values
+	 */
+	int maximum_number_of_values;
+
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The hashes of the entries
+	 */
+	uint32_t *hashes;
+
+	/* The values of the entries
+	 * An entry is NULL if it is unused
+	 */
+	intptr_t **values;
+
+	/* The value indexes of the entries
+	 * The value index is the order in which the value was inserted
+	 */
+	int *value_indexes;
+};
+
+int libesedb_hash_table_initialize(
+     libesedb_hash_table_t **hash_table,
+     int maximum_number_of_values,
+     libcerror_error_t **error );
+
+int libesedb_hash_table_free(
+     libesedb_hash_table_t **hash_table,
+     libcerror_error_t **error );
+
+int libesedb_hash_table_insert_value(
+     libesedb_hash_table_t *hash_table,
+     uint32_t hash,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int libesedb_hash_table_get_next_value_by_hash(
+     libesedb_hash_table_t *hash_table,
+     uint32_t hash,
+     int *entry_index,
+     int *value_index,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+int libesedb_hash_table_get_name_hash_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int libesedb_hash_table_get_name_hash_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int libesedb_hash_table_get_name_hash_from_utf16_string(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_HASH_TABLE_H ) */
+
@@ -28,6 +28,7 @@
 #include "libesedb_definitions.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_index.h"
+#include "libesedb_index_cursor.h"
 #include "libesedb_key.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
@@ -35,6 +36,7 @@
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page_tree.h"
+#include "libesedb_page_tree_cursor.h"
 #include "libesedb_record.h"
 #include "libesedb_types.h"
 
@@ -665,13 +667,9 @@ int libesedb_index_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error )
 {
-	libesedb_data_definition_t *index_data_definition  = NULL;
-	libesedb_data_definition_t *record_data_definition = NULL;
-	libesedb_internal_index_t *internal_index          = NULL;
-	libesedb_key_t *key                                = NULL;
-	uint8_t *index_data                                = NULL;
-	static char *function                              = "libesedb_index_get_record";
-	size_t index_data_size                             = 0;
+	libesedb_data_definition_t *index_data_definition = NULL;
+	libesedb_internal_index_t *internal_index         = NULL;
+	static char *function                             = "libesedb_index_get_record";
 
 	if( index == NULL )
 	{
@@ -686,47 +684,895 @@ int libesedb_index_get_record(
 	}
 	internal_index = (libesedb_internal_index_t *) index;
 
-	if( record == NULL )
+	if( libesedb_data_definition_initialize(
+	     &index_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index data definition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_get_leaf_value_by_index(
+	     internal_index->index_page_tree,
+	     internal_index->file_io_handle,
+	     internal_index->index_catalog_definition->father_data_page_number,
+	     record_entry,
+	     index_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from index page tree.",
+		 function,
+		 record_entry );
+
+		goto on_error;
+	}
+	if( libesedb_index_get_record_by_index_value(
+	     internal_index,
+	     index_data_definition,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_entry );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_free(
+	     &index_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index data definition.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &index_data_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the records of consecutive entries
+ * The records array should contain number_of_records entries that are set to NULL
+ * The primary keys of the index values are resolved against the table in key order,
+ * hence the table leaf pages are read sequentially, while the records are returned in index order
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_records(
+     libesedb_index_t *index,
+     int first_record_entry,
+     libesedb_record_t **records,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *data_definition         = NULL;
+	libesedb_internal_index_t *internal_index           = NULL;
+	libesedb_key_t **keys                               = NULL;
+	libesedb_page_tree_cursor_t *index_page_tree_cursor = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor       = NULL;
+	uint8_t *index_data                           = NULL;
+	int *sorted_record_entries                    = NULL;
+	static char *function                         = "libesedb_index_get_records";
+	size_t compare_size                           = 0;
+	size_t index_data_size                        = 0;
+	int compare_result                            = 0;
+	int lower_bound                               = 0;
+	int record_entry                              = 0;
+	int result                                    = 0;
+	int sorted_entry                              = 0;
+	int upper_bound                               = 0;
+
+	if( index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid index.",
 		 function );
 
 		return( -1 );
 	}
-	if( *record != NULL )
+	internal_index = (libesedb_internal_index_t *) index;
+
+	if( internal_index->table_definition == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing table definition.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfdata_btree_get_leaf_value_by_index(
-	     internal_index->index_values_tree,
-	     (intptr_t *) internal_index->file_io_handle,
-	     (libfdata_cache_t *) internal_index->index_values_cache,
-	     record_entry,
-	     (intptr_t **) &index_data_definition,
+	if( internal_index->table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first record entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_records <= 0 )
+	 || ( (size_t) number_of_records > (size_t) ( SSIZE_MAX / sizeof( libesedb_key_t * ) ) )
+	 || ( first_record_entry > ( INT_MAX - number_of_records ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_entry = 0;
+	     record_entry < number_of_records;
+	     record_entry++ )
+	{
+		if( records[ record_entry ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid record: %d value already set.",
+			 function,
+			 record_entry );
+
+			return( -1 );
+		}
+	}
+	keys = (libesedb_key_t **) memory_allocate(
+	                            sizeof( libesedb_key_t * ) * number_of_records );
+
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create keys.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     keys,
 	     0,
+	     sizeof( libesedb_key_t * ) * number_of_records ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear keys.",
+		 function );
+
+		memory_free(
+		 keys );
+
+		return( -1 );
+	}
+	sorted_record_entries = (int *) memory_allocate(
+	                                 sizeof( int ) * number_of_records );
+
+	if( sorted_record_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted record entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_initialize(
+	     &data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data definition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_cursor_initialize(
+	     &index_page_tree_cursor,
+	     internal_index->io_handle,
+	     internal_index->pages_vector,
+	     internal_index->pages_cache,
+	     internal_index->index_catalog_definition->father_data_page_number,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	/* Read the primary keys of the index values and sort the record entries
+	 * by primary key using a binary insertion sort. Only the first index value
+	 * is looked up by index, the cursor then moves along the index leaf pages
+	 */
+	for( record_entry = 0;
+	     record_entry < number_of_records;
+	     record_entry++ )
+	{
+		if( record_entry == 0 )
+		{
+			result = libesedb_page_tree_seek_leaf_value_by_index(
+			          internal_index->index_page_tree,
+			          index_page_tree_cursor,
+			          internal_index->file_io_handle,
+			          first_record_entry,
+			          data_definition,
+			          error );
+		}
+		else
+		{
+			result = libesedb_page_tree_cursor_get_next_leaf_value(
+			          index_page_tree_cursor,
+			          internal_index->file_io_handle,
+			          data_definition,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf value: %d from index page tree.",
+			 function,
+			 first_record_entry + record_entry );
+
+			goto on_error;
+		}
+		if( libesedb_data_definition_read_data(
+		     data_definition,
+		     internal_index->file_io_handle,
+		     internal_index->io_handle,
+		     internal_index->pages_vector,
+		     internal_index->pages_cache,
+		     &index_data,
+		     &index_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index data definition data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_key_initialize(
+		     &( keys[ record_entry ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		if( libesedb_key_set_data(
+		     keys[ record_entry ],
+		     index_data,
+		     index_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index data in key: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		keys[ record_entry ]->type = LIBESEDB_KEY_TYPE_SEEK_VALUE;
+
+		lower_bound = 0;
+		upper_bound = record_entry;
+
+		while( lower_bound < upper_bound )
+		{
+			sorted_entry = lower_bound + ( ( upper_bound - lower_bound ) / 2 );
+
+			compare_size = keys[ sorted_record_entries[ sorted_entry ] ]->data_size;
+
+			if( compare_size > index_data_size )
+			{
+				compare_size = index_data_size;
+			}
+			compare_result = 0;
+
+			if( compare_size > 0 )
+			{
+				compare_result = memory_compare(
+				                  keys[ record_entry ]->data,
+				                  keys[ sorted_record_entries[ sorted_entry ] ]->data,
+				                  compare_size );
+			}
+			if( ( compare_result > 0 )
+			 || ( ( compare_result == 0 )
+			  &&  ( index_data_size >= keys[ sorted_record_entries[ sorted_entry ] ]->data_size ) ) )
+			{
+				lower_bound = sorted_entry + 1;
+			}
+			else
+			{
+				upper_bound = sorted_entry;
+			}
+		}
+		for( sorted_entry = record_entry;
+		     sorted_entry > lower_bound;
+		     sorted_entry-- )
+		{
+			sorted_record_entries[ sorted_entry ] = sorted_record_entries[ sorted_entry - 1 ];
+		}
+		sorted_record_entries[ lower_bound ] = record_entry;
+	}
+	if( libesedb_page_tree_cursor_free(
+	     &index_page_tree_cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	/* Resolve the records in primary key order with a single page tree cursor,
+	 * so that the table pages of consecutive keys are shared
+	 */
+	if( libesedb_page_tree_cursor_initialize(
+	     &page_tree_cursor,
+	     internal_index->io_handle,
+	     internal_index->pages_vector,
+	     internal_index->pages_cache,
+	     internal_index->table_definition->table_catalog_definition->father_data_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	for( sorted_entry = 0;
+	     sorted_entry < number_of_records;
+	     sorted_entry++ )
+	{
+		record_entry = sorted_record_entries[ sorted_entry ];
+
+		result = libesedb_page_tree_cursor_seek_leaf_value(
+		          page_tree_cursor,
+		          internal_index->file_io_handle,
+		          keys[ record_entry ],
+		          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+		          data_definition,
+		          error );
+
+		if( result == 1 )
+		{
+			result = libesedb_page_tree_cursor_get_next_leaf_value(
+			          page_tree_cursor,
+			          internal_index->file_io_handle,
+			          data_definition,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table leaf value of record: %d.",
+			 function,
+			 first_record_entry + record_entry );
+
+			goto on_error;
+		}
+		if( libesedb_record_initialize(
+		     &( records[ record_entry ] ),
+		     internal_index->file_io_handle,
+		     internal_index->io_handle,
+		     internal_index->table_definition,
+		     internal_index->template_table_definition,
+		     internal_index->pages_vector,
+		     internal_index->pages_cache,
+		     internal_index->long_values_pages_vector,
+		     internal_index->long_values_pages_cache,
+		     data_definition,
+		     internal_index->long_values_tree,
+		     internal_index->long_values_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record: %d.",
+			 function,
+			 first_record_entry + record_entry );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_page_tree_cursor_free(
+	     &page_tree_cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_free(
+	     &data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free data definition.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_entry = 0;
+	     record_entry < number_of_records;
+	     record_entry++ )
+	{
+		if( libesedb_key_free(
+		     &( keys[ record_entry ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 sorted_record_entries );
+
+	memory_free(
+	 keys );
+
+	return( 1 );
+
+on_error:
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	if( index_page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &index_page_tree_cursor,
+		 NULL );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( sorted_record_entries != NULL )
+	{
+		memory_free(
+		 sorted_record_entries );
+	}
+	if( keys != NULL )
+	{
+		for( record_entry = 0;
+		     record_entry < number_of_records;
+		     record_entry++ )
+		{
+			if( keys[ record_entry ] != NULL )
+			{
+				libesedb_key_free(
+				 &( keys[ record_entry ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 keys );
+	}
+	for( record_entry = 0;
+	     record_entry < number_of_records;
+	     record_entry++ )
+	{
+		if( records[ record_entry ] != NULL )
+		{
+			libesedb_record_free(
+			 &( records[ record_entry ] ),
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Seeks an index value by key
+ * The key data contains the (normalized) key of the index value, the comparison operator
+ * determines the index value that is sought and can be LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+ * LIBESEDB_COMPARISON_OPERATOR_LESS, LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL,
+ * LIBESEDB_COMPARISON_OPERATOR_GREATER or LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL
+ * If found an index cursor is opened that is positioned so that libesedb_index_cursor_next
+ * retrieves the record of the matching index value and libesedb_index_cursor_previous
+ * the record before it. The cursor must be closed before the index is freed
+ * Make sure the value index_cursor is referencing, is set to NULL
+ * Returns 1 if successful, 0 if no such index value or -1 on error
+ */
+int libesedb_index_seek(
+     libesedb_index_t *index,
+     const uint8_t *key_data,
+     size_t key_size,
+     int comparison_operator,
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_index_cursor_t *safe_index_cursor = NULL;
+	static char *function                      = "libesedb_index_seek";
+	int result                                 = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_index_cursor_open(
+	     index,
+	     &safe_index_cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to open index cursor.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_index_cursor_seek(
+	          safe_index_cursor,
+	          key_data,
+	          key_size,
+	          comparison_operator,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf value: %d from index values tree.",
-		 function,
-		 record_entry );
+		 "%s: unable to seek index value.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libesedb_index_cursor_close(
+		     &safe_index_cursor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to close index cursor.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	*index_cursor = safe_index_cursor;
+
+	return( 1 );
+
+on_error:
+	if( safe_index_cursor != NULL )
+	{
+		libesedb_index_cursor_close(
+		 &safe_index_cursor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans a range of index values
+ * The key data contains the (normalized) key of the index value, where start key data of NULL
+ * starts the range at the first index value and end key data of NULL ends it at the last.
+ * The start comparison operator can be LIBESEDB_COMPARISON_OPERATOR_GREATER or
+ * LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL and the end comparison operator
+ * LIBESEDB_COMPARISON_OPERATOR_LESS or LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL
+ * If the range contains index values an index cursor is opened that is positioned before
+ * the first index value of the range. libesedb_index_cursor_next and libesedb_index_cursor_previous
+ * do not move beyond the bounds of the range, hence only the leaf pages that intersect the range are read
+ * The cursor must be closed before the index is freed
+ * Make sure the value index_cursor is referencing, is set to NULL
+ * Returns 1 if successful, 0 if the range contains no index values or -1 on error
+ */
+int libesedb_index_scan_range(
+     libesedb_index_t *index,
+     const uint8_t *start_key_data,
+     size_t start_key_size,
+     int start_comparison_operator,
+     const uint8_t *end_key_data,
+     size_t end_key_size,
+     int end_comparison_operator,
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_index_cursor_t *safe_index_cursor = NULL;
+	static char *function                      = "libesedb_index_scan_range";
+	int result                                 = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_index_cursor_open(
+	     index,
+	     &safe_index_cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to open index cursor.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_index_cursor_set_range(
+	          safe_index_cursor,
+	          start_key_data,
+	          start_key_size,
+	          start_comparison_operator,
+	          end_key_data,
+	          end_key_size,
+	          end_comparison_operator,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to set range of index cursor.",
+		 function );
 
 		goto on_error;
 	}
+	else if( result == 0 )
+	{
+		if( libesedb_index_cursor_close(
+		     &safe_index_cursor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to close index cursor.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	*index_cursor = safe_index_cursor;
+
+	return( 1 );
+
+on_error:
+	if( safe_index_cursor != NULL )
+	{
+		libesedb_index_cursor_close(
+		 &safe_index_cursor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the record referenced by an index value
+ * The index value contains the key of the record in the table values tree
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_record_by_index_value(
+     libesedb_internal_index_t *internal_index,
+     libesedb_data_definition_t *index_data_definition,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_key_t *key                                = NULL;
+	uint8_t *index_data                                = NULL;
+	static char *function                              = "libesedb_index_get_record_by_index_value";
+	size_t index_data_size                             = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_data_definition_read_data(
 	     index_data_definition,
 	     internal_index->file_io_handle,
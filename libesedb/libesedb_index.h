@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libesedb_catalog_definition.h"
+#include "libesedb_data_definition.h"
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
@@ -180,6 +181,41 @@ int libesedb_index_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_index_get_records(
+     libesedb_index_t *index,
+     int first_record_entry,
+     libesedb_record_t **records,
+     int number_of_records,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_seek(
+     libesedb_index_t *index,
+     const uint8_t *key_data,
+     size_t key_size,
+     int comparison_operator,
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_scan_range(
+     libesedb_index_t *index,
+     const uint8_t *start_key_data,
+     size_t start_key_size,
+     int start_comparison_operator,
+     const uint8_t *end_key_data,
+     size_t end_key_size,
+     int end_comparison_operator,
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error );
+
+int libesedb_index_get_record_by_index_value(
+     libesedb_internal_index_t *internal_index,
+     libesedb_data_definition_t *index_data_definition,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
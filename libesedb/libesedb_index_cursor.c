@@ -0,0 +1,1072 @@
+/*
+ * Index cursor functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page_tree_cursor.h"
+#include "libesedb_index.h"
+#include "libesedb_index_cursor.h"
+#include "libesedb_key.h"
+#include "libesedb_types.h"
+
+/* Opens an index cursor
+ * The cursor iterates the records of the table in index leaf page order, forward or backward,
+ * without using the index values tree. The cursor must be closed before the index is freed
+ * Make sure the value index_cursor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_cursor_open(
+     libesedb_index_t *index,
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index               = NULL;
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	static char *function                                   = "libesedb_index_cursor_open";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+	if( internal_index->index_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing index catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_cursor = memory_allocate_structure(
+	                         libesedb_internal_index_cursor_t );
+
+	if( internal_index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_index_cursor,
+	     0,
+	     sizeof( libesedb_internal_index_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index cursor.",
+		 function );
+
+		memory_free(
+		 internal_index_cursor );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_cursor_initialize(
+	     &( internal_index_cursor->page_tree_cursor ),
+	     internal_index->io_handle,
+	     internal_index->pages_vector,
+	     internal_index->pages_cache,
+	     internal_index->index_catalog_definition->father_data_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_initialize(
+	     &( internal_index_cursor->data_definition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data definition.",
+		 function );
+
+		goto on_error;
+	}
+	internal_index_cursor->internal_index = internal_index;
+
+	*index_cursor = (libesedb_index_cursor_t *) internal_index_cursor;
+
+	return( 1 );
+
+on_error:
+	if( internal_index_cursor != NULL )
+	{
+		if( internal_index_cursor->page_tree_cursor != NULL )
+		{
+			libesedb_page_tree_cursor_free(
+			 &( internal_index_cursor->page_tree_cursor ),
+			 NULL );
+		}
+		memory_free(
+		 internal_index_cursor );
+	}
+	return( -1 );
+}
+
+/* Closes an index cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_cursor_close(
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	static char *function                                   = "libesedb_index_cursor_close";
+	int result                                              = 1;
+
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_cursor != NULL )
+	{
+		internal_index_cursor = (libesedb_internal_index_cursor_t *) *index_cursor;
+		*index_cursor         = NULL;
+
+		/* The internal_index reference is freed elsewhere
+		 */
+		if( libesedb_page_tree_cursor_free(
+		     &( internal_index_cursor->page_tree_cursor ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page tree cursor.",
+			 function );
+
+			result = -1;
+		}
+		if( libesedb_data_definition_free(
+		     &( internal_index_cursor->data_definition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data definition.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_index_cursor->range_start_key != NULL )
+		{
+			if( libesedb_key_free(
+			     &( internal_index_cursor->range_start_key ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free range start key.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_index_cursor->range_end_key != NULL )
+		{
+			if( libesedb_key_free(
+			     &( internal_index_cursor->range_end_key ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free range end key.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 internal_index_cursor );
+	}
+	return( result );
+}
+
+/* Retrieves the next record
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libesedb_index_cursor_next(
+     libesedb_index_cursor_t *index_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index               = NULL;
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor           = NULL;
+	static char *function                                   = "libesedb_index_cursor_next";
+	uint32_t saved_page_number                              = 0;
+	uint16_t saved_number_of_page_values                    = 0;
+	uint16_t saved_page_value_index                         = 0;
+	int result                                              = 0;
+
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_cursor = (libesedb_internal_index_cursor_t *) index_cursor;
+
+	if( internal_index_cursor->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index cursor - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = internal_index_cursor->internal_index;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	page_tree_cursor = internal_index_cursor->page_tree_cursor;
+
+	saved_page_number           = page_tree_cursor->page_number;
+	saved_number_of_page_values = page_tree_cursor->number_of_page_values;
+	saved_page_value_index      = page_tree_cursor->page_value_index;
+
+	result = libesedb_page_tree_cursor_get_next_leaf_value(
+	          page_tree_cursor,
+	          internal_index->file_io_handle,
+	          internal_index_cursor->data_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next leaf value from page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = libesedb_index_cursor_is_within_range(
+	          internal_index_cursor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine if next leaf value is within range.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		/* Keep the cursor at the bound of the range
+		 */
+		page_tree_cursor->page_number           = saved_page_number;
+		page_tree_cursor->number_of_page_values = saved_number_of_page_values;
+		page_tree_cursor->page_value_index      = saved_page_value_index;
+
+		return( 0 );
+	}
+	if( libesedb_index_get_record_by_index_value(
+	     internal_index,
+	     internal_index_cursor->data_definition,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record by index value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the previous record
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libesedb_index_cursor_previous(
+     libesedb_index_cursor_t *index_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index               = NULL;
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor           = NULL;
+	static char *function                                   = "libesedb_index_cursor_previous";
+	uint32_t saved_page_number                              = 0;
+	uint16_t saved_number_of_page_values                    = 0;
+	uint16_t saved_page_value_index                         = 0;
+	int result                                              = 0;
+
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_cursor = (libesedb_internal_index_cursor_t *) index_cursor;
+
+	if( internal_index_cursor->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index cursor - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = internal_index_cursor->internal_index;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	page_tree_cursor = internal_index_cursor->page_tree_cursor;
+
+	saved_page_number           = page_tree_cursor->page_number;
+	saved_number_of_page_values = page_tree_cursor->number_of_page_values;
+	saved_page_value_index      = page_tree_cursor->page_value_index;
+
+	result = libesedb_page_tree_cursor_get_previous_leaf_value(
+	          page_tree_cursor,
+	          internal_index->file_io_handle,
+	          internal_index_cursor->data_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve previous leaf value from page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = libesedb_index_cursor_is_within_range(
+	          internal_index_cursor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine if previous leaf value is within range.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		/* Keep the cursor at the bound of the range
+		 */
+		page_tree_cursor->page_number           = saved_page_number;
+		page_tree_cursor->number_of_page_values = saved_number_of_page_values;
+		page_tree_cursor->page_value_index      = saved_page_value_index;
+
+		return( 0 );
+	}
+	if( libesedb_index_get_record_by_index_value(
+	     internal_index,
+	     internal_index_cursor->data_definition,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record by index value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+
+/* Positions the index cursor by key
+ * The key data contains the (normalized) key of the index value
+ * If found the cursor is positioned so that the next record is the record of the matching index value,
+ * otherwise the cursor is not positioned
+ * Returns 1 if successful, 0 if no such index value or -1 on error
+ */
+int libesedb_index_cursor_seek(
+     libesedb_index_cursor_t *index_cursor,
+     const uint8_t *key_data,
+     size_t key_size,
+     int comparison_operator,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	libesedb_key_t *key                                     = NULL;
+	static char *function                                   = "libesedb_index_cursor_seek";
+	int result                                              = 0;
+
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_cursor = (libesedb_internal_index_cursor_t *) index_cursor;
+
+	if( internal_index_cursor->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index cursor - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_size == 0 )
+	 || ( key_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_key_initialize(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_set_data(
+	     key,
+	     key_data,
+	     key_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key data.",
+		 function );
+
+		goto on_error;
+	}
+	key->type = LIBESEDB_KEY_TYPE_SEEK_VALUE;
+
+	result = libesedb_page_tree_cursor_seek_leaf_value(
+	          internal_index_cursor->page_tree_cursor,
+	          internal_index_cursor->internal_index->file_io_handle,
+	          key,
+	          comparison_operator,
+	          internal_index_cursor->data_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek leaf value in page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_free(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free key.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Restricts the index cursor to a range of index values
+ * The key data contains the (normalized) key of the index value, where start key data of NULL
+ * starts the range at the first index value and end key data of NULL ends it at the last.
+ * The start comparison operator can be LIBESEDB_COMPARISON_OPERATOR_GREATER or
+ * LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL and the end comparison operator
+ * LIBESEDB_COMPARISON_OPERATOR_LESS or LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL
+ * The cursor is positioned before the first index value of the range
+ * Returns 1 if successful, 0 if the range contains no index values or -1 on error
+ */
+int libesedb_index_cursor_set_range(
+     libesedb_index_cursor_t *index_cursor,
+     const uint8_t *start_key_data,
+     size_t start_key_size,
+     int start_comparison_operator,
+     const uint8_t *end_key_data,
+     size_t end_key_size,
+     int end_comparison_operator,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor           = NULL;
+	static char *function                                   = "libesedb_index_cursor_set_range";
+	uint32_t saved_page_number                              = 0;
+	uint16_t saved_number_of_page_values                    = 0;
+	uint16_t saved_page_value_index                         = 0;
+	int result                                              = 0;
+
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_cursor = (libesedb_internal_index_cursor_t *) index_cursor;
+
+	if( internal_index_cursor->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index cursor - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_key_data != NULL )
+	{
+		if( ( start_key_size == 0 )
+		 || ( start_key_size > (size_t) SSIZE_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid start key size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( start_comparison_operator != LIBESEDB_COMPARISON_OPERATOR_GREATER )
+		 && ( start_comparison_operator != LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported start comparison operator.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( end_key_data != NULL )
+	{
+		if( ( end_key_size == 0 )
+		 || ( end_key_size > (size_t) SSIZE_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid end key size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( end_comparison_operator != LIBESEDB_COMPARISON_OPERATOR_LESS )
+		 && ( end_comparison_operator != LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported end comparison operator.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	page_tree_cursor = internal_index_cursor->page_tree_cursor;
+
+	if( internal_index_cursor->range_start_key != NULL )
+	{
+		if( libesedb_key_free(
+		     &( internal_index_cursor->range_start_key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free range start key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_index_cursor->range_end_key != NULL )
+	{
+		if( libesedb_key_free(
+		     &( internal_index_cursor->range_end_key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free range end key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( start_key_data != NULL )
+	{
+		if( libesedb_key_initialize(
+		     &( internal_index_cursor->range_start_key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create range start key.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_key_set_data(
+		     internal_index_cursor->range_start_key,
+		     start_key_data,
+		     start_key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set range start key data.",
+			 function );
+
+			goto on_error;
+		}
+		internal_index_cursor->range_start_key->type = LIBESEDB_KEY_TYPE_SEEK_VALUE;
+		internal_index_cursor->range_start_comparison_operator = start_comparison_operator;
+	}
+	if( end_key_data != NULL )
+	{
+		if( libesedb_key_initialize(
+		     &( internal_index_cursor->range_end_key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create range end key.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_key_set_data(
+		     internal_index_cursor->range_end_key,
+		     end_key_data,
+		     end_key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set range end key data.",
+			 function );
+
+			goto on_error;
+		}
+		internal_index_cursor->range_end_key->type = LIBESEDB_KEY_TYPE_SEEK_VALUE;
+		internal_index_cursor->range_end_comparison_operator = end_comparison_operator;
+	}
+	/* Without a start key the cursor is not positioned and descends to the first leaf page
+	 */
+	page_tree_cursor->page_number = 0;
+
+	if( internal_index_cursor->range_start_key != NULL )
+	{
+		result = libesedb_page_tree_cursor_seek_leaf_value(
+		          page_tree_cursor,
+		          internal_index_cursor->internal_index->file_io_handle,
+		          internal_index_cursor->range_start_key,
+		          internal_index_cursor->range_start_comparison_operator,
+		          internal_index_cursor->data_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to seek range start in page tree cursor.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	/* Determine if the first index value is within the range, this does not change the position of the cursor
+	 */
+	saved_page_number           = page_tree_cursor->page_number;
+	saved_number_of_page_values = page_tree_cursor->number_of_page_values;
+	saved_page_value_index      = page_tree_cursor->page_value_index;
+
+	result = libesedb_page_tree_cursor_get_next_leaf_value(
+	          page_tree_cursor,
+	          internal_index_cursor->internal_index->file_io_handle,
+	          internal_index_cursor->data_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first leaf value of range from page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		result = libesedb_index_cursor_is_within_range(
+		          internal_index_cursor,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if first leaf value is within range.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	page_tree_cursor->page_number           = saved_page_number;
+	page_tree_cursor->number_of_page_values = saved_number_of_page_values;
+	page_tree_cursor->page_value_index      = saved_page_value_index;
+
+	return( result );
+
+on_error:
+	if( internal_index_cursor->range_start_key != NULL )
+	{
+		libesedb_key_free(
+		 &( internal_index_cursor->range_start_key ),
+		 NULL );
+	}
+	if( internal_index_cursor->range_end_key != NULL )
+	{
+		libesedb_key_free(
+		 &( internal_index_cursor->range_end_key ),
+		 NULL );
+	}
+	page_tree_cursor->page_number = 0;
+
+	return( -1 );
+}
+
+/* Determines if the index value the cursor is positioned on is within the range
+ * Returns 1 if within the range, 0 if not or -1 on error
+ */
+int libesedb_index_cursor_is_within_range(
+     libesedb_internal_index_cursor_t *internal_index_cursor,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_cursor_is_within_range";
+	int compare_result    = 0;
+
+	if( internal_index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index_cursor->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index cursor - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index_cursor->range_start_key != NULL )
+	{
+		if( libesedb_page_tree_cursor_compare_leaf_value_key(
+		     internal_index_cursor->page_tree_cursor,
+		     internal_index_cursor->internal_index->file_io_handle,
+		     internal_index_cursor->range_start_key,
+		     &compare_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare range start key with key of leaf value.",
+			 function );
+
+			return( -1 );
+		}
+		if( compare_result == LIBFDATA_COMPARE_GREATER )
+		{
+			return( 0 );
+		}
+		if( ( compare_result == LIBFDATA_COMPARE_EQUAL )
+		 && ( internal_index_cursor->range_start_comparison_operator == LIBESEDB_COMPARISON_OPERATOR_GREATER ) )
+		{
+			return( 0 );
+		}
+	}
+	if( internal_index_cursor->range_end_key != NULL )
+	{
+		if( libesedb_page_tree_cursor_compare_leaf_value_key(
+		     internal_index_cursor->page_tree_cursor,
+		     internal_index_cursor->internal_index->file_io_handle,
+		     internal_index_cursor->range_end_key,
+		     &compare_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare range end key with key of leaf value.",
+			 function );
+
+			return( -1 );
+		}
+		if( compare_result == LIBFDATA_COMPARE_LESS )
+		{
+			return( 0 );
+		}
+		if( ( compare_result == LIBFDATA_COMPARE_EQUAL )
+		 && ( internal_index_cursor->range_end_comparison_operator == LIBESEDB_COMPARISON_OPERATOR_LESS ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
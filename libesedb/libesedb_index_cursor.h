@@ -0,0 +1,124 @@
+/*
+ * Index cursor functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_INDEX_CURSOR_H )
+#define _LIBESEDB_INDEX_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_extern.h"
+#include "libesedb_key.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_page_tree_cursor.h"
+#include "libesedb_index.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_internal_index_cursor libesedb_internal_index_cursor_t;
+
+struct libesedb_internal_index_cursor
+{
+	/* The index
+	 */
+	libesedb_internal_index_t *internal_index;
+
+	/* The page tree cursor
+	 */
+	libesedb_page_tree_cursor_t *page_tree_cursor;
+
+	/* The data definition of the current index value
+	 */
+	libesedb_data_definition_t *data_definition;
+
+	/* The range start key
+	 * NULL if the range starts at the first index value
+	 */
+	libesedb_key_t *range_start_key;
+
+	/* The range start comparison operator
+	 */
+	int range_start_comparison_operator;
+
+	/* The range end key
+	 * NULL if the range ends at the last index value
+	 */
+	libesedb_key_t *range_end_key;
+
+	/* The range end comparison operator
+	 */
+	int range_end_comparison_operator;
+};
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_open(
+     libesedb_index_t *index,
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_close(
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_next(
+     libesedb_index_cursor_t *index_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_previous(
+     libesedb_index_cursor_t *index_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+int libesedb_index_cursor_seek(
+     libesedb_index_cursor_t *index_cursor,
+     const uint8_t *key_data,
+     size_t key_size,
+     int comparison_operator,
+     libcerror_error_t **error );
+
+int libesedb_index_cursor_set_range(
+     libesedb_index_cursor_t *index_cursor,
+     const uint8_t *start_key_data,
+     size_t start_key_size,
+     int start_comparison_operator,
+     const uint8_t *end_key_data,
+     size_t end_key_size,
+     int end_comparison_operator,
+     libcerror_error_t **error );
+
+int libesedb_index_cursor_is_within_range(
+     libesedb_internal_index_cursor_t *internal_index_cursor,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_INDEX_CURSOR_H ) */
+
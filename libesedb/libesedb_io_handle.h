@@ -27,6 +27,7 @@
 
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 
 #if defined( __cplusplus )
@@ -75,6 +76,12 @@ struct libesedb_io_handle
 	 */
 	uint32_t last_page_number;
 
+	/* The branch pages cache (reference)
+	 * Non-leaf pages are kept separate from the pages caches
+	 * so that scans of leaf pages do not evict them
+	 */
+	libfcache_cache_t *branch_pages_cache;
+
 	/* The codepage of the ASCII strings
 	 */
 	int ascii_codepage;
@@ -285,7 +285,7 @@ int libesedb_key_append_data(
 
 		return( -1 );
 	}
-	if( data_size > key->data_size )
+	if( data_size > 0 )
 	{
 		reallocation = memory_reallocate(
 		                key->data,
@@ -338,7 +338,6 @@ int libesedb_key_compare(
 	size_t second_key_data_index = 0;
 	int16_t compare_result       = -1;
 	uint8_t first_key_data       = 0;
-	uint8_t is_flexible_match    = 0;
 	int result                   = -1;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -424,6 +423,11 @@ int libesedb_key_compare(
 				 "long value segment" );
 				break;
 
+			case LIBESEDB_KEY_TYPE_SEEK_VALUE:
+				libcnotify_printf(
+				 "seek value" );
+				break;
+
 			default:
 				libcnotify_printf(
 				 "invalid" );
@@ -502,9 +506,6 @@ int libesedb_key_compare(
 		{
 			compare_data_size = second_key->data_size;
 		}
-/* TODO remove is_flexible_match test */
-		is_flexible_match = 0;
-
 		/* The long value key is stored reversed
 		 */
 		if( first_key->type == LIBESEDB_KEY_TYPE_LONG_VALUE )
@@ -521,6 +522,9 @@ int libesedb_key_compare(
 		{
 			first_key_data = first_key->data[ first_key_data_index ];
 
+			/* An index value key matches a leaf key of which the second byte
+			 * only differs in the high bit, a seek value key is matched exactly
+			 */
 			if( ( first_key->type == LIBESEDB_KEY_TYPE_INDEX_VALUE )
 			 && ( second_key->type == LIBESEDB_KEY_TYPE_LEAF ) )
 			{
@@ -530,8 +534,6 @@ int libesedb_key_compare(
 				 && ( ( first_key_data & 0x7f ) == second_key->data[ second_key_data_index ] ) )
 				{
 					first_key_data &= 0x7f;
-
-					is_flexible_match = 1;
 				}
 			}
 			compare_result = (int16_t) first_key_data - (int16_t) second_key->data[ second_key_data_index ];
@@ -556,7 +558,8 @@ int libesedb_key_compare(
 	}
 	else if( second_key->type == LIBESEDB_KEY_TYPE_BRANCH )
 	{
-		if( first_key->type == LIBESEDB_KEY_TYPE_INDEX_VALUE )
+		if( ( first_key->type == LIBESEDB_KEY_TYPE_INDEX_VALUE )
+		 || ( first_key->type == LIBESEDB_KEY_TYPE_SEEK_VALUE ) )
 		{
 			/* If the key exactly matches the branch key,
 			 * the leaf value is in the next branch node
@@ -594,16 +597,6 @@ int libesedb_key_compare(
 	}
 	else if( second_key->type == LIBESEDB_KEY_TYPE_LEAF )
 	{
-		if( is_flexible_match != 0 )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-/* TODO remove this after debugging */
-fprintf( stderr, "MARKER\n" );
-	}
-#endif
-		}
 		if( compare_result < 0 )
 		{
 			result = LIBFDATA_COMPARE_LESS;
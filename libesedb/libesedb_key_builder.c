@@ -0,0 +1,1695 @@
+/*
+ * Key builder functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_index.h"
+#include "libesedb_key_builder.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libuna.h"
+#include "libesedb_table_definition.h"
+#include "libesedb_types.h"
+
+/* Creates a key builder
+ * The key builder creates normalized keys of the index, one key segment (column) at a time,
+ * that can be used to seek the index or, for the primary index, to retrieve a record by key
+ * Make sure the value key_builder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_initialize(
+     libesedb_key_builder_t **key_builder,
+     libesedb_index_t *index,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index             = NULL;
+	libesedb_internal_key_builder_t *internal_key_builder = NULL;
+	static char *function                                 = "libesedb_key_builder_initialize";
+
+	if( key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_builder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key builder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+	if( internal_index->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_builder = memory_allocate_structure(
+	                        libesedb_internal_key_builder_t );
+
+	if( internal_key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key builder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_key_builder,
+	     0,
+	     sizeof( libesedb_internal_key_builder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key builder.",
+		 function );
+
+		memory_free(
+		 internal_key_builder );
+
+		return( -1 );
+	}
+	internal_key_builder->ascii_codepage = internal_index->io_handle->ascii_codepage;
+
+	if( libesedb_key_builder_read_segments(
+	     internal_key_builder,
+	     internal_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read key segments.",
+		 function );
+
+		goto on_error;
+	}
+	*key_builder = (libesedb_key_builder_t *) internal_key_builder;
+
+	return( 1 );
+
+on_error:
+	if( internal_key_builder != NULL )
+	{
+		if( internal_key_builder->segment_flags != NULL )
+		{
+			memory_free(
+			 internal_key_builder->segment_flags );
+		}
+		if( internal_key_builder->segment_column_catalog_definitions != NULL )
+		{
+			memory_free(
+			 internal_key_builder->segment_column_catalog_definitions );
+		}
+		memory_free(
+		 internal_key_builder );
+	}
+	return( -1 );
+}
+
+/* Frees a key builder
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_free(
+     libesedb_key_builder_t **key_builder,
+     libcerror_error_t **error )
+{
+	libesedb_internal_key_builder_t *internal_key_builder = NULL;
+	static char *function                                 = "libesedb_key_builder_free";
+
+	if( key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_builder != NULL )
+	{
+		internal_key_builder = (libesedb_internal_key_builder_t *) *key_builder;
+		*key_builder         = NULL;
+
+		/* The column catalog definitions are referenced and freed elsewhere
+		 */
+		if( internal_key_builder->segment_column_catalog_definitions != NULL )
+		{
+			memory_free(
+			 internal_key_builder->segment_column_catalog_definitions );
+		}
+		if( internal_key_builder->segment_flags != NULL )
+		{
+			memory_free(
+			 internal_key_builder->segment_flags );
+		}
+		if( internal_key_builder->key_data != NULL )
+		{
+			memory_free(
+			 internal_key_builder->key_data );
+		}
+		memory_free(
+		 internal_key_builder );
+	}
+	return( 1 );
+}
+
+/* Reads the key segments from the key field identifiers (KeyFldIDs) of the index
+ * Before format revision 7 a key segment is a 16-bit signed column identifier,
+ * which is negative for a descending segment. From format revision 7 a key segment (IDXSEG)
+ * is 4 bytes: 16-bit flags followed by a 16-bit column identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_read_segments(
+     libesedb_internal_key_builder_t *internal_key_builder,
+     libesedb_internal_index_t *internal_index,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_catalog_definition_t *index_catalog_definition  = NULL;
+	libesedb_table_definition_t *table_definition            = NULL;
+	static char *function                                    = "libesedb_key_builder_read_segments";
+	size_t key_field_identifiers_offset                      = 0;
+	size_t key_segment_size                                  = 0;
+	uint16_t column_identifier                               = 0;
+	uint16_t segment_flags                                   = 0;
+	int result                                               = 0;
+	int segment_index                                        = 0;
+
+	if( internal_key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_key_builder->segment_column_catalog_definitions != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key builder - segment column catalog definitions value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	index_catalog_definition = internal_index->index_catalog_definition;
+
+	if( index_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing index catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( index_catalog_definition->key_field_identifiers == NULL )
+	 || ( index_catalog_definition->key_field_identifiers_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index catalog definition - missing key field identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_index->io_handle->format_version == 0x620 )
+	 && ( internal_index->io_handle->format_revision < LIBESEDB_FORMAT_REVISION_4BYTE_KEY_SEGMENT ) )
+	{
+		key_segment_size = 2;
+	}
+	else
+	{
+		key_segment_size = 4;
+	}
+	if( ( index_catalog_definition->key_field_identifiers_size % key_segment_size ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported key field identifiers size: %" PRIzd ".",
+		 function,
+		 index_catalog_definition->key_field_identifiers_size );
+
+		return( -1 );
+	}
+	internal_key_builder->number_of_segments = (int) ( index_catalog_definition->key_field_identifiers_size / key_segment_size );
+
+	internal_key_builder->segment_column_catalog_definitions = (libesedb_catalog_definition_t **) memory_allocate(
+	                                                            sizeof( libesedb_catalog_definition_t * ) * internal_key_builder->number_of_segments );
+
+	if( internal_key_builder->segment_column_catalog_definitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment column catalog definitions.",
+		 function );
+
+		goto on_error;
+	}
+	internal_key_builder->segment_flags = (uint8_t *) memory_allocate(
+	                                       sizeof( uint8_t ) * internal_key_builder->number_of_segments );
+
+	if( internal_key_builder->segment_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment flags.",
+		 function );
+
+		goto on_error;
+	}
+	for( segment_index = 0;
+	     segment_index < internal_key_builder->number_of_segments;
+	     segment_index++ )
+	{
+		if( key_segment_size == 2 )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( index_catalog_definition->key_field_identifiers[ key_field_identifiers_offset ] ),
+			 column_identifier );
+
+			segment_flags = 0;
+
+			if( ( column_identifier & 0x8000 ) != 0 )
+			{
+				column_identifier = (uint16_t) ( 0x10000 - column_identifier );
+				segment_flags     = LIBESEDB_KEY_SEGMENT_FLAG_DESCENDING;
+			}
+		}
+		else
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( index_catalog_definition->key_field_identifiers[ key_field_identifiers_offset ] ),
+			 segment_flags );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 &( index_catalog_definition->key_field_identifiers[ key_field_identifiers_offset + 2 ] ),
+			 column_identifier );
+		}
+		key_field_identifiers_offset += key_segment_size;
+
+		if( ( ( segment_flags & LIBESEDB_KEY_SEGMENT_FLAG_TEMPLATE_COLUMN ) != 0 )
+		 && ( internal_index->template_table_definition != NULL ) )
+		{
+			table_definition = internal_index->template_table_definition;
+		}
+		else
+		{
+			table_definition = internal_index->table_definition;
+		}
+		result = libesedb_table_definition_get_column_catalog_definition_by_identifier(
+		          table_definition,
+		          (uint32_t) column_identifier,
+		          &column_catalog_definition,
+		          error );
+
+		if( ( result == 0 )
+		 && ( internal_index->template_table_definition != NULL )
+		 && ( table_definition != internal_index->template_table_definition ) )
+		{
+			result = libesedb_table_definition_get_column_catalog_definition_by_identifier(
+			          internal_index->template_table_definition,
+			          (uint32_t) column_identifier,
+			          &column_catalog_definition,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition: %" PRIu16 " of key segment: %d.",
+			 function,
+			 column_identifier,
+			 segment_index );
+
+			goto on_error;
+		}
+		internal_key_builder->segment_column_catalog_definitions[ segment_index ] = column_catalog_definition;
+		internal_key_builder->segment_flags[ segment_index ]                      = (uint8_t) ( segment_flags & LIBESEDB_KEY_SEGMENT_FLAG_DESCENDING );
+	}
+	return( 1 );
+
+on_error:
+	if( internal_key_builder->segment_flags != NULL )
+	{
+		memory_free(
+		 internal_key_builder->segment_flags );
+
+		internal_key_builder->segment_flags = NULL;
+	}
+	if( internal_key_builder->segment_column_catalog_definitions != NULL )
+	{
+		memory_free(
+		 internal_key_builder->segment_column_catalog_definitions );
+
+		internal_key_builder->segment_column_catalog_definitions = NULL;
+	}
+	internal_key_builder->number_of_segments = 0;
+
+	return( -1 );
+}
+
+/* Clears the key builder so that a new key can be built
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_clear(
+     libesedb_key_builder_t *key_builder,
+     libcerror_error_t **error )
+{
+	libesedb_internal_key_builder_t *internal_key_builder = NULL;
+	static char *function                                 = "libesedb_key_builder_clear";
+
+	if( key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_builder = (libesedb_internal_key_builder_t *) key_builder;
+
+	internal_key_builder->segment_index = 0;
+	internal_key_builder->key_size      = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the number of key segments
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_get_number_of_segments(
+     libesedb_key_builder_t *key_builder,
+     int *number_of_segments,
+     libcerror_error_t **error )
+{
+	libesedb_internal_key_builder_t *internal_key_builder = NULL;
+	static char *function                                 = "libesedb_key_builder_get_number_of_segments";
+
+	if( key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_builder = (libesedb_internal_key_builder_t *) key_builder;
+
+	if( number_of_segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_segments = internal_key_builder->number_of_segments;
+
+	return( 1 );
+}
+
+/* Retrieves the column catalog definition of the next key segment
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_get_next_segment(
+     libesedb_internal_key_builder_t *internal_key_builder,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_key_builder_get_next_segment";
+
+	if( internal_key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_key_builder->segment_column_catalog_definitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key builder - missing segment column catalog definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_key_builder->segment_index >= internal_key_builder->number_of_segments )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key builder - all %d key segments have been appended.",
+		 function,
+		 internal_key_builder->number_of_segments );
+
+		return( -1 );
+	}
+	*column_catalog_definition = internal_key_builder->segment_column_catalog_definitions[ internal_key_builder->segment_index ];
+
+	return( 1 );
+}
+
+/* Appends normalized key segment data
+ * The segment is stored as a prefix byte followed by the segment data, where the bits
+ * of both the prefix and the data are inverted when the segment is descending
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_append_segment_data(
+     libesedb_internal_key_builder_t *internal_key_builder,
+     uint8_t prefix,
+     const uint8_t *segment_data,
+     size_t segment_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *key_data     = NULL;
+	static char *function = "libesedb_key_builder_append_segment_data";
+	size_t key_data_size  = 0;
+	size_t key_offset     = 0;
+
+	if( internal_key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_key_builder->segment_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key builder - missing segment flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_key_builder->segment_index < 0 )
+	 || ( internal_key_builder->segment_index >= internal_key_builder->number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key builder - segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_data == NULL )
+	 && ( segment_data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_size > (size_t) ( SSIZE_MAX - internal_key_builder->key_size - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	key_data_size = internal_key_builder->key_size + 1 + segment_data_size;
+
+	if( key_data_size > internal_key_builder->key_data_size )
+	{
+		key_data = (uint8_t *) memory_reallocate(
+		                        internal_key_builder->key_data,
+		                        sizeof( uint8_t ) * key_data_size );
+
+		if( key_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize key data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_key_builder->key_data      = key_data;
+		internal_key_builder->key_data_size = key_data_size;
+	}
+	key_offset = internal_key_builder->key_size;
+
+	internal_key_builder->key_data[ key_offset ] = prefix;
+
+	if( segment_data_size > 0 )
+	{
+		if( memory_copy(
+		     &( internal_key_builder->key_data[ key_offset + 1 ] ),
+		     segment_data,
+		     segment_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy segment data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( internal_key_builder->segment_flags[ internal_key_builder->segment_index ] & LIBESEDB_KEY_SEGMENT_FLAG_DESCENDING ) != 0 )
+	{
+		while( key_offset < key_data_size )
+		{
+			internal_key_builder->key_data[ key_offset ] ^= 0xff;
+
+			key_offset++;
+		}
+	}
+	internal_key_builder->key_size = key_data_size;
+
+	internal_key_builder->segment_index += 1;
+
+	return( 1 );
+}
+
+/* Appends a NULL value key segment
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_append_null(
+     libesedb_key_builder_t *key_builder,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_key_builder_t *internal_key_builder    = NULL;
+	static char *function                                    = "libesedb_key_builder_append_null";
+
+	if( key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_builder = (libesedb_internal_key_builder_t *) key_builder;
+
+	if( libesedb_key_builder_get_next_segment(
+	     internal_key_builder,
+	     &column_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next key segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_key_builder_append_segment_data(
+	     internal_key_builder,
+	     LIBESEDB_KEY_SEGMENT_PREFIX_NULL,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key segment data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a boolean value key segment
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_append_boolean(
+     libesedb_key_builder_t *key_builder,
+     uint8_t value_boolean,
+     libcerror_error_t **error )
+{
+	uint8_t segment_data[ 1 ];
+
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_key_builder_t *internal_key_builder    = NULL;
+	static char *function                                    = "libesedb_key_builder_append_boolean";
+
+	if( key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_builder = (libesedb_internal_key_builder_t *) key_builder;
+
+	if( libesedb_key_builder_get_next_segment(
+	     internal_key_builder,
+	     &column_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next key segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition->column_type != LIBESEDB_COLUMN_TYPE_BOOLEAN )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 ".",
+		 function,
+		 column_catalog_definition->column_type );
+
+		return( -1 );
+	}
+	if( value_boolean == 0 )
+	{
+		segment_data[ 0 ] = 0x00;
+	}
+	else
+	{
+		segment_data[ 0 ] = 0xff;
+	}
+	if( libesedb_key_builder_append_segment_data(
+	     internal_key_builder,
+	     LIBESEDB_KEY_SEGMENT_PREFIX_DATA,
+	     segment_data,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key segment data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a 8-bit, 16-bit or 32-bit integer value key segment
+ * The value is truncated to the size of the column type, signed values are stored
+ * in two's complement. The normalized value is stored in big-endian with
+ * the sign bit inverted for signed column types
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_append_integer_32bit(
+     libesedb_key_builder_t *key_builder,
+     uint32_t value_32bit,
+     libcerror_error_t **error )
+{
+	uint8_t segment_data[ 4 ];
+
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_key_builder_t *internal_key_builder    = NULL;
+	static char *function                                    = "libesedb_key_builder_append_integer_32bit";
+	size_t segment_data_size                                 = 0;
+
+	if( key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_builder = (libesedb_internal_key_builder_t *) key_builder;
+
+	if( libesedb_key_builder_get_next_segment(
+	     internal_key_builder,
+	     &column_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next key segment.",
+		 function );
+
+		return( -1 );
+	}
+	switch( column_catalog_definition->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			segment_data[ 0 ] = (uint8_t) value_32bit;
+
+			segment_data_size = 1;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			value_32bit ^= 0x00008000UL;
+
+			byte_stream_copy_from_uint16_big_endian(
+			 segment_data,
+			 (uint16_t) value_32bit );
+
+			segment_data_size = 2;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			byte_stream_copy_from_uint16_big_endian(
+			 segment_data,
+			 (uint16_t) value_32bit );
+
+			segment_data_size = 2;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			value_32bit ^= 0x80000000UL;
+
+			byte_stream_copy_from_uint32_big_endian(
+			 segment_data,
+			 value_32bit );
+
+			segment_data_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			byte_stream_copy_from_uint32_big_endian(
+			 segment_data,
+			 value_32bit );
+
+			segment_data_size = 4;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column type: %" PRIu32 ".",
+			 function,
+			 column_catalog_definition->column_type );
+
+			return( -1 );
+	}
+	if( libesedb_key_builder_append_segment_data(
+	     internal_key_builder,
+	     LIBESEDB_KEY_SEGMENT_PREFIX_DATA,
+	     segment_data,
+	     segment_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key segment data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a 64-bit integer value key segment
+ * The normalized value is stored in big-endian with the sign bit inverted
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_append_integer_64bit(
+     libesedb_key_builder_t *key_builder,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	uint8_t segment_data[ 8 ];
+
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_key_builder_t *internal_key_builder    = NULL;
+	static char *function                                    = "libesedb_key_builder_append_integer_64bit";
+
+	if( key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_builder = (libesedb_internal_key_builder_t *) key_builder;
+
+	if( libesedb_key_builder_get_next_segment(
+	     internal_key_builder,
+	     &column_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next key segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_catalog_definition->column_type != LIBESEDB_COLUMN_TYPE_CURRENCY )
+	 && ( column_catalog_definition->column_type != LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 ".",
+		 function,
+		 column_catalog_definition->column_type );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_big_endian(
+	 segment_data,
+	 value_64bit ^ 0x8000000000000000ULL );
+
+	if( libesedb_key_builder_append_segment_data(
+	     internal_key_builder,
+	     LIBESEDB_KEY_SEGMENT_PREFIX_DATA,
+	     segment_data,
+	     8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key segment data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a 64-bit FILETIME value key segment
+ * For a 64-bit integer column the value is normalized as a signed integer,
+ * for a date and time column the value is normalized as a floating-point value
+ * that is all bits are inverted for a negative value, otherwise the sign bit is set
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_append_filetime(
+     libesedb_key_builder_t *key_builder,
+     uint64_t value_filetime,
+     libcerror_error_t **error )
+{
+	uint8_t segment_data[ 8 ];
+
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_key_builder_t *internal_key_builder    = NULL;
+	static char *function                                    = "libesedb_key_builder_append_filetime";
+
+	if( key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_builder = (libesedb_internal_key_builder_t *) key_builder;
+
+	if( libesedb_key_builder_get_next_segment(
+	     internal_key_builder,
+	     &column_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next key segment.",
+		 function );
+
+		return( -1 );
+	}
+	switch( column_catalog_definition->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			if( ( value_filetime & 0x8000000000000000ULL ) != 0 )
+			{
+				value_filetime ^= 0xffffffffffffffffULL;
+			}
+			else
+			{
+				value_filetime |= 0x8000000000000000ULL;
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			value_filetime ^= 0x8000000000000000ULL;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column type: %" PRIu32 ".",
+			 function,
+			 column_catalog_definition->column_type );
+
+			return( -1 );
+	}
+	byte_stream_copy_from_uint64_big_endian(
+	 segment_data,
+	 value_filetime );
+
+	if( libesedb_key_builder_append_segment_data(
+	     internal_key_builder,
+	     LIBESEDB_KEY_SEGMENT_PREFIX_DATA,
+	     segment_data,
+	     8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key segment data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a GUID value key segment
+ * The GUID data is expected in the little-endian format as stored in a record.
+ * The normalized value is stored in the GUID sort order, that is bytes 10 - 15,
+ * 8 - 9, 6 - 7, 4 - 5 and 0 - 3
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_append_guid(
+     libesedb_key_builder_t *key_builder,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t segment_data[ 16 ];
+
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_key_builder_t *internal_key_builder    = NULL;
+	static char *function                                    = "libesedb_key_builder_append_guid";
+
+	if( key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_builder = (libesedb_internal_key_builder_t *) key_builder;
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_key_builder_get_next_segment(
+	     internal_key_builder,
+	     &column_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next key segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition->column_type != LIBESEDB_COLUMN_TYPE_GUID )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 ".",
+		 function,
+		 column_catalog_definition->column_type );
+
+		return( -1 );
+	}
+	segment_data[ 0 ]  = guid_data[ 10 ];
+	segment_data[ 1 ]  = guid_data[ 11 ];
+	segment_data[ 2 ]  = guid_data[ 12 ];
+	segment_data[ 3 ]  = guid_data[ 13 ];
+	segment_data[ 4 ]  = guid_data[ 14 ];
+	segment_data[ 5 ]  = guid_data[ 15 ];
+	segment_data[ 6 ]  = guid_data[ 8 ];
+	segment_data[ 7 ]  = guid_data[ 9 ];
+	segment_data[ 8 ]  = guid_data[ 6 ];
+	segment_data[ 9 ]  = guid_data[ 7 ];
+	segment_data[ 10 ] = guid_data[ 4 ];
+	segment_data[ 11 ] = guid_data[ 5 ];
+	segment_data[ 12 ] = guid_data[ 0 ];
+	segment_data[ 13 ] = guid_data[ 1 ];
+	segment_data[ 14 ] = guid_data[ 2 ];
+	segment_data[ 15 ] = guid_data[ 3 ];
+
+	if( libesedb_key_builder_append_segment_data(
+	     internal_key_builder,
+	     LIBESEDB_KEY_SEGMENT_PREFIX_DATA,
+	     segment_data,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key segment data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an UTF-8 string value key segment
+ * Only text columns that use an ASCII codepage are supported, the string is converted
+ * to the codepage and the characters a - z are normalized to upper case. Unicode text
+ * columns are normalized using the Windows sort key (LCMapString) of the locale of
+ * the index, use libesedb_key_builder_append_normalized_data for these
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_append_utf8_string(
+     libesedb_key_builder_t *key_builder,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_key_builder_t *internal_key_builder    = NULL;
+	uint8_t *segment_data                                    = NULL;
+	static char *function                                    = "libesedb_key_builder_append_utf8_string";
+	size_t segment_data_index                                = 0;
+	size_t segment_data_size                                 = 0;
+	int codepage                                             = 0;
+
+	if( key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_builder = (libesedb_internal_key_builder_t *) key_builder;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_key_builder_get_next_segment(
+	     internal_key_builder,
+	     &column_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next key segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_catalog_definition->column_type != LIBESEDB_COLUMN_TYPE_TEXT )
+	 && ( column_catalog_definition->column_type != LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 ".",
+		 function,
+		 column_catalog_definition->column_type );
+
+		return( -1 );
+	}
+	codepage = (int) column_catalog_definition->codepage;
+
+	if( codepage == 1200 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported Unicode text column, use normalized data instead.",
+		 function );
+
+		return( -1 );
+	}
+	if( codepage == 0 )
+	{
+		codepage = internal_key_builder->ascii_codepage;
+	}
+	if( utf8_string_length == 0 )
+	{
+		if( libesedb_key_builder_append_segment_data(
+		     internal_key_builder,
+		     LIBESEDB_KEY_SEGMENT_PREFIX_ZERO_SIZE,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append key segment data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libuna_byte_stream_size_from_utf8(
+	     (libuna_utf8_character_t *) utf8_string,
+	     utf8_string_length,
+	     codepage,
+	     &segment_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine size of codepage string.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( segment_data_size == 0 )
+	 || ( segment_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid codepage string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	segment_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * segment_data_size );
+
+	if( segment_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create codepage string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_byte_stream_copy_from_utf8(
+	     segment_data,
+	     segment_data_size,
+	     codepage,
+	     (libuna_utf8_character_t *) utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to copy codepage string.",
+		 function );
+
+		goto on_error;
+	}
+	for( segment_data_index = 0;
+	     segment_data_index < segment_data_size;
+	     segment_data_index++ )
+	{
+		if( ( segment_data[ segment_data_index ] >= (uint8_t) 'a' )
+		 && ( segment_data[ segment_data_index ] <= (uint8_t) 'z' ) )
+		{
+			segment_data[ segment_data_index ] -= (uint8_t) 'a' - (uint8_t) 'A';
+		}
+	}
+	if( libesedb_key_builder_append_segment_data(
+	     internal_key_builder,
+	     LIBESEDB_KEY_SEGMENT_PREFIX_DATA,
+	     segment_data,
+	     segment_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key segment data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 segment_data );
+
+	return( 1 );
+
+on_error:
+	if( segment_data != NULL )
+	{
+		memory_free(
+		 segment_data );
+	}
+	return( -1 );
+}
+
+/* Appends normalized data as a key segment
+ * The data is expected to contain the normalized value without the segment prefix,
+ * for example the Windows sort key (LCMapString) of a Unicode text value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_append_normalized_data(
+     libesedb_key_builder_t *key_builder,
+     const uint8_t *normalized_data,
+     size_t normalized_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_key_builder_t *internal_key_builder    = NULL;
+	static char *function                                    = "libesedb_key_builder_append_normalized_data";
+	uint8_t prefix                                           = LIBESEDB_KEY_SEGMENT_PREFIX_DATA;
+
+	if( key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_builder = (libesedb_internal_key_builder_t *) key_builder;
+
+	if( normalized_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid normalized data.",
+		 function );
+
+		return( -1 );
+	}
+	if( normalized_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid normalized data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_key_builder_get_next_segment(
+	     internal_key_builder,
+	     &column_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next key segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( normalized_data_size == 0 )
+	{
+		prefix = LIBESEDB_KEY_SEGMENT_PREFIX_ZERO_SIZE;
+	}
+	if( libesedb_key_builder_append_segment_data(
+	     internal_key_builder,
+	     prefix,
+	     normalized_data,
+	     normalized_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key segment data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the key
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_get_key_size(
+     libesedb_key_builder_t *key_builder,
+     size_t *key_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_key_builder_t *internal_key_builder = NULL;
+	static char *function                                 = "libesedb_key_builder_get_key_size";
+
+	if( key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_builder = (libesedb_internal_key_builder_t *) key_builder;
+
+	if( key_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key size.",
+		 function );
+
+		return( -1 );
+	}
+	*key_size = internal_key_builder->key_size;
+
+	return( 1 );
+}
+
+/* Retrieves the key
+ * The key can contain fewer key segments than the index, in which case it can be used
+ * as a prefix key for a seek with a greater or equal comparison operator
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_key_builder_get_key(
+     libesedb_key_builder_t *key_builder,
+     uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_key_builder_t *internal_key_builder = NULL;
+	static char *function                                 = "libesedb_key_builder_get_key";
+
+	if( key_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_builder = (libesedb_internal_key_builder_t *) key_builder;
+
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size < internal_key_builder->key_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid key data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_key_builder->key_size > 0 )
+	{
+		if( memory_copy(
+		     key_data,
+		     internal_key_builder->key_data,
+		     internal_key_builder->key_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
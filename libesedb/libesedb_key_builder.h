@@ -0,0 +1,182 @@
+/*
+ * Key builder functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_KEY_BUILDER_H )
+#define _LIBESEDB_KEY_BUILDER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_extern.h"
+#include "libesedb_index.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_internal_key_builder libesedb_internal_key_builder_t;
+
+struct libesedb_internal_key_builder
+{
+	/* The ASCII codepage
+	 */
+	int ascii_codepage;
+
+	/* The number of key segments
+	 */
+	int number_of_segments;
+
+	/* The column catalog definitions of the key segments
+	 */
+	libesedb_catalog_definition_t **segment_column_catalog_definitions;
+
+	/* The key segment flags
+	 */
+	uint8_t *segment_flags;
+
+	/* The index of the next key segment
+	 */
+	int segment_index;
+
+	/* The key data
+	 */
+	uint8_t *key_data;
+
+	/* The key data size
+	 */
+	size_t key_data_size;
+
+	/* The key size
+	 */
+	size_t key_size;
+};
+
+LIBESEDB_EXTERN \
+int libesedb_key_builder_initialize(
+     libesedb_key_builder_t **key_builder,
+     libesedb_index_t *index,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_key_builder_free(
+     libesedb_key_builder_t **key_builder,
+     libcerror_error_t **error );
+
+int libesedb_key_builder_read_segments(
+     libesedb_internal_key_builder_t *internal_key_builder,
+     libesedb_internal_index_t *internal_index,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_key_builder_clear(
+     libesedb_key_builder_t *key_builder,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_key_builder_get_number_of_segments(
+     libesedb_key_builder_t *key_builder,
+     int *number_of_segments,
+     libcerror_error_t **error );
+
+int libesedb_key_builder_get_next_segment(
+     libesedb_internal_key_builder_t *internal_key_builder,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error );
+
+int libesedb_key_builder_append_segment_data(
+     libesedb_internal_key_builder_t *internal_key_builder,
+     uint8_t prefix,
+     const uint8_t *segment_data,
+     size_t segment_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_key_builder_append_null(
+     libesedb_key_builder_t *key_builder,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_key_builder_append_boolean(
+     libesedb_key_builder_t *key_builder,
+     uint8_t value_boolean,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_key_builder_append_integer_32bit(
+     libesedb_key_builder_t *key_builder,
+     uint32_t value_32bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_key_builder_append_integer_64bit(
+     libesedb_key_builder_t *key_builder,
+     uint64_t value_64bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_key_builder_append_filetime(
+     libesedb_key_builder_t *key_builder,
+     uint64_t value_filetime,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_key_builder_append_guid(
+     libesedb_key_builder_t *key_builder,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_key_builder_append_utf8_string(
+     libesedb_key_builder_t *key_builder,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_key_builder_append_normalized_data(
+     libesedb_key_builder_t *key_builder,
+     const uint8_t *normalized_data,
+     size_t normalized_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_key_builder_get_key_size(
+     libesedb_key_builder_t *key_builder,
+     size_t *key_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_key_builder_get_key(
+     libesedb_key_builder_t *key_builder,
+     uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_KEY_BUILDER_H ) */
+
@@ -0,0 +1,1156 @@
+/*
+ * Leaf counts functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_leaf_counts.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_page.h"
+#include "libesedb_page_tree_cursor.h"
+#include "libesedb_page_value.h"
+
+/* Creates leaf counts
+ * Make sure the value leaf_counts is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_leaf_counts_initialize(
+     libesedb_leaf_counts_t **leaf_counts,
+     uint32_t page_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_leaf_counts_initialize";
+
+	if( leaf_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( *leaf_counts != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid leaf counts value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*leaf_counts = memory_allocate_structure(
+	                libesedb_leaf_counts_t );
+
+	if( *leaf_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create leaf counts.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *leaf_counts,
+	     0,
+	     sizeof( libesedb_leaf_counts_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear leaf counts.",
+		 function );
+
+		goto on_error;
+	}
+	( *leaf_counts )->page_number = page_number;
+
+	return( 1 );
+
+on_error:
+	if( *leaf_counts != NULL )
+	{
+		memory_free(
+		 *leaf_counts );
+
+		*leaf_counts = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees leaf counts
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_leaf_counts_free(
+     libesedb_leaf_counts_t **leaf_counts,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_leaf_counts_free";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( leaf_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( *leaf_counts != NULL )
+	{
+		if( ( *leaf_counts )->child_leaf_counts != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *leaf_counts )->number_of_entries;
+			     entry_index++ )
+			{
+				if( ( *leaf_counts )->child_leaf_counts[ entry_index ] == NULL )
+				{
+					continue;
+				}
+				if( libesedb_leaf_counts_free(
+				     &( ( *leaf_counts )->child_leaf_counts[ entry_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free child leaf counts: %d.",
+					 function,
+					 entry_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *leaf_counts )->child_leaf_counts );
+		}
+		if( ( *leaf_counts )->cumulative_number_of_leaf_values != NULL )
+		{
+			memory_free(
+			 ( *leaf_counts )->cumulative_number_of_leaf_values );
+		}
+		if( ( *leaf_counts )->child_page_numbers != NULL )
+		{
+			memory_free(
+			 ( *leaf_counts )->child_page_numbers );
+		}
+		memory_free(
+		 *leaf_counts );
+
+		*leaf_counts = NULL;
+	}
+	return( result );
+}
+
+/* Reads the page of the leaf counts
+ * For a leaf page this determines the number of leaf values, for a branch page
+ * the child page numbers, of which the leaf values are counted on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_leaf_counts_read_page(
+     libesedb_leaf_counts_t *leaf_counts,
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page             = NULL;
+	libesedb_page_value_t *page_value = NULL;
+	static char *function             = "libesedb_leaf_counts_read_page";
+	uint32_t child_page_number        = 0;
+	uint32_t page_flags               = 0;
+	uint16_t number_of_page_values    = 0;
+	uint16_t page_value_index         = 0;
+	int result                        = 0;
+
+	if( leaf_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_counts->child_page_numbers != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid leaf counts - child page numbers value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_cursor_get_page(
+	     page_tree_cursor,
+	     file_io_handle,
+	     leaf_counts->page_number,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 leaf_counts->page_number );
+
+		goto on_error;
+	}
+	if( libesedb_page_get_flags(
+	     page,
+	     &page_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 " flags.",
+		 function,
+		 leaf_counts->page_number );
+
+		goto on_error;
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &number_of_page_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page: %" PRIu32 " values.",
+		 function,
+		 leaf_counts->page_number );
+
+		goto on_error;
+	}
+	leaf_counts->number_of_entries         = 0;
+	leaf_counts->number_of_counted_entries = 0;
+	leaf_counts->number_of_leaf_values     = 0;
+
+	if( ( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+	 || ( ( page_flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 ) )
+	{
+		leaf_counts->is_leaf_page = 1;
+
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+		{
+			return( 1 );
+		}
+		/* Page value 0 contains the common page key and is skipped
+		 */
+		for( page_value_index = 1;
+		     page_value_index < number_of_page_values;
+		     page_value_index++ )
+		{
+			if( libesedb_page_get_value_by_index(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( page_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) == 0 )
+			{
+				leaf_counts->number_of_leaf_values++;
+			}
+		}
+		return( 1 );
+	}
+	leaf_counts->is_leaf_page = 0;
+
+	if( number_of_page_values <= 1 )
+	{
+		return( 1 );
+	}
+	leaf_counts->child_page_numbers = (uint32_t *) memory_allocate(
+	                                                sizeof( uint32_t ) * ( number_of_page_values - 1 ) );
+
+	if( leaf_counts->child_page_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create child page numbers.",
+		 function );
+
+		goto on_error;
+	}
+	leaf_counts->cumulative_number_of_leaf_values = (int *) memory_allocate(
+	                                                         sizeof( int ) * ( number_of_page_values - 1 ) );
+
+	if( leaf_counts->cumulative_number_of_leaf_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cumulative number of leaf values.",
+		 function );
+
+		goto on_error;
+	}
+	leaf_counts->child_leaf_counts = (libesedb_leaf_counts_t **) memory_allocate(
+	                                                              sizeof( libesedb_leaf_counts_t * ) * ( number_of_page_values - 1 ) );
+
+	if( leaf_counts->child_leaf_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create child leaf counts.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     leaf_counts->child_leaf_counts,
+	     0,
+	     sizeof( libesedb_leaf_counts_t * ) * ( number_of_page_values - 1 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear child leaf counts.",
+		 function );
+
+		goto on_error;
+	}
+	/* Page value 0 contains the common page key and is skipped
+	 */
+	for( page_value_index = 1;
+	     page_value_index < number_of_page_values;
+	     page_value_index++ )
+	{
+		result = libesedb_page_tree_cursor_get_child_page_number(
+		          page_tree_cursor,
+		          page,
+		          page_value_index,
+		          &child_page_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve child page number: %" PRIu16 " from page: %" PRIu32 ".",
+			 function,
+			 page_value_index,
+			 leaf_counts->page_number );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			leaf_counts->child_page_numbers[ leaf_counts->number_of_entries ] = child_page_number;
+
+			leaf_counts->number_of_entries += 1;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( leaf_counts->child_leaf_counts != NULL )
+	{
+		memory_free(
+		 leaf_counts->child_leaf_counts );
+
+		leaf_counts->child_leaf_counts = NULL;
+	}
+	if( leaf_counts->cumulative_number_of_leaf_values != NULL )
+	{
+		memory_free(
+		 leaf_counts->cumulative_number_of_leaf_values );
+
+		leaf_counts->cumulative_number_of_leaf_values = NULL;
+	}
+	if( leaf_counts->child_page_numbers != NULL )
+	{
+		memory_free(
+		 leaf_counts->child_page_numbers );
+
+		leaf_counts->child_page_numbers = NULL;
+	}
+	leaf_counts->number_of_entries = 0;
+
+	return( -1 );
+}
+
+/* Determines the number of leaf values of the first entry that has not been counted
+ * Child leaf pages are counted using only their page header and page tags,
+ * child branch pages are counted recursively and their leaf counts are retained
+ * The header page is used to read the page headers
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_leaf_counts_count_next_entry(
+     libesedb_leaf_counts_t *leaf_counts,
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *header_page,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libesedb_leaf_counts_t *child_leaf_counts = NULL;
+	static char *function                     = "libesedb_leaf_counts_count_next_entry";
+	uint32_t child_page_number                = 0;
+	uint32_t page_flags                       = 0;
+	uint16_t number_of_page_values            = 0;
+	int entry_index                           = 0;
+	int number_of_leaf_values                 = 0;
+	int previous_number_of_leaf_values        = 0;
+
+	if( leaf_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( leaf_counts->child_page_numbers == NULL )
+	 || ( leaf_counts->child_leaf_counts == NULL )
+	 || ( leaf_counts->cumulative_number_of_leaf_values == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid leaf counts - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = leaf_counts->number_of_counted_entries;
+
+	if( ( entry_index < 0 )
+	 || ( entry_index >= leaf_counts->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid leaf counts - number of counted entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	child_page_number = leaf_counts->child_page_numbers[ entry_index ];
+
+	if( child_page_number == leaf_counts->page_number )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid child page number: %" PRIu32 " value out of bounds.",
+		 function,
+		 child_page_number );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_cursor_read_page_header(
+	     page_tree_cursor,
+	     file_io_handle,
+	     child_page_number,
+	     header_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page: %" PRIu32 " header.",
+		 function,
+		 child_page_number );
+
+		goto on_error;
+	}
+	if( libesedb_page_get_flags(
+	     header_page,
+	     &page_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 " flags.",
+		 function,
+		 child_page_number );
+
+		goto on_error;
+	}
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+	{
+		number_of_leaf_values = 0;
+	}
+	else if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+	{
+		if( libesedb_page_get_number_of_live_values_from_tags(
+		     header_page,
+		     page_tree_cursor->io_handle,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page: %" PRIu32 " values.",
+			 function,
+			 child_page_number );
+
+			goto on_error;
+		}
+		number_of_leaf_values = (int) number_of_page_values;
+	}
+	else
+	{
+		if( libesedb_leaf_counts_initialize(
+		     &child_leaf_counts,
+		     child_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create child leaf counts.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_leaf_counts_read_page(
+		     child_leaf_counts,
+		     page_tree_cursor,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read child page: %" PRIu32 ".",
+			 function,
+			 child_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_leaf_counts_get_number_of_leaf_values(
+		     child_leaf_counts,
+		     page_tree_cursor,
+		     file_io_handle,
+		     header_page,
+		     &number_of_leaf_values,
+		     recursion_depth + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of leaf values of child page: %" PRIu32 ".",
+			 function,
+			 child_page_number );
+
+			goto on_error;
+		}
+	}
+	if( entry_index > 0 )
+	{
+		previous_number_of_leaf_values = leaf_counts->cumulative_number_of_leaf_values[ entry_index - 1 ];
+	}
+	if( number_of_leaf_values > ( INT_MAX - previous_number_of_leaf_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of leaf values value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	leaf_counts->child_leaf_counts[ entry_index ]                = child_leaf_counts;
+	leaf_counts->cumulative_number_of_leaf_values[ entry_index ] = previous_number_of_leaf_values + number_of_leaf_values;
+
+	leaf_counts->number_of_counted_entries += 1;
+
+	return( 1 );
+
+on_error:
+	if( child_leaf_counts != NULL )
+	{
+		libesedb_leaf_counts_free(
+		 &child_leaf_counts,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of leaf values
+ * The leaf values of entries that have not been counted are counted
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_leaf_counts_get_number_of_leaf_values(
+     libesedb_leaf_counts_t *leaf_counts,
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *header_page,
+     int *number_of_leaf_values,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_leaf_counts_get_number_of_leaf_values";
+
+	if( leaf_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_counts->is_leaf_page != 0 )
+	{
+		*number_of_leaf_values = leaf_counts->number_of_leaf_values;
+
+		return( 1 );
+	}
+	while( leaf_counts->number_of_counted_entries < leaf_counts->number_of_entries )
+	{
+		if( libesedb_leaf_counts_count_next_entry(
+		     leaf_counts,
+		     page_tree_cursor,
+		     file_io_handle,
+		     header_page,
+		     recursion_depth,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to count leaf values of entry: %d.",
+			 function,
+			 leaf_counts->number_of_counted_entries );
+
+			return( -1 );
+		}
+	}
+	if( leaf_counts->number_of_entries == 0 )
+	{
+		*number_of_leaf_values = 0;
+	}
+	else
+	{
+		*number_of_leaf_values = leaf_counts->cumulative_number_of_leaf_values[ leaf_counts->number_of_entries - 1 ];
+	}
+	return( 1 );
+}
+
+/* Retrieves the entry that contains a specific leaf value of a branch page
+ * Entries are only counted up to the entry that contains the leaf value
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libesedb_leaf_counts_get_entry_by_leaf_value_index(
+     libesedb_leaf_counts_t *leaf_counts,
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *header_page,
+     int leaf_value_index,
+     int *entry_index,
+     int *entry_leaf_value_index,
+     libcerror_error_t **error )
+{
+	static char *function  = "libesedb_leaf_counts_get_entry_by_leaf_value_index";
+	int safe_entry_index   = 0;
+	int lower_entry_index  = 0;
+	int middle_entry_index = 0;
+	int upper_entry_index  = 0;
+
+	if( leaf_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_counts->is_leaf_page != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported leaf counts - not a branch page.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_value_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid leaf value index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_leaf_value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry leaf value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( leaf_counts->number_of_counted_entries > 0 )
+	 && ( leaf_counts->cumulative_number_of_leaf_values[ leaf_counts->number_of_counted_entries - 1 ] > leaf_value_index ) )
+	{
+		/* Search for the first counted entry of which the cumulative number of leaf values
+		 * exceeds the leaf value index
+		 */
+		lower_entry_index = 0;
+		upper_entry_index = leaf_counts->number_of_counted_entries - 1;
+
+		while( lower_entry_index < upper_entry_index )
+		{
+			middle_entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+			if( leaf_counts->cumulative_number_of_leaf_values[ middle_entry_index ] > leaf_value_index )
+			{
+				upper_entry_index = middle_entry_index;
+			}
+			else
+			{
+				lower_entry_index = middle_entry_index + 1;
+			}
+		}
+		safe_entry_index = lower_entry_index;
+	}
+	else
+	{
+		safe_entry_index = -1;
+
+		while( leaf_counts->number_of_counted_entries < leaf_counts->number_of_entries )
+		{
+			if( libesedb_leaf_counts_count_next_entry(
+			     leaf_counts,
+			     page_tree_cursor,
+			     file_io_handle,
+			     header_page,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to count leaf values of entry: %d.",
+				 function,
+				 leaf_counts->number_of_counted_entries );
+
+				return( -1 );
+			}
+			if( leaf_counts->cumulative_number_of_leaf_values[ leaf_counts->number_of_counted_entries - 1 ] > leaf_value_index )
+			{
+				safe_entry_index = leaf_counts->number_of_counted_entries - 1;
+
+				break;
+			}
+		}
+		if( safe_entry_index == -1 )
+		{
+			return( 0 );
+		}
+	}
+	*entry_index            = safe_entry_index;
+	*entry_leaf_value_index = leaf_value_index;
+
+	if( safe_entry_index > 0 )
+	{
+		*entry_leaf_value_index -= leaf_counts->cumulative_number_of_leaf_values[ safe_entry_index - 1 ];
+	}
+	return( 1 );
+}
+
+/* Retrieves the data definition of a specific leaf value
+ * This descends from the page of the leaf counts to the leaf page that contains
+ * the leaf value and positions the page tree cursor on the leaf value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_leaf_counts_get_leaf_value_by_index(
+     libesedb_leaf_counts_t *leaf_counts,
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     int leaf_value_index,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error )
+{
+	libesedb_leaf_counts_t *branch_leaf_counts = NULL;
+	libesedb_page_t *header_page               = NULL;
+	libesedb_page_t *page                      = NULL;
+	static char *function                      = "libesedb_leaf_counts_get_leaf_value_by_index";
+	uint32_t page_number                       = 0;
+	uint16_t page_value_index                  = 0;
+	int entry_index                            = 0;
+	int entry_leaf_value_index                 = 0;
+	int recursion_depth                        = 0;
+	int result                                 = 0;
+
+	if( leaf_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_value_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid leaf value index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* The header page is used to count the leaf values of entries that have not been counted
+	 */
+	if( libesedb_page_initialize(
+	     &header_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create header page.",
+		 function );
+
+		goto on_error;
+	}
+	branch_leaf_counts     = leaf_counts;
+	page_number            = leaf_counts->page_number;
+	entry_leaf_value_index = leaf_value_index;
+
+	for( recursion_depth = 0;
+	     recursion_depth < LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH;
+	     recursion_depth++ )
+	{
+		if( branch_leaf_counts->is_leaf_page != 0 )
+		{
+			page_number = branch_leaf_counts->page_number;
+
+			break;
+		}
+		result = libesedb_leaf_counts_get_entry_by_leaf_value_index(
+		          branch_leaf_counts,
+		          page_tree_cursor,
+		          file_io_handle,
+		          header_page,
+		          entry_leaf_value_index,
+		          &entry_index,
+		          &entry_leaf_value_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry from page: %" PRIu32 ".",
+			 function,
+			 branch_leaf_counts->page_number );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid leaf value index value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( branch_leaf_counts->child_leaf_counts[ entry_index ] == NULL )
+		{
+			page_number = branch_leaf_counts->child_page_numbers[ entry_index ];
+
+			break;
+		}
+		branch_leaf_counts = branch_leaf_counts->child_leaf_counts[ entry_index ];
+	}
+	if( recursion_depth >= LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_free(
+	     &header_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free header page.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_cursor_get_page(
+	     page_tree_cursor,
+	     file_io_handle,
+	     page_number,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		goto on_error;
+	}
+	page_tree_cursor->page_number = page_number;
+
+	if( libesedb_page_tree_cursor_read_leaf_page_header(
+	     page_tree_cursor,
+	     page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read leaf page header.",
+		 function );
+
+		goto on_error;
+	}
+	/* Page value 0 contains the common page key and is skipped
+	 */
+	for( page_value_index = 1;
+	     page_value_index < page_tree_cursor->number_of_page_values;
+	     page_value_index++ )
+	{
+		page_tree_cursor->page_value_index = page_value_index;
+
+		result = libesedb_page_tree_cursor_get_leaf_value(
+		          page_tree_cursor,
+		          page,
+		          data_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf value: %" PRIu16 " from page: %" PRIu32 ".",
+			 function,
+			 page_value_index,
+			 page_number );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( entry_leaf_value_index == 0 )
+			{
+				return( 1 );
+			}
+			entry_leaf_value_index--;
+		}
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+	 "%s: missing leaf value: %d.",
+	 function,
+	 leaf_value_index );
+
+on_error:
+	if( header_page != NULL )
+	{
+		libesedb_page_free(
+		 &header_page,
+		 NULL );
+	}
+	page_tree_cursor->page_number = 0;
+
+	return( -1 );
+}
+
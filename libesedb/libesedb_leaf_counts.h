@@ -0,0 +1,132 @@
+/*
+ * Leaf counts functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_LEAF_COUNTS_H )
+#define _LIBESEDB_LEAF_COUNTS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_page.h"
+#include "libesedb_page_tree_cursor.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_leaf_counts libesedb_leaf_counts_t;
+
+struct libesedb_leaf_counts
+{
+	/* The page number
+	 */
+	uint32_t page_number;
+
+	/* Value to indicate the page is a leaf page
+	 */
+	uint8_t is_leaf_page;
+
+	/* The number of leaf values of a leaf page
+	 */
+	int number_of_leaf_values;
+
+	/* The number of (non-defunct) child page entries of a branch page
+	 */
+	int number_of_entries;
+
+	/* The child page numbers
+	 */
+	uint32_t *child_page_numbers;
+
+	/* The leaf counts of the child pages
+	 * An entry is NULL if the child page is a leaf page
+	 */
+	libesedb_leaf_counts_t **child_leaf_counts;
+
+	/* The cumulative number of leaf values
+	 * Entry N contains the number of leaf values of the child pages of entries 0 to N
+	 */
+	int *cumulative_number_of_leaf_values;
+
+	/* The number of entries of which the number of leaf values has been determined
+	 */
+	int number_of_counted_entries;
+};
+
+int libesedb_leaf_counts_initialize(
+     libesedb_leaf_counts_t **leaf_counts,
+     uint32_t page_number,
+     libcerror_error_t **error );
+
+int libesedb_leaf_counts_free(
+     libesedb_leaf_counts_t **leaf_counts,
+     libcerror_error_t **error );
+
+int libesedb_leaf_counts_read_page(
+     libesedb_leaf_counts_t *leaf_counts,
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libesedb_leaf_counts_count_next_entry(
+     libesedb_leaf_counts_t *leaf_counts,
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *header_page,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libesedb_leaf_counts_get_number_of_leaf_values(
+     libesedb_leaf_counts_t *leaf_counts,
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *header_page,
+     int *number_of_leaf_values,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libesedb_leaf_counts_get_entry_by_leaf_value_index(
+     libesedb_leaf_counts_t *leaf_counts,
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *header_page,
+     int leaf_value_index,
+     int *entry_index,
+     int *entry_leaf_value_index,
+     libcerror_error_t **error );
+
+int libesedb_leaf_counts_get_leaf_value_by_index(
+     libesedb_leaf_counts_t *leaf_counts,
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     int leaf_value_index,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_LEAF_COUNTS_H ) */
+
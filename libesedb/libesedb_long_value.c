@@ -24,14 +24,17 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libesedb_data_definition.h"
 #include "libesedb_data_segment.h"
 #include "libesedb_definitions.h"
+#include "libesedb_key.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_libfvalue.h"
 #include "libesedb_long_value.h"
+#include "libesedb_page_tree_cursor.h"
 #include "libesedb_record_value.h"
 
 /* Creates a long value
@@ -43,13 +46,719 @@ int libesedb_long_value_initialize(
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
      libesedb_catalog_definition_t *column_catalog_definition,
-     libfdata_list_t *data_segments_list,
+     libfdata_vector_t *long_values_pages_vector,
+     libfcache_cache_t *long_values_pages_cache,
+     uint32_t long_values_root_page_number,
+     const uint8_t *long_value_key,
+     size_t long_value_key_size,
      libcerror_error_t **error )
 {
+	uint8_t segment_key_data[ 8 ];
+
 	libesedb_internal_long_value_t *internal_long_value = NULL;
 	static char *function                               = "libesedb_long_value_initialize";
 
-	if( long_value == NULL )
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *long_value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid long value value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( long_value_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value key.",
+		 function );
+
+		return( -1 );
+	}
+	if( long_value_key_size != 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupport long value key size: %" PRIzd ".",
+		 function,
+		 long_value_key_size );
+
+		return( -1 );
+	}
+	internal_long_value = memory_allocate_structure(
+	                       libesedb_internal_long_value_t );
+
+	if( internal_long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create long value.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_long_value,
+	     0,
+	     sizeof( libesedb_internal_long_value_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear long value.",
+		 function );
+
+		memory_free(
+		 internal_long_value );
+
+		return( -1 );
+	}
+	if( libfcache_cache_initialize(
+	     &( internal_long_value->data_segments_cache ),
+	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_LONG_VALUES_DATA,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data segments cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_cursor_initialize(
+	     &( internal_long_value->page_tree_cursor ),
+	     io_handle,
+	     long_values_pages_vector,
+	     long_values_pages_cache,
+	     long_values_root_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_initialize(
+	     &( internal_long_value->data_definition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data definition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_initialize(
+	     &( internal_long_value->segment_data_definition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create segment data definition.",
+		 function );
+
+		goto on_error;
+	}
+	/* The long value segment key consists of the reversed long value key
+	 * followed by the big-endian segment offset
+	 */
+	segment_key_data[ 0 ] = long_value_key[ 3 ];
+	segment_key_data[ 1 ] = long_value_key[ 2 ];
+	segment_key_data[ 2 ] = long_value_key[ 1 ];
+	segment_key_data[ 3 ] = long_value_key[ 0 ];
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( segment_key_data[ 4 ] ),
+	 0 );
+
+	if( libesedb_key_initialize(
+	     &( internal_long_value->segment_key ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create segment key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_set_data(
+	     internal_long_value->segment_key,
+	     segment_key_data,
+	     8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set segment key data.",
+		 function );
+
+		goto on_error;
+	}
+	internal_long_value->segment_key->type = LIBESEDB_KEY_TYPE_LONG_VALUE_SEGMENT;
+
+	if( memory_copy(
+	     internal_long_value->long_value_key,
+	     long_value_key,
+	     4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy long value key.",
+		 function );
+
+		goto on_error;
+	}
+	internal_long_value->file_io_handle            = file_io_handle;
+	internal_long_value->io_handle                 = io_handle;
+	internal_long_value->column_catalog_definition = column_catalog_definition;
+	internal_long_value->long_values_pages_vector  = long_values_pages_vector;
+	internal_long_value->long_values_pages_cache   = long_values_pages_cache;
+
+	*long_value = (libesedb_long_value_t *) internal_long_value;
+
+	return( 1 );
+
+on_error:
+	if( internal_long_value != NULL )
+	{
+		if( internal_long_value->segment_key != NULL )
+		{
+			libesedb_key_free(
+			 &( internal_long_value->segment_key ),
+			 NULL );
+		}
+		if( internal_long_value->segment_data_definition != NULL )
+		{
+			libesedb_data_definition_free(
+			 &( internal_long_value->segment_data_definition ),
+			 NULL );
+		}
+		if( internal_long_value->data_definition != NULL )
+		{
+			libesedb_data_definition_free(
+			 &( internal_long_value->data_definition ),
+			 NULL );
+		}
+		if( internal_long_value->page_tree_cursor != NULL )
+		{
+			libesedb_page_tree_cursor_free(
+			 &( internal_long_value->page_tree_cursor ),
+			 NULL );
+		}
+		if( internal_long_value->data_segments_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( internal_long_value->data_segments_cache ),
+			 NULL );
+		}
+		memory_free(
+		 internal_long_value );
+	}
+	return( -1 );
+}
+
+/* Frees a long value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_free(
+     libesedb_long_value_t **long_value,
+     libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_free";
+	int result                                          = 1;
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *long_value != NULL )
+	{
+		internal_long_value = (libesedb_internal_long_value_t *) *long_value;
+		*long_value         = NULL;
+
+		/* The file_io_handle, io_handle, long_values_pages_vector and long_values_pages_cache
+		 * references are freed elsewhere
+		 */
+		if( internal_long_value->data_segments_list != NULL )
+		{
+			if( libfdata_list_free(
+			     &( internal_long_value->data_segments_list ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data segments list.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libesedb_page_tree_cursor_free(
+		     &( internal_long_value->page_tree_cursor ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page tree cursor.",
+			 function );
+
+			result = -1;
+		}
+		if( libesedb_data_definition_free(
+		     &( internal_long_value->data_definition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data definition.",
+			 function );
+
+			result = -1;
+		}
+		if( libesedb_data_definition_free(
+		     &( internal_long_value->segment_data_definition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free segment data definition.",
+			 function );
+
+			result = -1;
+		}
+		if( libesedb_key_free(
+		     &( internal_long_value->segment_key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free segment key.",
+			 function );
+
+			result = -1;
+		}
+		if( libfcache_cache_free(
+		     &( internal_long_value->data_segments_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data segments cache.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_long_value->record_value != NULL )
+		{
+			if( libfvalue_value_free(
+			     &( internal_long_value->record_value ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record value.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 internal_long_value );
+	}
+	return( result );
+}
+
+/* Positions the long values page tree cursor before the first long value segment
+ * Returns 1 if successful, 0 if no such long value or -1 on error
+ */
+int libesedb_long_value_seek_first_segment(
+     libesedb_internal_long_value_t *internal_long_value,
+     libcerror_error_t **error )
+{
+	libesedb_key_t *key   = NULL;
+	static char *function = "libesedb_long_value_seek_first_segment";
+	int result            = 0;
+
+	if( internal_long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_key_initialize(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_set_data(
+	     key,
+	     internal_long_value->long_value_key,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set long value key data in key.",
+		 function );
+
+		goto on_error;
+	}
+	key->type = LIBESEDB_KEY_TYPE_LONG_VALUE;
+
+	result = libesedb_page_tree_cursor_seek_leaf_value(
+	          internal_long_value->page_tree_cursor,
+	          internal_long_value->file_io_handle,
+	          key,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          internal_long_value->data_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek long value leaf value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_free(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free key.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* The long value leaf value is stored before the long value segment leaf values
+	 */
+	if( libesedb_page_tree_cursor_get_next_leaf_value(
+	     internal_long_value->page_tree_cursor,
+	     internal_long_value->file_io_handle,
+	     internal_long_value->data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve long value leaf value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_read_long_value(
+	     internal_long_value->data_definition,
+	     internal_long_value->file_io_handle,
+	     internal_long_value->long_values_pages_vector,
+	     internal_long_value->long_values_pages_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data definition long value.",
+		 function );
+
+		goto on_error;
+	}
+	internal_long_value->segment_offset      = 0;
+	internal_long_value->segment_data_size   = 0;
+	internal_long_value->next_segment_offset = 0;
+
+	return( 1 );
+
+on_error:
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the next long value segment
+ * The segment is read from the leaf value that follows the current position of
+ * the long values page tree cursor, which only requires a descent of the tree
+ * when the segment is stored in the next leaf page
+ * Returns 1 if successful, 0 if no such segment or -1 on error
+ */
+int libesedb_long_value_read_next_segment(
+     libesedb_internal_long_value_t *internal_long_value,
+     libcerror_error_t **error )
+{
+	uint8_t *segment_data                = NULL;
+	static char *function                = "libesedb_long_value_read_next_segment";
+	size_t segment_data_size             = 0;
+	uint32_t saved_page_number           = 0;
+	uint16_t saved_number_of_page_values = 0;
+	uint16_t saved_page_value_index      = 0;
+	int compare_result                   = 0;
+	int result                           = 0;
+
+	if( internal_long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_long_value->page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid long value - missing page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_long_value->next_segment_offset > (off64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid long value - next segment offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	saved_page_number           = internal_long_value->page_tree_cursor->page_number;
+	saved_number_of_page_values = internal_long_value->page_tree_cursor->number_of_page_values;
+	saved_page_value_index      = internal_long_value->page_tree_cursor->page_value_index;
+
+	result = libesedb_page_tree_cursor_get_next_leaf_value(
+	          internal_long_value->page_tree_cursor,
+	          internal_long_value->file_io_handle,
+	          internal_long_value->data_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next leaf value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* The next leaf value is the next segment if its key is the long value key
+		 * followed by the offset of the next segment
+		 */
+		byte_stream_copy_from_uint32_big_endian(
+		 &( internal_long_value->segment_key->data[ 4 ] ),
+		 (uint32_t) internal_long_value->next_segment_offset );
+
+		if( libesedb_page_tree_cursor_compare_leaf_value_key(
+		     internal_long_value->page_tree_cursor,
+		     internal_long_value->file_io_handle,
+		     internal_long_value->segment_key,
+		     &compare_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare segment key with key of leaf value.",
+			 function );
+
+			return( -1 );
+		}
+		if( compare_result != LIBFDATA_COMPARE_EQUAL )
+		{
+			result = 0;
+		}
+	}
+	if( result == 0 )
+	{
+		/* Keep the cursor positioned after the last segment
+		 */
+		internal_long_value->page_tree_cursor->page_number           = saved_page_number;
+		internal_long_value->page_tree_cursor->number_of_page_values = saved_number_of_page_values;
+		internal_long_value->page_tree_cursor->page_value_index      = saved_page_value_index;
+
+		return( 0 );
+	}
+	if( libesedb_data_definition_read_data(
+	     internal_long_value->data_definition,
+	     internal_long_value->file_io_handle,
+	     internal_long_value->io_handle,
+	     internal_long_value->long_values_pages_vector,
+	     internal_long_value->long_values_pages_cache,
+	     &segment_data,
+	     &segment_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     internal_long_value->segment_data_definition,
+	     internal_long_value->data_definition,
+	     sizeof( libesedb_data_definition_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy segment data definition.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value->segment_offset       = internal_long_value->next_segment_offset;
+	internal_long_value->segment_data_size    = segment_data_size;
+	internal_long_value->next_segment_offset += (off64_t) segment_data_size;
+
+	return( 1 );
+}
+
+/* Positions the long values page tree cursor on the long value segment that contains a specific offset
+ * Only the long values page tree is descended, the preceding segments are not read
+ * If the offset is beyond the end of the data the cursor is positioned on the last segment
+ * Returns 1 if successful, 0 if no such long value or -1 on error
+ */
+int libesedb_long_value_seek_segment(
+     libesedb_internal_long_value_t *internal_long_value,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	libesedb_key_t *leaf_value_key = NULL;
+	uint8_t *segment_data          = NULL;
+	static char *function          = "libesedb_long_value_seek_segment";
+	size_t segment_data_size       = 0;
+	uint32_t segment_offset        = 0;
+	int result                     = 0;
+
+	if( internal_long_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -60,120 +769,224 @@ int libesedb_long_value_initialize(
 
 		return( -1 );
 	}
-	if( *long_value != NULL )
+	if( internal_long_value->segment_key == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid long value value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid long value - missing segment key.",
 		 function );
 
 		return( -1 );
 	}
-	if( column_catalog_definition == NULL )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid column catalog definition.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( data_segments_list == NULL )
+	/* The segment offsets are stored as 32-bit values
+	 */
+	if( offset > (off64_t) UINT32_MAX )
+	{
+		offset = (off64_t) UINT32_MAX;
+	}
+	byte_stream_copy_from_uint32_big_endian(
+	 &( internal_long_value->segment_key->data[ 4 ] ),
+	 (uint32_t) offset );
+
+	/* Seek the last leaf value with a key not greater than the segment key of the offset,
+	 * which is the segment that contains the offset or the long value leaf value
+	 */
+	result = libesedb_page_tree_cursor_seek_leaf_value(
+	          internal_long_value->page_tree_cursor,
+	          internal_long_value->file_io_handle,
+	          internal_long_value->segment_key,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL,
+	          internal_long_value->data_definition,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data segments list.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek segment leaf value.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_long_value = memory_allocate_structure(
-	                       libesedb_internal_long_value_t );
-
-	if( internal_long_value == NULL )
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libesedb_page_tree_cursor_get_next_leaf_value(
+	     internal_long_value->page_tree_cursor,
+	     internal_long_value->file_io_handle,
+	     internal_long_value->data_definition,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create long value.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment leaf value.",
 		 function );
 
 		goto on_error;
 	}
-	if( memory_set(
-	     internal_long_value,
-	     0,
-	     sizeof( libesedb_internal_long_value_t ) ) == NULL )
+	if( libesedb_key_initialize(
+	     &leaf_value_key,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear long value.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create leaf value key.",
 		 function );
 
-		memory_free(
-		 internal_long_value );
-
-		return( -1 );
+		goto on_error;
 	}
-	if( libfcache_cache_initialize(
-	     &( internal_long_value->data_segments_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_LONG_VALUES_DATA,
+	if( libesedb_page_tree_cursor_get_leaf_value_key(
+	     internal_long_value->page_tree_cursor,
+	     internal_long_value->file_io_handle,
+	     leaf_value_key,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data segments cache.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value key.",
 		 function );
 
 		goto on_error;
 	}
-	internal_long_value->file_io_handle            = file_io_handle;
-	internal_long_value->io_handle                 = io_handle;
-	internal_long_value->column_catalog_definition = column_catalog_definition;
-	internal_long_value->data_segments_list        = data_segments_list;
+	if( ( leaf_value_key->data_size != 4 )
+	 && ( leaf_value_key->data_size != 8 ) )
+	{
+		result = 0;
+	}
+	else if( memory_compare(
+	          leaf_value_key->data,
+	          internal_long_value->segment_key->data,
+	          4 ) != 0 )
+	{
+		result = 0;
+	}
+	else if( leaf_value_key->data_size == 8 )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( leaf_value_key->data[ 4 ] ),
+		 segment_offset );
+	}
+	if( result != 0 )
+	{
+		if( leaf_value_key->data_size == 4 )
+		{
+			/* The long value has no segment with an offset not greater than the offset,
+			 * the cursor is positioned after the long value leaf value
+			 */
+			internal_long_value->segment_offset      = 0;
+			internal_long_value->segment_data_size   = 0;
+			internal_long_value->next_segment_offset = 0;
+		}
+		else
+		{
+			if( libesedb_data_definition_read_data(
+			     internal_long_value->data_definition,
+			     internal_long_value->file_io_handle,
+			     internal_long_value->io_handle,
+			     internal_long_value->long_values_pages_vector,
+			     internal_long_value->long_values_pages_cache,
+			     &segment_data,
+			     &segment_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read segment data.",
+				 function );
 
-	*long_value = (libesedb_long_value_t *) internal_long_value;
+				goto on_error;
+			}
+			if( segment_data_size == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid segment data size value out of bounds.",
+				 function );
 
-	return( 1 );
+				goto on_error;
+			}
+			if( memory_copy(
+			     internal_long_value->segment_data_definition,
+			     internal_long_value->data_definition,
+			     sizeof( libesedb_data_definition_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy segment data definition.",
+				 function );
+
+				goto on_error;
+			}
+			internal_long_value->segment_offset      = (off64_t) segment_offset;
+			internal_long_value->segment_data_size   = segment_data_size;
+			internal_long_value->next_segment_offset = (off64_t) segment_offset + segment_data_size;
+		}
+	}
+	if( libesedb_key_free(
+	     &leaf_value_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free leaf value key.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
 
 on_error:
-	if( internal_long_value != NULL )
+	if( leaf_value_key != NULL )
 	{
-		if( internal_long_value->data_segments_cache != NULL )
-		{
-			libfcache_cache_free(
-			 &( internal_long_value->data_segments_cache ),
-			 NULL );
-		}
-		memory_free(
-		 internal_long_value );
+		libesedb_key_free(
+		 &leaf_value_key,
+		 NULL );
 	}
 	return( -1 );
 }
 
-/* Frees a long value
+/* Reads the data segments list
+ * The segments are read by a single walk of the long values page tree leaf values
  * Returns 1 if successful or -1 on error
  */
-int libesedb_long_value_free(
-     libesedb_long_value_t **long_value,
+int libesedb_long_value_read_data_segments_list(
+     libesedb_internal_long_value_t *internal_long_value,
      libcerror_error_t **error )
 {
-	libesedb_internal_long_value_t *internal_long_value = NULL;
-	static char *function                               = "libesedb_long_value_free";
-	int result                                          = 1;
+	static char *function = "libesedb_long_value_read_data_segments_list";
+	int result            = 0;
 
-	if( long_value == NULL )
+	if( internal_long_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -184,59 +997,96 @@ int libesedb_long_value_free(
 
 		return( -1 );
 	}
-	if( *long_value != NULL )
+	if( internal_long_value->data_segments_list != NULL )
 	{
-		internal_long_value = (libesedb_internal_long_value_t *) *long_value;
-		*long_value         = NULL;
+		return( 1 );
+	}
+	if( libfdata_list_initialize(
+	     &( internal_long_value->data_segments_list ),
+	     NULL,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_data_segment_read_element_data,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data segments list.",
+		 function );
 
-		/* The file_io_handle and io_handle references are freed elsewhere
-		 */
-		if( libfdata_list_free(
-		     &( internal_long_value->data_segments_list ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free data segments list.",
-			 function );
+		goto on_error;
+	}
+	result = libesedb_long_value_seek_first_segment(
+	          internal_long_value,
+	          error );
 
-			result = -1;
-		}
-		if( libfcache_cache_free(
-		     &( internal_long_value->data_segments_cache ),
-		     error ) != 1 )
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek first segment.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		result = libesedb_long_value_read_next_segment(
+		          internal_long_value,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free data segments cache.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read next segment.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-		if( internal_long_value->record_value != NULL )
+		else if( result != 0 )
 		{
-			if( libfvalue_value_free(
-			     &( internal_long_value->record_value ),
+			if( libesedb_data_definition_read_long_value_segment(
+			     internal_long_value->segment_data_definition,
+			     internal_long_value->file_io_handle,
+			     internal_long_value->io_handle,
+			     internal_long_value->long_values_pages_vector,
+			     internal_long_value->long_values_pages_cache,
+			     (uint32_t) internal_long_value->segment_offset,
+			     internal_long_value->data_segments_list,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free record value.",
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data definition long value segment.",
 				 function );
 
-				result = -1;
+				goto on_error;
 			}
 		}
-		memory_free(
-		 internal_long_value );
 	}
-	return( result );
+	while( result == 1 );
+
+	return( 1 );
+
+on_error:
+	if( internal_long_value->data_segments_list != NULL )
+	{
+		libfdata_list_free(
+		 &( internal_long_value->data_segments_list ),
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieve the data size
@@ -263,6 +1113,33 @@ int libesedb_long_value_get_data_size(
 	}
 	internal_long_value = (libesedb_internal_long_value_t *) long_value;
 
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data size is determined by a single walk of the segments,
+	 * where the segments after a gap in the segment offsets are ignored
+	 */
+	if( libesedb_long_value_read_data_segments_list(
+	     internal_long_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data segments list.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfdata_list_get_size(
 	     internal_long_value->data_segments_list,
 	     data_size,
@@ -332,6 +1209,19 @@ int libesedb_long_value_get_data(
 
 		return( -1 );
 	}
+	if( libesedb_long_value_read_data_segments_list(
+	     internal_long_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data segments list.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfdata_list_get_size(
 	     internal_long_value->data_segments_list,
 	     &data_segments_size,
@@ -480,6 +1370,19 @@ int libesedb_long_value_get_record_value(
 	}
 	if( internal_long_value->record_value == NULL )
 	{
+		if( libesedb_long_value_read_data_segments_list(
+		     internal_long_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data segments list.",
+			 function );
+
+			goto on_error;
+		}
 		if( libfdata_list_get_size(
 		     internal_long_value->data_segments_list,
 		     &data_size,
@@ -724,6 +1627,19 @@ int libesedb_long_value_get_number_of_data_segments(
 	}
 	internal_long_value = (libesedb_internal_long_value_t *) long_value;
 
+	if( libesedb_long_value_read_data_segments_list(
+	     internal_long_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data segments list.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfdata_list_get_number_of_elements(
 	     internal_long_value->data_segments_list,
 	     number_of_data_segments,
@@ -758,15 +1674,28 @@ int libesedb_long_value_get_data_segment_size(
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid long value.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+	if( libesedb_long_value_read_data_segments_list(
+	     internal_long_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data segments list.",
 		 function );
 
 		return( -1 );
 	}
-	internal_long_value = (libesedb_internal_long_value_t *) long_value;
-
 	if( libfdata_list_get_element_value_by_index(
 	     internal_long_value->data_segments_list,
 	     (intptr_t *) internal_long_value->file_io_handle,
@@ -831,6 +1760,19 @@ int libesedb_long_value_get_data_segment(
 	}
 	internal_long_value = (libesedb_internal_long_value_t *) long_value;
 
+	if( libesedb_long_value_read_data_segments_list(
+	     internal_long_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data segments list.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfdata_list_get_element_value_by_index(
 	     internal_long_value->data_segments_list,
 	     (intptr_t *) internal_long_value->file_io_handle,
@@ -1227,6 +2169,376 @@ int libesedb_long_value_get_utf16_string(
 	return( result );
 }
 
+/* Reads data at the current offset into a buffer
+ * Consecutive segments are read sequentially from the long values page tree leaf values,
+ * after a seek only the segment that contains the offset is looked up,
+ * hence only the current segment is kept in memory
+ * The data size is determined once, by a walk of the segment leaf values
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libesedb_long_value_read_buffer(
+         libesedb_long_value_t *long_value,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	uint8_t *segment_data                               = NULL;
+	static char *function                               = "libesedb_long_value_read_buffer";
+	size64_t data_size                                  = 0;
+	size_t buffer_offset                                = 0;
+	size_t read_size                                    = 0;
+	size_t segment_data_offset                          = 0;
+	size_t segment_data_size                            = 0;
+	int result                                          = 0;
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+	if( internal_long_value->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid long value - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_long_value_get_data_size(
+	     long_value,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) internal_long_value->current_offset >= data_size )
+	{
+		return( 0 );
+	}
+	/* The data after a gap in the segment offsets is not read
+	 */
+	if( (size64_t) buffer_size > ( data_size - (size64_t) internal_long_value->current_offset ) )
+	{
+		buffer_size = (size_t) ( data_size - (size64_t) internal_long_value->current_offset );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		/* Sequential reads continue with the next segment, otherwise
+		 * the segment that contains the current offset is sought
+		 */
+		if( ( internal_long_value->segment_data_size == 0 )
+		 || ( internal_long_value->current_offset < internal_long_value->segment_offset )
+		 || ( internal_long_value->current_offset > internal_long_value->next_segment_offset ) )
+		{
+			result = libesedb_long_value_seek_segment(
+			          internal_long_value,
+			          internal_long_value->current_offset,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to seek segment of offset: %" PRIi64 ".",
+				 function,
+				 internal_long_value->current_offset );
+
+				return( -1 );
+			}
+		}
+		if( internal_long_value->current_offset >= internal_long_value->next_segment_offset )
+		{
+			if( internal_long_value->current_offset > internal_long_value->next_segment_offset )
+			{
+				break;
+			}
+			result = libesedb_long_value_read_next_segment(
+			          internal_long_value,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read next segment.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		if( libesedb_data_definition_read_data(
+		     internal_long_value->segment_data_definition,
+		     internal_long_value->file_io_handle,
+		     internal_long_value->io_handle,
+		     internal_long_value->long_values_pages_vector,
+		     internal_long_value->long_values_pages_cache,
+		     &segment_data,
+		     &segment_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read segment data.",
+			 function );
+
+			return( -1 );
+		}
+		segment_data_offset = (size_t) ( internal_long_value->current_offset - internal_long_value->segment_offset );
+
+		if( segment_data_offset >= segment_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid segment data offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		read_size = segment_data_size - segment_data_offset;
+
+		if( read_size > ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+		if( memory_copy(
+		     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+		     &( segment_data[ segment_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy segment data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset                       += read_size;
+		internal_long_value->current_offset += (off64_t) read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads data at a specific offset into a buffer
+ * Only the segments that contain the data are read
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libesedb_long_value_read_buffer_at_offset(
+         libesedb_long_value_t *long_value,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( libesedb_long_value_seek_offset(
+	     long_value,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Seeks a certain offset of the data
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libesedb_long_value_seek_offset(
+         libesedb_long_value_t *long_value,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_seek_offset";
+	size64_t data_size                                  = 0;
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_long_value->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		if( libesedb_long_value_get_data_size(
+		     long_value,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data size.",
+			 function );
+
+			return( -1 );
+		}
+		offset += (off64_t) data_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value->current_offset = offset;
+
+	return( offset );
+}
+
+/* Retrieves the current offset of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_get_offset(
+     libesedb_long_value_t *long_value,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_get_offset";
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = internal_long_value->current_offset;
+
+	return( 1 );
+}
+
 /* Deprecated */
 
 /* Retrieve the number of data segments
@@ -1253,6 +2565,19 @@ int libesedb_long_value_get_number_of_segments(
 	}
 	internal_long_value = (libesedb_internal_long_value_t *) long_value;
 
+	if( libesedb_long_value_read_data_segments_list(
+	     internal_long_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data segments list.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfdata_list_get_number_of_elements(
 	     internal_long_value->data_segments_list,
 	     number_of_segments,
@@ -1319,6 +2644,19 @@ int libesedb_long_value_get_segment_data(
 
 		return( -1 );
 	}
+	if( libesedb_long_value_read_data_segments_list(
+	     internal_long_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data segments list.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfdata_list_get_element_value_by_index(
 	     internal_long_value->data_segments_list,
 	     (intptr_t *) internal_long_value->file_io_handle,
@@ -26,13 +26,16 @@
 #include <types.h>
 
 #include "libesedb_catalog_definition.h"
+#include "libesedb_data_definition.h"
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
+#include "libesedb_key.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_libfvalue.h"
+#include "libesedb_page_tree_cursor.h"
 #include "libesedb_types.h"
 
 #if defined( __cplusplus )
@@ -55,15 +58,53 @@ struct libesedb_internal_long_value
 	 */
 	libesedb_catalog_definition_t *column_catalog_definition;
 
-	/* The long values tree
+	/* The long values pages vector
 	 */
-	libfdata_btree_t *long_values_tree;
+	libfdata_vector_t *long_values_pages_vector;
 
-	/* The long values cache
+	/* The long values pages cache
 	 */
-	libfcache_cache_t *long_values_cache;
+	libfcache_cache_t *long_values_pages_cache;
+
+	/* The long value key
+	 */
+	uint8_t long_value_key[ 4 ];
+
+	/* The long values page tree cursor
+	 */
+	libesedb_page_tree_cursor_t *page_tree_cursor;
+
+	/* The key of the next long value segment
+	 */
+	libesedb_key_t *segment_key;
+
+	/* The data definition used to walk the leaf values
+	 */
+	libesedb_data_definition_t *data_definition;
+
+	/* The data definition of the current segment
+	 */
+	libesedb_data_definition_t *segment_data_definition;
+
+	/* The offset of the current segment
+	 */
+	off64_t segment_offset;
+
+	/* The data size of the current segment
+	 * 0 when no segment has been read
+	 */
+	size_t segment_data_size;
+
+	/* The offset of the next segment
+	 */
+	off64_t next_segment_offset;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
 
 	/* The data segments list
+	 * NULL when not read
 	 */
 	libfdata_list_t *data_segments_list;
 
@@ -81,7 +122,11 @@ int libesedb_long_value_initialize(
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
      libesedb_catalog_definition_t *column_catalog_definition,
-     libfdata_list_t *data_segments_list,
+     libfdata_vector_t *long_values_pages_vector,
+     libfcache_cache_t *long_values_pages_cache,
+     uint32_t long_values_root_page_number,
+     const uint8_t *long_value_key,
+     size_t long_value_key_size,
      libcerror_error_t **error );
 
 LIBESEDB_EXTERN \
@@ -89,6 +134,23 @@ int libesedb_long_value_free(
      libesedb_long_value_t **long_value,
      libcerror_error_t **error );
 
+int libesedb_long_value_seek_first_segment(
+     libesedb_internal_long_value_t *internal_long_value,
+     libcerror_error_t **error );
+
+int libesedb_long_value_read_next_segment(
+     libesedb_internal_long_value_t *internal_long_value,
+     libcerror_error_t **error );
+
+int libesedb_long_value_seek_segment(
+     libesedb_internal_long_value_t *internal_long_value,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libesedb_long_value_read_data_segments_list(
+     libesedb_internal_long_value_t *internal_long_value,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_long_value_get_data_size(
      libesedb_long_value_t *long_value,
@@ -154,6 +216,34 @@ int libesedb_long_value_get_utf16_string(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+ssize_t libesedb_long_value_read_buffer(
+         libesedb_long_value_t *long_value,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+ssize_t libesedb_long_value_read_buffer_at_offset(
+         libesedb_long_value_t *long_value,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+off64_t libesedb_long_value_seek_offset(
+         libesedb_long_value_t *long_value,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_long_value_get_offset(
+     libesedb_long_value_t *long_value,
+     off64_t *offset,
+     libcerror_error_t **error );
+
 /* Deprecated */
 
 LIBESEDB_EXTERN \
@@ -30,6 +30,7 @@
 #include "libesedb_libfvalue.h"
 #include "libesedb_multi_value.h"
 #include "libesedb_types.h"
+#include "libesedb_utf8_string.h"
 
 /* Creates a multi value
  * Make sure the value multi_value is referencing, is set to NULL
@@ -1007,11 +1008,46 @@ int libesedb_multi_value_get_value_utf8_string_size(
 	}
 	else
 	{
-		result = libfvalue_value_get_utf8_string_size(
-			  internal_multi_value->record_value,
-			  multi_value_index,
-			  utf8_string_size,
-			  error );
+		if( libfvalue_value_get_entry_data(
+		     internal_multi_value->record_value,
+		     multi_value_index,
+		     &entry_data,
+		     &entry_data_size,
+		     &encoding,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record value entry: %d data.",
+			 function,
+			 multi_value_index );
+
+			return( -1 );
+		}
+		result = 0;
+
+		/* Convert UTF-16 little-endian data in-tree and leave
+		 * the strings it does not support to libfvalue
+		 */
+		if( ( encoding == LIBFVALUE_CODEPAGE_1200_MIXED )
+		 && ( entry_data != NULL ) )
+		{
+			result = libesedb_utf8_string_size_from_utf16_stream(
+				  entry_data,
+				  entry_data_size,
+				  utf8_string_size,
+				  error );
+		}
+		if( result == 0 )
+		{
+			result = libfvalue_value_get_utf8_string_size(
+				  internal_multi_value->record_value,
+				  multi_value_index,
+				  utf8_string_size,
+				  error );
+		}
 	}
 	if( result != 1 )
 	{
@@ -1132,12 +1168,48 @@ int libesedb_multi_value_get_value_utf8_string(
 	}
 	else
 	{
-		result = libfvalue_value_copy_to_utf8_string(
-			  internal_multi_value->record_value,
-			  multi_value_index,
-			  utf8_string,
-			  utf8_string_size,
-			  error );
+		if( libfvalue_value_get_entry_data(
+		     internal_multi_value->record_value,
+		     multi_value_index,
+		     &entry_data,
+		     &entry_data_size,
+		     &encoding,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record value entry: %d data.",
+			 function,
+			 multi_value_index );
+
+			return( -1 );
+		}
+		result = 0;
+
+		/* Convert UTF-16 little-endian data in-tree and leave
+		 * the strings it does not support to libfvalue
+		 */
+		if( ( encoding == LIBFVALUE_CODEPAGE_1200_MIXED )
+		 && ( entry_data != NULL ) )
+		{
+			result = libesedb_utf8_string_copy_from_utf16_stream(
+				  utf8_string,
+				  utf8_string_size,
+				  entry_data,
+				  entry_data_size,
+				  error );
+		}
+		if( result == 0 )
+		{
+			result = libfvalue_value_copy_to_utf8_string(
+				  internal_multi_value->record_value,
+				  multi_value_index,
+				  utf8_string,
+				  utf8_string_size,
+				  error );
+		}
 	}
 	if( result != 1 )
 	{
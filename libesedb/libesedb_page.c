@@ -1063,6 +1063,486 @@ on_error:
 	return( -1 );
 }
 
+/* Reads a page and its header
+ * Unlike libesedb_page_read_file_io_handle this does not calculate the page checksums
+ * or read the page values, and the page data is reused if already allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_read_header_file_io_handle(
+     libesedb_page_t *page,
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_read_header_file_io_handle";
+	ssize_t read_count    = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page->data != NULL )
+	 && ( page->data_size != (size_t) io_handle->page_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The page values would reference the page data that is overwritten
+	 */
+	if( libcdata_array_empty(
+	     page->values_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_value_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty page values array.",
+		 function );
+
+		return( -1 );
+	}
+	page->page_number = (uint32_t) ( ( file_offset - io_handle->page_size ) / io_handle->page_size );
+	page->offset      = file_offset;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading page: %" PRIu32 " header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 page->page_number,
+		 page->offset,
+		 page->offset );
+	}
+#endif
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     page->offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek page offset: %" PRIi64 ".",
+		 function,
+		 page->offset );
+
+		return( -1 );
+	}
+	if( page->data == NULL )
+	{
+		page->data = (uint8_t *) memory_allocate(
+		                          (size_t) io_handle->page_size );
+
+		if( page->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create page data.",
+			 function );
+
+			return( -1 );
+		}
+		page->data_size = (size_t) io_handle->page_size;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              page->data,
+	              page->data_size,
+	              error );
+
+	if( read_count != (ssize_t) page->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_header_read_data(
+	     page->header,
+	     io_handle,
+	     page->data,
+	     page->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Clones a page
+ * The page data is copied from the source page and the header and values
+ * are read from the copy, without reading the page from the file again
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_clone(
+     libesedb_page_t **destination_page,
+     libesedb_page_t *source_page,
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_clone";
+
+	if( destination_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination page.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_page != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination page value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_page == NULL )
+	{
+		*destination_page = NULL;
+
+		return( 1 );
+	}
+	if( source_page->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid source page - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source_page->data_size == 0 )
+	 || ( source_page->data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source page - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_initialize(
+	     destination_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination page.",
+		 function );
+
+		goto on_error;
+	}
+	( *destination_page )->page_number = source_page->page_number;
+	( *destination_page )->offset      = source_page->offset;
+
+	( *destination_page )->data = (uint8_t *) memory_allocate(
+	                                           source_page->data_size );
+
+	if( ( *destination_page )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination page data.",
+		 function );
+
+		goto on_error;
+	}
+	( *destination_page )->data_size = source_page->data_size;
+
+	if( memory_copy(
+	     ( *destination_page )->data,
+	     source_page->data,
+	     source_page->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy page data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_header_read_data(
+	     ( *destination_page )->header,
+	     io_handle,
+	     ( *destination_page )->data,
+	     ( *destination_page )->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_read_values(
+	     *destination_page,
+	     io_handle,
+	     ( *destination_page )->data,
+	     ( *destination_page )->data_size,
+	     ( *destination_page )->header->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page values.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_page != NULL )
+	{
+		libesedb_page_free(
+		 destination_page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines the number of non-defunct page values from the page tags
+ * Page value 0, which contains the common page key, is not included
+ * This only requires the page header to be read and does not create page values
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_get_number_of_live_values_from_tags(
+     libesedb_page_t *page,
+     libesedb_io_handle_t *io_handle,
+     uint16_t *number_of_values,
+     libcerror_error_t **error )
+{
+	const uint8_t *page_tags_data   = NULL;
+	static char *function           = "libesedb_page_get_number_of_live_values_from_tags";
+	size_t page_tags_data_size      = 0;
+	size_t page_values_data_size    = 0;
+	uint16_t number_of_page_tags    = 0;
+	uint16_t page_tag_offset        = 0;
+	uint16_t page_tag_size          = 0;
+	uint16_t page_tags_index        = 0;
+	uint16_t safe_number_of_values  = 0;
+	uint8_t has_flags_in_value_data = 0;
+	uint8_t page_tag_flags          = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page->header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page - missing header.",
+		 function );
+
+		return( -1 );
+	}
+	if( page->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of values.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_page_tags = page->header->available_page_tag;
+
+	if( number_of_page_tags <= 1 )
+	{
+		*number_of_values = 0;
+
+		return( 1 );
+	}
+	if( page->header->data_size >= page->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page values data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	page_values_data_size = page->data_size - page->header->data_size;
+	page_tags_data_size   = 4 * (size_t) number_of_page_tags;
+
+	if( page_tags_data_size > page_values_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of page tags value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	page_values_data_size -= page_tags_data_size;
+
+	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 && ( io_handle->page_size >= 16384 ) )
+	{
+		has_flags_in_value_data = 1;
+	}
+	/* The page tags are stored back to front, skip page tag 0
+	 */
+	page_tags_data = &( page->data[ page->data_size - 8 ] );
+
+	for( page_tags_index = 1;
+	     page_tags_index < number_of_page_tags;
+	     page_tags_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 page_tags_data,
+		 page_tag_size );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( page_tags_data[ 2 ] ),
+		 page_tag_offset );
+
+		page_tags_data -= 4;
+
+		if( has_flags_in_value_data != 0 )
+		{
+			page_tag_flags   = 0;
+			page_tag_offset &= 0x7fff;
+			page_tag_size   &= 0x7fff;
+
+			if( ( page_tag_offset >= page_values_data_size )
+			 || ( (size_t) page_tag_size > ( page_values_data_size - page_tag_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: unsupported page tag: %" PRIu16 " value offset or size value out of bounds.",
+				 function,
+				 page_tags_index );
+
+				return( -1 );
+			}
+			if( page_tag_size >= 2 )
+			{
+				/* The page tags flags are stored in the upper byte of the first 16-bit value
+				 */
+				page_tag_flags = page->data[ page->header->data_size + page_tag_offset + 1 ] >> 5;
+			}
+		}
+		else
+		{
+			page_tag_flags = (uint8_t) ( page_tag_offset >> 13 );
+		}
+		if( ( page_tag_flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) == 0 )
+		{
+			safe_number_of_values++;
+		}
+	}
+	*number_of_values = safe_number_of_values;
+
+	return( 1 );
+}
+
 /* Checks if the page is valid root page
  * Returns 1 if successful or -1 on error
  */
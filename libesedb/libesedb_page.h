@@ -105,6 +105,25 @@ int libesedb_page_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libesedb_page_read_header_file_io_handle(
+     libesedb_page_t *page,
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libesedb_page_clone(
+     libesedb_page_t **destination_page,
+     libesedb_page_t *source_page,
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libesedb_page_get_number_of_live_values_from_tags(
+     libesedb_page_t *page,
+     libesedb_io_handle_t *io_handle,
+     uint16_t *number_of_values,
+     libcerror_error_t **error );
+
 int libesedb_page_validate_root_page(
      libesedb_page_t *page,
      libcerror_error_t **error );
@@ -29,6 +29,7 @@
 #include "libesedb_definitions.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_key.h"
+#include "libesedb_leaf_counts.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
@@ -36,6 +37,7 @@
 #include "libesedb_libfdata.h"
 #include "libesedb_page.h"
 #include "libesedb_page_tree.h"
+#include "libesedb_page_tree_cursor.h"
 #include "libesedb_page_tree_value.h"
 #include "libesedb_space_tree_value.h"
 #include "libesedb_root_page_header.h"
@@ -167,6 +169,22 @@ int libesedb_page_tree_free(
 		/* The io_handle, pages_vector, pages_cache, table_definition and template_table_definition references
 		 * are freed elsewhere
 		 */
+		if( ( *page_tree )->leaf_counts != NULL )
+		{
+			if( libesedb_leaf_counts_free(
+			     &( ( *page_tree )->leaf_counts ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free leaf counts.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *page_tree );
 
@@ -1462,7 +1480,7 @@ int libesedb_page_tree_get_key_and_value(
 	}
 	if( libesedb_key_append_data(
 	     safe_key,
-	     page_value->data,
+	     safe_page_tree_value->local_key,
 	     (size_t) safe_page_tree_value->local_key_size,
 	     error ) != 1 )
 	{
@@ -1521,27 +1539,19 @@ on_error:
 	return( -1 );
 }
 
-/* Determines the number of leaf values from a page
+/* Determines the number of leaf values
+ * Only the page header and page tags of the leaf pages are read
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_tree_get_number_of_leaf_values_from_page(
+int libesedb_page_tree_get_number_of_leaf_values(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
-     libesedb_page_t *page,
+     uint32_t root_page_number,
      int *number_of_leaf_values,
-     int recursion_depth,
      libcerror_error_t **error )
 {
-	libesedb_page_t *child_page                 = NULL;
-	libesedb_page_tree_value_t *page_tree_value = NULL;
-	libesedb_page_value_t *page_value           = NULL;
-	libfcache_cache_t *child_page_cache         = NULL;
-	static char *function                       = "libesedb_page_tree_get_number_of_leaf_values_from_page";
-	uint32_t child_page_number                  = 0;
-	uint32_t page_flags                         = 0;
-	uint16_t number_of_page_values              = 0;
-	uint16_t page_value_index                   = 0;
-	int safe_number_of_leaf_values              = 0;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	static char *function                         = "libesedb_page_tree_get_number_of_leaf_values";
 
 	if( page_tree == NULL )
 	{
@@ -1554,13 +1564,19 @@ int libesedb_page_tree_get_number_of_leaf_values_from_page(
 
 		return( -1 );
 	}
-	if( page_tree->io_handle == NULL )
+#if ( SIZEOF_INT <= 4 )
+	if( ( root_page_number < 1 )
+	 || ( root_page_number > (uint32_t) INT_MAX ) )
+#else
+	if( ( root_page_number < 1 )
+	 || ( (int) root_page_number > INT_MAX ) )
+#endif
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid page tree - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid root page number value out of bounds.",
 		 function );
 
 		return( -1 );
@@ -1576,341 +1592,188 @@ int libesedb_page_tree_get_number_of_leaf_values_from_page(
 
 		return( -1 );
 	}
-	if( ( recursion_depth < 0 )
-	 || ( recursion_depth > LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH ) )
+	if( libesedb_page_tree_cursor_initialize(
+	     &page_tree_cursor,
+	     page_tree->io_handle,
+	     page_tree->pages_vector,
+	     page_tree->pages_cache,
+	     root_page_number,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid recursion depth value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree cursor.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libesedb_page_get_number_of_values(
-	     page,
-	     &number_of_page_values,
+	if( libesedb_page_tree_cursor_get_number_of_leaf_values(
+	     page_tree_cursor,
+	     file_io_handle,
+	     number_of_leaf_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of page values.",
-		 function );
+		 "%s: unable to retrieve number of leaf values from root page: %" PRIu32 ".",
+		 function,
+		 root_page_number );
 
 		goto on_error;
 	}
-	if( number_of_page_values == 0 )
-	{
-		return( 1 );
-	}
-	if( libesedb_page_get_flags(
-	     page,
-	     &page_flags,
+	if( libesedb_page_tree_cursor_free(
+	     &page_tree_cursor,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page flags.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page tree cursor.",
 		 function );
 
 		goto on_error;
 	}
-        /* Use a local cache to prevent cache invalidation of the page
-         * when reading child pages.
-         */
-	if( libfcache_cache_initialize(
-	     &child_page_cache,
-	     1,
-	     error ) != 1 )
+	return( 1 );
+
+on_error:
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Positions a page tree cursor on a specific leaf value
+ * The number of leaf values per branch page entry are determined on demand
+ * and retained in the page tree, so that subsequent calls descend directly
+ * to the leaf page that contains the leaf value. The following leaf values
+ * can be retrieved with libesedb_page_tree_cursor_get_next_leaf_value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_seek_leaf_value_by_index(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     int leaf_value_index,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_tree_seek_leaf_value_by_index";
+
+	if( page_tree == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create child page cache.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( page_value_index = 1;
-	     page_value_index < number_of_page_values;
-	     page_value_index++ )
+	if( page_tree_cursor == NULL )
 	{
-		if( libesedb_page_get_value_by_index(
-		     page,
-		     page_value_index,
-		     &page_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve page value: %" PRIu16 ".",
-			 function,
-			 page_value_index );
-
-			goto on_error;
-		}
-		if( page_value == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing page value: %" PRIu16 ".",
-			 function,
-			 page_value_index );
-
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: page value: %03" PRIu16 " page tag flags\t\t: 0x%02" PRIx8 "",
-			 function,
-			 page_value_index,
-			 page_value->flags );
-			libesedb_debug_print_page_tag_flags(
-			 page_value->flags );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
 
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif
-		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
-		{
-			continue;
-		}
-		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
-		{
-			safe_number_of_leaf_values++;
+		return( -1 );
+	}
+	if( ( page_tree->leaf_counts != NULL )
+	 && ( page_tree->leaf_counts->page_number != page_tree_cursor->root_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page tree cursor - root page number value out of bounds.",
+		 function );
 
-			continue;
-		}
-		if( libesedb_page_tree_value_initialize(
-		     &page_tree_value,
+		return( -1 );
+	}
+	if( page_tree->leaf_counts == NULL )
+	{
+		if( libesedb_leaf_counts_initialize(
+		     &( page_tree->leaf_counts ),
+		     page_tree_cursor->root_page_number,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create page tree value.",
+			 "%s: unable to create leaf counts.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libesedb_page_tree_value_read_data(
-		     page_tree_value,
-		     page_value->data,
-		     (size_t) page_value->size,
-		     page_value->flags,
+		if( libesedb_leaf_counts_read_page(
+		     page_tree->leaf_counts,
+		     page_tree_cursor,
+		     file_io_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read page tree value: %" PRIu16 ".",
-			 function,
-			 page_value_index );
-
-			goto on_error;
-		}
-		if( page_tree_value->data_size < 4 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid page tree value: %" PRIu16 " data size value out of bounds.",
-			 function,
-			 page_value_index );
-
-			goto on_error;
-		}
-		byte_stream_copy_to_uint32_little_endian(
-		 page_tree_value->data,
-		 child_page_number );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: page value: %03" PRIu16 " child page number\t\t: %" PRIu32 "",
+			 "%s: unable to read root page: %" PRIu32 ".",
 			 function,
-			 page_value_index,
-			 child_page_number );
+			 page_tree_cursor->root_page_number );
 
-			if( child_page_number == 0 )
-			{
-				libcnotify_printf(
-				 " (invalid page number)\n" );
-			}
-			else if( child_page_number > page_tree->io_handle->last_page_number )
-			{
-				libcnotify_printf(
-				 " (exceeds last page number: %" PRIu32 ")\n",
-				 page_tree->io_handle->last_page_number );
-			}
-			libcnotify_printf(
-			 "\n" );
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif
-#if ( SIZEOF_INT <= 4 )
-		if( ( child_page_number < 1 )
-		 || ( child_page_number > (uint32_t) INT_MAX ) )
-#else
-		if( ( child_page_number < 1 )
-		 || ( (int) child_page_number > INT_MAX ) )
-#endif
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid child page number value out of bounds.",
-			 function );
+			libesedb_leaf_counts_free(
+			 &( page_tree->leaf_counts ),
+			 NULL );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( libcnotify_verbose != 0 )
-		 && ( page_tree_value->data_size > 4 ) )
-		{
-			libcnotify_printf(
-			 "%s: page value: %03" PRIu16 " trailing data:\n",
-			 function,
-			 page_value_index );
-			libcnotify_print_data(
-			 &( page_tree_value->data[ 4 ] ),
-			 page_tree_value->data_size - 4,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-		}
-#endif
-		if( ( child_page_number > 0 )
-		 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
-		{
-			if( libfdata_vector_get_element_value_by_index(
-			     page_tree->pages_vector,
-			     (intptr_t *) file_io_handle,
-			     (libfdata_cache_t *) child_page_cache,
-			     (int) child_page_number - 1,
-			     (intptr_t **) &child_page,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve page: %" PRIu32 ".",
-				 function,
-				 child_page_number );
-
-				goto on_error;
-			}
-			if( libesedb_page_validate_page(
-			     child_page,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported page.",
-				 function );
-
-				goto on_error;
-			}
-			if( libesedb_page_tree_get_number_of_leaf_values_from_page(
-			     page_tree,
-			     file_io_handle,
-			     child_page,
-			     number_of_leaf_values,
-			     recursion_depth + 1,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve number of leaf values from page: %" PRIu32 ".",
-				 function,
-				 child_page_number );
-
-				goto on_error;
-			}
-		}
-		if( libesedb_page_tree_value_free(
-		     &page_tree_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free page tree value.",
-			 function );
-
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( libfcache_cache_free(
-	     &child_page_cache,
+	if( libesedb_leaf_counts_get_leaf_value_by_index(
+	     page_tree->leaf_counts,
+	     page_tree_cursor,
+	     file_io_handle,
+	     leaf_value_index,
+	     data_definition,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free child page cache.",
-		 function );
-
-		goto on_error;
-	}
-	*number_of_leaf_values += safe_number_of_leaf_values;
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d.",
+		 function,
+		 leaf_value_index );
 
-	return( 1 );
+		page_tree_cursor->page_number = 0;
 
-on_error:
-	if( page_tree_value != NULL )
-	{
-		libesedb_page_tree_value_free(
-		 &page_tree_value,
-		 NULL );
-	}
-	if( child_page_cache != NULL )
-	{
-		libfcache_cache_free(
-		 &child_page_cache,
-		 NULL );
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Determines the number of leaf values
+/* Retrieves the data definition of a specific leaf value
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_tree_get_number_of_leaf_values(
+int libesedb_page_tree_get_leaf_value_by_index(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
      uint32_t root_page_number,
-     int *number_of_leaf_values,
+     int leaf_value_index,
+     libesedb_data_definition_t *data_definition,
      libcerror_error_t **error )
 {
-	libesedb_page_t *root_page         = NULL;
-	libfcache_cache_t *root_page_cache = NULL;
-	static char *function              = "libesedb_page_tree_get_number_of_leaf_values";
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	static char *function                         = "libesedb_page_tree_get_leaf_value_by_index";
 
 	if( page_tree == NULL )
 	{
@@ -1923,113 +1786,50 @@ int libesedb_page_tree_get_number_of_leaf_values(
 
 		return( -1 );
 	}
-#if ( SIZEOF_INT <= 4 )
-	if( ( root_page_number < 1 )
-	 || ( root_page_number > (uint32_t) INT_MAX ) )
-#else
-	if( ( root_page_number < 1 )
-	 || ( (int) root_page_number > INT_MAX ) )
-#endif
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid root page number value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	if( number_of_leaf_values == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of leaf values.",
-		 function );
-
-		return( -1 );
-	}
-	*number_of_leaf_values = 0;
-
-        /* Use a local cache to prevent cache invalidation of the root page
-         * when reading child pages.
-         */
-	if( libfcache_cache_initialize(
-	     &root_page_cache,
-	     1,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create root page cache.",
-		 function );
-
-		goto on_error;
-	}
-/* TODO move root page number into page tree and set on init */
-	if( libfdata_vector_get_element_value_by_index(
+	if( libesedb_page_tree_cursor_initialize(
+	     &page_tree_cursor,
+	     page_tree->io_handle,
 	     page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) root_page_cache,
-	     (int) root_page_number - 1,
-	     (intptr_t **) &root_page,
-	     0,
+	     page_tree->pages_cache,
+	     root_page_number,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page: %" PRIu32 ".",
-		 function,
-		 root_page_number );
-
-		goto on_error;
-	}
-	if( libesedb_page_validate_root_page(
-	     root_page,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported root page.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree cursor.",
 		 function );
 
 		goto on_error;
 	}
-	if( libesedb_page_tree_get_number_of_leaf_values_from_page(
+	if( libesedb_page_tree_seek_leaf_value_by_index(
 	     page_tree,
+	     page_tree_cursor,
 	     file_io_handle,
-	     root_page,
-	     number_of_leaf_values,
-	     0,
+	     leaf_value_index,
+	     data_definition,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of leaf values from page: %" PRIu32 ".",
+		 "%s: unable to retrieve leaf value: %d.",
 		 function,
-		 root_page_number );
+		 leaf_value_index );
 
 		goto on_error;
 	}
-	if( libfcache_cache_free(
-	     &root_page_cache,
+	if( libesedb_page_tree_cursor_free(
+	     &page_tree_cursor,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free page cache.",
+		 "%s: unable to free page tree cursor.",
 		 function );
 
 		goto on_error;
@@ -2037,10 +1837,10 @@ int libesedb_page_tree_get_number_of_leaf_values(
 	return( 1 );
 
 on_error:
-	if( root_page_cache != NULL )
+	if( page_tree_cursor != NULL )
 	{
-		libfcache_cache_free(
-		 &root_page_cache,
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
 		 NULL );
 	}
 	return( -1 );
@@ -25,13 +25,16 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_data_definition.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_key.h"
+#include "libesedb_leaf_counts.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page.h"
+#include "libesedb_page_tree_cursor.h"
 #include "libesedb_page_tree_value.h"
 #include "libesedb_page_value.h"
 #include "libesedb_table_definition.h"
@@ -71,6 +74,10 @@ struct libesedb_page_tree
 	/* The pages cache
 	 */
 	libfcache_cache_t *pages_cache;
+
+	/* The leaf counts of the root page
+	 */
+	libesedb_leaf_counts_t *leaf_counts;
 };
 
 int libesedb_page_tree_initialize(
@@ -117,19 +124,27 @@ int libesedb_page_tree_get_key_and_value(
      libesedb_page_tree_value_t **page_tree_value,
      libcerror_error_t **error );
 
-int libesedb_page_tree_get_number_of_leaf_values_from_page(
+int libesedb_page_tree_get_number_of_leaf_values(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
-     libesedb_page_t *page,
+     uint32_t root_page_number,
      int *number_of_leaf_values,
-     int recursion_depth,
      libcerror_error_t **error );
 
-int libesedb_page_tree_get_number_of_leaf_values(
+int libesedb_page_tree_seek_leaf_value_by_index(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     int leaf_value_index,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_leaf_value_by_index(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
      uint32_t root_page_number,
-     int *number_of_leaf_values,
+     int leaf_value_index,
+     libesedb_data_definition_t *data_definition,
      libcerror_error_t **error );
 
 /* TODO deprecate */
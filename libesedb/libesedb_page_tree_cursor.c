@@ -0,0 +1,2900 @@
+/*
+ * Page tree cursor functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_key.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page.h"
+#include "libesedb_page_tree_cursor.h"
+#include "libesedb_page_tree_value.h"
+#include "libesedb_page_value.h"
+
+/* Creates a page tree cursor
+ * Make sure the value page_tree_cursor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_cursor_initialize(
+     libesedb_page_tree_cursor_t **page_tree_cursor,
+     libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     uint32_t root_page_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_tree_cursor_initialize";
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_tree_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page tree cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*page_tree_cursor = memory_allocate_structure(
+	                     libesedb_page_tree_cursor_t );
+
+	if( *page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *page_tree_cursor,
+	     0,
+	     sizeof( libesedb_page_tree_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	( *page_tree_cursor )->io_handle        = io_handle;
+	( *page_tree_cursor )->pages_vector     = pages_vector;
+	( *page_tree_cursor )->pages_cache      = pages_cache;
+	( *page_tree_cursor )->root_page_number = root_page_number;
+
+	return( 1 );
+
+on_error:
+	if( *page_tree_cursor != NULL )
+	{
+		memory_free(
+		 *page_tree_cursor );
+
+		*page_tree_cursor = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a page tree cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_cursor_free(
+     libesedb_page_tree_cursor_t **page_tree_cursor,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_tree_cursor_free";
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_tree_cursor != NULL )
+	{
+		/* The io_handle, pages_vector and pages_cache references are freed elsewhere
+		 */
+		memory_free(
+		 *page_tree_cursor );
+
+		*page_tree_cursor = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific page
+ * Branch (non-leaf) pages are retrieved from the branch pages cache, if available,
+ * so that leaf pages read during scans do not evict the upper levels of the tree
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_cursor_get_page(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_tree_cursor_get_page";
+	uint32_t page_flags   = 0;
+	int result            = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( page_number > page_tree_cursor->io_handle->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number: %" PRIu32 " value out of bounds.",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->io_handle->branch_pages_cache != NULL )
+	{
+		result = libesedb_page_tree_cursor_get_branch_page(
+		          page_tree_cursor,
+		          page_number,
+		          page,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve branch page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( libfdata_vector_get_element_value_by_index(
+	     page_tree_cursor->pages_vector,
+	     (intptr_t *) file_io_handle,
+	     (libfdata_cache_t *) page_tree_cursor->pages_cache,
+	     (int) page_number - 1,
+	     (intptr_t **) page,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	if( libesedb_page_validate_page(
+	     *page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		*page = NULL;
+
+		return( -1 );
+	}
+	if( page_tree_cursor->io_handle->branch_pages_cache != NULL )
+	{
+		if( libesedb_page_get_flags(
+		     *page,
+		     &page_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 " flags.",
+			 function,
+			 page_number );
+
+			*page = NULL;
+
+			return( -1 );
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+		{
+			if( libesedb_page_tree_cursor_cache_branch_page(
+			     page_tree_cursor,
+			     page_number,
+			     page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to cache branch page: %" PRIu32 ".",
+				 function,
+				 page_number );
+
+				*page = NULL;
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific page from the branch pages cache
+ * Returns 1 if successful, 0 if the page is not cached or -1 on error
+ */
+int libesedb_page_tree_cursor_get_branch_page(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libesedb_page_tree_cursor_get_branch_page";
+	off64_t cache_value_offset           = 0;
+	off64_t page_offset                  = 0;
+	int64_t cache_value_timestamp        = 0;
+	int cache_entry_index                = 0;
+	int cache_value_file_index           = 0;
+	int number_of_cache_entries          = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_get_number_of_entries(
+	     page_tree_cursor->io_handle->branch_pages_cache,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_cache_entries <= 0 )
+	{
+		return( 0 );
+	}
+	cache_entry_index = (int) ( page_number % (uint32_t) number_of_cache_entries );
+
+	if( libfcache_cache_get_value_by_index(
+	     page_tree_cursor->io_handle->branch_pages_cache,
+	     cache_entry_index,
+	     &cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( cache_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfcache_cache_value_get_identifier(
+	     cache_value,
+	     &cache_value_file_index,
+	     &cache_value_offset,
+	     &cache_value_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value identifier.",
+		 function );
+
+		return( -1 );
+	}
+	page_offset = page_tree_cursor->io_handle->pages_data_offset
+	            + ( (off64_t) ( page_number - 1 ) * page_tree_cursor->io_handle->page_size );
+
+	if( cache_value_offset != page_offset )
+	{
+		return( 0 );
+	}
+	if( libfcache_cache_value_get_value(
+	     cache_value,
+	     (intptr_t **) page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Stores a specific branch page in the branch pages cache
+ * The branch page is cloned from the page retrieved from the pages cache,
+ * which can evict it during a scan, so that it is not read from the file again
+ * On return page references the page in the branch pages cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_cursor_cache_branch_page(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *branch_page = NULL;
+	static char *function        = "libesedb_page_tree_cursor_cache_branch_page";
+	off64_t page_offset          = 0;
+	int cache_entry_index        = 0;
+	int number_of_cache_entries  = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing page.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_get_number_of_entries(
+	     page_tree_cursor->io_handle->branch_pages_cache,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_cache_entries <= 0 )
+	{
+		return( 1 );
+	}
+	cache_entry_index = (int) ( page_number % (uint32_t) number_of_cache_entries );
+
+	page_offset = page_tree_cursor->io_handle->pages_data_offset
+	            + ( (off64_t) ( page_number - 1 ) * page_tree_cursor->io_handle->page_size );
+
+	if( libesedb_page_clone(
+	     &branch_page,
+	     *page,
+	     page_tree_cursor->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clone branch page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		goto on_error;
+	}
+	if( libfcache_cache_set_value_by_index(
+	     page_tree_cursor->io_handle->branch_pages_cache,
+	     cache_entry_index,
+	     0,
+	     page_offset,
+	     0,
+	     (intptr_t *) branch_page,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_free,
+	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set branch page: %" PRIu32 " in cache.",
+		 function,
+		 page_number );
+
+		goto on_error;
+	}
+	*page = branch_page;
+
+	return( 1 );
+
+on_error:
+	if( branch_page != NULL )
+	{
+		libesedb_page_free(
+		 &branch_page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the header of a specific page
+ * The page is read outside of the pages cache and its page values are not read,
+ * which allows a single page to be reused to read the headers of multiple pages
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_cursor_read_page_header(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     libesedb_page_t *page,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_tree_cursor_read_page_header";
+	off64_t page_offset   = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( page_number > page_tree_cursor->io_handle->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number: %" PRIu32 " value out of bounds.",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	page_offset = page_tree_cursor->io_handle->pages_data_offset
+	            + ( (off64_t) ( page_number - 1 ) * page_tree_cursor->io_handle->page_size );
+
+	if( libesedb_page_read_header_file_io_handle(
+	     page,
+	     page_tree_cursor->io_handle,
+	     file_io_handle,
+	     page_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page: %" PRIu32 " header.",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the child page number of a specific branch page value
+ * Returns 1 if successful, 0 if the page value is defunct or -1 on error
+ */
+int libesedb_page_tree_cursor_get_child_page_number(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     uint32_t *child_page_number,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	static char *function                       = "libesedb_page_tree_cursor_get_child_page_number";
+	uint32_t safe_child_page_number             = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( child_page_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid child page number.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_value_by_index(
+	     page,
+	     page_value_index,
+	     &page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+	{
+		return( 0 );
+	}
+	if( libesedb_page_tree_value_initialize(
+	     &page_tree_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_value_read_data(
+	     page_tree_value,
+	     page_value->data,
+	     (size_t) page_value->size,
+	     page_value->flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page tree value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	if( page_tree_value->data_size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page tree value data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 page_tree_value->data,
+	 safe_child_page_number );
+
+	if( libesedb_page_tree_value_free(
+	     &page_tree_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page tree value.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( safe_child_page_number == 0 )
+	 || ( safe_child_page_number > page_tree_cursor->io_handle->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid child page number: %" PRIu32 " value out of bounds.",
+		 function,
+		 safe_child_page_number );
+
+		goto on_error;
+	}
+	*child_page_number = safe_child_page_number;
+
+	return( 1 );
+
+on_error:
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the page number of the first or last leaf page
+ * The leaf page is determined by descending from the root page along the first
+ * or last non-defunct child of every branch page
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_cursor_get_outer_leaf_page_number(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     uint8_t get_last,
+     uint32_t *leaf_page_number,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page          = NULL;
+	static char *function          = "libesedb_page_tree_cursor_get_outer_leaf_page_number";
+	uint32_t child_page_number     = 0;
+	uint32_t page_flags            = 0;
+	uint32_t page_number           = 0;
+	uint16_t number_of_page_values = 0;
+	uint16_t page_value_iterator   = 0;
+	int recursion_depth            = 0;
+	int result                     = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_page_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf page number.",
+		 function );
+
+		return( -1 );
+	}
+	page_number = page_tree_cursor->root_page_number;
+
+	for( recursion_depth = 0;
+	     recursion_depth < LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH;
+	     recursion_depth++ )
+	{
+		if( libesedb_page_tree_cursor_get_page(
+		     page_tree_cursor,
+		     file_io_handle,
+		     page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		if( libesedb_page_get_flags(
+		     page,
+		     &page_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 " flags.",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		if( ( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		 || ( ( page_flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 ) )
+		{
+			*leaf_page_number = page_number;
+
+			return( 1 );
+		}
+		if( libesedb_page_get_number_of_values(
+		     page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page: %" PRIu32 " values.",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		/* Page value 0 contains the common page key and is skipped
+		 */
+		result = 0;
+
+		for( page_value_iterator = 1;
+		     page_value_iterator < number_of_page_values;
+		     page_value_iterator++ )
+		{
+			result = libesedb_page_tree_cursor_get_child_page_number(
+			          page_tree_cursor,
+			          page,
+			          ( get_last != 0 ) ? number_of_page_values - page_value_iterator : page_value_iterator,
+			          &child_page_number,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve child page number from page: %" PRIu32 ".",
+				 function,
+				 page_number );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				break;
+			}
+		}
+		if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing child page number in page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		page_number = child_page_number;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid recursion depth value out of bounds.",
+	 function );
+
+	return( -1 );
+}
+
+/* Reads the number of values of the current leaf page
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_cursor_read_leaf_page_header(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libesedb_page_t *page,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_tree_cursor_read_leaf_page_header";
+	uint32_t page_flags   = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_flags(
+	     page,
+	     &page_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 " flags.",
+		 function,
+		 page_tree_cursor->page_number );
+
+		return( -1 );
+	}
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+	{
+		page_tree_cursor->number_of_page_values = 0;
+
+		return( 1 );
+	}
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported page: %" PRIu32 " flags - not a leaf page.",
+		 function,
+		 page_tree_cursor->page_number );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &( page_tree_cursor->number_of_page_values ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page: %" PRIu32 " values.",
+		 function,
+		 page_tree_cursor->page_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data definition of the leaf value at the current page value index
+ * Returns 1 if successful, 0 if the page value is defunct or -1 on error
+ */
+int libesedb_page_tree_cursor_get_leaf_value(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libesedb_page_t *page,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	static char *function                       = "libesedb_page_tree_cursor_get_leaf_value";
+	size_t data_offset                          = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_value_by_index(
+	     page,
+	     page_tree_cursor->page_value_index,
+	     &page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 ".",
+		 function,
+		 page_tree_cursor->page_value_index );
+
+		goto on_error;
+	}
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page value: %" PRIu16 ".",
+		 function,
+		 page_tree_cursor->page_value_index );
+
+		goto on_error;
+	}
+	if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+	{
+		return( 0 );
+	}
+	if( libesedb_page_tree_value_initialize(
+	     &page_tree_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_value_read_data(
+	     page_tree_value,
+	     page_value->data,
+	     (size_t) page_value->size,
+	     page_value->flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page tree value: %" PRIu16 ".",
+		 function,
+		 page_tree_cursor->page_value_index );
+
+		goto on_error;
+	}
+	data_offset = (size_t) page_value->offset + 2 + page_tree_value->local_key_size;
+
+	if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+	{
+		data_offset += 2;
+	}
+	if( ( data_offset > (size_t) UINT16_MAX )
+	 || ( page_tree_value->data_size > (size_t) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page value: %" PRIu16 " data offset or size value out of bounds.",
+		 function,
+		 page_tree_cursor->page_value_index );
+
+		goto on_error;
+	}
+	data_definition->page_offset      = (off64_t) ( page_tree_cursor->page_number - 1 ) * page_tree_cursor->io_handle->page_size;
+	data_definition->page_number      = page_tree_cursor->page_number;
+	data_definition->page_value_index = page_tree_cursor->page_value_index;
+	data_definition->data_offset      = (uint16_t) data_offset;
+	data_definition->data_size        = (uint16_t) page_tree_value->data_size;
+
+	if( libesedb_page_tree_value_free(
+	     &page_tree_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page tree value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the data definition of the next leaf value
+ * If the cursor is not positioned it descends to the first leaf page, otherwise it
+ * advances by page value index and follows the next page numbers of the leaf pages
+ * When the last leaf value was passed the cursor remains positioned after it
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_page_tree_cursor_get_next_leaf_value(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page         = NULL;
+	static char *function         = "libesedb_page_tree_cursor_get_next_leaf_value";
+	uint32_t next_page_number     = 0;
+	uint32_t number_of_leaf_pages = 0;
+	uint32_t page_number          = 0;
+	uint8_t read_page_header      = 0;
+	int result                    = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->page_number == 0 )
+	{
+		if( libesedb_page_tree_cursor_get_outer_leaf_page_number(
+		     page_tree_cursor,
+		     file_io_handle,
+		     0,
+		     &page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first leaf page number.",
+			 function );
+
+			return( -1 );
+		}
+		page_tree_cursor->page_number      = page_number;
+		page_tree_cursor->page_value_index = 0;
+
+		read_page_header = 1;
+	}
+	for( ;; )
+	{
+		/* The page is retrieved from the pages cache on every call, this is a cache hit
+		 * unless the page was evicted since the previous call
+		 */
+		if( libesedb_page_tree_cursor_get_page(
+		     page_tree_cursor,
+		     file_io_handle,
+		     page_tree_cursor->page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_tree_cursor->page_number );
+
+			return( -1 );
+		}
+		if( read_page_header != 0 )
+		{
+			if( libesedb_page_tree_cursor_read_leaf_page_header(
+			     page_tree_cursor,
+			     page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read leaf page header.",
+				 function );
+
+				return( -1 );
+			}
+			read_page_header = 0;
+		}
+		/* Page value 0 contains the common page key and is skipped
+		 */
+		while( ( page_tree_cursor->page_value_index + 1 ) < page_tree_cursor->number_of_page_values )
+		{
+			page_tree_cursor->page_value_index += 1;
+
+			result = libesedb_page_tree_cursor_get_leaf_value(
+			          page_tree_cursor,
+			          page,
+			          data_definition,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve leaf value: %" PRIu16 " from page: %" PRIu32 ".",
+				 function,
+				 page_tree_cursor->page_value_index,
+				 page_tree_cursor->page_number );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				return( 1 );
+			}
+		}
+		if( libesedb_page_get_next_page_number(
+		     page,
+		     &next_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 " next page number.",
+			 function,
+			 page_tree_cursor->page_number );
+
+			return( -1 );
+		}
+		if( next_page_number == 0 )
+		{
+			break;
+		}
+		if( next_page_number == page_tree_cursor->page_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid next page number: %" PRIu32 " value out of bounds.",
+			 function,
+			 next_page_number );
+
+			return( -1 );
+		}
+		/* Prevent an endless loop on a corrupted leaf page chain
+		 */
+		if( number_of_leaf_pages >= page_tree_cursor->io_handle->last_page_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of leaf pages value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_leaf_pages++;
+
+		page_tree_cursor->page_number      = next_page_number;
+		page_tree_cursor->page_value_index = 0;
+
+		read_page_header = 1;
+	}
+	page_tree_cursor->page_value_index = page_tree_cursor->number_of_page_values;
+
+	return( 0 );
+}
+
+/* Retrieves the data definition of the previous leaf value
+ * If the cursor is not positioned it descends to the last leaf page, otherwise it
+ * moves back by page value index and follows the previous page numbers of the leaf pages
+ * When the first leaf value was passed the cursor remains positioned before it
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_page_tree_cursor_get_previous_leaf_value(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page         = NULL;
+	static char *function         = "libesedb_page_tree_cursor_get_previous_leaf_value";
+	uint32_t number_of_leaf_pages = 0;
+	uint32_t page_number          = 0;
+	uint32_t previous_page_number = 0;
+	uint8_t read_page_header      = 0;
+	int result                    = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->page_number == 0 )
+	{
+		if( libesedb_page_tree_cursor_get_outer_leaf_page_number(
+		     page_tree_cursor,
+		     file_io_handle,
+		     1,
+		     &page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last leaf page number.",
+			 function );
+
+			return( -1 );
+		}
+		page_tree_cursor->page_number = page_number;
+
+		read_page_header = 1;
+	}
+	for( ;; )
+	{
+		if( libesedb_page_tree_cursor_get_page(
+		     page_tree_cursor,
+		     file_io_handle,
+		     page_tree_cursor->page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_tree_cursor->page_number );
+
+			return( -1 );
+		}
+		if( read_page_header != 0 )
+		{
+			if( libesedb_page_tree_cursor_read_leaf_page_header(
+			     page_tree_cursor,
+			     page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read leaf page header.",
+				 function );
+
+				return( -1 );
+			}
+			page_tree_cursor->page_value_index = page_tree_cursor->number_of_page_values;
+
+			read_page_header = 0;
+		}
+		/* Page value 0 contains the common page key and is skipped
+		 */
+		while( page_tree_cursor->page_value_index > 1 )
+		{
+			page_tree_cursor->page_value_index -= 1;
+
+			result = libesedb_page_tree_cursor_get_leaf_value(
+			          page_tree_cursor,
+			          page,
+			          data_definition,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve leaf value: %" PRIu16 " from page: %" PRIu32 ".",
+				 function,
+				 page_tree_cursor->page_value_index,
+				 page_tree_cursor->page_number );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				return( 1 );
+			}
+		}
+		if( libesedb_page_get_previous_page_number(
+		     page,
+		     &previous_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 " previous page number.",
+			 function,
+			 page_tree_cursor->page_number );
+
+			return( -1 );
+		}
+		if( previous_page_number == 0 )
+		{
+			break;
+		}
+		if( previous_page_number == page_tree_cursor->page_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid previous page number: %" PRIu32 " value out of bounds.",
+			 function,
+			 previous_page_number );
+
+			return( -1 );
+		}
+		/* Prevent an endless loop on a corrupted leaf page chain
+		 */
+		if( number_of_leaf_pages >= page_tree_cursor->io_handle->last_page_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of leaf pages value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_leaf_pages++;
+
+		page_tree_cursor->page_number = previous_page_number;
+
+		read_page_header = 1;
+	}
+	page_tree_cursor->page_value_index = 0;
+
+	return( 0 );
+}
+
+/* Retrieves the key of a specific page value
+ * The key of the page value consists of the common key, stored in page value 0,
+ * and the local key of the page value
+ * The key data is set in key, which should not contain data
+ * Returns 1 if successful, 0 if the page value is defunct or -1 on error
+ */
+int libesedb_page_tree_cursor_get_key(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     libesedb_key_t *key,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *header_page_value    = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	static char *function                       = "libesedb_page_tree_cursor_get_key";
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_value_by_index(
+	     page,
+	     page_value_index,
+	     &page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+	{
+		return( 0 );
+	}
+	if( libesedb_page_tree_value_initialize(
+	     &page_tree_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_value_read_data(
+	     page_tree_value,
+	     page_value->data,
+	     (size_t) page_value->size,
+	     page_value->flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page tree value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	if( page_tree_value->common_key_size > 0 )
+	{
+		if( libesedb_page_get_value_by_index(
+		     page,
+		     0,
+		     &header_page_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: 0.",
+			 function );
+
+			goto on_error;
+		}
+		if( header_page_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing page value: 0.",
+			 function );
+
+			goto on_error;
+		}
+		if( page_tree_value->common_key_size > header_page_value->size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: common key size exceeds header page value size.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_key_set_data(
+		     key,
+		     header_page_value->data,
+		     (size_t) page_tree_value->common_key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set common key data in key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_key_append_data(
+	     key,
+	     page_tree_value->local_key,
+	     (size_t) page_tree_value->local_key_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to append local key data to key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_value_free(
+	     &page_tree_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page tree value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares a key with the key of a specific page value
+ * Returns 1 if successful, 0 if the page value is defunct or -1 on error
+ */
+int libesedb_page_tree_cursor_compare_key(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     libesedb_key_t *key,
+     uint8_t page_key_type,
+     int *compare_result,
+     libcerror_error_t **error )
+{
+	libesedb_key_t *page_key = NULL;
+	static char *function    = "libesedb_page_tree_cursor_compare_key";
+	int result               = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( compare_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compare result.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_key_initialize(
+	     &page_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page key.",
+		 function );
+
+		goto on_error;
+	}
+	page_key->type = page_key_type;
+
+	result = libesedb_page_tree_cursor_get_key(
+	          page_tree_cursor,
+	          page,
+	          page_value_index,
+	          page_key,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key of page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libesedb_key_free(
+		     &page_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page key.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	result = libesedb_key_compare(
+	          key,
+	          page_key,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare key with key of page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	if( libesedb_key_free(
+	     &page_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page key.",
+		 function );
+
+		goto on_error;
+	}
+	*compare_result = result;
+
+	return( 1 );
+
+on_error:
+	if( page_key != NULL )
+	{
+		libesedb_key_free(
+		 &page_key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines the index of the first non-defunct page value of which the key
+ * compares as not less than the key, by a binary search of the page values
+ * Returns 1 if successful, 0 if no such page value or -1 on error
+ */
+int libesedb_page_tree_cursor_get_lower_bound_page_value_index(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libesedb_page_t *page,
+     libesedb_key_t *key,
+     uint8_t page_key_type,
+     uint16_t *page_value_index,
+     libcerror_error_t **error )
+{
+	static char *function          = "libesedb_page_tree_cursor_get_lower_bound_page_value_index";
+	uint16_t high_value_index      = 0;
+	uint16_t live_value_index      = 0;
+	uint16_t low_value_index       = 1;
+	uint16_t middle_value_index    = 0;
+	uint16_t number_of_page_values = 0;
+	int compare_result             = 0;
+	int result                     = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &number_of_page_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page values.",
+		 function );
+
+		return( -1 );
+	}
+	/* Page value 0 contains the common page key and is skipped
+	 * The non-defunct page values before low_value_index compare as less than the key
+	 * and the non-defunct page values from high_value_index onwards as not less
+	 */
+	if( number_of_page_values > 1 )
+	{
+		high_value_index = number_of_page_values;
+	}
+	else
+	{
+		high_value_index = 1;
+	}
+	while( low_value_index < high_value_index )
+	{
+		middle_value_index = low_value_index + ( ( high_value_index - low_value_index ) / 2 );
+
+		/* Defunct page values are skipped by moving to the next non-defunct page value
+		 */
+		for( live_value_index = middle_value_index;
+		     live_value_index < high_value_index;
+		     live_value_index++ )
+		{
+			result = libesedb_page_tree_cursor_compare_key(
+			          page_tree_cursor,
+			          page,
+			          live_value_index,
+			          key,
+			          page_key_type,
+			          &compare_result,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare key with key of page value: %" PRIu16 ".",
+				 function,
+				 live_value_index );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				break;
+			}
+		}
+		if( result == 0 )
+		{
+			high_value_index = middle_value_index;
+		}
+		else if( compare_result == LIBFDATA_COMPARE_GREATER )
+		{
+			low_value_index = live_value_index + 1;
+		}
+		else
+		{
+			high_value_index = live_value_index;
+		}
+	}
+	/* The page value at the lower bound can be defunct
+	 */
+	for( live_value_index = low_value_index;
+	     live_value_index < number_of_page_values;
+	     live_value_index++ )
+	{
+		result = libesedb_page_tree_cursor_compare_key(
+		          page_tree_cursor,
+		          page,
+		          live_value_index,
+		          key,
+		          page_key_type,
+		          &compare_result,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key with key of page value: %" PRIu16 ".",
+			 function,
+			 live_value_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*page_value_index = live_value_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Compares a key with the key of the leaf value the cursor is positioned on
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_cursor_compare_leaf_value_key(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_key_t *key,
+     int *compare_result,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page = NULL;
+	static char *function = "libesedb_page_tree_cursor_compare_leaf_value_key";
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_cursor_get_page(
+	     page_tree_cursor,
+	     file_io_handle,
+	     page_tree_cursor->page_number,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 page_tree_cursor->page_number );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_cursor_compare_key(
+	     page_tree_cursor,
+	     page,
+	     page_tree_cursor->page_value_index,
+	     key,
+	     LIBESEDB_KEY_TYPE_LEAF,
+	     compare_result,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare key with key of leaf value: %" PRIu16 " in page: %" PRIu32 ".",
+		 function,
+		 page_tree_cursor->page_value_index,
+		 page_tree_cursor->page_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the key of the leaf value the cursor is positioned on
+ * The key data is set in key, which should not contain data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_cursor_get_leaf_value_key(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_key_t *key,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page = NULL;
+	static char *function = "libesedb_page_tree_cursor_get_leaf_value_key";
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_cursor_get_page(
+	     page_tree_cursor,
+	     file_io_handle,
+	     page_tree_cursor->page_number,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 page_tree_cursor->page_number );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_cursor_get_key(
+	     page_tree_cursor,
+	     page,
+	     page_tree_cursor->page_value_index,
+	     key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key of leaf value: %" PRIu16 " in page: %" PRIu32 ".",
+		 function,
+		 page_tree_cursor->page_value_index,
+		 page_tree_cursor->page_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Positions the cursor on a leaf value by key
+ * The branch pages are descended by a binary search of their page values after which
+ * the leaf page is searched by a binary search. The comparison operator determines
+ * the leaf value that is sought:
+ * LIBESEDB_COMPARISON_OPERATOR_EQUAL the leaf value with a key equal to the key
+ * LIBESEDB_COMPARISON_OPERATOR_LESS the last leaf value with a key less than the key
+ * LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL the last leaf value with a key not greater than the key
+ * LIBESEDB_COMPARISON_OPERATOR_GREATER the first leaf value with a key greater than the key
+ * LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL the first leaf value with a key not less than the key
+ * If found the cursor is positioned before the leaf value, so that the next leaf value
+ * is the leaf value that was sought, otherwise the cursor is not positioned
+ * The data definition is used to store intermediate leaf values
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_page_tree_cursor_seek_leaf_value(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_key_t *key,
+     int comparison_operator,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page                = NULL;
+	static char *function                = "libesedb_page_tree_cursor_seek_leaf_value";
+	uint32_t child_page_number           = 0;
+	uint32_t page_flags                  = 0;
+	uint32_t page_number                 = 0;
+	uint32_t saved_page_number           = 0;
+	uint16_t number_of_page_values       = 0;
+	uint16_t page_value_index            = 0;
+	uint16_t saved_number_of_page_values = 0;
+	uint16_t saved_page_value_index      = 0;
+	uint8_t is_after_first_value         = 0;
+	int compare_result                   = 0;
+	int recursion_depth                  = 0;
+	int result                           = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( comparison_operator != LIBESEDB_COMPARISON_OPERATOR_EQUAL )
+	 && ( comparison_operator != LIBESEDB_COMPARISON_OPERATOR_LESS )
+	 && ( comparison_operator != LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL )
+	 && ( comparison_operator != LIBESEDB_COMPARISON_OPERATOR_GREATER )
+	 && ( comparison_operator != LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported comparison operator.",
+		 function );
+
+		return( -1 );
+	}
+	page_tree_cursor->page_number = 0;
+
+	page_number = page_tree_cursor->root_page_number;
+
+	for( recursion_depth = 0;
+	     recursion_depth < LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH;
+	     recursion_depth++ )
+	{
+		if( libesedb_page_tree_cursor_get_page(
+		     page_tree_cursor,
+		     file_io_handle,
+		     page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		if( libesedb_page_get_flags(
+		     page,
+		     &page_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 " flags.",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		if( ( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		 || ( ( page_flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 ) )
+		{
+			break;
+		}
+		result = libesedb_page_tree_cursor_get_lower_bound_page_value_index(
+		          page_tree_cursor,
+		          page,
+		          key,
+		          LIBESEDB_KEY_TYPE_BRANCH,
+		          &page_value_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to search page: %" PRIu32 " values.",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			result = libesedb_page_tree_cursor_get_child_page_number(
+			          page_tree_cursor,
+			          page,
+			          page_value_index,
+			          &child_page_number,
+			          error );
+		}
+		else
+		{
+			/* The key is greater than the keys of all the child pages
+			 * in which case the last non-defunct child page is descended
+			 */
+			if( libesedb_page_get_number_of_values(
+			     page,
+			     &number_of_page_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of page: %" PRIu32 " values.",
+				 function,
+				 page_number );
+
+				return( -1 );
+			}
+			for( page_value_index = number_of_page_values;
+			     page_value_index > 1;
+			     page_value_index-- )
+			{
+				result = libesedb_page_tree_cursor_get_child_page_number(
+				          page_tree_cursor,
+				          page,
+				          page_value_index - 1,
+				          &child_page_number,
+				          error );
+
+				if( result != 0 )
+				{
+					break;
+				}
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve child page number from page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing child page number in page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		page_number = child_page_number;
+	}
+	if( recursion_depth >= LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	page_tree_cursor->page_number = page_number;
+
+	if( libesedb_page_tree_cursor_read_leaf_page_header(
+	     page_tree_cursor,
+	     page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read leaf page header.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_page_tree_cursor_get_lower_bound_page_value_index(
+	          page_tree_cursor,
+	          page,
+	          key,
+	          LIBESEDB_KEY_TYPE_LEAF,
+	          &page_value_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to search page: %" PRIu32 " values.",
+		 function,
+		 page_number );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		page_tree_cursor->page_value_index = page_value_index;
+	}
+	else
+	{
+		page_tree_cursor->page_value_index = page_tree_cursor->number_of_page_values;
+	}
+	/* A branch key that equals the key refers to the next child page, see libesedb_key_compare,
+	 * hence leaf values not less than the key can be stored in the preceding leaf pages.
+	 * Move backwards until the cursor is positioned on a leaf value less than the key
+	 * or before the first leaf value
+	 */
+	for( ;; )
+	{
+		result = libesedb_page_tree_cursor_get_previous_leaf_value(
+		          page_tree_cursor,
+		          file_io_handle,
+		          data_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve previous leaf value.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libesedb_page_tree_cursor_compare_leaf_value_key(
+		     page_tree_cursor,
+		     file_io_handle,
+		     key,
+		     &compare_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key with key of leaf value.",
+			 function );
+
+			goto on_error;
+		}
+		if( compare_result == LIBFDATA_COMPARE_GREATER )
+		{
+			break;
+		}
+	}
+	/* The cursor is now positioned before the first leaf value not less than the key,
+	 * which is on the last leaf value less than the key if such a leaf value exists
+	 */
+	is_after_first_value = (uint8_t) ( page_tree_cursor->page_value_index > 0 );
+
+	for( ;; )
+	{
+		saved_page_number           = page_tree_cursor->page_number;
+		saved_number_of_page_values = page_tree_cursor->number_of_page_values;
+		saved_page_value_index      = page_tree_cursor->page_value_index;
+
+		result = libesedb_page_tree_cursor_get_next_leaf_value(
+		          page_tree_cursor,
+		          file_io_handle,
+		          data_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next leaf value.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libesedb_page_tree_cursor_compare_leaf_value_key(
+			     page_tree_cursor,
+			     file_io_handle,
+			     key,
+			     &compare_result,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare key with key of leaf value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* Leaf values equal to the key are passed when seeking a greater leaf value
+		 */
+		if( ( result == 0 )
+		 || ( compare_result != LIBFDATA_COMPARE_EQUAL )
+		 || ( comparison_operator != LIBESEDB_COMPARISON_OPERATOR_GREATER ) )
+		{
+			break;
+		}
+	}
+	page_tree_cursor->page_number           = saved_page_number;
+	page_tree_cursor->number_of_page_values = saved_number_of_page_values;
+	page_tree_cursor->page_value_index      = saved_page_value_index;
+
+	if( ( result != 0 )
+	 && ( compare_result == LIBFDATA_COMPARE_EQUAL )
+	 && ( ( comparison_operator == LIBESEDB_COMPARISON_OPERATOR_EQUAL )
+	  || ( comparison_operator == LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL ) ) )
+	{
+		return( 1 );
+	}
+	if( ( result != 0 )
+	 && ( ( comparison_operator == LIBESEDB_COMPARISON_OPERATOR_GREATER )
+	  || ( comparison_operator == LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL ) ) )
+	{
+		return( 1 );
+	}
+	if( ( is_after_first_value != 0 )
+	 && ( ( comparison_operator == LIBESEDB_COMPARISON_OPERATOR_LESS )
+	  || ( comparison_operator == LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL ) ) )
+	{
+		/* Position the cursor before the last leaf value less than the key
+		 */
+		if( libesedb_page_tree_cursor_get_previous_leaf_value(
+		     page_tree_cursor,
+		     file_io_handle,
+		     data_definition,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve previous leaf value.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	page_tree_cursor->page_number = 0;
+
+	return( 0 );
+
+on_error:
+	page_tree_cursor->page_number = 0;
+
+	return( -1 );
+}
+
+/* Determines the number of leaf values
+ * This descends to the first leaf page and follows the next page numbers of the leaf pages,
+ * where only the page header and page tags of the leaf pages are read
+ * The current position of the cursor is not changed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_cursor_get_number_of_leaf_values(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     int *number_of_leaf_values,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *leaf_page     = NULL;
+	static char *function          = "libesedb_page_tree_cursor_get_number_of_leaf_values";
+	uint32_t next_page_number      = 0;
+	uint32_t number_of_leaf_pages  = 0;
+	uint32_t page_flags            = 0;
+	uint32_t page_number           = 0;
+	uint16_t number_of_page_values = 0;
+	int safe_number_of_leaf_values = 0;
+
+	if( page_tree_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_cursor->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree cursor - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_cursor_get_outer_leaf_page_number(
+	     page_tree_cursor,
+	     file_io_handle,
+	     0,
+	     &page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first leaf page number.",
+		 function );
+
+		goto on_error;
+	}
+	/* The leaf pages are read into a single page, outside of the pages cache,
+	 * to prevent the leaf pages from evicting the branch pages
+	 */
+	if( libesedb_page_initialize(
+	     &leaf_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create leaf page.",
+		 function );
+
+		goto on_error;
+	}
+	while( page_number != 0 )
+	{
+		/* Prevent an endless loop on a corrupted leaf page chain
+		 */
+		if( number_of_leaf_pages >= page_tree_cursor->io_handle->last_page_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of leaf pages value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_leaf_pages++;
+
+		if( libesedb_page_tree_cursor_read_page_header(
+		     page_tree_cursor,
+		     file_io_handle,
+		     page_number,
+		     leaf_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page: %" PRIu32 " header.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_flags(
+		     leaf_page,
+		     &page_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 " flags.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+		{
+			number_of_page_values = 0;
+		}
+		else if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported page: %" PRIu32 " flags - not a leaf page.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		else if( libesedb_page_get_number_of_live_values_from_tags(
+		          leaf_page,
+		          page_tree_cursor->io_handle,
+		          &number_of_page_values,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page: %" PRIu32 " values.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( (int) number_of_page_values > ( INT_MAX - safe_number_of_leaf_values ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of leaf values value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		safe_number_of_leaf_values += (int) number_of_page_values;
+
+		if( libesedb_page_get_next_page_number(
+		     leaf_page,
+		     &next_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 " next page number.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( next_page_number == page_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid next page number: %" PRIu32 " value out of bounds.",
+			 function,
+			 next_page_number );
+
+			goto on_error;
+		}
+		page_number = next_page_number;
+	}
+	if( libesedb_page_free(
+	     &leaf_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free leaf page.",
+		 function );
+
+		goto on_error;
+	}
+	*number_of_leaf_values = safe_number_of_leaf_values;
+
+	return( 1 );
+
+on_error:
+	if( leaf_page != NULL )
+	{
+		libesedb_page_free(
+		 &leaf_page,
+		 NULL );
+	}
+	return( -1 );
+}
+
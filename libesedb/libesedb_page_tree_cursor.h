@@ -0,0 +1,208 @@
+/*
+ * Page tree cursor functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_PAGE_TREE_CURSOR_H )
+#define _LIBESEDB_PAGE_TREE_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_key.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_page_tree_cursor libesedb_page_tree_cursor_t;
+
+struct libesedb_page_tree_cursor
+{
+	/* The IO handle
+	 */
+	libesedb_io_handle_t *io_handle;
+
+	/* The pages vector
+	 */
+	libfdata_vector_t *pages_vector;
+
+	/* The pages cache
+	 */
+	libfcache_cache_t *pages_cache;
+
+	/* The root page number
+	 */
+	uint32_t root_page_number;
+
+	/* The current (leaf) page number
+	 * 0 when the cursor is not positioned
+	 */
+	uint32_t page_number;
+
+	/* The number of values in the current page
+	 */
+	uint16_t number_of_page_values;
+
+	/* The current page value index
+	 * 0 when positioned before the first value of the page
+	 * and the number of page values when positioned after the last value
+	 */
+	uint16_t page_value_index;
+};
+
+int libesedb_page_tree_cursor_initialize(
+     libesedb_page_tree_cursor_t **page_tree_cursor,
+     libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     uint32_t root_page_number,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_free(
+     libesedb_page_tree_cursor_t **page_tree_cursor,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_get_page(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_get_branch_page(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_cache_branch_page(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_read_page_header(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     libesedb_page_t *page,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_get_child_page_number(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     uint32_t *child_page_number,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_get_outer_leaf_page_number(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     uint8_t get_last,
+     uint32_t *leaf_page_number,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_read_leaf_page_header(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libesedb_page_t *page,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_get_leaf_value(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libesedb_page_t *page,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_get_next_leaf_value(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_get_previous_leaf_value(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_get_key(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     libesedb_key_t *key,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_compare_key(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     libesedb_key_t *key,
+     uint8_t page_key_type,
+     int *compare_result,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_get_lower_bound_page_value_index(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libesedb_page_t *page,
+     libesedb_key_t *key,
+     uint8_t page_key_type,
+     uint16_t *page_value_index,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_compare_leaf_value_key(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_key_t *key,
+     int *compare_result,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_get_leaf_value_key(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_key_t *key,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_seek_leaf_value(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     libesedb_key_t *key,
+     int comparison_operator,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_cursor_get_number_of_leaf_values(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     int *number_of_leaf_values,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_PAGE_TREE_CURSOR_H ) */
+
@@ -43,6 +43,10 @@ struct libesedb_page_tree_value
 	 */
 	uint16_t local_key_size;
 
+	/* The local key
+	 */
+	const uint8_t *local_key;
+
 	/* The data
 	 */
 	const uint8_t *data;
@@ -0,0 +1,511 @@
+/*
+ * Predicate functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_definitions.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_predicate.h"
+
+/* Creates a predicate
+ * Make sure the value predicate is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_predicate_initialize(
+     libesedb_predicate_t **predicate,
+     uint32_t column_identifier,
+     int comparison_operator,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_predicate_initialize";
+
+	if( predicate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid predicate.",
+		 function );
+
+		return( -1 );
+	}
+	if( *predicate != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid predicate value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( comparison_operator != LIBESEDB_COMPARISON_OPERATOR_EQUAL )
+	 && ( comparison_operator != LIBESEDB_COMPARISON_OPERATOR_NOT_EQUAL )
+	 && ( comparison_operator != LIBESEDB_COMPARISON_OPERATOR_LESS )
+	 && ( comparison_operator != LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL )
+	 && ( comparison_operator != LIBESEDB_COMPARISON_OPERATOR_GREATER )
+	 && ( comparison_operator != LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported comparison operator.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data_size == 0 )
+	 || ( value_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*predicate = memory_allocate_structure(
+	              libesedb_predicate_t );
+
+	if( *predicate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create predicate.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *predicate,
+	     0,
+	     sizeof( libesedb_predicate_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear predicate.",
+		 function );
+
+		memory_free(
+		 *predicate );
+
+		*predicate = NULL;
+
+		return( -1 );
+	}
+	( *predicate )->value_data = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * value_data_size );
+
+	if( ( *predicate )->value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( *predicate )->value_data,
+	     value_data,
+	     sizeof( uint8_t ) * value_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy value data.",
+		 function );
+
+		goto on_error;
+	}
+	( *predicate )->column_identifier   = column_identifier;
+	( *predicate )->comparison_operator = comparison_operator;
+	( *predicate )->value_data_size     = value_data_size;
+
+	return( 1 );
+
+on_error:
+	if( *predicate != NULL )
+	{
+		if( ( *predicate )->value_data != NULL )
+		{
+			memory_free(
+			 ( *predicate )->value_data );
+		}
+		memory_free(
+		 *predicate );
+
+		*predicate = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a predicate
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_predicate_free(
+     libesedb_predicate_t **predicate,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_predicate_free";
+
+	if( predicate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid predicate.",
+		 function );
+
+		return( -1 );
+	}
+	if( *predicate != NULL )
+	{
+		if( ( *predicate )->value_data != NULL )
+		{
+			memory_free(
+			 ( *predicate )->value_data );
+		}
+		memory_free(
+		 *predicate );
+
+		*predicate = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares the raw column data with the predicate value
+ * The data is expected to be stored in the same (little-endian) format as the predicate value
+ * A column without data (NULL) never matches
+ * Returns 1 if the data matches the predicate, 0 if not or -1 on error
+ */
+int libesedb_predicate_compare_data(
+     libesedb_predicate_t *predicate,
+     uint32_t column_type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	byte_stream_float32_t data_float32;
+	byte_stream_float32_t value_float32;
+	byte_stream_float64_t data_float64;
+	byte_stream_float64_t value_float64;
+
+	static char *function = "libesedb_predicate_compare_data";
+	size_t compare_size   = 0;
+	uint64_t data_value   = 0;
+	uint64_t value_value  = 0;
+	uint8_t integer_size  = 0;
+	int comparison_result = 0;
+	int is_signed         = 0;
+	int result            = 0;
+
+	if( predicate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid predicate.",
+		 function );
+
+		return( -1 );
+	}
+	if( predicate->value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid predicate - missing value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 || ( data_size == 0 ) )
+	{
+		return( 0 );
+	}
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			integer_size = 1;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			is_signed    = 1;
+			integer_size = 2;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			integer_size = 2;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			is_signed    = 1;
+			integer_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			integer_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			is_signed    = 1;
+			integer_size = 8;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			integer_size = 8;
+			break;
+
+		default:
+			break;
+	}
+	if( integer_size != 0 )
+	{
+		if( ( data_size != (size_t) integer_size )
+		 || ( predicate->value_data_size != (size_t) integer_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported data size: %" PRIzd " or value data size: %" PRIzd " for column type: %" PRIu32 ".",
+			 function,
+			 data_size,
+			 predicate->value_data_size,
+			 column_type );
+
+			return( -1 );
+		}
+		switch( integer_size )
+		{
+			case 1:
+				data_value  = data[ 0 ];
+				value_value = predicate->value_data[ 0 ];
+				break;
+
+			case 2:
+				byte_stream_copy_to_uint16_little_endian(
+				 data,
+				 data_value );
+
+				byte_stream_copy_to_uint16_little_endian(
+				 predicate->value_data,
+				 value_value );
+
+				if( is_signed != 0 )
+				{
+					data_value  = (uint64_t) (int64_t) (int16_t) data_value;
+					value_value = (uint64_t) (int64_t) (int16_t) value_value;
+				}
+				break;
+
+			case 4:
+				byte_stream_copy_to_uint32_little_endian(
+				 data,
+				 data_value );
+
+				byte_stream_copy_to_uint32_little_endian(
+				 predicate->value_data,
+				 value_value );
+
+				if( is_signed != 0 )
+				{
+					data_value  = (uint64_t) (int64_t) (int32_t) data_value;
+					value_value = (uint64_t) (int64_t) (int32_t) value_value;
+				}
+				break;
+
+			case 8:
+				byte_stream_copy_to_uint64_little_endian(
+				 data,
+				 data_value );
+
+				byte_stream_copy_to_uint64_little_endian(
+				 predicate->value_data,
+				 value_value );
+				break;
+		}
+		if( column_type == LIBESEDB_COLUMN_TYPE_FLOAT_32BIT )
+		{
+			data_float32.integer  = (uint32_t) data_value;
+			value_float32.integer = (uint32_t) value_value;
+
+			if( data_float32.floating_point < value_float32.floating_point )
+			{
+				comparison_result = -1;
+			}
+			else if( data_float32.floating_point > value_float32.floating_point )
+			{
+				comparison_result = 1;
+			}
+		}
+		else if( column_type == LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT )
+		{
+			data_float64.integer  = data_value;
+			value_float64.integer = value_value;
+
+			if( data_float64.floating_point < value_float64.floating_point )
+			{
+				comparison_result = -1;
+			}
+			else if( data_float64.floating_point > value_float64.floating_point )
+			{
+				comparison_result = 1;
+			}
+		}
+		else if( is_signed != 0 )
+		{
+			if( (int64_t) data_value < (int64_t) value_value )
+			{
+				comparison_result = -1;
+			}
+			else if( (int64_t) data_value > (int64_t) value_value )
+			{
+				comparison_result = 1;
+			}
+		}
+		else
+		{
+			if( data_value < value_value )
+			{
+				comparison_result = -1;
+			}
+			else if( data_value > value_value )
+			{
+				comparison_result = 1;
+			}
+		}
+	}
+	else
+	{
+		/* Binary data, text and GUID values are compared byte-wise
+		 */
+		compare_size = data_size;
+
+		if( compare_size > predicate->value_data_size )
+		{
+			compare_size = predicate->value_data_size;
+		}
+		comparison_result = memory_compare(
+		                     data,
+		                     predicate->value_data,
+		                     compare_size );
+
+		if( comparison_result == 0 )
+		{
+			if( data_size < predicate->value_data_size )
+			{
+				comparison_result = -1;
+			}
+			else if( data_size > predicate->value_data_size )
+			{
+				comparison_result = 1;
+			}
+		}
+	}
+	switch( predicate->comparison_operator )
+	{
+		case LIBESEDB_COMPARISON_OPERATOR_EQUAL:
+			result = ( comparison_result == 0 );
+			break;
+
+		case LIBESEDB_COMPARISON_OPERATOR_NOT_EQUAL:
+			result = ( comparison_result != 0 );
+			break;
+
+		case LIBESEDB_COMPARISON_OPERATOR_LESS:
+			result = ( comparison_result < 0 );
+			break;
+
+		case LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL:
+			result = ( comparison_result <= 0 );
+			break;
+
+		case LIBESEDB_COMPARISON_OPERATOR_GREATER:
+			result = ( comparison_result > 0 );
+			break;
+
+		case LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL:
+			result = ( comparison_result >= 0 );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported comparison operator: %d.",
+			 function,
+			 predicate->comparison_operator );
+
+			return( -1 );
+	}
+	return( result );
+}
+
@@ -0,0 +1,79 @@
+/*
+ * Predicate functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_PREDICATE_H )
+#define _LIBESEDB_PREDICATE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_predicate libesedb_predicate_t;
+
+struct libesedb_predicate
+{
+	/* The column identifier
+	 */
+	uint32_t column_identifier;
+
+	/* The comparison operator
+	 */
+	int comparison_operator;
+
+	/* The value data
+	 */
+	uint8_t *value_data;
+
+	/* The value data size
+	 */
+	size_t value_data_size;
+};
+
+int libesedb_predicate_initialize(
+     libesedb_predicate_t **predicate,
+     uint32_t column_identifier,
+     int comparison_operator,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+int libesedb_predicate_free(
+     libesedb_predicate_t **predicate,
+     libcerror_error_t **error );
+
+int libesedb_predicate_compare_data(
+     libesedb_predicate_t *predicate,
+     uint32_t column_type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_PREDICATE_H ) */
+
@@ -140,6 +140,8 @@ int libesedb_record_initialize(
 
 		return( -1 );
 	}
+	internal_record->decompressed_value_entry = -1;
+
 	if( libcdata_array_initialize(
 	     &( internal_record->values_array ),
 	     0,
@@ -251,6 +253,11 @@ int libesedb_record_free(
 
 			result = -1;
 		}
+		if( internal_record->decompressed_value_data != NULL )
+		{
+			memory_free(
+			 internal_record->decompressed_value_data );
+		}
 		memory_free(
 		 internal_record );
 	}
@@ -747,49 +754,471 @@ int libesedb_record_get_utf16_column_name(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( internal_record->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record - missing IO handle.",
-		 function );
+	if( internal_record->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_column_catalog_definition(
+	     internal_record,
+	     value_entry,
+	     &column_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_definition_get_utf16_name(
+	     column_catalog_definition,
+	     utf16_string,
+	     utf16_string_size,
+	     internal_record->io_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to retrieve UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value entry of a specific column identifier
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_record_get_value_entry_by_column_identifier(
+     libesedb_record_t *record,
+     uint32_t column_identifier,
+     int *value_entry,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_record_t *internal_record              = NULL;
+	static char *function                                    = "libesedb_record_get_value_entry_by_column_identifier";
+	int column_index                                         = 0;
+	int result                                               = 0;
+	int template_table_number_of_columns                     = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( internal_record->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* The template table columns precede the table columns in the values
+	 */
+	if( internal_record->template_table_definition != NULL )
+	{
+		result = libesedb_table_definition_get_column_by_identifier(
+		          internal_record->template_table_definition,
+		          column_identifier,
+		          &column_index,
+		          &column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from template table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*value_entry = column_index;
+
+			return( 1 );
+		}
+		if( libcdata_list_get_number_of_elements(
+		     internal_record->template_table_definition->column_catalog_definition_list,
+		     &template_table_number_of_columns,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of columns from template table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libesedb_table_definition_get_column_by_identifier(
+	          internal_record->table_definition,
+	          column_identifier,
+	          &column_index,
+	          &column_catalog_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column catalog definition from table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*value_entry = template_table_number_of_columns + column_index;
+	}
+	return( result );
+}
+
+/* Retrieves the value entry of a specific UTF-8 encoded column name
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_record_get_value_entry_by_utf8_name(
+     libesedb_record_t *record,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *value_entry,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_record_t *internal_record              = NULL;
+	static char *function                                    = "libesedb_record_get_value_entry_by_utf8_name";
+	int column_index                                         = 0;
+	int result                                               = 0;
+	int template_table_number_of_columns                     = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( internal_record->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* The template table columns precede the table columns in the values
+	 */
+	if( internal_record->template_table_definition != NULL )
+	{
+		result = libesedb_table_definition_get_column_by_utf8_name(
+		          internal_record->template_table_definition,
+		          utf8_string,
+		          utf8_string_length,
+		          internal_record->io_handle->ascii_codepage,
+		          &column_index,
+		          &column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from template table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*value_entry = column_index;
+
+			return( 1 );
+		}
+		if( libcdata_list_get_number_of_elements(
+		     internal_record->template_table_definition->column_catalog_definition_list,
+		     &template_table_number_of_columns,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of columns from template table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libesedb_table_definition_get_column_by_utf8_name(
+	          internal_record->table_definition,
+	          utf8_string,
+	          utf8_string_length,
+	          internal_record->io_handle->ascii_codepage,
+	          &column_index,
+	          &column_catalog_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column catalog definition from table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*value_entry = template_table_number_of_columns + column_index;
+	}
+	return( result );
+}
+
+/* Retrieves the value entry of a specific UTF-16 encoded column name
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_record_get_value_entry_by_utf16_name(
+     libesedb_record_t *record,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int *value_entry,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_record_t *internal_record              = NULL;
+	static char *function                                    = "libesedb_record_get_value_entry_by_utf16_name";
+	int column_index                                         = 0;
+	int result                                               = 0;
+	int template_table_number_of_columns                     = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( internal_record->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* The template table columns precede the table columns in the values
+	 */
+	if( internal_record->template_table_definition != NULL )
+	{
+		result = libesedb_table_definition_get_column_by_utf16_name(
+		          internal_record->template_table_definition,
+		          utf16_string,
+		          utf16_string_length,
+		          internal_record->io_handle->ascii_codepage,
+		          &column_index,
+		          &column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from template table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*value_entry = column_index;
+
+			return( 1 );
+		}
+		if( libcdata_list_get_number_of_elements(
+		     internal_record->template_table_definition->column_catalog_definition_list,
+		     &template_table_number_of_columns,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of columns from template table.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
-	if( libesedb_record_get_column_catalog_definition(
-	     internal_record,
-	     value_entry,
-	     &column_catalog_definition,
-	     error ) != 1 )
+	result = libesedb_table_definition_get_column_by_utf16_name(
+	          internal_record->table_definition,
+	          utf16_string,
+	          utf16_string_length,
+	          internal_record->io_handle->ascii_codepage,
+	          &column_index,
+	          &column_catalog_definition,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve column catalog definition.",
+		 "%s: unable to retrieve column catalog definition from table.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_catalog_definition_get_utf16_name(
-	     column_catalog_definition,
-	     utf16_string,
-	     utf16_string_size,
-	     internal_record->io_handle->ascii_codepage,
-	     error ) != 1 )
+	else if( result != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to retrieve UTF-16 string.",
-		 function );
-
-		return( -1 );
+		*value_entry = template_table_number_of_columns + column_index;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves the value of the specific entry
@@ -2072,6 +2501,241 @@ int libesedb_record_get_value_floating_point_64bit(
 	return( result );
 }
 
+/* Retrieves the decompressed data of a specific entry
+ * The decompressed data is retained by the record so that retrieving
+ * the string size and the string of an entry decompresses the value only once
+ * If decompress_7bit is 0, 7-bit compressed data is not decompressed since
+ * the record value functions convert it directly into an UTF-8 string
+ * Returns 1 if successful, 0 if the value is not compressed or -1 on error
+ */
+int libesedb_record_get_decompressed_value_data(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libfvalue_value_t *record_value,
+     const uint8_t **decompressed_data,
+     size_t *decompressed_data_size,
+     uint8_t *leading_byte,
+     uint8_t decompress_7bit,
+     libcerror_error_t **error )
+{
+	uint8_t *entry_data           = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	static char *function         = "libesedb_record_get_decompressed_value_data";
+	size_t entry_data_size        = 0;
+	size_t uncompressed_data_size = 0;
+	uint32_t data_flags           = 0;
+	int encoding                  = 0;
+	int result                    = 0;
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( decompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( decompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( leading_byte == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leading byte.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_record->decompressed_value_data != NULL )
+	 && ( internal_record->decompressed_value_entry == value_entry ) )
+	{
+		*decompressed_data      = internal_record->decompressed_value_data;
+		*decompressed_data_size = internal_record->decompressed_value_data_size;
+		*leading_byte           = internal_record->decompressed_value_leading_byte;
+
+		return( 1 );
+	}
+	result = libfvalue_value_has_data(
+	          record_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if value: %d has data.",
+		 function,
+		 value_entry );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_data_flags(
+	     record_value,
+	     &data_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data flags.",
+		 function,
+		 value_entry );
+
+		goto on_error;
+	}
+	/* Multi values are handled by the record value functions
+	 */
+	if( ( ( data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) == 0 )
+	 || ( ( data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_entry_data(
+	     record_value,
+	     0,
+	     &entry_data,
+	     &entry_data_size,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record value entry data.",
+		 function );
+
+		goto on_error;
+	}
+	/* 7-bit compressed data is converted directly into an UTF-8 string
+	 * by the record value functions
+	 */
+	if( ( decompress_7bit == 0 )
+	 && ( entry_data != NULL )
+	 && ( entry_data_size > 0 )
+	 && ( entry_data[ 0 ] != 0x18 ) )
+	{
+		return( 0 );
+	}
+	if( libesedb_compression_decompress_get_size(
+	     entry_data,
+	     entry_data_size,
+	     &uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve uncompressed data size.",
+		 function );
+
+		goto on_error;
+	}
+	/* Empty values are handled by the record value functions
+	 */
+	if( uncompressed_data_size == 0 )
+	{
+		return( 0 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_compression_decompress(
+	     entry_data,
+	     entry_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable decompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_record->decompressed_value_data != NULL )
+	{
+		memory_free(
+		 internal_record->decompressed_value_data );
+	}
+	internal_record->decompressed_value_entry        = value_entry;
+	internal_record->decompressed_value_data         = uncompressed_data;
+	internal_record->decompressed_value_data_size    = uncompressed_data_size;
+	internal_record->decompressed_value_leading_byte = entry_data[ 0 ];
+
+	*decompressed_data      = uncompressed_data;
+	*decompressed_data_size = uncompressed_data_size;
+	*leading_byte           = entry_data[ 0 ];
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
 /* Retrieves the size of an UTF-8 string a specific entry
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if value is NULL or -1 on error
@@ -2085,8 +2749,11 @@ int libesedb_record_get_value_utf8_string_size(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *decompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_utf8_string_size";
+	size_t decompressed_data_size                            = 0;
 	uint32_t column_type                                     = 0;
+	uint8_t leading_byte                                     = 0;
 	int result                                               = 0;
 
 	if( record == NULL )
@@ -2160,11 +2827,44 @@ int libesedb_record_get_value_utf8_string_size(
 
 		return( -1 );
 	}
-	result = libesedb_record_value_get_utf8_string_size(
+	result = libesedb_record_get_decompressed_value_data(
+	          internal_record,
+	          value_entry,
 	          record_value,
-	          utf8_string_size,
+	          &decompressed_data,
+	          &decompressed_data_size,
+	          &leading_byte,
+	          0,
 	          error );
 
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve decompressed data of value: %d.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+		          decompressed_data,
+		          decompressed_data_size,
+		          leading_byte,
+		          utf8_string_size,
+		          error );
+	}
+	else
+	{
+		result = libesedb_record_value_get_utf8_string_size(
+		          record_value,
+		          utf8_string_size,
+		          error );
+	}
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -2195,8 +2895,11 @@ int libesedb_record_get_value_utf8_string(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *decompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_utf8_string";
+	size_t decompressed_data_size                            = 0;
 	uint32_t column_type                                     = 0;
+	uint8_t leading_byte                                     = 0;
 	int result                                               = 0;
 
 	if( record == NULL )
@@ -2270,12 +2973,46 @@ int libesedb_record_get_value_utf8_string(
 
 		return( -1 );
 	}
-	result = libesedb_record_value_get_utf8_string(
+	result = libesedb_record_get_decompressed_value_data(
+	          internal_record,
+	          value_entry,
 	          record_value,
-	          utf8_string,
-	          utf8_string_size,
+	          &decompressed_data,
+	          &decompressed_data_size,
+	          &leading_byte,
+	          0,
 	          error );
 
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve decompressed data of value: %d.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libesedb_compression_copy_uncompressed_data_to_utf8_string(
+		          decompressed_data,
+		          decompressed_data_size,
+		          leading_byte,
+		          utf8_string,
+		          utf8_string_size,
+		          error );
+	}
+	else
+	{
+		result = libesedb_record_value_get_utf8_string(
+		          record_value,
+		          utf8_string,
+		          utf8_string_size,
+		          error );
+	}
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -2304,8 +3041,11 @@ int libesedb_record_get_value_utf16_string_size(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *decompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_utf16_string_size";
+	size_t decompressed_data_size                            = 0;
 	uint32_t column_type                                     = 0;
+	uint8_t leading_byte                                     = 0;
 	int result                                               = 0;
 
 	if( record == NULL )
@@ -2373,17 +3113,50 @@ int libesedb_record_get_value_utf16_string_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve value: %d from values array.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	result = libesedb_record_get_decompressed_value_data(
+	          internal_record,
+	          value_entry,
+	          record_value,
+	          &decompressed_data,
+	          &decompressed_data_size,
+	          &leading_byte,
+	          1,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve decompressed data of value: %d.",
 		 function,
 		 value_entry );
 
 		return( -1 );
 	}
-	result = libesedb_record_value_get_utf16_string_size(
-	          record_value,
-	          utf16_string_size,
-	          error );
-
+	else if( result != 0 )
+	{
+		result = libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+		          decompressed_data,
+		          decompressed_data_size,
+		          leading_byte,
+		          utf16_string_size,
+		          error );
+	}
+	else
+	{
+		result = libesedb_record_value_get_utf16_string_size(
+		          record_value,
+		          utf16_string_size,
+		          error );
+	}
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -2414,8 +3187,11 @@ int libesedb_record_get_value_utf16_string(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *decompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_utf16_string";
+	size_t decompressed_data_size                            = 0;
 	uint32_t column_type                                     = 0;
+	uint8_t leading_byte                                     = 0;
 	int result                                               = 0;
 
 	if( record == NULL )
@@ -2489,12 +3265,46 @@ int libesedb_record_get_value_utf16_string(
 
 		return( -1 );
 	}
-	result = libesedb_record_value_get_utf16_string(
+	result = libesedb_record_get_decompressed_value_data(
+	          internal_record,
+	          value_entry,
 	          record_value,
-	          utf16_string,
-	          utf16_string_size,
+	          &decompressed_data,
+	          &decompressed_data_size,
+	          &leading_byte,
+	          1,
 	          error );
 
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve decompressed data of value: %d.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libesedb_compression_copy_uncompressed_data_to_utf16_string(
+		          decompressed_data,
+		          decompressed_data_size,
+		          leading_byte,
+		          utf16_string,
+		          utf16_string_size,
+		          error );
+	}
+	else
+	{
+		result = libesedb_record_value_get_utf16_string(
+		          record_value,
+		          utf16_string,
+		          utf16_string_size,
+		          error );
+	}
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -2978,296 +3788,6 @@ int libesedb_record_is_multi_value(
 	return( ( data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 );
 }
 
-/* Retrieves the long value data segments list of a specific entry
- * Creates a new data segments list
- * Returns 1 if successful, 0 if the item does not contain such value or -1 on error
- */
-int libesedb_record_get_long_value_data_segments_list(
-     libesedb_internal_record_t *internal_record,
-     const uint8_t *long_value_key,
-     size_t long_value_key_size,
-     libfdata_list_t **data_segments_list,
-     libcerror_error_t **error )
-{
-	uint8_t long_value_segment_key[ 8 ];
-
-	libesedb_data_definition_t *data_definition = NULL;
-	libesedb_key_t *key                         = NULL;
-	static char *function                       = "libesedb_record_get_long_value_data_segments_list";
-	uint32_t long_value_segment_offset          = 0;
-	int result                                  = 0;
-
-	if( internal_record == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
-		 function );
-
-		return( -1 );
-	}
-	if( long_value_key == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid long value key.",
-		 function );
-
-		return( -1 );
-	}
-	if( long_value_key_size != 4 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupport long value key size: %" PRIzd ".",
-		 function,
-		 long_value_key_size );
-
-		return( -1 );
-	}
-	if( data_segments_list == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data segments list.",
-		 function );
-
-		return( -1 );
-	}
-	if( libesedb_key_initialize(
-	     &key,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create key.",
-		 function );
-
-		goto on_error;
-	}
-	if( libesedb_key_set_data(
-	     key,
-	     long_value_key,
-	     long_value_key_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set long value key data in key.",
-		 function );
-
-		goto on_error;
-	}
-	key->type = LIBESEDB_KEY_TYPE_LONG_VALUE;
-
-	result = libfdata_btree_get_leaf_value_by_key(
-	          internal_record->long_values_tree,
-	          (intptr_t *) internal_record->file_io_handle,
-	          (libfdata_cache_t *) internal_record->long_values_cache,
-	          (intptr_t *) key,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_key_compare,
-	          LIBFDATA_BTREE_SEARCH_FLAG_SCAN_NEXT_NODE,
-	          (intptr_t **) &data_definition,
-	          0,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf value by key.",
-		 function );
-
-		goto on_error;
-	}
-	if( libesedb_key_free(
-	     &key,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free key.",
-		 function );
-
-		goto on_error;
-	}
-	if( result == 0 )
-	{
-		return( 0 );
-	}
-	if( libfdata_list_initialize(
-	     data_segments_list,
-	     NULL,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_data_segment_read_element_data,
-	     NULL,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data segments list.",
-		 function );
-
-		goto on_error;
-	}
-	if( libesedb_data_definition_read_long_value(
-	     data_definition,
-	     internal_record->file_io_handle,
-	     internal_record->long_values_pages_vector,
-	     internal_record->long_values_pages_cache,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read data definition long value.",
-		 function );
-
-		goto on_error;
-	}
-	/* Reverse the reversed long value key
-	 */
-	long_value_segment_key[ 0 ] = long_value_key[ 3 ];
-	long_value_segment_key[ 1 ] = long_value_key[ 2 ];
-	long_value_segment_key[ 2 ] = long_value_key[ 1 ];
-	long_value_segment_key[ 3 ] = long_value_key[ 0 ];
-
-	do
-	{
-		byte_stream_copy_from_uint32_big_endian(
-		 &( long_value_segment_key[ 4 ] ),
-		 long_value_segment_offset );
-
-		if( libesedb_key_initialize(
-		     &key,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create key.",
-			 function );
-
-			goto on_error;
-		}
-		if( libesedb_key_set_data(
-		     key,
-		     long_value_segment_key,
-		     8,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set long value segment key data in key.",
-			 function );
-
-			goto on_error;
-		}
-		key->type = LIBESEDB_KEY_TYPE_LONG_VALUE_SEGMENT;
-
-		result = libfdata_btree_get_leaf_value_by_key(
-			  internal_record->long_values_tree,
-			  (intptr_t *) internal_record->file_io_handle,
-			  (libfdata_cache_t *) internal_record->long_values_cache,
-		          (intptr_t *) key,
-		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_key_compare,
-		          LIBFDATA_BTREE_SEARCH_FLAG_SCAN_NEXT_NODE,
-		          (intptr_t **) &data_definition,
-			  0,
-			  error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve leaf value by key.",
-			 function );
-
-			goto on_error;
-		}
-		if( libesedb_key_free(
-		     &key,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free key.",
-			 function );
-
-			goto on_error;
-		}
-		if( result != 0 )
-		{
-			if( libesedb_data_definition_read_long_value_segment(
-			     data_definition,
-			     internal_record->file_io_handle,
-			     internal_record->io_handle,
-			     internal_record->long_values_pages_vector,
-			     internal_record->long_values_pages_cache,
-			     long_value_segment_offset,
-			     *data_segments_list,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read data definition long value segment.",
-				 function );
-
-				goto on_error;
-			}
-			long_value_segment_offset += data_definition->data_size;
-		}
-	}
-	while( result == 1 );
-
-	return( 1 );
-
-on_error:
-	if( *data_segments_list != NULL )
-	{
-		libfdata_list_free(
-		 data_segments_list,
-		 NULL );
-	}
-	if( key != NULL )
-	{
-		libesedb_key_free(
-		 &key,
-		 NULL );
-	}
-	return( -1 );
-}
-
 /* Retrieves the long value of a specific entry
  * Creates a new long value
  * Returns 1 if successful, 0 if the item does not contain such value or -1 on error
@@ -3280,7 +3800,6 @@ int libesedb_record_get_long_value(
 {
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
-	libfdata_list_t *data_segments_list                      = NULL;
 	libfvalue_value_t *record_value                          = NULL;
 	uint8_t* value_data                                      = NULL;
 	static char *function                                    = "libesedb_record_get_long_value";
@@ -3430,34 +3949,27 @@ int libesedb_record_get_long_value(
 
 		goto on_error;
 	}
-	result = libesedb_record_get_long_value_data_segments_list(
-		  internal_record,
-		  value_data,
-		  value_data_size,
-		  &data_segments_list,
-		  error );
-
-	if( result == -1 )
+	if( internal_record->table_definition->long_value_catalog_definition == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable retrieve value data.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - invalid table definition - missing long value catalog definition.",
 		 function );
 
 		goto on_error;
 	}
-	else if( result == 0 )
-	{
-		return( 0 );
-	}
 	if( libesedb_long_value_initialize(
 	     long_value,
 	     internal_record->file_io_handle,
 	     internal_record->io_handle,
 	     column_catalog_definition,
-	     data_segments_list,
+	     internal_record->long_values_pages_vector,
+	     internal_record->long_values_pages_cache,
+	     internal_record->table_definition->long_value_catalog_definition->father_data_page_number,
+	     value_data,
+	     value_data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3469,13 +3981,47 @@ int libesedb_record_get_long_value(
 
 		goto on_error;
 	}
+	/* The long value is located once, its segments are read on demand
+	 */
+	result = libesedb_long_value_seek_first_segment(
+	          (libesedb_internal_long_value_t *) *long_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek first segment of long value.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libesedb_long_value_free(
+		     long_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free long value.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
 	return( 1 );
 
 on_error:
-	if( data_segments_list != NULL )
+	if( *long_value != NULL )
 	{
-		libfdata_list_free(
-		 &data_segments_list,
+		libesedb_long_value_free(
+		 long_value,
 		 NULL );
 	}
 	return( -1 );
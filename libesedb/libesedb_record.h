@@ -33,6 +33,7 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_libfvalue.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -88,6 +89,23 @@ struct libesedb_internal_record
 	 */
 	libcdata_array_t *values_array;
 
+	/* The value entry of the decompressed value data
+	 * -1 if not set
+	 */
+	int decompressed_value_entry;
+
+	/* The decompressed value data
+	 */
+	uint8_t *decompressed_value_data;
+
+	/* The decompressed value data size
+	 */
+	size_t decompressed_value_data_size;
+
+	/* The leading byte of the compressed value data
+	 */
+	uint8_t decompressed_value_leading_byte;
+
 	/* The (record) flags 
 	 */
 	uint8_t flags;
@@ -169,6 +187,29 @@ int libesedb_record_get_utf16_column_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_record_get_value_entry_by_column_identifier(
+     libesedb_record_t *record,
+     uint32_t column_identifier,
+     int *value_entry,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_get_value_entry_by_utf8_name(
+     libesedb_record_t *record,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *value_entry,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_get_value_entry_by_utf16_name(
+     libesedb_record_t *record,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int *value_entry,
+     libcerror_error_t **error );
+
 /* TODO deprecate */
 LIBESEDB_EXTERN \
 int libesedb_record_get_value(
@@ -257,6 +298,16 @@ int libesedb_record_get_value_floating_point_64bit(
      double *value_floating_point_64bit,
      libcerror_error_t **error );
 
+int libesedb_record_get_decompressed_value_data(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libfvalue_value_t *record_value,
+     const uint8_t **decompressed_data,
+     size_t *decompressed_data_size,
+     uint8_t *leading_byte,
+     uint8_t decompress_7bit,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_value_utf8_string_size(
      libesedb_record_t *record,
@@ -314,13 +365,6 @@ int libesedb_record_is_multi_value(
      int value_entry,
      libcerror_error_t **error );
 
-int libesedb_record_get_long_value_data_segments_list(
-     libesedb_internal_record_t *internal_record,
-     const uint8_t *long_value_key,
-     size_t long_value_key_size,
-     libfdata_list_t **data_segments_list,
-     libcerror_error_t **error );
-
 LIBESEDB_EXTERN \
 int libesedb_record_get_long_value(
      libesedb_record_t *record,
@@ -25,6 +25,7 @@
 #include "libesedb_compression.h"
 #include "libesedb_definitions.h"
 #include "libesedb_record_value.h"
+#include "libesedb_utf8_string.h"
 
 /* Retrieves the size of an UTF-8 string
  * The returned size includes the end of string character
@@ -123,11 +124,45 @@ int libesedb_record_value_get_utf8_string_size(
 		}
 		else
 		{
-			result = libfvalue_value_get_utf8_string_size(
-			          record_value,
-			          0,
-			          utf8_string_size,
-			          error );
+			if( libfvalue_value_get_entry_data(
+			     record_value,
+			     0,
+			     &entry_data,
+			     &entry_data_size,
+			     &encoding,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record value entry data.",
+				 function );
+
+				return( -1 );
+			}
+			result = 0;
+
+			/* Convert UTF-16 little-endian data in-tree and leave
+			 * the strings it does not support to libfvalue
+			 */
+			if( ( encoding == LIBFVALUE_CODEPAGE_1200_MIXED )
+			 && ( entry_data != NULL ) )
+			{
+				result = libesedb_utf8_string_size_from_utf16_stream(
+				          entry_data,
+				          entry_data_size,
+				          utf8_string_size,
+				          error );
+			}
+			if( result == 0 )
+			{
+				result = libfvalue_value_get_utf8_string_size(
+				          record_value,
+				          0,
+				          utf8_string_size,
+				          error );
+			}
 		}
 		if( result != 1 )
 		{
@@ -243,12 +278,47 @@ int libesedb_record_value_get_utf8_string(
 		}
 		else
 		{
-			result = libfvalue_value_copy_to_utf8_string(
-			          record_value,
-			          0,
-			          utf8_string,
-			          utf8_string_size,
-			          error );
+			if( libfvalue_value_get_entry_data(
+			     record_value,
+			     0,
+			     &entry_data,
+			     &entry_data_size,
+			     &encoding,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record value entry data.",
+				 function );
+
+				return( -1 );
+			}
+			result = 0;
+
+			/* Convert UTF-16 little-endian data in-tree and leave
+			 * the strings it does not support to libfvalue
+			 */
+			if( ( encoding == LIBFVALUE_CODEPAGE_1200_MIXED )
+			 && ( entry_data != NULL ) )
+			{
+				result = libesedb_utf8_string_copy_from_utf16_stream(
+				          utf8_string,
+				          utf8_string_size,
+				          entry_data,
+				          entry_data_size,
+				          error );
+			}
+			if( result == 0 )
+			{
+				result = libfvalue_value_copy_to_utf8_string(
+				          record_value,
+				          0,
+				          utf8_string,
+				          utf8_string_size,
+				          error );
+			}
 		}
 		if( result != 1 )
 		{
@@ -20,14 +20,17 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
 #include "libesedb_column.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_definitions.h"
+#include "libesedb_filter.h"
 #include "libesedb_index.h"
 #include "libesedb_io_handle.h"
+#include "libesedb_key.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
@@ -1507,6 +1510,320 @@ int libesedb_table_get_column(
 	return( 1 );
 }
 
+/* Retrieves the column for a specific UTF-8 encoded name
+ * Use the flag LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE to retrieve the column
+ * ignoring the template table
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_table_get_column_by_utf8_name(
+     libesedb_table_t *table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libesedb_column_t **column,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_table_t *internal_table                = NULL;
+	static char *function                                    = "libesedb_table_get_column_by_utf8_name";
+	int column_index                                         = 0;
+	int result                                               = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags.",
+		 function );
+
+		return( -1 );
+	}
+	/* The template table columns precede the table columns
+	 */
+	if( ( ( flags & LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE ) == 0 )
+	 && ( internal_table->template_table_definition != NULL ) )
+	{
+		result = libesedb_table_definition_get_column_by_utf8_name(
+		          internal_table->template_table_definition,
+		          utf8_string,
+		          utf8_string_length,
+		          internal_table->io_handle->ascii_codepage,
+		          &column_index,
+		          &column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from template table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
+		result = libesedb_table_definition_get_column_by_utf8_name(
+		          internal_table->table_definition,
+		          utf8_string,
+		          utf8_string_length,
+		          internal_table->io_handle->ascii_codepage,
+		          &column_index,
+		          &column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result != 0 )
+	{
+		if( libesedb_column_initialize(
+		     column,
+		     internal_table->io_handle,
+		     column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create column.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the column for a specific UTF-16 encoded name
+ * Use the flag LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE to retrieve the column
+ * ignoring the template table
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_table_get_column_by_utf16_name(
+     libesedb_table_t *table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libesedb_column_t **column,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_table_t *internal_table                = NULL;
+	static char *function                                    = "libesedb_table_get_column_by_utf16_name";
+	int column_index                                         = 0;
+	int result                                               = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags.",
+		 function );
+
+		return( -1 );
+	}
+	/* The template table columns precede the table columns
+	 */
+	if( ( ( flags & LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE ) == 0 )
+	 && ( internal_table->template_table_definition != NULL ) )
+	{
+		result = libesedb_table_definition_get_column_by_utf16_name(
+		          internal_table->template_table_definition,
+		          utf16_string,
+		          utf16_string_length,
+		          internal_table->io_handle->ascii_codepage,
+		          &column_index,
+		          &column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from template table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
+		result = libesedb_table_definition_get_column_by_utf16_name(
+		          internal_table->table_definition,
+		          utf16_string,
+		          utf16_string_length,
+		          internal_table->io_handle->ascii_codepage,
+		          &column_index,
+		          &column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result != 0 )
+	{
+		if( libesedb_column_initialize(
+		     column,
+		     internal_table->io_handle,
+		     column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create column.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
 /* Retrieves the number of indexes
  * Returns 1 if successful or -1 on error
  */
@@ -1780,25 +2097,239 @@ int libesedb_table_get_record(
 
 		return( -1 );
 	}
-	if( libfdata_btree_get_leaf_value_by_index(
-	     internal_table->table_values_tree,
-	     (intptr_t *) internal_table->file_io_handle,
-	     (libfdata_cache_t *) internal_table->table_values_cache,
-	     record_entry,
-	     (intptr_t **) &record_data_definition,
-	     0,
+	if( libesedb_data_definition_initialize(
+	     &record_data_definition,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf value: %d from table values tree.",
-		 function,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record data definition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_get_leaf_value_by_index(
+	     internal_table->table_page_tree,
+	     internal_table->file_io_handle,
+	     internal_table->table_definition->table_catalog_definition->father_data_page_number,
+	     record_entry,
+	     record_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from table page tree.",
+		 function,
 		 record_entry );
 
+		goto on_error;
+	}
+	if( libesedb_record_initialize(
+	     record,
+	     internal_table->file_io_handle,
+	     internal_table->io_handle,
+	     internal_table->table_definition,
+	     internal_table->template_table_definition,
+	     internal_table->pages_vector,
+	     internal_table->pages_cache,
+	     internal_table->long_values_pages_vector,
+	     internal_table->long_values_pages_cache,
+	     record_data_definition,
+	     internal_table->long_values_tree,
+	     internal_table->long_values_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_free(
+	     &record_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record data definition.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *record != NULL )
+	{
+		libesedb_record_free(
+		 record,
+		 NULL );
+	}
+	if( record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &record_data_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific record by its key
+ * The key data contains the (normalized) primary key of the record,
+ * which is looked up in the table values tree
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libesedb_table_get_record_by_key(
+     libesedb_table_t *table,
+     const uint8_t *key_data,
+     size_t key_size,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_internal_table_t *internal_table          = NULL;
+	libesedb_key_t *key                                = NULL;
+	static char *function                              = "libesedb_table_get_record_by_key";
+	int result                                         = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_size == 0 )
+	 || ( key_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
 		return( -1 );
 	}
+	if( libesedb_key_initialize(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_set_data(
+	     key,
+	     key_data,
+	     key_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key data.",
+		 function );
+
+		goto on_error;
+	}
+	key->type = LIBESEDB_KEY_TYPE_SEEK_VALUE;
+
+	result = libfdata_btree_get_leaf_value_by_key(
+	          internal_table->table_values_tree,
+	          (intptr_t *) internal_table->file_io_handle,
+	          (libfdata_cache_t *) internal_table->table_values_cache,
+	          (intptr_t *) key,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_key_compare,
+	          LIBFDATA_BTREE_SEARCH_FLAG_SCAN_NEXT_NODE,
+	          (intptr_t **) &record_data_definition,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value by key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_free(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free key.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* The record data definition is managed by the table values tree
+	 */
 	if( libesedb_record_initialize(
 	     record,
 	     internal_table->file_io_handle,
@@ -1821,8 +2352,1125 @@ int libesedb_table_get_record(
 		 "%s: unable to create record.",
 		 function );
 
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the next record that matches the filter
+ * The search starts at the record entry, on return the record entry contains the entry of the matching record
+ * The predicates of the filter are evaluated on the raw record data and a record is only created if it matches
+ * Returns 1 if successful, 0 if no matching record was found or -1 on error
+ */
+int libesedb_table_get_next_record_by_filter(
+     libesedb_table_t *table,
+     libesedb_filter_t *filter,
+     int *record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_internal_filter_t *internal_filter        = NULL;
+	libesedb_internal_table_t *internal_table          = NULL;
+	static char *function                              = "libesedb_table_get_next_record_by_filter";
+	int number_of_records                              = 0;
+	int result                                         = 0;
+	int safe_record_entry                              = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libesedb_internal_filter_t *) filter;
+
+	if( record_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid record entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
 		return( -1 );
 	}
+	if( libesedb_table_get_number_of_records(
+	     table,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	for( safe_record_entry = *record_entry;
+	     safe_record_entry < number_of_records;
+	     safe_record_entry++ )
+	{
+		if( libfdata_btree_get_leaf_value_by_index(
+		     internal_table->table_values_tree,
+		     (intptr_t *) internal_table->file_io_handle,
+		     (libfdata_cache_t *) internal_table->table_values_cache,
+		     safe_record_entry,
+		     (intptr_t **) &record_data_definition,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf value: %d from table values tree.",
+			 function,
+			 safe_record_entry );
+
+			return( -1 );
+		}
+		result = libesedb_data_definition_evaluate_predicates(
+		          record_data_definition,
+		          internal_table->file_io_handle,
+		          internal_table->io_handle,
+		          internal_table->pages_vector,
+		          internal_table->pages_cache,
+		          internal_table->table_definition,
+		          internal_table->template_table_definition,
+		          internal_filter->predicates_array,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to evaluate filter on record: %d.",
+			 function,
+			 safe_record_entry );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			break;
+		}
+	}
+	if( safe_record_entry >= number_of_records )
+	{
+		*record_entry = number_of_records;
+
+		return( 0 );
+	}
+	if( libesedb_record_initialize(
+	     record,
+	     internal_table->file_io_handle,
+	     internal_table->io_handle,
+	     internal_table->table_definition,
+	     internal_table->template_table_definition,
+	     internal_table->pages_vector,
+	     internal_table->pages_cache,
+	     internal_table->long_values_pages_vector,
+	     internal_table->long_values_pages_cache,
+	     record_data_definition,
+	     internal_table->long_values_tree,
+	     internal_table->long_values_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		return( -1 );
+	}
+	*record_entry = safe_record_entry;
+
+	return( 1 );
+}
+
+/* Retrieves the data of a specific fixed size column of a specific record
+ * The column data is read directly from the record data without creating a record
+ * Returns 1 if successful, 0 if the column has no data or -1 on error
+ */
+int libesedb_table_get_fixed_size_column_data(
+     libesedb_internal_table_t *internal_table,
+     int record_entry,
+     uint32_t column_identifier,
+     uint32_t *column_type,
+     const uint8_t **column_data,
+     size_t *column_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_data_definition_t *record_data_definition       = NULL;
+	static char *function                                    = "libesedb_table_get_fixed_size_column_data";
+	size_t column_offset                                     = 0;
+	int result                                               = 0;
+
+	if( internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column type.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The offset of the most recently used fixed size column is cached
+	 * since the offset is the same for every record of the table
+	 */
+	if( ( internal_table->fixed_size_column_catalog_definition != NULL )
+	 && ( internal_table->fixed_size_column_catalog_definition->identifier == column_identifier ) )
+	{
+		column_catalog_definition = internal_table->fixed_size_column_catalog_definition;
+		column_offset             = internal_table->fixed_size_column_offset;
+	}
+	else
+	{
+		if( libesedb_data_definition_get_fixed_size_column_offset(
+		     internal_table->table_definition,
+		     internal_table->template_table_definition,
+		     column_identifier,
+		     &column_catalog_definition,
+		     &column_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset of column: %" PRIu32 ".",
+			 function,
+			 column_identifier );
+
+			return( -1 );
+		}
+		internal_table->fixed_size_column_catalog_definition = column_catalog_definition;
+		internal_table->fixed_size_column_offset             = column_offset;
+	}
+	if( libfdata_btree_get_leaf_value_by_index(
+	     internal_table->table_values_tree,
+	     (intptr_t *) internal_table->file_io_handle,
+	     (libfdata_cache_t *) internal_table->table_values_cache,
+	     record_entry,
+	     (intptr_t **) &record_data_definition,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from table values tree.",
+		 function,
+		 record_entry );
+
+		return( -1 );
+	}
+	result = libesedb_data_definition_get_fixed_size_column_data(
+	          record_data_definition,
+	          internal_table->file_io_handle,
+	          internal_table->io_handle,
+	          internal_table->pages_vector,
+	          internal_table->pages_cache,
+	          column_identifier,
+	          column_offset,
+	          (size_t) column_catalog_definition->size,
+	          column_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data of column: %" PRIu32 " of record: %d.",
+		 function,
+		 column_identifier,
+		 record_entry );
+
+		return( -1 );
+	}
+	*column_type      = column_catalog_definition->column_type;
+	*column_data_size = (size_t) column_catalog_definition->size;
+
+	return( result );
+}
+
+/* Retrieves the 32-bit value of a specific column of a specific record
+ * This is a fast path for libesedb_record_get_value_32bit that reads the value directly
+ * from the record data, only fixed size columns are supported
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_table_get_record_value_32bit(
+     libesedb_table_t *table,
+     int record_entry,
+     uint32_t column_identifier,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	const uint8_t *column_data = NULL;
+	static char *function      = "libesedb_table_get_record_value_32bit";
+	size_t column_data_size    = 0;
+	uint32_t column_type       = 0;
+	int result                 = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 32-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_table_get_fixed_size_column_data(
+	          (libesedb_internal_table_t *) table,
+	          record_entry,
+	          column_identifier,
+	          &column_type,
+	          &column_data,
+	          &column_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data of column: %" PRIu32 ".",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	if( ( column_type != LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+	 && ( column_type != LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 ".",
+		 function,
+		 column_type );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		if( column_data_size != 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column data size: %" PRIzd ".",
+			 function,
+			 column_data_size );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 column_data,
+		 *value_32bit );
+	}
+	return( result );
+}
+
+/* Retrieves the 64-bit value of a specific column of a specific record
+ * This is a fast path for libesedb_record_get_value_64bit that reads the value directly
+ * from the record data, only fixed size columns are supported
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_table_get_record_value_64bit(
+     libesedb_table_t *table,
+     int record_entry,
+     uint32_t column_identifier,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	const uint8_t *column_data = NULL;
+	static char *function      = "libesedb_table_get_record_value_64bit";
+	size_t column_data_size    = 0;
+	uint32_t column_type       = 0;
+	int result                 = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_table_get_fixed_size_column_data(
+	          (libesedb_internal_table_t *) table,
+	          record_entry,
+	          column_identifier,
+	          &column_type,
+	          &column_data,
+	          &column_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data of column: %" PRIu32 ".",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	if( ( column_type != LIBESEDB_COLUMN_TYPE_CURRENCY )
+	 && ( column_type != LIBESEDB_COLUMN_TYPE_DATE_TIME )
+	 && ( column_type != LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 ".",
+		 function,
+		 column_type );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		if( column_data_size != 8 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column data size: %" PRIzd ".",
+			 function,
+			 column_data_size );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 column_data,
+		 *value_64bit );
+	}
+	return( result );
+}
+
+/* Retrieves the 64-bit filetime value of a specific column of a specific record
+ * This is a fast path for libesedb_record_get_value_filetime that reads the value directly
+ * from the record data, only fixed size columns are supported
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_table_get_record_value_filetime(
+     libesedb_table_t *table,
+     int record_entry,
+     uint32_t column_identifier,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	const uint8_t *column_data = NULL;
+	static char *function      = "libesedb_table_get_record_value_filetime";
+	size_t column_data_size    = 0;
+	uint32_t column_type       = 0;
+	int result                 = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 64-bit filetime value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_table_get_fixed_size_column_data(
+	          (libesedb_internal_table_t *) table,
+	          record_entry,
+	          column_identifier,
+	          &column_type,
+	          &column_data,
+	          &column_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data of column: %" PRIu32 ".",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	if( column_type != LIBESEDB_COLUMN_TYPE_DATE_TIME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 ".",
+		 function,
+		 column_type );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		if( column_data_size != 8 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column data size: %" PRIzd ".",
+			 function,
+			 column_data_size );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 column_data,
+		 *value_64bit );
+	}
+	return( result );
+}
+
+/* Retrieves the 32-bit floating point value of a specific column of a specific record
+ * This is a fast path for libesedb_record_get_value_floating_point_32bit that reads the value directly
+ * from the record data, only fixed size columns are supported
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_table_get_record_value_floating_point_32bit(
+     libesedb_table_t *table,
+     int record_entry,
+     uint32_t column_identifier,
+     float *value_floating_point_32bit,
+     libcerror_error_t **error )
+{
+	byte_stream_float32_t value_float32;
+
+	const uint8_t *column_data = NULL;
+	static char *function      = "libesedb_table_get_record_value_floating_point_32bit";
+	size_t column_data_size    = 0;
+	uint32_t column_type       = 0;
+	int result                 = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_floating_point_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 32-bit floating point value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_table_get_fixed_size_column_data(
+	          (libesedb_internal_table_t *) table,
+	          record_entry,
+	          column_identifier,
+	          &column_type,
+	          &column_data,
+	          &column_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data of column: %" PRIu32 ".",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	if( column_type != LIBESEDB_COLUMN_TYPE_FLOAT_32BIT )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 ".",
+		 function,
+		 column_type );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		if( column_data_size != 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column data size: %" PRIzd ".",
+			 function,
+			 column_data_size );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 column_data,
+		 value_float32.integer );
+
+		*value_floating_point_32bit = value_float32.floating_point;
+	}
+	return( result );
+}
+
+/* Retrieves the 64-bit floating point value of a specific column of a specific record
+ * This is a fast path for libesedb_record_get_value_floating_point_64bit that reads the value directly
+ * from the record data, only fixed size columns are supported
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_table_get_record_value_floating_point_64bit(
+     libesedb_table_t *table,
+     int record_entry,
+     uint32_t column_identifier,
+     double *value_floating_point_64bit,
+     libcerror_error_t **error )
+{
+	byte_stream_float64_t value_float64;
+
+	const uint8_t *column_data = NULL;
+	static char *function      = "libesedb_table_get_record_value_floating_point_64bit";
+	size_t column_data_size    = 0;
+	uint32_t column_type       = 0;
+	int result                 = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_floating_point_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 64-bit floating point value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_table_get_fixed_size_column_data(
+	          (libesedb_internal_table_t *) table,
+	          record_entry,
+	          column_identifier,
+	          &column_type,
+	          &column_data,
+	          &column_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data of column: %" PRIu32 ".",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	if( column_type != LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 ".",
+		 function,
+		 column_type );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		if( column_data_size != 8 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column data size: %" PRIzd ".",
+			 function,
+			 column_data_size );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 column_data,
+		 value_float64.integer );
+
+		*value_floating_point_64bit = value_float64.floating_point;
+	}
+	return( result );
+}
+
+/* Retrieves the 32-bit values of a specific column of multiple records
+ * This is a bulk variant of libesedb_table_get_record_value_32bit, only fixed size columns are supported
+ * The values array must contain space for the number of records values
+ * The value is set array contains 1 if the value of the corresponding record is set or 0 if the value is NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_records_values_32bit(
+     libesedb_table_t *table,
+     uint32_t column_identifier,
+     int first_record_entry,
+     int number_of_records,
+     uint32_t *values_32bit,
+     uint8_t *value_is_set,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	const uint8_t *column_data                = NULL;
+	static char *function                     = "libesedb_table_get_records_values_32bit";
+	size_t column_data_size                   = 0;
+	uint32_t column_type                      = 0;
+	int result                                = 0;
+	int value_index                           = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( first_record_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first record entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( values_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 32-bit values.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_is_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value is set.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_records;
+	     value_index++ )
+	{
+		result = libesedb_table_get_fixed_size_column_data(
+		          internal_table,
+		          first_record_entry + value_index,
+		          column_identifier,
+		          &column_type,
+		          &column_data,
+		          &column_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data of column: %" PRIu32 " of record: %d.",
+			 function,
+			 column_identifier,
+			 first_record_entry + value_index );
+
+			return( -1 );
+		}
+		if( value_index == 0 )
+		{
+			if( ( column_type != LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+			 && ( column_type != LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported column type: %" PRIu32 ".",
+				 function,
+				 column_type );
+
+				return( -1 );
+			}
+			if( column_data_size != 4 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported column data size: %" PRIzd ".",
+				 function,
+				 column_data_size );
+
+				return( -1 );
+			}
+		}
+		if( result != 0 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 column_data,
+			 values_32bit[ value_index ] );
+
+			value_is_set[ value_index ] = 1;
+		}
+		else
+		{
+			values_32bit[ value_index ] = 0;
+			value_is_set[ value_index ] = 0;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the 64-bit values of a specific column of multiple records
+ * This is a bulk variant of libesedb_table_get_record_value_64bit, only fixed size columns are supported
+ * The values array must contain space for the number of records values
+ * The value is set array contains 1 if the value of the corresponding record is set or 0 if the value is NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_records_values_64bit(
+     libesedb_table_t *table,
+     uint32_t column_identifier,
+     int first_record_entry,
+     int number_of_records,
+     uint64_t *values_64bit,
+     uint8_t *value_is_set,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	const uint8_t *column_data                = NULL;
+	static char *function                     = "libesedb_table_get_records_values_64bit";
+	size_t column_data_size                   = 0;
+	uint32_t column_type                      = 0;
+	int result                                = 0;
+	int value_index                           = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( first_record_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first record entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( values_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 64-bit values.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_is_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value is set.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_records;
+	     value_index++ )
+	{
+		result = libesedb_table_get_fixed_size_column_data(
+		          internal_table,
+		          first_record_entry + value_index,
+		          column_identifier,
+		          &column_type,
+		          &column_data,
+		          &column_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data of column: %" PRIu32 " of record: %d.",
+			 function,
+			 column_identifier,
+			 first_record_entry + value_index );
+
+			return( -1 );
+		}
+		if( value_index == 0 )
+		{
+			if( ( column_type != LIBESEDB_COLUMN_TYPE_CURRENCY )
+			 && ( column_type != LIBESEDB_COLUMN_TYPE_DATE_TIME )
+			 && ( column_type != LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported column type: %" PRIu32 ".",
+				 function,
+				 column_type );
+
+				return( -1 );
+			}
+			if( column_data_size != 8 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported column data size: %" PRIzd ".",
+				 function,
+				 column_data_size );
+
+				return( -1 );
+			}
+		}
+		if( result != 0 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 column_data,
+			 values_64bit[ value_index ] );
+
+			value_is_set[ value_index ] = 1;
+		}
+		else
+		{
+			values_64bit[ value_index ] = 0;
+			value_is_set[ value_index ] = 0;
+		}
+	}
 	return( 1 );
 }
 
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_catalog_definition.h"
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
@@ -98,6 +99,14 @@ struct libesedb_internal_table
 	/* The long values cache
 	 */
 	libfcache_cache_t *long_values_cache;
+
+	/* The catalog definition of the most recently used fixed size column
+	 */
+	libesedb_catalog_definition_t *fixed_size_column_catalog_definition;
+
+	/* The offset of the most recently used fixed size column in the record data
+	 */
+	size_t fixed_size_column_offset;
 };
 
 int libesedb_table_initialize(
@@ -186,6 +195,24 @@ int libesedb_table_get_column(
      uint8_t flags,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_get_column_by_utf8_name(
+     libesedb_table_t *table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libesedb_column_t **column,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_column_by_utf16_name(
+     libesedb_table_t *table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libesedb_column_t **column,
+     uint8_t flags,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_table_get_number_of_indexes(
      libesedb_table_t *table,
@@ -212,6 +239,91 @@ int libesedb_table_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_get_record_by_key(
+     libesedb_table_t *table,
+     const uint8_t *key_data,
+     size_t key_size,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_next_record_by_filter(
+     libesedb_table_t *table,
+     libesedb_filter_t *filter,
+     int *record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+int libesedb_table_get_fixed_size_column_data(
+     libesedb_internal_table_t *internal_table,
+     int record_entry,
+     uint32_t column_identifier,
+     uint32_t *column_type,
+     const uint8_t **column_data,
+     size_t *column_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_record_value_32bit(
+     libesedb_table_t *table,
+     int record_entry,
+     uint32_t column_identifier,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_record_value_64bit(
+     libesedb_table_t *table,
+     int record_entry,
+     uint32_t column_identifier,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_record_value_filetime(
+     libesedb_table_t *table,
+     int record_entry,
+     uint32_t column_identifier,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_record_value_floating_point_32bit(
+     libesedb_table_t *table,
+     int record_entry,
+     uint32_t column_identifier,
+     float *value_floating_point_32bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_record_value_floating_point_64bit(
+     libesedb_table_t *table,
+     int record_entry,
+     uint32_t column_identifier,
+     double *value_floating_point_64bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_records_values_32bit(
+     libesedb_table_t *table,
+     uint32_t column_identifier,
+     int first_record_entry,
+     int number_of_records,
+     uint32_t *values_32bit,
+     uint8_t *value_is_set,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_records_values_64bit(
+     libesedb_table_t *table,
+     uint32_t column_identifier,
+     int first_record_entry,
+     int number_of_records,
+     uint64_t *values_64bit,
+     uint8_t *value_is_set,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
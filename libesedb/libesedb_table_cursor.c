@@ -0,0 +1,466 @@
+/*
+ * Table cursor functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_page_tree_cursor.h"
+#include "libesedb_record.h"
+#include "libesedb_table.h"
+#include "libesedb_table_cursor.h"
+#include "libesedb_types.h"
+
+/* Opens a table cursor
+ * The cursor iterates the records of the table in leaf page order, forward or backward,
+ * without using the table values tree. The cursor must be closed before the table is freed
+ * Make sure the value table_cursor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_cursor_open(
+     libesedb_table_t *table,
+     libesedb_table_cursor_t **table_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table               = NULL;
+	libesedb_internal_table_cursor_t *internal_table_cursor = NULL;
+	static char *function                                   = "libesedb_table_cursor_open";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid table cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table_cursor = memory_allocate_structure(
+	                         libesedb_internal_table_cursor_t );
+
+	if( internal_table_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create table cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_table_cursor,
+	     0,
+	     sizeof( libesedb_internal_table_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear table cursor.",
+		 function );
+
+		memory_free(
+		 internal_table_cursor );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_cursor_initialize(
+	     &( internal_table_cursor->page_tree_cursor ),
+	     internal_table->io_handle,
+	     internal_table->pages_vector,
+	     internal_table->pages_cache,
+	     internal_table->table_definition->table_catalog_definition->father_data_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_initialize(
+	     &( internal_table_cursor->data_definition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data definition.",
+		 function );
+
+		goto on_error;
+	}
+	internal_table_cursor->internal_table = internal_table;
+
+	*table_cursor = (libesedb_table_cursor_t *) internal_table_cursor;
+
+	return( 1 );
+
+on_error:
+	if( internal_table_cursor != NULL )
+	{
+		if( internal_table_cursor->page_tree_cursor != NULL )
+		{
+			libesedb_page_tree_cursor_free(
+			 &( internal_table_cursor->page_tree_cursor ),
+			 NULL );
+		}
+		memory_free(
+		 internal_table_cursor );
+	}
+	return( -1 );
+}
+
+/* Closes a table cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_cursor_close(
+     libesedb_table_cursor_t **table_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_cursor_t *internal_table_cursor = NULL;
+	static char *function                                   = "libesedb_table_cursor_close";
+	int result                                              = 1;
+
+	if( table_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table_cursor != NULL )
+	{
+		internal_table_cursor = (libesedb_internal_table_cursor_t *) *table_cursor;
+		*table_cursor         = NULL;
+
+		/* The internal_table reference is freed elsewhere
+		 */
+		if( libesedb_page_tree_cursor_free(
+		     &( internal_table_cursor->page_tree_cursor ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page tree cursor.",
+			 function );
+
+			result = -1;
+		}
+		if( libesedb_data_definition_free(
+		     &( internal_table_cursor->data_definition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data definition.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_table_cursor );
+	}
+	return( result );
+}
+
+/* Retrieves the next record
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libesedb_table_cursor_next(
+     libesedb_table_cursor_t *table_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table               = NULL;
+	libesedb_internal_table_cursor_t *internal_table_cursor = NULL;
+	static char *function                                   = "libesedb_table_cursor_next";
+	int result                                              = 0;
+
+	if( table_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table_cursor = (libesedb_internal_table_cursor_t *) table_cursor;
+
+	if( internal_table_cursor->internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table cursor - missing table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = internal_table_cursor->internal_table;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_page_tree_cursor_get_next_leaf_value(
+	          internal_table_cursor->page_tree_cursor,
+	          internal_table->file_io_handle,
+	          internal_table_cursor->data_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next leaf value from page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libesedb_record_initialize(
+	     record,
+	     internal_table->file_io_handle,
+	     internal_table->io_handle,
+	     internal_table->table_definition,
+	     internal_table->template_table_definition,
+	     internal_table->pages_vector,
+	     internal_table->pages_cache,
+	     internal_table->long_values_pages_vector,
+	     internal_table->long_values_pages_cache,
+	     internal_table_cursor->data_definition,
+	     internal_table->long_values_tree,
+	     internal_table->long_values_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the previous record
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libesedb_table_cursor_previous(
+     libesedb_table_cursor_t *table_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table               = NULL;
+	libesedb_internal_table_cursor_t *internal_table_cursor = NULL;
+	static char *function                                   = "libesedb_table_cursor_previous";
+	int result                                              = 0;
+
+	if( table_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table_cursor = (libesedb_internal_table_cursor_t *) table_cursor;
+
+	if( internal_table_cursor->internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table cursor - missing table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = internal_table_cursor->internal_table;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_page_tree_cursor_get_previous_leaf_value(
+	          internal_table_cursor->page_tree_cursor,
+	          internal_table->file_io_handle,
+	          internal_table_cursor->data_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve previous leaf value from page tree cursor.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libesedb_record_initialize(
+	     record,
+	     internal_table->file_io_handle,
+	     internal_table->io_handle,
+	     internal_table->table_definition,
+	     internal_table->template_table_definition,
+	     internal_table->pages_vector,
+	     internal_table->pages_cache,
+	     internal_table->long_values_pages_vector,
+	     internal_table->long_values_pages_cache,
+	     internal_table_cursor->data_definition,
+	     internal_table->long_values_tree,
+	     internal_table->long_values_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,84 @@
+/*
+ * Table cursor functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_TABLE_CURSOR_H )
+#define _LIBESEDB_TABLE_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_extern.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_page_tree_cursor.h"
+#include "libesedb_table.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_internal_table_cursor libesedb_internal_table_cursor_t;
+
+struct libesedb_internal_table_cursor
+{
+	/* The table
+	 */
+	libesedb_internal_table_t *internal_table;
+
+	/* The page tree cursor
+	 */
+	libesedb_page_tree_cursor_t *page_tree_cursor;
+
+	/* The data definition of the current record
+	 */
+	libesedb_data_definition_t *data_definition;
+};
+
+LIBESEDB_EXTERN \
+int libesedb_table_cursor_open(
+     libesedb_table_t *table,
+     libesedb_table_cursor_t **table_cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_cursor_close(
+     libesedb_table_cursor_t **table_cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_cursor_next(
+     libesedb_table_cursor_t *table_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_cursor_previous(
+     libesedb_table_cursor_t *table_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_TABLE_CURSOR_H ) */
+
@@ -25,9 +25,11 @@
 
 #include "libesedb_catalog_definition.h"
 #include "libesedb_definitions.h"
+#include "libesedb_hash_table.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
+#include "libesedb_libuna.h"
 #include "libesedb_table_definition.h"
 
 /* Creates a table definition
@@ -119,6 +121,8 @@ int libesedb_table_definition_initialize(
 
 		return( -1 );
 	}
+	( *table_definition )->column_name_hash_table_ascii_codepage = LIBUNA_CODEPAGE_WINDOWS_1252;
+
 	if( libcdata_list_initialize(
 	     &( ( *table_definition )->column_catalog_definition_list ),
 	     error ) != 1 )
@@ -238,6 +242,38 @@ int libesedb_table_definition_free(
 				result = -1;
 			}
 		}
+		if( ( *table_definition )->column_name_hash_table != NULL )
+		{
+			if( libesedb_hash_table_free(
+			     &( ( *table_definition )->column_name_hash_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free column name hash table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *table_definition )->column_identifier_hash_table != NULL )
+		{
+			if( libesedb_hash_table_free(
+			     &( ( *table_definition )->column_identifier_hash_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free column identifier hash table.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcdata_list_free(
 		     &( ( *table_definition )->column_catalog_definition_list ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_catalog_definition_free,
@@ -274,6 +310,123 @@ int libesedb_table_definition_free(
 	return( result );
 }
 
+/* Empties the column, index, long value and callback catalog definitions of the table definition
+ * The table catalog definition is kept
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_definition_empty(
+     libesedb_table_definition_t *table_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_table_definition_empty";
+	int result            = 1;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->long_value_catalog_definition != NULL )
+	{
+		if( libesedb_catalog_definition_free(
+		     &( table_definition->long_value_catalog_definition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free long value catalog definition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( table_definition->callback_catalog_definition != NULL )
+	{
+		if( libesedb_catalog_definition_free(
+		     &( table_definition->callback_catalog_definition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free callback catalog definition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( table_definition->column_name_hash_table != NULL )
+	{
+		if( libesedb_hash_table_free(
+		     &( table_definition->column_name_hash_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column name hash table.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( table_definition->column_identifier_hash_table != NULL )
+	{
+		if( libesedb_hash_table_free(
+		     &( table_definition->column_identifier_hash_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column identifier hash table.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcdata_list_empty(
+	     table_definition->column_catalog_definition_list,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_catalog_definition_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty column catalog definition list.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdata_list_empty(
+	     table_definition->index_catalog_definition_list,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_catalog_definition_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty index catalog definition list.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
 /* Sets a long value catalog definition to the table definition
  * Returns 1 if successful or -1 on error
  */
@@ -452,6 +605,40 @@ int libesedb_table_definition_append_column_catalog_definition(
 
 		return( -1 );
 	}
+	/* The column hash tables are rebuilt on demand
+	 */
+	if( table_definition->column_name_hash_table != NULL )
+	{
+		if( libesedb_hash_table_free(
+		     &( table_definition->column_name_hash_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column name hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( table_definition->column_identifier_hash_table != NULL )
+	{
+		if( libesedb_hash_table_free(
+		     &( table_definition->column_identifier_hash_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column identifier hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -516,3 +703,742 @@ int libesedb_table_definition_append_index_catalog_definition(
 	return( 1 );
 }
 
+/* Builds the column hash tables
+ * The column catalog definitions are hashed by name and by identifier so that
+ * a column can be retrieved without comparing all column catalog definitions
+ * The names are decoded using the ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_definition_build_column_hash_tables(
+     libesedb_table_definition_t *table_definition,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element                    = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	static char *function                                    = "libesedb_table_definition_build_column_hash_tables";
+	uint32_t name_hash                                       = 0;
+	int column_index                                         = 0;
+	int number_of_columns                                    = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->column_name_hash_table != NULL )
+	{
+		if( libesedb_hash_table_free(
+		     &( table_definition->column_name_hash_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column name hash table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( table_definition->column_identifier_hash_table != NULL )
+	{
+		if( libesedb_hash_table_free(
+		     &( table_definition->column_identifier_hash_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column identifier hash table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_list_get_number_of_elements(
+	     table_definition->column_catalog_definition_list,
+	     &number_of_columns,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of column catalog definitions.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_hash_table_initialize(
+	     &( table_definition->column_name_hash_table ),
+	     number_of_columns,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column name hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_hash_table_initialize(
+	     &( table_definition->column_identifier_hash_table ),
+	     number_of_columns,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column identifier hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_list_get_first_element(
+	     table_definition->column_catalog_definition_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first column catalog definition list element.",
+		 function );
+
+		goto on_error;
+	}
+	for( column_index = 0;
+	     column_index < number_of_columns;
+	     column_index++ )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition: %d from list element.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		if( column_catalog_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column catalog definition: %d.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		name_hash = LIBESEDB_HASH_TABLE_NAME_HASH_INITIAL_VALUE;
+
+		if( column_catalog_definition->name != NULL )
+		{
+			if( libesedb_hash_table_get_name_hash_from_byte_stream(
+			     column_catalog_definition->name,
+			     column_catalog_definition->name_size,
+			     ascii_codepage,
+			     &name_hash,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve name hash of column catalog definition: %d.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+		}
+		/* The value index of a column catalog definition in the hash tables
+		 * corresponds to the column index, since the values are inserted in order
+		 */
+		if( libesedb_hash_table_insert_value(
+		     table_definition->column_name_hash_table,
+		     name_hash,
+		     (intptr_t *) column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert column catalog definition: %d into name hash table.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		if( libesedb_hash_table_insert_value(
+		     table_definition->column_identifier_hash_table,
+		     column_catalog_definition->identifier,
+		     (intptr_t *) column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert column catalog definition: %d into identifier hash table.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next column catalog definition list element.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	table_definition->column_name_hash_table_ascii_codepage = ascii_codepage;
+
+	return( 1 );
+
+on_error:
+	if( table_definition->column_identifier_hash_table != NULL )
+	{
+		libesedb_hash_table_free(
+		 &( table_definition->column_identifier_hash_table ),
+		 NULL );
+	}
+	if( table_definition->column_name_hash_table != NULL )
+	{
+		libesedb_hash_table_free(
+		 &( table_definition->column_name_hash_table ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the column catalog definition for a specific column identifier
+ * Returns 1 if successful, 0 if no such column catalog definition or -1 on error
+ */
+int libesedb_table_definition_get_column_catalog_definition_by_identifier(
+     libesedb_table_definition_t *table_definition,
+     uint32_t column_identifier,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_table_definition_get_column_catalog_definition_by_identifier";
+	int column_index      = 0;
+	int result            = 0;
+
+	result = libesedb_table_definition_get_column_by_identifier(
+	          table_definition,
+	          column_identifier,
+	          &column_index,
+	          column_catalog_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %" PRIu32 ".",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the column index and catalog definition for a specific column identifier
+ * Returns 1 if successful, 0 if no such column catalog definition or -1 on error
+ */
+int libesedb_table_definition_get_column_by_identifier(
+     libesedb_table_definition_t *table_definition,
+     uint32_t column_identifier,
+     int *column_index,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *safe_column_catalog_definition = NULL;
+	static char *function                                         = "libesedb_table_definition_get_column_by_identifier";
+	int entry_index                                               = 0;
+	int result                                                    = 0;
+	int safe_column_index                                         = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column index.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( table_definition->column_name_hash_table == NULL )
+	 || ( table_definition->column_identifier_hash_table == NULL ) )
+	{
+		if( libesedb_table_definition_build_column_hash_tables(
+		     table_definition,
+		     table_definition->column_name_hash_table_ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build column hash tables.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	entry_index = -1;
+
+	do
+	{
+		result = libesedb_hash_table_get_next_value_by_hash(
+		          table_definition->column_identifier_hash_table,
+		          column_identifier,
+		          &entry_index,
+		          &safe_column_index,
+		          (intptr_t **) &safe_column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from identifier hash table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( ( safe_column_catalog_definition != NULL )
+		 && ( safe_column_catalog_definition->identifier == column_identifier ) )
+		{
+			*column_index              = safe_column_index;
+			*column_catalog_definition = safe_column_catalog_definition;
+
+			return( 1 );
+		}
+	}
+	while( result != 0 );
+
+	return( 0 );
+}
+
+/* Retrieves the column index and catalog definition for a specific UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such column catalog definition or -1 on error
+ */
+int libesedb_table_definition_get_column_by_utf8_name(
+     libesedb_table_definition_t *table_definition,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     int *column_index,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *safe_column_catalog_definition = NULL;
+	static char *function                                         = "libesedb_table_definition_get_column_by_utf8_name";
+	uint32_t name_hash                                            = 0;
+	int compare_result                                            = 0;
+	int entry_index                                               = 0;
+	int result                                                    = 0;
+	int safe_column_index                                         = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column index.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	/* The column name hash table is rebuild if it was build with a different codepage
+	 */
+	if( ( table_definition->column_name_hash_table == NULL )
+	 || ( table_definition->column_identifier_hash_table == NULL )
+	 || ( table_definition->column_name_hash_table_ascii_codepage != ascii_codepage ) )
+	{
+		if( libesedb_table_definition_build_column_hash_tables(
+		     table_definition,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build column hash tables.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_hash_table_get_name_hash_from_utf8_string(
+	     utf8_string,
+	     utf8_string_length,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name hash of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	/* Columns with a different name can have the same hash
+	 */
+	entry_index = -1;
+
+	do
+	{
+		result = libesedb_hash_table_get_next_value_by_hash(
+		          table_definition->column_name_hash_table,
+		          name_hash,
+		          &entry_index,
+		          &safe_column_index,
+		          (intptr_t **) &safe_column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from name hash table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( ( safe_column_catalog_definition == NULL )
+		 || ( safe_column_catalog_definition->name == NULL ) )
+		{
+			continue;
+		}
+		compare_result = libuna_utf8_string_compare_with_byte_stream(
+		                  utf8_string,
+		                  utf8_string_length,
+		                  safe_column_catalog_definition->name,
+		                  safe_column_catalog_definition->name_size,
+		                  ascii_codepage,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare UTF-8 string with column catalog definition: %d name.",
+			 function,
+			 safe_column_index );
+
+			return( -1 );
+		}
+		else if( compare_result == LIBUNA_COMPARE_EQUAL )
+		{
+			*column_index              = safe_column_index;
+			*column_catalog_definition = safe_column_catalog_definition;
+
+			return( 1 );
+		}
+	}
+	while( result != 0 );
+
+	return( 0 );
+}
+
+/* Retrieves the column index and catalog definition for a specific UTF-16 encoded name
+ * Returns 1 if successful, 0 if no such column catalog definition or -1 on error
+ */
+int libesedb_table_definition_get_column_by_utf16_name(
+     libesedb_table_definition_t *table_definition,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int ascii_codepage,
+     int *column_index,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *safe_column_catalog_definition = NULL;
+	static char *function                                         = "libesedb_table_definition_get_column_by_utf16_name";
+	uint32_t name_hash                                            = 0;
+	int compare_result                                            = 0;
+	int entry_index                                               = 0;
+	int result                                                    = 0;
+	int safe_column_index                                         = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column index.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	/* The column name hash table is rebuild if it was build with a different codepage
+	 */
+	if( ( table_definition->column_name_hash_table == NULL )
+	 || ( table_definition->column_identifier_hash_table == NULL )
+	 || ( table_definition->column_name_hash_table_ascii_codepage != ascii_codepage ) )
+	{
+		if( libesedb_table_definition_build_column_hash_tables(
+		     table_definition,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build column hash tables.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_hash_table_get_name_hash_from_utf16_string(
+	     utf16_string,
+	     utf16_string_length,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name hash of UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	/* Columns with a different name can have the same hash
+	 */
+	entry_index = -1;
+
+	do
+	{
+		result = libesedb_hash_table_get_next_value_by_hash(
+		          table_definition->column_name_hash_table,
+		          name_hash,
+		          &entry_index,
+		          &safe_column_index,
+		          (intptr_t **) &safe_column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from name hash table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( ( safe_column_catalog_definition == NULL )
+		 || ( safe_column_catalog_definition->name == NULL ) )
+		{
+			continue;
+		}
+		compare_result = libuna_utf16_string_compare_with_byte_stream(
+		                  utf16_string,
+		                  utf16_string_length,
+		                  safe_column_catalog_definition->name,
+		                  safe_column_catalog_definition->name_size,
+		                  ascii_codepage,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare UTF-16 string with column catalog definition: %d name.",
+			 function,
+			 safe_column_index );
+
+			return( -1 );
+		}
+		else if( compare_result == LIBUNA_COMPARE_EQUAL )
+		{
+			*column_index              = safe_column_index;
+			*column_catalog_definition = safe_column_catalog_definition;
+
+			return( 1 );
+		}
+	}
+	while( result != 0 );
+
+	return( 0 );
+}
+
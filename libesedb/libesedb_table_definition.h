@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libesedb_catalog_definition.h"
+#include "libesedb_hash_table.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 
@@ -56,6 +57,29 @@ struct libesedb_table_definition
 	/* The index catalog definition list
 	 */
 	libcdata_list_t *index_catalog_definition_list;
+
+	/* The column name hash table
+	 * The column catalog definitions are hashed by name
+	 */
+	libesedb_hash_table_t *column_name_hash_table;
+
+	/* The codepage used to hash the names in the column name hash table
+	 */
+	int column_name_hash_table_ascii_codepage;
+
+	/* The column identifier hash table
+	 * The column catalog definitions are hashed by identifier
+	 */
+	libesedb_hash_table_t *column_identifier_hash_table;
+
+	/* The number of the catalog (leaf) page that contains the table catalog definition
+	 * 0 if the column, index, long value and callback catalog definitions have been read
+	 */
+	uint32_t catalog_page_number;
+
+	/* The index of the catalog page value that contains the table catalog definition
+	 */
+	uint16_t catalog_page_value_index;
 };
 
 int libesedb_table_definition_initialize(
@@ -67,6 +91,10 @@ int libesedb_table_definition_free(
      libesedb_table_definition_t **table_definition,
      libcerror_error_t **error );
 
+int libesedb_table_definition_empty(
+     libesedb_table_definition_t *table_definition,
+     libcerror_error_t **error );
+
 int libesedb_table_definition_set_long_value_catalog_definition(
      libesedb_table_definition_t *table_definition,
      libesedb_catalog_definition_t *long_value_catalog_definition,
@@ -87,6 +115,42 @@ int libesedb_table_definition_append_index_catalog_definition(
      libesedb_catalog_definition_t *index_catalog_definition,
      libcerror_error_t **error );
 
+int libesedb_table_definition_build_column_hash_tables(
+     libesedb_table_definition_t *table_definition,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libesedb_table_definition_get_column_catalog_definition_by_identifier(
+     libesedb_table_definition_t *table_definition,
+     uint32_t column_identifier,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error );
+
+int libesedb_table_definition_get_column_by_identifier(
+     libesedb_table_definition_t *table_definition,
+     uint32_t column_identifier,
+     int *column_index,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error );
+
+int libesedb_table_definition_get_column_by_utf8_name(
+     libesedb_table_definition_t *table_definition,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int ascii_codepage,
+     int *column_index,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error );
+
+int libesedb_table_definition_get_column_by_utf16_name(
+     libesedb_table_definition_t *table_definition,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int ascii_codepage,
+     int *column_index,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
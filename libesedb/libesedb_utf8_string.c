@@ -0,0 +1,373 @@
+/*
+ * UTF-8 string functions
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+#include "libesedb_utf8_string.h"
+
+/* Retrieves the size of an UTF-8 string of an UTF-16 little-endian stream
+ * Runs of ASCII characters are converted 4 characters at a time
+ * Streams with a byte order mark or unpaired surrogates are not supported
+ * and should be converted with libuna instead
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if the stream is not supported or -1 on error
+ */
+int libesedb_utf8_string_size_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libesedb_utf8_string_size_from_utf16_stream";
+	size_t safe_utf8_string_size = 0;
+	size_t utf16_stream_index    = 0;
+	uint64_t value_64bit         = 0;
+	uint16_t utf16_surrogate     = 0;
+	uint16_t utf16_character     = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size == 0 )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	/* Leave byte order mark handling to libuna
+	 */
+	if( ( ( utf16_stream[ 0 ] == 0xff ) && ( utf16_stream[ 1 ] == 0xfe ) )
+	 || ( ( utf16_stream[ 0 ] == 0xfe ) && ( utf16_stream[ 1 ] == 0xff ) ) )
+	{
+		return( 0 );
+	}
+	while( utf16_stream_index < utf16_stream_size )
+	{
+		if( ( utf16_stream_size - utf16_stream_index ) >= 8 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( utf16_stream[ utf16_stream_index ] ),
+			 value_64bit );
+
+			/* Check if all 4 characters are ASCII and none of them is the end of string character
+			 */
+			if( ( ( value_64bit & 0xff80ff80ff80ff80ULL ) == 0 )
+			 && ( ( ( value_64bit - 0x0001000100010001ULL ) & 0x8000800080008000ULL ) == 0 ) )
+			{
+				safe_utf8_string_size += 4;
+				utf16_stream_index    += 8;
+
+				continue;
+			}
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 utf16_character );
+
+		utf16_stream_index += 2;
+
+		if( utf16_character == 0 )
+		{
+			break;
+		}
+		if( utf16_character < 0x0080 )
+		{
+			safe_utf8_string_size += 1;
+		}
+		else if( utf16_character < 0x0800 )
+		{
+			safe_utf8_string_size += 2;
+		}
+		else if( ( utf16_character >= 0xd800 )
+		      && ( utf16_character <= 0xdbff ) )
+		{
+			if( utf16_stream_index >= utf16_stream_size )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( utf16_stream[ utf16_stream_index ] ),
+			 utf16_surrogate );
+
+			if( ( utf16_surrogate < 0xdc00 )
+			 || ( utf16_surrogate > 0xdfff ) )
+			{
+				return( 0 );
+			}
+			utf16_stream_index += 2;
+
+			safe_utf8_string_size += 4;
+		}
+		else if( ( utf16_character >= 0xdc00 )
+		      && ( utf16_character <= 0xdfff ) )
+		{
+			return( 0 );
+		}
+		else
+		{
+			safe_utf8_string_size += 3;
+		}
+	}
+	/* Add the end of string character
+	 */
+	*utf8_string_size = safe_utf8_string_size + 1;
+
+	return( 1 );
+}
+
+/* Copies an UTF-16 little-endian stream to an UTF-8 string
+ * Runs of ASCII characters are converted 4 characters at a time
+ * Streams with a byte order mark or unpaired surrogates are not supported
+ * and should be converted with libuna instead
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if the stream is not supported or -1 on error
+ */
+int libesedb_utf8_string_copy_from_utf16_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libesedb_utf8_string_copy_from_utf16_stream";
+	size_t utf16_stream_index  = 0;
+	size_t utf8_string_index   = 0;
+	uint64_t value_64bit       = 0;
+	uint32_t unicode_character = 0;
+	uint16_t utf16_surrogate   = 0;
+	uint8_t character_size     = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size == 0 )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	/* Leave byte order mark handling to libuna
+	 */
+	if( ( ( utf16_stream[ 0 ] == 0xff ) && ( utf16_stream[ 1 ] == 0xfe ) )
+	 || ( ( utf16_stream[ 0 ] == 0xfe ) && ( utf16_stream[ 1 ] == 0xff ) ) )
+	{
+		return( 0 );
+	}
+	while( utf16_stream_index < utf16_stream_size )
+	{
+		if( ( ( utf16_stream_size - utf16_stream_index ) >= 8 )
+		 && ( ( utf8_string_size - utf8_string_index ) >= 4 ) )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( utf16_stream[ utf16_stream_index ] ),
+			 value_64bit );
+
+			/* Check if all 4 characters are ASCII and none of them is the end of string character
+			 */
+			if( ( ( value_64bit & 0xff80ff80ff80ff80ULL ) == 0 )
+			 && ( ( ( value_64bit - 0x0001000100010001ULL ) & 0x8000800080008000ULL ) == 0 ) )
+			{
+				utf8_string[ utf8_string_index ]     = (uint8_t) value_64bit;
+				utf8_string[ utf8_string_index + 1 ] = (uint8_t) ( value_64bit >> 16 );
+				utf8_string[ utf8_string_index + 2 ] = (uint8_t) ( value_64bit >> 32 );
+				utf8_string[ utf8_string_index + 3 ] = (uint8_t) ( value_64bit >> 48 );
+
+				utf8_string_index  += 4;
+				utf16_stream_index += 8;
+
+				continue;
+			}
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 unicode_character );
+
+		utf16_stream_index += 2;
+
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		if( unicode_character < 0x0080 )
+		{
+			character_size = 1;
+		}
+		else if( unicode_character < 0x0800 )
+		{
+			character_size = 2;
+		}
+		else if( ( unicode_character >= 0xd800 )
+		      && ( unicode_character <= 0xdbff ) )
+		{
+			if( utf16_stream_index >= utf16_stream_size )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( utf16_stream[ utf16_stream_index ] ),
+			 utf16_surrogate );
+
+			if( ( utf16_surrogate < 0xdc00 )
+			 || ( utf16_surrogate > 0xdfff ) )
+			{
+				return( 0 );
+			}
+			utf16_stream_index += 2;
+
+			unicode_character = 0x010000
+			                  + ( ( unicode_character - 0xd800 ) << 10 )
+			                  + ( utf16_surrogate - 0xdc00 );
+
+			character_size = 4;
+		}
+		else if( ( unicode_character >= 0xdc00 )
+		      && ( unicode_character <= 0xdfff ) )
+		{
+			return( 0 );
+		}
+		else
+		{
+			character_size = 3;
+		}
+		if( character_size > ( utf8_string_size - utf8_string_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		switch( character_size )
+		{
+			case 1:
+				utf8_string[ utf8_string_index++ ] = (uint8_t) unicode_character;
+				break;
+
+			case 2:
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xc0 | ( unicode_character >> 6 ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+				break;
+
+			case 3:
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xe0 | ( unicode_character >> 12 ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+				break;
+
+			default:
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xf0 | ( unicode_character >> 18 ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 12 ) & 0x3f ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+				break;
+		}
+	}
+	if( utf8_string_index >= utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	utf8_string[ utf8_string_index ] = 0;
+
+	return( 1 );
+}
+
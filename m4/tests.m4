@@ -21,3 +21,19 @@ AC_DEFUN([AX_TESTS_CHECK_LOCAL],
   ])
 ])
 
+dnl Function to detect whether the benchmark programs should be build
+AC_DEFUN([AX_TESTS_CHECK_ENABLE_BENCHMARKS],
+  [AX_COMMON_ARG_ENABLE(
+    [benchmarks],
+    [benchmarks],
+    [build the benchmark programs],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_benchmarks" != xno],
+    [ac_cv_enable_benchmarks=yes])
+
+  AM_CONDITIONAL(
+    HAVE_BENCHMARKS,
+    [test "x$ac_cv_enable_benchmarks" != xno])
+])
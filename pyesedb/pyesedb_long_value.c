@@ -52,6 +52,66 @@ PyMethodDef pyesedb_long_value_object_methods[] = {
 	  "\n"
 	  "Retrieves the data as a string." },
 
+	/* Functions to access the data as a stream */
+
+	{ "read_buffer",
+	  (PyCFunction) pyesedb_long_value_read_buffer,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer(size) -> Binary string\n"
+	  "\n"
+	  "Reads a buffer of data." },
+
+	{ "read_buffer_at_offset",
+	  (PyCFunction) pyesedb_long_value_read_buffer_at_offset,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_at_offset(size, offset) -> Binary string\n"
+	  "\n"
+	  "Reads a buffer of data at a specific offset." },
+
+	{ "seek_offset",
+	  (PyCFunction) pyesedb_long_value_seek_offset,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "seek_offset(offset, whence) -> None\n"
+	  "\n"
+	  "Seeks an offset within the data." },
+
+	{ "get_offset",
+	  (PyCFunction) pyesedb_long_value_get_offset,
+	  METH_NOARGS,
+	  "get_offset() -> Integer\n"
+	  "\n"
+	  "Retrieves the current offset within the data." },
+
+	{ "get_size",
+	  (PyCFunction) pyesedb_long_value_get_size,
+	  METH_NOARGS,
+	  "get_size() -> Integer\n"
+	  "\n"
+	  "Retrieves the size of the data." },
+
+	/* Functions for file-like object compatibility */
+
+	{ "read",
+	  (PyCFunction) pyesedb_long_value_read_buffer,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read(size) -> Binary string\n"
+	  "\n"
+	  "Reads a buffer of data." },
+
+	{ "seek",
+	  (PyCFunction) pyesedb_long_value_seek_offset,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "seek(offset, whence) -> None\n"
+	  "\n"
+	  "Seeks an offset within the data." },
+
+	{ "tell",
+	  (PyCFunction) pyesedb_long_value_get_offset,
+	  METH_NOARGS,
+	  "tell() -> Integer\n"
+	  "\n"
+	  "Retrieves the current offset within the data." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -64,6 +124,12 @@ PyGetSetDef pyesedb_long_value_object_get_set_definitions[] = {
 	  "The data",
 	  NULL },
 
+	{ "size",
+	  (getter) pyesedb_long_value_get_size,
+	  (setter) 0,
+	  "The size of the data",
+	  NULL },
+
 	/* Sentinel */
 	{ NULL, NULL, NULL, NULL, NULL }
 };
@@ -548,3 +614,502 @@ on_error:
 	return( NULL );
 }
 
+/* Reads data at the current offset into a buffer
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_long_value_read_buffer(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *integer_object    = NULL;
+	PyObject *string_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	char *buffer                = NULL;
+	static char *function       = "pyesedb_long_value_read_buffer";
+	static char *keyword_list[] = { "size", NULL };
+	ssize_t read_count          = 0;
+	off64_t current_offset      = 0;
+	size64_t data_size          = 0;
+	int64_t read_size           = 0;
+	int result                  = 0;
+
+	if( pyesedb_long_value == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid long value.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|O",
+	     keyword_list,
+	     &integer_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( integer_object == NULL )
+	 || ( integer_object == Py_None ) )
+	{
+		/* Read the remainder of the data
+		 */
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libesedb_long_value_get_data_size(
+		          pyesedb_long_value->long_value,
+		          &data_size,
+		          &error );
+
+		if( result == 1 )
+		{
+			result = libesedb_long_value_get_offset(
+			          pyesedb_long_value->long_value,
+			          &current_offset,
+			          &error );
+		}
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyesedb_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve data size and current offset.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		if( (size64_t) current_offset < data_size )
+		{
+			read_size = (int64_t) ( data_size - (size64_t) current_offset );
+		}
+	}
+	else if( pyesedb_integer_signed_copy_to_64bit(
+	          integer_object,
+	          &read_size,
+	          &error ) != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_ValueError,
+		 "%s: unable to convert integer object into read size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	if( read_size < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read size value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	/* Make sure the data fits into a memory buffer
+	 */
+	if( ( read_size > (int64_t) INT_MAX )
+	 || ( read_size > (int64_t) SSIZE_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read size value exceeds maximum.",
+		 function );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	string_object = PyBytes_FromStringAndSize(
+	                 NULL,
+	                 (Py_ssize_t) read_size );
+
+	buffer = PyBytes_AsString(
+	          string_object );
+#else
+	string_object = PyString_FromStringAndSize(
+	                 NULL,
+	                 (Py_ssize_t) read_size );
+
+	buffer = PyString_AsString(
+	          string_object );
+#endif
+	if( buffer == NULL )
+	{
+		Py_DecRef(
+		 string_object );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libesedb_long_value_read_buffer(
+	              pyesedb_long_value->long_value,
+	              (uint8_t *) buffer,
+	              (size_t) read_size,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( read_count == -1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		Py_DecRef(
+		 string_object );
+
+		return( NULL );
+	}
+	/* Need to resize the string here in case read_size was not fully read.
+	 */
+#if PY_MAJOR_VERSION >= 3
+	if( _PyBytes_Resize(
+	     &string_object,
+	     (Py_ssize_t) read_count ) != 0 )
+#else
+	if( _PyString_Resize(
+	     &string_object,
+	     (Py_ssize_t) read_count ) != 0 )
+#endif
+	{
+		Py_DecRef(
+		 string_object );
+
+		return( NULL );
+	}
+	return( string_object );
+}
+
+/* Reads data at a specific offset into a buffer
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_long_value_read_buffer_at_offset(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *integer_object    = NULL;
+	PyObject *string_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	char *buffer                = NULL;
+	static char *function       = "pyesedb_long_value_read_buffer_at_offset";
+	static char *keyword_list[] = { "size", "offset", NULL };
+	ssize_t read_count          = 0;
+	off64_t read_offset         = 0;
+	int64_t read_size           = 0;
+
+	if( pyesedb_long_value == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid long value.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "OL",
+	     keyword_list,
+	     &integer_object,
+	     &read_offset ) == 0 )
+	{
+		return( NULL );
+	}
+	if( pyesedb_integer_signed_copy_to_64bit(
+	     integer_object,
+	     &read_size,
+	     &error ) != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_ValueError,
+		 "%s: unable to convert integer object into read size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	if( read_size < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read size value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	/* Make sure the data fits into a memory buffer
+	 */
+	if( ( read_size > (int64_t) INT_MAX )
+	 || ( read_size > (int64_t) SSIZE_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read size value exceeds maximum.",
+		 function );
+
+		return( NULL );
+	}
+	if( read_offset < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read offset value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	string_object = PyBytes_FromStringAndSize(
+	                 NULL,
+	                 (Py_ssize_t) read_size );
+
+	buffer = PyBytes_AsString(
+	          string_object );
+#else
+	string_object = PyString_FromStringAndSize(
+	                 NULL,
+	                 (Py_ssize_t) read_size );
+
+	buffer = PyString_AsString(
+	          string_object );
+#endif
+	if( buffer == NULL )
+	{
+		Py_DecRef(
+		 string_object );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libesedb_long_value_read_buffer_at_offset(
+	              pyesedb_long_value->long_value,
+	              (uint8_t *) buffer,
+	              (size_t) read_size,
+	              (off64_t) read_offset,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( read_count == -1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		Py_DecRef(
+		 string_object );
+
+		return( NULL );
+	}
+	/* Need to resize the string here in case read_size was not fully read.
+	 */
+#if PY_MAJOR_VERSION >= 3
+	if( _PyBytes_Resize(
+	     &string_object,
+	     (Py_ssize_t) read_count ) != 0 )
+#else
+	if( _PyString_Resize(
+	     &string_object,
+	     (Py_ssize_t) read_count ) != 0 )
+#endif
+	{
+		Py_DecRef(
+		 string_object );
+
+		return( NULL );
+	}
+	return( string_object );
+}
+
+/* Seeks a certain offset of the data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_long_value_seek_offset(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyesedb_long_value_seek_offset";
+	static char *keyword_list[] = { "offset", "whence", NULL };
+	off64_t offset              = 0;
+	int whence                  = 0;
+
+	if( pyesedb_long_value == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid long value.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "L|i",
+	     keyword_list,
+	     &offset,
+	     &whence ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	offset = libesedb_long_value_seek_offset(
+	          pyesedb_long_value->long_value,
+	          offset,
+	          whence,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( offset == -1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to seek offset.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Retrieves the current offset of the data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_long_value_get_offset(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments PYESEDB_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyesedb_long_value_get_offset";
+	off64_t current_offset   = 0;
+	int result               = 0;
+
+	PYESEDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyesedb_long_value == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid long value.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_long_value_get_offset(
+	          pyesedb_long_value->long_value,
+	          &current_offset,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve offset.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyesedb_integer_signed_new_from_64bit(
+	                  (int64_t) current_offset );
+
+	return( integer_object );
+}
+
+/* Retrieves the size of the data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_long_value_get_size(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments PYESEDB_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyesedb_long_value_get_size";
+	size64_t data_size       = 0;
+	int result               = 0;
+
+	PYESEDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyesedb_long_value == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid long value.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_long_value_get_data_size(
+	          pyesedb_long_value->long_value,
+	          &data_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyesedb_integer_unsigned_new_from_64bit(
+	                  (uint64_t) data_size );
+
+	return( integer_object );
+}
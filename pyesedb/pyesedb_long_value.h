@@ -71,6 +71,29 @@ PyObject *pyesedb_long_value_get_data_as_string(
            pyesedb_long_value_t *pyesedb_long_value,
            PyObject *arguments );
 
+PyObject *pyesedb_long_value_read_buffer(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyesedb_long_value_read_buffer_at_offset(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyesedb_long_value_seek_offset(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyesedb_long_value_get_offset(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments );
+
+PyObject *pyesedb_long_value_get_size(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments );
+
 #if defined( __cplusplus )
 }
 #endif
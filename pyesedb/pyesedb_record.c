@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
@@ -88,6 +89,13 @@ PyMethodDef pyesedb_record_object_methods[] = {
 	  "\n"
 	  "Retrieves the value data as a binary string." },
 
+	{ "get_value_data_as_boolean",
+	  (PyCFunction) pyesedb_record_get_value_data_as_boolean,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_value_data_as_boolean(value_entry) -> Boolean or None\n"
+	  "\n"
+	  "Retrieves the value data as a boolean." },
+
 	{ "get_value_data_as_floating_point",
 	  (PyCFunction) pyesedb_record_get_value_data_as_floating_point,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -116,6 +124,13 @@ PyMethodDef pyesedb_record_object_methods[] = {
 	  "\n"
 	  "Retrieves the value data as a long value." },
 
+	{ "get_value_by_name",
+	  (PyCFunction) pyesedb_record_get_value_by_name,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_value_by_name(column_name) -> Object or None\n"
+	  "\n"
+	  "Retrieves the value of the column with the corresponding name." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -957,6 +972,118 @@ on_error:
 	return( NULL );
 }
 
+/* Retrieves the value data represented as a boolean
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_record_get_value_data_as_boolean(
+           pyesedb_record_t *pyesedb_record,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyesedb_record_get_value_data_as_boolean";
+	static char *keyword_list[] = { "value_entry", NULL };
+	uint32_t column_type        = 0;
+	uint8_t value_boolean       = 0;
+	int result                  = 0;
+	int value_entry             = 0;
+
+	if( pyesedb_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &value_entry ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_record_get_column_type(
+	          pyesedb_record->record,
+	          value_entry,
+	          &column_type,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve column: %d type.",
+		 function,
+		 value_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	if( column_type != LIBESEDB_COLUMN_TYPE_BOOLEAN )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: value: %d is not a boolean type.",
+		 function,
+		 value_entry );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_record_get_value_boolean(
+	          pyesedb_record->record,
+	          value_entry,
+	          &value_boolean,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve boolean value: %d.",
+		 function,
+		 value_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	if( value_boolean != 0 )
+	{
+		Py_IncRef(
+		 (PyObject *) Py_True );
+
+		return( Py_True );
+	}
+	Py_IncRef(
+	 (PyObject *) Py_False );
+
+	return( Py_False );
+}
+
 /* Retrieves the value data represented as a floating point
  * Returns a Python object if successful or NULL on error
  */
@@ -1532,3 +1659,207 @@ on_error:
 	return( NULL );
 }
 
+/* Retrieves the value of a specific column name
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_record_get_value_by_name(
+           pyesedb_record_t *pyesedb_record,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	PyObject *arguments_tuple   = NULL;
+	PyObject *value_object      = NULL;
+	char *column_name           = NULL;
+	static char *keyword_list[] = { "column_name", NULL };
+	static char *function       = "pyesedb_record_get_value_by_name";
+	size_t column_name_length   = 0;
+	uint32_t column_type        = 0;
+	uint8_t value_data_flags    = 0;
+	int result                  = 0;
+	int value_entry             = 0;
+
+	if( pyesedb_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "s",
+	     keyword_list,
+	     &column_name ) == 0 )
+	{
+		return( NULL );
+	}
+	column_name_length = narrow_string_length(
+	                      column_name );
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_record_get_value_entry_by_utf8_name(
+	          pyesedb_record->record,
+	          (uint8_t *) column_name,
+	          column_name_length,
+	          &value_entry,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve value entry.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	/* Check if the column is present
+	 */
+	else if( result == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_record_get_value_data_flags(
+	          pyesedb_record->record,
+	          value_entry,
+	          &value_data_flags,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve value: %d data flags.",
+		 function,
+		 value_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_record_get_column_type(
+	          pyesedb_record->record,
+	          value_entry,
+	          &column_type,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve column: %d type.",
+		 function,
+		 value_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	arguments_tuple = Py_BuildValue(
+	                   "(i)",
+	                   value_entry );
+
+	if( arguments_tuple == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create arguments tuple.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+	{
+		value_object = pyesedb_record_get_value_data_as_long_value(
+		                pyesedb_record,
+		                arguments_tuple,
+		                NULL );
+	}
+	else if( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
+	{
+		value_object = pyesedb_record_get_value_data(
+		                pyesedb_record,
+		                arguments_tuple,
+		                NULL );
+	}
+	else
+	{
+		switch( column_type )
+		{
+			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+				value_object = pyesedb_record_get_value_data_as_boolean(
+				                pyesedb_record,
+				                arguments_tuple,
+				                NULL );
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			case LIBESEDB_COLUMN_TYPE_CURRENCY:
+			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+				value_object = pyesedb_record_get_value_data_as_integer(
+				                pyesedb_record,
+				                arguments_tuple,
+				                NULL );
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+				value_object = pyesedb_record_get_value_data_as_floating_point(
+				                pyesedb_record,
+				                arguments_tuple,
+				                NULL );
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_TEXT:
+			case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+				value_object = pyesedb_record_get_value_data_as_string(
+				                pyesedb_record,
+				                arguments_tuple,
+				                NULL );
+				break;
+
+			default:
+				value_object = pyesedb_record_get_value_data(
+				                pyesedb_record,
+				                arguments_tuple,
+				                NULL );
+				break;
+		}
+	}
+	Py_DecRef(
+	 arguments_tuple );
+
+	return( value_object );
+}
+
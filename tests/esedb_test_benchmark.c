@@ -0,0 +1,713 @@
+/*
+ * Library benchmark program
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "esedb_test_getopt.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+
+/* The default number of scanned records after which a record is looked up
+ */
+#define ESEDB_TEST_BENCHMARK_LOOKUP_INTERVAL	16
+
+/* The number of times the file is opened by the open benchmark
+ */
+#define ESEDB_TEST_BENCHMARK_OPEN_ITERATIONS	100
+
+/* Prints usage information
+ */
+void esedb_test_benchmark_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use esedb_test_benchmark to measure the time of library operations\n"
+	                 "on an Extensible Storage Engine (ESE) Database File (EDB).\n\n" );
+
+	fprintf( stream, "Usage: esedb_test_benchmark [ -b benchmark ] [ -l interval ] [ -h ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+	fprintf( stream, "\t-b:     the benchmark to run, options: all (default), open, scan_lookup\n"
+	                 "\t        open: opens and closes the file %d times\n"
+	                 "\t        scan_lookup: scans the records of every table with a table cursor\n"
+	                 "\t        and looks up a record by entry after every interval scanned records\n",
+	         ESEDB_TEST_BENCHMARK_OPEN_ITERATIONS );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-l:     the number of scanned records after which a record is looked up\n"
+	                 "\t        (default is %d)\n",
+	         ESEDB_TEST_BENCHMARK_LOOKUP_INTERVAL );
+}
+
+/* Returns the number of seconds elapsed since the start clock
+ */
+double esedb_test_benchmark_get_elapsed_time(
+        clock_t start_clock )
+{
+	return( (double) ( clock() - start_clock ) / (double) CLOCKS_PER_SEC );
+}
+
+/* Opens and closes the file a number of times, which measures the time needed to read
+ * the file header, the database and the catalog
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_benchmark_open(
+     const system_character_t *source,
+     int number_of_iterations,
+     libcerror_error_t **error )
+{
+	libesedb_file_t *file = NULL;
+	static char *function = "esedb_test_benchmark_open";
+	int iteration         = 0;
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( libesedb_file_initialize(
+		     &file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize file.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libesedb_file_open_wide(
+		     file,
+		     source,
+		     LIBESEDB_OPEN_READ,
+		     error ) != 1 )
+#else
+		if( libesedb_file_open(
+		     file,
+		     source,
+		     LIBESEDB_OPEN_READ,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_file_close(
+		     file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_file_free(
+		     &file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libesedb_file_close(
+		 file,
+		 NULL );
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans the records of every table with a table cursor, interleaved with record
+ * lookups by entry, which descend the table values tree from its root page
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_benchmark_scan_lookup(
+     libesedb_file_t *file,
+     int lookup_interval,
+     int *number_of_scanned_records,
+     int *number_of_looked_up_records,
+     libcerror_error_t **error )
+{
+	libesedb_record_t *record             = NULL;
+	libesedb_table_t *table               = NULL;
+	libesedb_table_cursor_t *table_cursor = NULL;
+	static char *function                 = "esedb_test_benchmark_scan_lookup";
+	int number_of_records                 = 0;
+	int number_of_tables                  = 0;
+	int record_entry                      = 0;
+	int result                            = 0;
+	int table_index                       = 0;
+
+	if( lookup_interval <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid lookup interval value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_scanned_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of scanned records.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_looked_up_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of looked up records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_scanned_records   = 0;
+	*number_of_looked_up_records = 0;
+
+	if( libesedb_file_get_number_of_tables(
+	     file,
+	     &number_of_tables,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tables.",
+		 function );
+
+		goto on_error;
+	}
+	for( table_index = 0;
+	     table_index < number_of_tables;
+	     table_index++ )
+	{
+		if( libesedb_file_get_table(
+		     file,
+		     table_index,
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table: %d.",
+			 function,
+			 table_index );
+
+			goto on_error;
+		}
+		if( libesedb_table_get_number_of_records(
+		     table,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records of table: %d.",
+			 function,
+			 table_index );
+
+			goto on_error;
+		}
+		if( libesedb_table_cursor_open(
+		     table,
+		     &table_cursor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to open cursor of table: %d.",
+			 function,
+			 table_index );
+
+			goto on_error;
+		}
+		do
+		{
+			result = libesedb_table_cursor_next(
+			          table_cursor,
+			          &record,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next record of table: %d.",
+				 function,
+				 table_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( libesedb_record_free(
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record.",
+				 function );
+
+				goto on_error;
+			}
+			*number_of_scanned_records += 1;
+
+			if( ( *number_of_scanned_records % lookup_interval ) != 0 )
+			{
+				continue;
+			}
+			/* Spread the lookups over the table with a large prime stride
+			 */
+			record_entry = (int) ( ( (uint64_t) *number_of_scanned_records * 7919 ) % (uint64_t) number_of_records );
+
+			if( libesedb_table_get_record(
+			     table,
+			     record_entry,
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d of table: %d.",
+				 function,
+				 record_entry,
+				 table_index );
+
+				goto on_error;
+			}
+			if( libesedb_record_free(
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record.",
+				 function );
+
+				goto on_error;
+			}
+			*number_of_looked_up_records += 1;
+		}
+		while( result != 0 );
+
+		if( libesedb_table_cursor_close(
+		     &table_cursor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to close cursor of table: %d.",
+			 function,
+			 table_index );
+
+			goto on_error;
+		}
+		if( libesedb_table_free(
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table: %d.",
+			 function,
+			 table_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( table_cursor != NULL )
+	{
+		libesedb_table_cursor_close(
+		 &table_cursor,
+		 NULL );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                 = NULL;
+	libesedb_file_t *file                    = NULL;
+	system_character_t *option_benchmark     = NULL;
+	system_character_t *option_interval      = NULL;
+	system_character_t *source               = NULL;
+	clock_t start_clock                      = 0;
+	system_integer_t option                  = 0;
+	size_t string_index                      = 0;
+	size_t string_length                     = 0;
+	int lookup_interval                      = ESEDB_TEST_BENCHMARK_LOOKUP_INTERVAL;
+	int number_of_looked_up_records          = 0;
+	int number_of_scanned_records            = 0;
+	int run_open                             = 1;
+	int run_scan_lookup                      = 1;
+
+	while( ( option = esedb_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "b:hl:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				esedb_test_benchmark_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				option_benchmark = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				esedb_test_benchmark_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'l':
+				option_interval = optarg;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		esedb_test_benchmark_usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( option_benchmark != NULL )
+	{
+		string_length = system_string_length(
+		                 option_benchmark );
+
+		if( ( string_length == 3 )
+		 && ( system_string_compare(
+		       option_benchmark,
+		       _SYSTEM_STRING( "all" ),
+		       3 ) == 0 ) )
+		{
+			run_open        = 1;
+			run_scan_lookup = 1;
+		}
+		else if( ( string_length == 4 )
+		      && ( system_string_compare(
+		            option_benchmark,
+		            _SYSTEM_STRING( "open" ),
+		            4 ) == 0 ) )
+		{
+			run_open        = 1;
+			run_scan_lookup = 0;
+		}
+		else if( ( string_length == 11 )
+		      && ( system_string_compare(
+		            option_benchmark,
+		            _SYSTEM_STRING( "scan_lookup" ),
+		            11 ) == 0 ) )
+		{
+			run_open        = 0;
+			run_scan_lookup = 1;
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported benchmark: %" PRIs_SYSTEM ".\n",
+			 option_benchmark );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( option_interval != NULL )
+	{
+		string_length = system_string_length(
+		                 option_interval );
+
+		lookup_interval = 0;
+
+		for( string_index = 0;
+		     string_index < string_length;
+		     string_index++ )
+		{
+			if( ( option_interval[ string_index ] < (system_character_t) '0' )
+			 || ( option_interval[ string_index ] > (system_character_t) '9' )
+			 || ( lookup_interval >= 100000000 ) )
+			{
+				lookup_interval = 0;
+
+				break;
+			}
+			lookup_interval *= 10;
+			lookup_interval += (int) ( option_interval[ string_index ] - (system_character_t) '0' );
+		}
+		if( lookup_interval <= 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported lookup interval: %" PRIs_SYSTEM ".\n",
+			 option_interval );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( run_open != 0 )
+	{
+		start_clock = clock();
+
+		if( esedb_test_benchmark_open(
+		     source,
+		     ESEDB_TEST_BENCHMARK_OPEN_ITERATIONS,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run open benchmark.\n" );
+
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "open: file opened and closed %d times in %.3f seconds\n",
+		 ESEDB_TEST_BENCHMARK_OPEN_ITERATIONS,
+		 esedb_test_benchmark_get_elapsed_time(
+		  start_clock ) );
+	}
+	if( run_scan_lookup == 0 )
+	{
+		return( EXIT_SUCCESS );
+	}
+	if( libesedb_file_initialize(
+	     &file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize file.\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libesedb_file_open_wide(
+	     file,
+	     source,
+	     LIBESEDB_OPEN_READ,
+	     &error ) != 1 )
+#else
+	if( libesedb_file_open(
+	     file,
+	     source,
+	     LIBESEDB_OPEN_READ,
+	     &error ) != 1 )
+#endif
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open file: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( run_scan_lookup != 0 )
+	{
+		start_clock = clock();
+
+		if( esedb_test_benchmark_scan_lookup(
+		     file,
+		     lookup_interval,
+		     &number_of_scanned_records,
+		     &number_of_looked_up_records,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run scan and lookup benchmark.\n" );
+
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "scan_lookup: %d records scanned and %d records looked up in %.3f seconds\n",
+		 number_of_scanned_records,
+		 number_of_looked_up_records,
+		 esedb_test_benchmark_get_elapsed_time(
+		  start_clock ) );
+	}
+	if( libesedb_file_close(
+	     file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close file.\n" );
+
+		goto on_error;
+	}
+	if( libesedb_file_free(
+	     &file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free file.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libesedb_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libesedb_file_close(
+		 file,
+		 NULL );
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -32,15 +33,312 @@
 #include "esedb_test_libcdata.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
+#include "esedb_test_libfcache.h"
+#include "esedb_test_libfdata.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
 #include "../libesedb/libesedb_catalog.h"
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
 #include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_table_definition.h"
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+/* Catalog definition: table MSysObjects
+ */
+uint8_t esedb_test_catalog_table_definition_data[ 45 ] = {
+	0x08, 0x80, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x14, 0x00, 0x00, 0x00, 0xff, 0x00,
+	0x0b, 0x00, 0x4d, 0x53, 0x79, 0x73, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73 };
+
+/* Catalog definition: column ColumnName1
+ */
+uint8_t esedb_test_catalog_column_definition_data1[ 45 ] = {
+	0x08, 0x80, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x14, 0x00, 0x00, 0x00, 0xff, 0x00,
+	0x0b, 0x00, 0x43, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x4e, 0x61, 0x6d, 0x65, 0x31 };
+
+/* Catalog definition: index IndexName01
+ */
+uint8_t esedb_test_catalog_index_definition_data[ 45 ] = {
+	0x08, 0x80, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x14, 0x00, 0x00, 0x00, 0xff, 0x00,
+	0x0b, 0x00, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x4e, 0x61, 0x6d, 0x65, 0x30, 0x31 };
+
+/* Catalog definition: long value LongValues1
+ */
+uint8_t esedb_test_catalog_long_value_definition_data[ 45 ] = {
+	0x08, 0x80, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x14, 0x00, 0x00, 0x00, 0xff, 0x00,
+	0x0b, 0x00, 0x4c, 0x6f, 0x6e, 0x67, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x31 };
+
+/* Catalog definition: column ColumnName2
+ */
+uint8_t esedb_test_catalog_column_definition_data2[ 45 ] = {
+	0x08, 0x80, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x14, 0x00, 0x00, 0x00, 0xff, 0x00,
+	0x0b, 0x00, 0x43, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x4e, 0x61, 0x6d, 0x65, 0x32 };
+
+/* Catalog definition: column ColumnName2 with an unsupported last fixed size data type
+ */
+uint8_t esedb_test_catalog_corrupted_column_definition_data2[ 45 ] = {
+	0x04, 0x80, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x14, 0x00, 0x00, 0x00, 0xff, 0x00,
+	0x0b, 0x00, 0x43, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x4e, 0x61, 0x6d, 0x65, 0x32 };
+
+/* The catalog test data contains 3 pages of 4096 bytes, with a catalog leaf root page (1)
+ * that contains a table catalog definition followed by a column, index, long value
+ * and another column catalog definition
+ */
+uint8_t esedb_test_catalog_data[ 3 * 4096 ];
+
+/* Writes the catalog test data
+ * If corrupted is set the last column catalog definition cannot be read
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_catalog_write_data(
+     uint8_t *data,
+     size_t data_size,
+     int corrupted,
+     libcerror_error_t **error )
+{
+	uint8_t key1[ 2 ]               = { 0x7f, 0x01 };
+	uint8_t key2[ 2 ]               = { 0x7f, 0x02 };
+	uint8_t key3[ 2 ]               = { 0x7f, 0x03 };
+	uint8_t key4[ 2 ]               = { 0x7f, 0x04 };
+	uint8_t key5[ 2 ]               = { 0x7f, 0x05 };
+
+	const uint8_t *keys[ 5 ]        = { key1, key2, key3, key4, key5 };
+	const uint8_t *values_data[ 5 ] = { NULL, NULL, NULL, NULL, NULL };
+	size_t key_sizes[ 5 ]           = { 2, 2, 2, 2, 2 };
+	size_t values_data_sizes[ 5 ]   = { 45, 45, 45, 45, 45 };
+
+	values_data[ 0 ] = esedb_test_catalog_table_definition_data;
+	values_data[ 1 ] = esedb_test_catalog_column_definition_data1;
+	values_data[ 2 ] = esedb_test_catalog_index_definition_data;
+	values_data[ 3 ] = esedb_test_catalog_long_value_definition_data;
+
+	if( corrupted == 0 )
+	{
+		values_data[ 4 ] = esedb_test_catalog_column_definition_data2;
+	}
+	else
+	{
+		values_data[ 4 ] = esedb_test_catalog_corrupted_column_definition_data2;
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     1,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     0,
+	     0,
+	     keys,
+	     key_sizes,
+	     values_data,
+	     values_data_sizes,
+	     5,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees the IO handle, pages vector and pages cache of the catalog test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_catalog_free_test_data(
+     libbfio_handle_t **file_io_handle,
+     libesedb_io_handle_t **io_handle,
+     libfdata_vector_t **pages_vector,
+     libfcache_cache_t **pages_cache,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	if( *pages_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     pages_cache,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *pages_vector != NULL )
+	{
+		if( libfdata_vector_free(
+		     pages_vector,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *io_handle != NULL )
+	{
+		if( libesedb_io_handle_free(
+		     io_handle,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *file_io_handle != NULL )
+	{
+		if( esedb_test_close_file_io_handle(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Creates the IO handle, pages vector and pages cache of the catalog test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_catalog_initialize_test_data(
+     libbfio_handle_t **file_io_handle,
+     libesedb_io_handle_t **io_handle,
+     libfdata_vector_t **pages_vector,
+     libfcache_cache_t **pages_cache,
+     libcerror_error_t **error )
+{
+	int segment_index = 0;
+
+	if( esedb_test_open_file_io_handle(
+	     file_io_handle,
+	     esedb_test_catalog_data,
+	     3 * 4096,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libesedb_io_handle_initialize(
+	     io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( *io_handle )->format_revision = 0x0000000c;
+	( *io_handle )->page_size       = 4096;
+
+	if( libesedb_io_handle_set_pages_data_range(
+	     *io_handle,
+	     3 * 4096,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_vector_initialize(
+	     pages_vector,
+	     (size64_t) ( *io_handle )->page_size,
+	     (intptr_t *) *io_handle,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_vector_append_segment(
+	     *pages_vector,
+	     &segment_index,
+	     0,
+	     ( *io_handle )->pages_data_offset,
+	     ( *io_handle )->pages_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     pages_cache,
+	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	esedb_test_catalog_free_test_data(
+	 file_io_handle,
+	 io_handle,
+	 pages_vector,
+	 pages_cache,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads a table catalog definition with a specific name and identifier into the catalog
+ * The name must consist of 11 characters, like "MSysObjects"
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_catalog_read_named_table_definition(
+     libesedb_catalog_t *catalog,
+     const char *name,
+     uint8_t identifier,
+     libcerror_error_t **error )
+{
+	uint8_t data[ 45 ];
+
+	libesedb_table_definition_t *table_definition = NULL;
+	static char *function                         = "esedb_test_catalog_read_named_table_definition";
+
+	if( memory_copy(
+	     data,
+	     esedb_test_catalog_table_definition_data,
+	     45 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy table catalog definition data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( data[ 34 ] ),
+	     name,
+	     11 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	data[ 10 ] = identifier;
+
+	/* The table definition is freed together with the catalog
+	 */
+	if( libesedb_catalog_read_value_data(
+	     catalog,
+	     data,
+	     45,
+	     &table_definition,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Tests the libesedb_catalog_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -258,10 +556,652 @@ int esedb_test_catalog_initialize(
 	}
 #endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
 
-	/* Clean up
-	 */
-	result = libesedb_io_handle_free(
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_read_file_io_handle(
+     void )
+{
+	uint8_t data[ 4096 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libesedb_catalog_t *catalog      = NULL;
+	libesedb_io_handle_t *io_handle  = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_revision = 0x0000000c;
+	io_handle->page_size       = 4096;
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+/* TODO implement */
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_read_file_io_handle(
+	          catalog,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_read_table_definition_values function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_read_table_definition_values(
+     void )
+{
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_t *catalog                              = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_io_handle_t *io_handle                          = NULL;
+	libesedb_table_definition_t *table_definition            = NULL;
+	libfcache_cache_t *pages_cache                           = NULL;
+	libfdata_vector_t *pages_vector                          = NULL;
+	int number_of_elements                                   = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_catalog_write_data(
+	          esedb_test_catalog_data,
+	          3 * 4096,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_catalog_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table definition is read from the first catalog page value
+	 * and is freed together with the catalog
+	 */
+	result = libesedb_catalog_read_value_data(
+	          catalog,
+	          esedb_test_catalog_table_definition_data,
+	          45,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_definition->catalog_page_number      = 1;
+	table_definition->catalog_page_value_index = 1;
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_read_table_definition_values(
+	          NULL,
+	          file_io_handle,
+	          table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_read_table_definition_values(
+	          catalog,
+	          file_io_handle,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that a failed read does not leave partially read catalog definitions
+	 */
+	result = libesedb_catalog_read_table_definition_values(
+	          catalog,
+	          file_io_handle,
+	          table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "table_definition->catalog_page_number",
+	 table_definition->catalog_page_number,
+	 (uint32_t) 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_definition->long_value_catalog_definition",
+	 table_definition->long_value_catalog_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_definition->column_name_hash_table",
+	 table_definition->column_name_hash_table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_definition->column_identifier_hash_table",
+	 table_definition->column_identifier_hash_table );
+
+	result = libcdata_list_get_number_of_elements(
+	          table_definition->column_catalog_definition_list,
+	          &number_of_elements,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_get_number_of_elements(
+	          table_definition->index_catalog_definition_list,
+	          &number_of_elements,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a retry after a failed read reads all catalog definitions once
+	 */
+	result = esedb_test_catalog_write_data(
+	          esedb_test_catalog_data,
+	          3 * 4096,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_read_table_definition_values(
+	          catalog,
+	          file_io_handle,
+	          table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "table_definition->catalog_page_number",
+	 table_definition->catalog_page_number,
+	 (uint32_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition->long_value_catalog_definition",
+	 table_definition->long_value_catalog_definition );
+
+	result = libcdata_list_get_number_of_elements(
+	          table_definition->column_catalog_definition_list,
+	          &number_of_elements,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_get_number_of_elements(
+	          table_definition->index_catalog_definition_list,
+	          &number_of_elements,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_get_column_catalog_definition_by_identifier(
+	          table_definition,
+	          2,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column_catalog_definition",
+	 column_catalog_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the values are not read again
+	 */
+	result = libesedb_catalog_read_table_definition_values(
+	          catalog,
+	          file_io_handle,
+	          table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_get_number_of_elements(
+	          table_definition->column_catalog_definition_list,
+	          &number_of_elements,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_catalog_free_test_data(
+	          &file_io_handle,
 	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -269,10 +1209,6 @@ int esedb_test_catalog_initialize(
 	 result,
 	 1 );
 
-	ESEDB_TEST_ASSERT_IS_NULL(
-	 "io_handle",
-	 io_handle );
-
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
@@ -291,71 +1227,122 @@ on_error:
 		 &catalog,
 		 NULL );
 	}
-	if( io_handle != NULL )
-	{
-		libesedb_io_handle_free(
-		 &io_handle,
-		 NULL );
-	}
+	esedb_test_catalog_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 NULL );
+
 	return( 0 );
 }
 
-/* Tests the libesedb_catalog_free function
+/* Tests the libesedb_catalog_build_table_definition_hash_table function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_catalog_free(
+int esedb_test_catalog_build_table_definition_hash_table(
      void )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcdata_list_t *table_definition_list        = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_catalog_t *catalog                   = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	libfcache_cache_t *pages_cache                = NULL;
+	libfdata_vector_t *pages_vector               = NULL;
+	int result                                    = 0;
 
-	/* Test error cases
+	/* Initialize test
 	 */
-	result = libesedb_catalog_free(
-	          NULL,
+	result = esedb_test_catalog_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	/* The names "Tableasqitb" and "Tableaeavux" have the same name hash
+	 * and the name "Tableasqitb" is defined twice
+	 */
+	result = esedb_test_catalog_read_named_table_definition(
+	          catalog,
+	          "Tableasqitb",
+	          5,
+	          &error );
 
-	return( 1 );
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-/* Tests the libesedb_catalog_read_file_io_handle function
- * Returns 1 if successful or 0 if not
- */
-int esedb_test_catalog_read_file_io_handle(
-     void )
-{
-	uint8_t data[ 4096 ];
+	result = esedb_test_catalog_read_named_table_definition(
+	          catalog,
+	          "Tableaeavux",
+	          6,
+	          &error );
 
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	libesedb_catalog_t *catalog      = NULL;
-	libesedb_io_handle_t *io_handle  = NULL;
-	int result                       = 0;
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* Initialize test
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_catalog_read_named_table_definition(
+	          catalog,
+	          "Tableasqitb",
+	          7,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
 	 */
-	result = libesedb_io_handle_initialize(
-	          &io_handle,
+	result = libesedb_catalog_build_table_definition_hash_table(
+	          catalog,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -363,22 +1350,48 @@ int esedb_test_catalog_read_file_io_handle(
 	 result,
 	 1 );
 
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "io_handle",
-	 io_handle );
+	 "catalog->table_definition_hash_table",
+	 catalog->table_definition_hash_table );
+
+	result = libesedb_catalog_get_table_definition_by_utf8_name(
+	          catalog,
+	          (uint8_t *) "Tableaeavux",
+	          11,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	io_handle->format_revision = 0x0000000c;
-	io_handle->page_size       = 4096;
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "table_definition->table_catalog_definition->identifier",
+	 table_definition->table_catalog_definition->identifier,
+	 (uint32_t) 6 );
 
-	result = libesedb_catalog_initialize(
-	          &catalog,
-	          io_handle,
-	          NULL,
-	          NULL,
+	table_definition = NULL;
+
+	/* Test that the first table definition in catalog order is returned
+	 */
+	result = libesedb_catalog_get_table_definition_by_utf8_name(
+	          catalog,
+	          (uint8_t *) "Tableasqitb",
+	          11,
+	          &table_definition,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -387,19 +1400,25 @@ int esedb_test_catalog_read_file_io_handle(
 	 1 );
 
 	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "catalog",
-	 catalog );
+	 "table_definition",
+	 table_definition );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Initialize file IO handle
-	 */
-	result = esedb_test_open_file_io_handle(
-	          &file_io_handle,
-	          data,
-	          4096,
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "table_definition->table_catalog_definition->identifier",
+	 table_definition->table_catalog_definition->identifier,
+	 (uint32_t) 5 );
+
+	table_definition = NULL;
+
+	result = libesedb_catalog_get_table_definition_by_name(
+	          catalog,
+	          (uint8_t *) "Tableaeavux",
+	          11,
+	          &table_definition,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -408,41 +1427,93 @@ int esedb_test_catalog_read_file_io_handle(
 	 1 );
 
 	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
+	 "table_definition",
+	 table_definition );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-/* TODO implement */
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "table_definition->table_catalog_definition->identifier",
+	 table_definition->table_catalog_definition->identifier,
+	 (uint32_t) 6 );
 
-	/* Test error cases
-	 */
-	result = libesedb_catalog_read_file_io_handle(
-	          NULL,
-	          file_io_handle,
-	          1,
+	table_definition = NULL;
+
+	result = libesedb_catalog_get_table_definition_by_name(
+	          catalog,
+	          (uint8_t *) "Tableasqitb",
+	          11,
+	          &table_definition,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "table_definition->table_catalog_definition->identifier",
+	 table_definition->table_catalog_definition->identifier,
+	 (uint32_t) 5 );
 
-	result = libesedb_catalog_read_file_io_handle(
+	table_definition = NULL;
+
+	/* Test that the table definition hash table is rebuild
+	 */
+	result = libesedb_catalog_build_table_definition_hash_table(
 	          catalog,
-	          file_io_handle,
-	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_table_definition_by_utf8_name(
+	          catalog,
+	          (uint8_t *) "Tableasqitb",
+	          11,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "table_definition->table_catalog_definition->identifier",
+	 table_definition->table_catalog_definition->identifier,
+	 (uint32_t) 5 );
+
+	table_definition = NULL;
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_build_table_definition_hash_table(
+	          NULL,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -457,21 +1528,27 @@ int esedb_test_catalog_read_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up file IO handle
-	 */
-	result = esedb_test_close_file_io_handle(
-	          &file_io_handle,
+	table_definition_list          = catalog->table_definition_list;
+	catalog->table_definition_list = NULL;
+
+	result = libesedb_catalog_build_table_definition_hash_table(
+	          catalog,
 	          &error );
 
+	catalog->table_definition_list = table_definition_list;
+
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	ESEDB_TEST_ASSERT_IS_NULL(
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	/* Clean up
 	 */
 	result = libesedb_catalog_free(
@@ -491,8 +1568,11 @@ int esedb_test_catalog_read_file_io_handle(
 	 "error",
 	 error );
 
-	result = libesedb_io_handle_free(
+	result = esedb_test_catalog_free_test_data(
+	          &file_io_handle,
 	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -500,10 +1580,6 @@ int esedb_test_catalog_read_file_io_handle(
 	 result,
 	 1 );
 
-	ESEDB_TEST_ASSERT_IS_NULL(
-	 "io_handle",
-	 io_handle );
-
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
@@ -516,24 +1592,19 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
 	if( catalog != NULL )
 	{
 		libesedb_catalog_free(
 		 &catalog,
 		 NULL );
 	}
-	if( io_handle != NULL )
-	{
-		libesedb_io_handle_free(
-		 &io_handle,
-		 NULL );
-	}
+	esedb_test_catalog_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 NULL );
+
 	return( 0 );
 }
 
@@ -1151,6 +2222,14 @@ int main(
 	 "libesedb_catalog_read_file_io_handle",
 	 esedb_test_catalog_read_file_io_handle );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_read_table_definition_values",
+	 esedb_test_catalog_read_table_definition_values );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_build_table_definition_hash_table",
+	 esedb_test_catalog_build_table_definition_hash_table );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize test
@@ -0,0 +1,3231 @@
+/*
+ * Library catalog_cache type test program
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
+#include "esedb_test_libcdata.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/esedb_catalog_cache.h"
+#include "../libesedb/libesedb_catalog.h"
+#include "../libesedb/libesedb_catalog_cache.h"
+#include "../libesedb/libesedb_checksum.h"
+#include "../libesedb/libesedb_file_header.h"
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+uint8_t esedb_test_catalog_cache_data1[ 120 ] = {
+	0x65, 0x73, 0x65, 0x64, 0x62, 0x63, 0x61, 0x74, 0x94, 0xb8, 0xbd, 0xd0, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xbc, 0x20, 0x0d, 0x00, 0x20, 0x00, 0x00,
+	0x1f, 0xe7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x7e, 0x06, 0x00, 0x25, 0x08, 0x15, 0x04,
+	0x01, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x4d, 0x79, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x31 };
+
+uint8_t esedb_test_catalog_cache_database_signature1[ 28 ] = {
+	0xc8, 0x7e, 0x06, 0x00, 0x25, 0x08, 0x15, 0x04, 0x01, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Sets the database file values of the test catalog cache data
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_cache_set_test_values(
+     libesedb_catalog_cache_t *catalog_cache )
+{
+	if( catalog_cache == NULL )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     catalog_cache->database_signature,
+	     esedb_test_catalog_cache_database_signature1,
+	     28 ) == NULL )
+	{
+		return( 0 );
+	}
+	catalog_cache->file_size            = 0x00100000UL;
+	catalog_cache->file_header_checksum = 0x0d20bca0UL;
+	catalog_cache->page_size            = 0x00002000UL;
+	catalog_cache->database_time        = 0x0005e71fUL;
+
+	return( 1 );
+}
+
+/* Copies the test catalog cache data and updates the checksum to match the copied data size
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_catalog_cache_copy_test_data(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_catalog_cache_copy_test_data";
+	uint32_t checksum     = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( esedb_catalog_cache_header_t ) )
+	 || ( data_size > 120 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     esedb_test_catalog_cache_data1,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_checksum_calculate_little_endian_xor32(
+	     &checksum,
+	     &( data[ 12 ] ),
+	     data_size - 12,
+	     0x89abcdefUL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->checksum,
+	 checksum );
+
+	return( 1 );
+}
+
+/* Tests the libesedb_catalog_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libesedb_catalog_cache_t *catalog_cache = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 1;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_cache_initialize(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_free(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_cache_initialize(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	catalog_cache = (libesedb_catalog_cache_t *) 0x12345678UL;
+
+	result = libesedb_catalog_cache_initialize(
+	          &catalog_cache,
+	          &error );
+
+	catalog_cache = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_catalog_cache_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_catalog_cache_initialize(
+		          &catalog_cache,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( catalog_cache != NULL )
+			{
+				libesedb_catalog_cache_free(
+				 &catalog_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "catalog_cache",
+			 catalog_cache );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_catalog_cache_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_catalog_cache_initialize(
+		          &catalog_cache,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( catalog_cache != NULL )
+			{
+				libesedb_catalog_cache_free(
+				 &catalog_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "catalog_cache",
+			 catalog_cache );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog_cache != NULL )
+	{
+		libesedb_catalog_cache_free(
+		 &catalog_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_cache_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_cache_set_file_header_values function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_cache_set_file_header_values(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libesedb_catalog_cache_t *catalog_cache = NULL;
+	libesedb_file_header_t *file_header     = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_catalog_cache_initialize(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_header_initialize(
+	          &file_header,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_header",
+	 file_header );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_header->checksum      = 0x0d20bca0UL;
+	file_header->page_size     = 0x00002000UL;
+	file_header->database_time = 0x0005e71fUL;
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_cache_set_file_header_values(
+	          catalog_cache,
+	          file_header,
+	          0x00100000UL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "catalog_cache->file_size",
+	 (uint64_t) catalog_cache->file_size,
+	 (uint64_t) 0x00100000UL );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "catalog_cache->file_header_checksum",
+	 catalog_cache->file_header_checksum,
+	 (uint32_t) 0x0d20bca0UL );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "catalog_cache->page_size",
+	 catalog_cache->page_size,
+	 (uint32_t) 0x00002000UL );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "catalog_cache->database_time",
+	 catalog_cache->database_time,
+	 (uint64_t) 0x0005e71fUL );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_cache_set_file_header_values(
+	          NULL,
+	          file_header,
+	          0x00100000UL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_set_file_header_values(
+	          catalog_cache,
+	          NULL,
+	          0x00100000UL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_file_header_free(
+	          &file_header,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file_header",
+	 file_header );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_free(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_header != NULL )
+	{
+		libesedb_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	if( catalog_cache != NULL )
+	{
+		libesedb_catalog_cache_free(
+		 &catalog_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_cache_read_entry_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_cache_read_entry_data(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libesedb_catalog_t *catalog                   = NULL;
+	libesedb_catalog_cache_t *catalog_cache       = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	size_t entry_data_size                        = 0;
+	int number_of_table_definitions               = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->last_page_number = 16;
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_initialize(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_catalog_cache_set_test_values(
+	          catalog_cache );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_cache_read_entry_data(
+	          catalog_cache,
+	          catalog,
+	          &( esedb_test_catalog_cache_data1[ sizeof( esedb_catalog_cache_header_t ) ] ),
+	          48,
+	          &entry_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "entry_data_size",
+	 entry_data_size,
+	 (size_t) 48 );
+
+	result = libesedb_catalog_get_number_of_table_definitions(
+	          catalog,
+	          &number_of_table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_table_definitions",
+	 number_of_table_definitions,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_table_definition_by_name(
+	          catalog,
+	          (uint8_t *) "MyTable1",
+	          8,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "table_definition->catalog_page_number",
+	 table_definition->catalog_page_number,
+	 (uint32_t) 10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "table_definition->table_catalog_definition->identifier",
+	 table_definition->table_catalog_definition->identifier,
+	 (uint32_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "table_definition->table_catalog_definition->father_data_page_number",
+	 table_definition->table_catalog_definition->father_data_page_number,
+	 (uint32_t) 4 );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_cache_read_entry_data(
+	          NULL,
+	          catalog,
+	          &( esedb_test_catalog_cache_data1[ sizeof( esedb_catalog_cache_header_t ) ] ),
+	          48,
+	          &entry_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_read_entry_data(
+	          catalog_cache,
+	          NULL,
+	          &( esedb_test_catalog_cache_data1[ sizeof( esedb_catalog_cache_header_t ) ] ),
+	          48,
+	          &entry_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_read_entry_data(
+	          catalog_cache,
+	          catalog,
+	          NULL,
+	          48,
+	          &entry_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_read_entry_data(
+	          catalog_cache,
+	          catalog,
+	          &( esedb_test_catalog_cache_data1[ sizeof( esedb_catalog_cache_header_t ) ] ),
+	          (size_t) SSIZE_MAX + 1,
+	          &entry_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_read_entry_data(
+	          catalog_cache,
+	          catalog,
+	          &( esedb_test_catalog_cache_data1[ sizeof( esedb_catalog_cache_header_t ) ] ),
+	          48,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the entry data is smaller than the entry
+	 */
+	result = libesedb_catalog_cache_read_entry_data(
+	          catalog_cache,
+	          catalog,
+	          &( esedb_test_catalog_cache_data1[ sizeof( esedb_catalog_cache_header_t ) ] ),
+	          39,
+	          &entry_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the entry data is truncated in the name
+	 */
+	result = libesedb_catalog_cache_read_entry_data(
+	          catalog_cache,
+	          catalog,
+	          &( esedb_test_catalog_cache_data1[ sizeof( esedb_catalog_cache_header_t ) ] ),
+	          47,
+	          &entry_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* No table definition is appended on error
+	 */
+	result = libesedb_catalog_get_number_of_table_definitions(
+	          catalog,
+	          &number_of_table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_table_definitions",
+	 number_of_table_definitions,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_cache_free(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog_cache != NULL )
+	{
+		libesedb_catalog_cache_free(
+		 &catalog_cache,
+		 NULL );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_cache_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_cache_read_data(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libesedb_catalog_t *catalog                   = NULL;
+	libesedb_catalog_cache_t *catalog_cache       = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	uint8_t catalog_cache_data[ 120 ];
+	int number_of_table_definitions               = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->last_page_number = 16;
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_initialize(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_catalog_cache_set_test_values(
+	          catalog_cache );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test catalog cache that does not match the database file
+	 */
+	catalog_cache->database_time += 1;
+
+	result = libesedb_catalog_cache_read_data(
+	          catalog_cache,
+	          catalog,
+	          esedb_test_catalog_cache_data1,
+	          120,
+	          &error );
+
+	catalog_cache->database_time -= 1;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test catalog cache with a checksum mismatch
+	 */
+	esedb_test_catalog_cache_data1[ 119 ] = 0x32;
+
+	result = libesedb_catalog_cache_read_data(
+	          catalog_cache,
+	          catalog,
+	          esedb_test_catalog_cache_data1,
+	          120,
+	          &error );
+
+	esedb_test_catalog_cache_data1[ 119 ] = 0x31;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test catalog cache with truncated entry data
+	 */
+	result = esedb_test_catalog_cache_copy_test_data(
+	          catalog_cache_data,
+	          100,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_read_data(
+	          catalog_cache,
+	          catalog,
+	          catalog_cache_data,
+	          100,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = esedb_test_catalog_cache_copy_test_data(
+	          catalog_cache_data,
+	          116,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_read_data(
+	          catalog_cache,
+	          catalog,
+	          catalog_cache_data,
+	          116,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test catalog cache with an entry name size value out of bounds
+	 */
+	esedb_test_catalog_cache_data1[ 104 ] = 0x40;
+
+	result = esedb_test_catalog_cache_copy_test_data(
+	          catalog_cache_data,
+	          120,
+	          &error );
+
+	esedb_test_catalog_cache_data1[ 104 ] = 0x08;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_read_data(
+	          catalog_cache,
+	          catalog,
+	          catalog_cache_data,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test catalog cache with a number of entries value out of bounds
+	 */
+	esedb_test_catalog_cache_data1[ 68 ] = 0x02;
+
+	result = esedb_test_catalog_cache_copy_test_data(
+	          catalog_cache_data,
+	          120,
+	          &error );
+
+	esedb_test_catalog_cache_data1[ 68 ] = 0x01;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_read_data(
+	          catalog_cache,
+	          catalog,
+	          catalog_cache_data,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The table definitions read before the error remain in the catalog,
+	 * hence libesedb_file_open_read recreates the catalog on error
+	 */
+	result = libesedb_catalog_get_number_of_table_definitions(
+	          catalog,
+	          &number_of_table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_table_definitions",
+	 number_of_table_definitions,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_cache_read_data(
+	          catalog_cache,
+	          catalog,
+	          esedb_test_catalog_cache_data1,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_number_of_table_definitions(
+	          catalog,
+	          &number_of_table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_table_definitions",
+	 number_of_table_definitions,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_table_definition_by_name(
+	          catalog,
+	          (uint8_t *) "MyTable1",
+	          8,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "table_definition->catalog_page_number",
+	 table_definition->catalog_page_number,
+	 (uint32_t) 10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "table_definition->catalog_page_value_index",
+	 table_definition->catalog_page_value_index,
+	 (uint16_t) 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "table_definition->table_catalog_definition->father_data_page_number",
+	 table_definition->table_catalog_definition->father_data_page_number,
+	 (uint32_t) 4 );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_cache_read_data(
+	          NULL,
+	          catalog,
+	          esedb_test_catalog_cache_data1,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_read_data(
+	          catalog_cache,
+	          NULL,
+	          esedb_test_catalog_cache_data1,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_read_data(
+	          catalog_cache,
+	          catalog,
+	          NULL,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_read_data(
+	          catalog_cache,
+	          catalog,
+	          esedb_test_catalog_cache_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test catalog with table definitions already set
+	 */
+	result = libesedb_catalog_cache_read_data(
+	          catalog_cache,
+	          catalog,
+	          esedb_test_catalog_cache_data1,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_cache_free(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog_cache != NULL )
+	{
+		libesedb_catalog_cache_free(
+		 &catalog_cache,
+		 NULL );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_cache_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_cache_read_file_io_handle(
+     void )
+{
+	uint8_t catalog_cache_data[ 120 ];
+
+	libbfio_handle_t *file_io_handle        = NULL;
+	libcerror_error_t *error                = NULL;
+	libesedb_catalog_t *catalog             = NULL;
+	libesedb_catalog_cache_t *catalog_cache = NULL;
+	libesedb_io_handle_t *io_handle         = NULL;
+	int number_of_table_definitions         = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->last_page_number = 16;
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_initialize(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_catalog_cache_set_test_values(
+	          catalog_cache );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_catalog_cache_copy_test_data(
+	          catalog_cache_data,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          catalog_cache_data,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_cache_read_file_io_handle(
+	          catalog_cache,
+	          catalog,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_number_of_table_definitions(
+	          catalog,
+	          &number_of_table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_table_definitions",
+	 number_of_table_definitions,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test catalog cache that does not match the database file
+	 */
+	catalog_cache->database_time += 1;
+
+	result = libesedb_catalog_cache_read_file_io_handle(
+	          catalog_cache,
+	          catalog,
+	          file_io_handle,
+	          &error );
+
+	catalog_cache->database_time -= 1;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_number_of_table_definitions(
+	          catalog,
+	          &number_of_table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_table_definitions",
+	 number_of_table_definitions,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test catalog cache that is smaller than the catalog cache header
+	 */
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          catalog_cache_data,
+	          sizeof( esedb_catalog_cache_header_t ) - 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_read_file_io_handle(
+	          catalog_cache,
+	          catalog,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the catalog cache entry is truncated
+	 */
+	result = esedb_test_catalog_cache_copy_test_data(
+	          catalog_cache_data,
+	          100,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          catalog_cache_data,
+	          100,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_read_file_io_handle(
+	          catalog_cache,
+	          catalog,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_cache_read_file_io_handle(
+	          NULL,
+	          catalog,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_read_file_io_handle(
+	          catalog_cache,
+	          catalog,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_cache_free(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( catalog_cache != NULL )
+	{
+		libesedb_catalog_cache_free(
+		 &catalog_cache,
+		 NULL );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_cache_get_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_cache_get_data_size(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libesedb_catalog_t *catalog             = NULL;
+	libesedb_catalog_cache_t *catalog_cache = NULL;
+	libesedb_io_handle_t *io_handle         = NULL;
+	size_t data_size                        = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->last_page_number = 16;
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_initialize(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_catalog_cache_set_test_values(
+	          catalog_cache );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	/* Test a catalog without table definitions
+	 */
+	result = libesedb_catalog_cache_get_data_size(
+	          catalog_cache,
+	          catalog,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) sizeof( esedb_catalog_cache_header_t ) );
+
+	result = libesedb_catalog_cache_read_data(
+	          catalog_cache,
+	          catalog,
+	          esedb_test_catalog_cache_data1,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_get_data_size(
+	          catalog_cache,
+	          catalog,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 120 );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_cache_get_data_size(
+	          NULL,
+	          catalog,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_get_data_size(
+	          catalog_cache,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_get_data_size(
+	          catalog_cache,
+	          catalog,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_cache_free(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog_cache != NULL )
+	{
+		libesedb_catalog_cache_free(
+		 &catalog_cache,
+		 NULL );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_cache_write_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_cache_write_data(
+     void )
+{
+	uint8_t data[ 120 ];
+
+	libcerror_error_t *error                = NULL;
+	libesedb_catalog_t *catalog             = NULL;
+	libesedb_catalog_cache_t *catalog_cache = NULL;
+	libesedb_io_handle_t *io_handle         = NULL;
+	size_t data_size                        = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->last_page_number = 16;
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_initialize(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_catalog_cache_set_test_values(
+	          catalog_cache );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_catalog_cache_read_data(
+	          catalog_cache,
+	          catalog,
+	          esedb_test_catalog_cache_data1,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_cache_get_data_size(
+	          catalog_cache,
+	          catalog,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 120 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_write_data(
+	          catalog_cache,
+	          catalog,
+	          data,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          esedb_test_catalog_cache_data1,
+	          120 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_cache_write_data(
+	          NULL,
+	          catalog,
+	          data,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_write_data(
+	          catalog_cache,
+	          NULL,
+	          data,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_write_data(
+	          catalog_cache,
+	          catalog,
+	          NULL,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_write_data(
+	          catalog_cache,
+	          catalog,
+	          data,
+	          119,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_cache_free(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog_cache != NULL )
+	{
+		libesedb_catalog_cache_free(
+		 &catalog_cache,
+		 NULL );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_cache_write_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_cache_write_file_io_handle(
+     void )
+{
+	uint8_t catalog_cache_data[ 120 ];
+
+	libbfio_handle_t *file_io_handle                   = NULL;
+	libcerror_error_t *error                           = NULL;
+	libesedb_catalog_t *catalog                        = NULL;
+	libesedb_catalog_t *read_catalog                   = NULL;
+	libesedb_catalog_cache_t *catalog_cache            = NULL;
+	libesedb_io_handle_t *io_handle                    = NULL;
+	libesedb_table_definition_t *read_table_definition = NULL;
+	libesedb_table_definition_t *table_definition      = NULL;
+	int number_of_table_definitions                    = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->last_page_number = 16;
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_initialize(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_catalog_cache_set_test_values(
+	          catalog_cache );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_catalog_cache_read_data(
+	          catalog_cache,
+	          catalog,
+	          esedb_test_catalog_cache_data1,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          catalog_cache_data,
+	          120,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_write_file_io_handle(
+	          catalog_cache,
+	          catalog,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          catalog_cache_data,
+	          esedb_test_catalog_cache_data1,
+	          120 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the written catalog cache reads back the same table definitions
+	 */
+	result = libesedb_catalog_initialize(
+	          &read_catalog,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "read_catalog",
+	 read_catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_read_file_io_handle(
+	          catalog_cache,
+	          read_catalog,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_number_of_table_definitions(
+	          read_catalog,
+	          &number_of_table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_table_definitions",
+	 number_of_table_definitions,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_table_definition_by_name(
+	          catalog,
+	          (uint8_t *) "MyTable1",
+	          8,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_table_definition_by_name(
+	          read_catalog,
+	          (uint8_t *) "MyTable1",
+	          8,
+	          &read_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "read_table_definition",
+	 read_table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "read_table_definition->catalog_page_number",
+	 read_table_definition->catalog_page_number,
+	 table_definition->catalog_page_number );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "read_table_definition->catalog_page_value_index",
+	 read_table_definition->catalog_page_value_index,
+	 table_definition->catalog_page_value_index );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "read_table_definition->table_catalog_definition->type",
+	 read_table_definition->table_catalog_definition->type,
+	 table_definition->table_catalog_definition->type );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "read_table_definition->table_catalog_definition->identifier",
+	 read_table_definition->table_catalog_definition->identifier,
+	 table_definition->table_catalog_definition->identifier );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "read_table_definition->table_catalog_definition->father_data_page_number",
+	 read_table_definition->table_catalog_definition->father_data_page_number,
+	 table_definition->table_catalog_definition->father_data_page_number );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "read_table_definition->table_catalog_definition->father_data_page_object_identifier",
+	 read_table_definition->table_catalog_definition->father_data_page_object_identifier,
+	 table_definition->table_catalog_definition->father_data_page_object_identifier );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "read_table_definition->table_catalog_definition->size",
+	 read_table_definition->table_catalog_definition->size,
+	 table_definition->table_catalog_definition->size );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "read_table_definition->table_catalog_definition->codepage",
+	 read_table_definition->table_catalog_definition->codepage,
+	 table_definition->table_catalog_definition->codepage );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "read_table_definition->table_catalog_definition->name_size",
+	 read_table_definition->table_catalog_definition->name_size,
+	 table_definition->table_catalog_definition->name_size );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "read_table_definition->table_catalog_definition->template_name_size",
+	 read_table_definition->table_catalog_definition->template_name_size,
+	 table_definition->table_catalog_definition->template_name_size );
+
+	result = memory_compare(
+	          read_table_definition->table_catalog_definition->name,
+	          table_definition->table_catalog_definition->name,
+	          8 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_catalog_free(
+	          &read_catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "read_catalog",
+	 read_catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the catalog cache cannot be written
+	 */
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_write_file_io_handle(
+	          catalog_cache,
+	          catalog,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_cache_write_file_io_handle(
+	          NULL,
+	          catalog,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_cache_write_file_io_handle(
+	          catalog_cache,
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_cache_free(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( catalog_cache != NULL )
+	{
+		libesedb_catalog_cache_free(
+		 &catalog_cache,
+		 NULL );
+	}
+	if( read_catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &read_catalog,
+		 NULL );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_cache_initialize",
+	 esedb_test_catalog_cache_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_cache_free",
+	 esedb_test_catalog_cache_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_cache_set_file_header_values",
+	 esedb_test_catalog_cache_set_file_header_values );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_cache_read_entry_data",
+	 esedb_test_catalog_cache_read_entry_data );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_cache_read_data",
+	 esedb_test_catalog_cache_read_data );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_cache_read_file_io_handle",
+	 esedb_test_catalog_cache_read_file_io_handle );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_cache_get_data_size",
+	 esedb_test_catalog_cache_get_data_size );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_cache_write_data",
+	 esedb_test_catalog_cache_write_data );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_cache_write_file_io_handle",
+	 esedb_test_catalog_cache_write_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
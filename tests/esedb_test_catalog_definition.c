@@ -35,6 +35,7 @@
 #include "esedb_test_unused.h"
 
 #include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
 
 /* Catalog definition: MSysObjects with name
  */
@@ -651,6 +652,167 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_catalog_definition_read_type function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_definition_read_type(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint16_t type            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_definition_read_type(
+	          esedb_test_catalog_definition_data1,
+	          45,
+	          &type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "type",
+	 type,
+	 (uint16_t) LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_read_type(
+	          esedb_test_catalog_definition_data2,
+	          97,
+	          &type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "type",
+	 type,
+	 (uint16_t) LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_definition_read_type(
+	          NULL,
+	          45,
+	          &type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_definition_read_type(
+	          esedb_test_catalog_definition_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_definition_read_type(
+	          esedb_test_catalog_definition_data1,
+	          9,
+	          &type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_definition_read_type(
+	          esedb_test_catalog_definition_data1,
+	          45,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with last_fixed_size_data_type < 2
+	 */
+	esedb_test_catalog_definition_data1[ 0 ] = 0x01;
+
+	result = libesedb_catalog_definition_read_type(
+	          esedb_test_catalog_definition_data1,
+	          45,
+	          &type,
+	          &error );
+
+	esedb_test_catalog_definition_data1[ 0 ] = 0x08;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libesedb_catalog_definition_get_identifier function
  * Returns 1 if successful or 0 if not
  */
@@ -1596,6 +1758,10 @@ int main(
 	 "libesedb_catalog_definition_read_data",
 	 esedb_test_catalog_definition_read_data );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_definition_read_type",
+	 esedb_test_catalog_definition_read_type );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize catalog_definition for tests
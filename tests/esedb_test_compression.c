@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
 #include <types.h>
@@ -30,6 +31,7 @@
 
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
+#include "esedb_test_libfwnt.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
@@ -72,6 +74,22 @@ uint8_t esedb_test_compression_lzxpress_compressed_data[ 33 ] = {
 	0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
 	0x7a };
 
+/* The UTF-16 little-endian string: LZXPRESS string compressed in LZXpress
+ * including leading byte 0x18 and uncompressed data size 0x001e
+ */
+uint8_t esedb_test_compression_lzxpress_compressed_utf16_string[ 37 ] = {
+	0x18, 0x1e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x5a, 0x00, 0x58, 0x00, 0x50, 0x00, 0x52,
+	0x00, 0x45, 0x00, 0x53, 0x00, 0x53, 0x00, 0x20, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69,
+	0x00, 0x6e, 0x00, 0x67, 0x00 };
+
+uint8_t esedb_test_compression_lzxpress_uncompressed_utf8_string[ 16 ] = {
+	0x4c, 0x5a, 0x58, 0x50, 0x52, 0x45, 0x53, 0x53, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00
+};
+
+uint16_t esedb_test_compression_lzxpress_uncompressed_utf16_string[ 16 ] = {
+	0x4c, 0x5a, 0x58, 0x50, 0x52, 0x45, 0x53, 0x53, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00
+};
+
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
 /* Tests the libesedb_compression_7bit_decompress_get_size function
@@ -394,22 +412,113 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_lzxpress_decompress_get_size function
+/* Tests the libesedb_compression_7bit_decompress function with data that is not a multiple of 7 bytes
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_lzxpress_decompress_get_size(
+int esedb_test_compression_7bit_decompress_unaligned(
      void )
 {
-	libcerror_error_t *error      = NULL;
-	size_t uncompressed_data_size = 0;
-	int result                    = 0;
+	uint8_t compressed_data[ 64 ];
+	uint8_t uncompressed_data[ 72 ];
+
+	libcerror_error_t *error       = NULL;
+	size_t compressed_data_size    = 0;
+	size_t number_of_characters    = 0;
+	size_t uncompressed_data_index = 0;
+	uint16_t value_16bit           = 0;
+	uint8_t bit_index              = 0;
+	int result                     = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_lzxpress_decompress_get_size(
-	          esedb_test_compression_lzxpress_compressed_data,
-	          33,
-	          &uncompressed_data_size,
+	for( number_of_characters = 1;
+	     number_of_characters <= 56;
+	     number_of_characters++ )
+	{
+		/* Pack the first characters of the uncompressed data
+		 */
+		compressed_data[ 0 ] = 0x10;
+		compressed_data_size = 1;
+		value_16bit          = 0;
+		bit_index            = 0;
+
+		for( uncompressed_data_index = 0;
+		     uncompressed_data_index < number_of_characters;
+		     uncompressed_data_index++ )
+		{
+			value_16bit |= (uint16_t) esedb_test_compression_7bit_uncompressed_data[ uncompressed_data_index ] << bit_index;
+
+			bit_index += 7;
+
+			if( bit_index >= 8 )
+			{
+				compressed_data[ compressed_data_size++ ] = (uint8_t) ( value_16bit & 0xff );
+
+				value_16bit >>= 8;
+
+				bit_index -= 8;
+			}
+		}
+		if( bit_index > 0 )
+		{
+			compressed_data[ compressed_data_size++ ] = (uint8_t) ( value_16bit & 0xff );
+		}
+		result = libesedb_compression_7bit_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          72,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          esedb_test_compression_7bit_uncompressed_data,
+		          number_of_characters );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_7bit_decompress_get_utf8_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_7bit_decompress_get_utf8_string_size(
+     void )
+{
+	uint8_t compressed_data[ 8 ] = {
+		0x00, 0x41, 0x40, 0x10, 0x02, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_7bit_decompress_get_utf8_string_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          &utf8_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -418,9 +527,31 @@ int esedb_test_compression_lzxpress_decompress_get_size(
 	 1 );
 
 	ESEDB_TEST_ASSERT_EQUAL_SIZE(
-	 "uncompressed_data_size",
-	 uncompressed_data_size,
-	 (size_t) 26 );
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test UTF-16 encoded characters: U+0041 U+1041 followed by end of string characters
+	 */
+	result = libesedb_compression_7bit_decompress_get_utf8_string_size(
+	          compressed_data,
+	          8,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 5 );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -428,10 +559,10 @@ int esedb_test_compression_lzxpress_decompress_get_size(
 
 	/* Test error cases
 	 */
-	result = libesedb_compression_lzxpress_decompress_get_size(
+	result = libesedb_compression_7bit_decompress_get_utf8_string_size(
 	          NULL,
-	          33,
-	          &uncompressed_data_size,
+	          50,
+	          &utf8_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -446,10 +577,10 @@ int esedb_test_compression_lzxpress_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_lzxpress_decompress_get_size(
-	          esedb_test_compression_lzxpress_compressed_data,
+	result = libesedb_compression_7bit_decompress_get_utf8_string_size(
+	          esedb_test_compression_7bit_compressed_data,
 	          (size_t) SSIZE_MAX + 1,
-	          &uncompressed_data_size,
+	          &utf8_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -464,10 +595,10 @@ int esedb_test_compression_lzxpress_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_lzxpress_decompress_get_size(
-	          esedb_test_compression_lzxpress_compressed_data,
+	result = libesedb_compression_7bit_decompress_get_utf8_string_size(
+	          esedb_test_compression_7bit_compressed_data,
 	          0,
-	          &uncompressed_data_size,
+	          &utf8_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -482,9 +613,9 @@ int esedb_test_compression_lzxpress_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_lzxpress_decompress_get_size(
-	          esedb_test_compression_lzxpress_compressed_data,
-	          33,
+	result = libesedb_compression_7bit_decompress_get_utf8_string_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
 	          NULL,
 	          &error );
 
@@ -500,10 +631,10 @@ int esedb_test_compression_lzxpress_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_lzxpress_decompress_get_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          50,
-	          &uncompressed_data_size,
+	result = libesedb_compression_7bit_decompress_get_utf8_string_size(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          &utf8_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -529,23 +660,29 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_lzxpress_decompress function
+/* Tests the libesedb_compression_7bit_decompress_to_utf8_string function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_lzxpress_decompress(
+int esedb_test_compression_7bit_decompress_to_utf8_string(
      void )
 {
-	uint8_t uncompressed_data[ 64 ];
+	uint8_t compressed_data[ 8 ] = {
+		0x00, 0x41, 0x40, 0x10, 0x02, 0x00, 0x00, 0x00 };
+
+	uint8_t expected_utf8_string[ 5 ] = {
+		0x41, 0xe1, 0x81, 0x81, 0x00 };
+
+	uint8_t utf8_string[ 64 ];
 
 	libcerror_error_t *error = NULL;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_lzxpress_decompress(
-	          esedb_test_compression_lzxpress_compressed_data,
-	          33,
-	          uncompressed_data,
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf8_string,
 	          64,
 	          &error );
 
@@ -559,9 +696,37 @@ int esedb_test_compression_lzxpress_decompress(
 	 error );
 
 	result = memory_compare(
-	          uncompressed_data,
-	          (uint8_t *) "abcdefghijklmnopqrstuvwxyz",
-	          26 );
+	          utf8_string,
+	          esedb_test_compression_7bit_uncompressed_utf8_string,
+	          56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test UTF-16 encoded characters: U+0041 U+1041 followed by end of string characters
+	 */
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          compressed_data,
+	          8,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          5 );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -570,10 +735,124 @@ int esedb_test_compression_lzxpress_decompress(
 
 	/* Test error cases
 	 */
-	result = libesedb_compression_lzxpress_decompress(
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          NULL,
+	          50,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
 	          NULL,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf8_string,
+	          55,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_lzxpress_compressed_data,
 	          33,
-	          uncompressed_data,
+	          utf8_string,
 	          64,
 	          &error );
 
@@ -600,10 +879,10 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_decompress_get_size function
+/* Tests the libesedb_compression_lzxpress_decompress_get_size function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_decompress_get_size(
+int esedb_test_compression_lzxpress_decompress_get_size(
      void )
 {
 	libcerror_error_t *error      = NULL;
@@ -612,9 +891,9 @@ int esedb_test_compression_decompress_get_size(
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_decompress_get_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          50,
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
 	          &uncompressed_data_size,
 	          &error );
 
@@ -626,7 +905,344 @@ int esedb_test_compression_decompress_get_size(
 	ESEDB_TEST_ASSERT_EQUAL_SIZE(
 	 "uncompressed_data_size",
 	 uncompressed_data_size,
-	 (size_t) 56 );
+	 (size_t) 26 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          NULL,
+	          33,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          0,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_lzxpress_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_lzxpress_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_lzxpress_decompress(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          (uint8_t *) "abcdefghijklmnopqrstuvwxyz",
+	          26 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_lzxpress_decompress(
+	          NULL,
+	          33,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_lzxpress_decompress function against libfwnt_lzxpress_decompress
+ * using pseudo-random compressed data
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_lzxpress_decompress_libfwnt(
+     void )
+{
+	uint8_t compressed_data[ 1024 ];
+	uint8_t libfwnt_uncompressed_data[ 8192 ];
+	uint8_t uncompressed_data[ 8192 ];
+
+	libcerror_error_t *error              = NULL;
+	size_t compressed_data_offset         = 0;
+	size_t indicator_offset               = 0;
+	size_t libfwnt_uncompressed_data_size = 0;
+	uint32_t indicator                    = 0;
+	uint32_t random_value                 = 1;
+	int bit_index                         = 0;
+	int iterator                          = 0;
+	int libfwnt_result                    = 0;
+	int number_of_groups                  = 0;
+	int result                            = 0;
+
+	for( iterator = 0;
+	     iterator < 1024;
+	     iterator++ )
+	{
+		/* Leading byte and uncompressed data size of 8192
+		 */
+		compressed_data[ 0 ] = 0x18;
+		compressed_data[ 1 ] = 0x00;
+		compressed_data[ 2 ] = 0x20;
+
+		compressed_data_offset = 3;
+
+		random_value     = ( random_value * 1103515245UL ) + 12345;
+		number_of_groups = 1 + (int) ( ( random_value >> 16 ) % 8 );
+
+		while( number_of_groups > 0 )
+		{
+			indicator        = 0;
+			indicator_offset = compressed_data_offset;
+
+			compressed_data_offset += 4;
+
+			for( bit_index = 31;
+			     bit_index >= 0;
+			     bit_index-- )
+			{
+				random_value = ( random_value * 1103515245UL ) + 12345;
+
+				if( ( ( random_value >> 16 ) % 4 ) == 0 )
+				{
+					indicator |= (uint32_t) 1 << bit_index;
+
+					/* Match with an offset of 1 to 64 and a random size
+					 */
+					compressed_data[ compressed_data_offset++ ] = (uint8_t) ( random_value & 0xff );
+					compressed_data[ compressed_data_offset++ ] = (uint8_t) ( ( random_value >> 8 ) & 0x01 );
+
+					if( ( random_value & 0x07 ) == 0x07 )
+					{
+						compressed_data[ compressed_data_offset++ ] = (uint8_t) ( ( random_value >> 24 ) & 0xff );
+					}
+				}
+				else
+				{
+					compressed_data[ compressed_data_offset++ ] = (uint8_t) ( ( random_value >> 24 ) & 0xff );
+				}
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 &( compressed_data[ indicator_offset ] ),
+			 indicator );
+
+			number_of_groups--;
+		}
+		libfwnt_uncompressed_data_size = 8192;
+
+		libfwnt_result = libfwnt_lzxpress_decompress(
+		                  &( compressed_data[ 3 ] ),
+		                  compressed_data_offset - 3,
+		                  libfwnt_uncompressed_data,
+		                  &libfwnt_uncompressed_data_size,
+		                  &error );
+
+		if( libfwnt_result != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+		result = libesedb_compression_lzxpress_decompress(
+		          compressed_data,
+		          compressed_data_offset,
+		          uncompressed_data,
+		          8192,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 libfwnt_result );
+
+		if( result == 1 )
+		{
+			result = memory_compare(
+			          uncompressed_data,
+			          libfwnt_uncompressed_data,
+			          libfwnt_uncompressed_data_size );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_decompress_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_decompress_get_size(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 56 );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -672,10 +1288,513 @@ int esedb_test_compression_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress_get_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          (size_t) SSIZE_MAX + 1,
-	          &uncompressed_data_size,
+	result = libesedb_compression_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_compression_decompress(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          (uint8_t *) "abcdefghijklmnopqrstuvwxyz",
+	          26 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_decompress(
+	          NULL,
+	          50,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_get_utf8_string_size_from_uncompressed_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_get_utf8_string_size_from_uncompressed_data(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          0x10,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+	          NULL,
+	          56,
+	          0x10,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+	          esedb_test_compression_7bit_uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0x10,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          0x10,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_get_utf8_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_get_utf8_string_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_get_utf8_string_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_compression_get_utf8_string_size(
+	          esedb_test_compression_lzxpress_compressed_utf16_string,
+	          37,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 16 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_get_utf8_string_size(
+	          NULL,
+	          50,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_get_utf8_string_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_copy_uncompressed_data_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_copy_uncompressed_data_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_copy_uncompressed_data_to_utf8_string(
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          0x10,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          esedb_test_compression_7bit_uncompressed_utf8_string,
+	          sizeof( uint8_t ) * 56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_copy_uncompressed_data_to_utf8_string(
+	          NULL,
+	          56,
+	          0x10,
+	          utf8_string,
+	          64,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -690,10 +1809,12 @@ int esedb_test_compression_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress_get_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          0,
-	          &uncompressed_data_size,
+	result = libesedb_compression_copy_uncompressed_data_to_utf8_string(
+	          esedb_test_compression_7bit_uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0x10,
+	          utf8_string,
+	          64,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -708,10 +1829,12 @@ int esedb_test_compression_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress_get_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          50,
+	result = libesedb_compression_copy_uncompressed_data_to_utf8_string(
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          0x10,
 	          NULL,
+	          64,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -737,23 +1860,23 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_decompress function
+/* Tests the libesedb_compression_copy_to_utf8_string function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_decompress(
+int esedb_test_compression_copy_to_utf8_string(
      void )
 {
-	uint8_t uncompressed_data[ 64 ];
+	uint8_t utf8_string[ 64 ];
 
 	libcerror_error_t *error = NULL;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_decompress(
+	result = libesedb_compression_copy_to_utf8_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
-	          uncompressed_data,
+	          utf8_string,
 	          64,
 	          &error );
 
@@ -767,19 +1890,19 @@ int esedb_test_compression_decompress(
 	 error );
 
 	result = memory_compare(
-	          uncompressed_data,
-	          esedb_test_compression_7bit_uncompressed_data,
-	          56 );
+	          utf8_string,
+	          esedb_test_compression_7bit_uncompressed_utf8_string,
+	          sizeof( uint8_t ) * 56 );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	result = libesedb_compression_decompress(
-	          esedb_test_compression_lzxpress_compressed_data,
-	          33,
-	          uncompressed_data,
+	result = libesedb_compression_copy_to_utf8_string(
+	          esedb_test_compression_lzxpress_compressed_utf16_string,
+	          37,
+	          utf8_string,
 	          64,
 	          &error );
 
@@ -793,9 +1916,9 @@ int esedb_test_compression_decompress(
 	 error );
 
 	result = memory_compare(
-	          uncompressed_data,
-	          (uint8_t *) "abcdefghijklmnopqrstuvwxyz",
-	          26 );
+	          utf8_string,
+	          esedb_test_compression_lzxpress_uncompressed_utf8_string,
+	          sizeof( uint8_t ) * 16 );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -804,10 +1927,10 @@ int esedb_test_compression_decompress(
 
 	/* Test error cases
 	 */
-	result = libesedb_compression_decompress(
+	result = libesedb_compression_copy_to_utf8_string(
 	          NULL,
 	          50,
-	          uncompressed_data,
+	          utf8_string,
 	          64,
 	          &error );
 
@@ -823,10 +1946,10 @@ int esedb_test_compression_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress(
+	result = libesedb_compression_copy_to_utf8_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          (size_t) SSIZE_MAX + 1,
-	          uncompressed_data,
+	          utf8_string,
 	          64,
 	          &error );
 
@@ -842,10 +1965,10 @@ int esedb_test_compression_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress(
+	result = libesedb_compression_copy_to_utf8_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          0,
-	          uncompressed_data,
+	          utf8_string,
 	          64,
 	          &error );
 
@@ -861,7 +1984,7 @@ int esedb_test_compression_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_decompress(
+	result = libesedb_compression_copy_to_utf8_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
 	          NULL,
@@ -891,22 +2014,23 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_get_utf8_string_size function
+/* Tests the libesedb_compression_get_utf16_string_size_from_uncompressed_data function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_get_utf8_string_size(
+int esedb_test_compression_get_utf16_string_size_from_uncompressed_data(
      void )
 {
 	libcerror_error_t *error = NULL;
-	size_t utf8_string_size  = 0;
+	size_t utf16_string_size = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_get_utf8_string_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          50,
-	          &utf8_string_size,
+	result = libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          0x10,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -915,22 +2039,21 @@ int esedb_test_compression_get_utf8_string_size(
 	 1 );
 
 	ESEDB_TEST_ASSERT_EQUAL_SIZE(
-	 "utf8_string_size",
-	 utf8_string_size,
+	 "utf16_string_size",
+	 utf16_string_size,
 	 (size_t) 56 );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-/* TODO add test with LZXPRESS compressed string */
-
 	/* Test error cases
 	 */
-	result = libesedb_compression_get_utf8_string_size(
+	result = libesedb_compression_get_utf16_string_size_from_uncompressed_data(
 	          NULL,
-	          50,
-	          &utf8_string_size,
+	          56,
+	          0x10,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -945,28 +2068,11 @@ int esedb_test_compression_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_get_utf8_string_size(
-	          esedb_test_compression_7bit_compressed_data,
+	result = libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+	          esedb_test_compression_7bit_uncompressed_data,
 	          (size_t) SSIZE_MAX + 1,
-	          &utf8_string_size,
-	          &error );
-
-	ESEDB_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libesedb_compression_get_utf8_string_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          0,
-	          &utf8_string_size,
+	          0x10,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -981,9 +2087,10 @@ int esedb_test_compression_get_utf8_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_get_utf8_string_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          50,
+	result = libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          0x10,
 	          NULL,
 	          &error );
 
@@ -1010,24 +2117,22 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_copy_to_utf8_string function
+/* Tests the libesedb_compression_get_utf16_string_size function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_copy_to_utf8_string(
+int esedb_test_compression_get_utf16_string_size(
      void )
 {
-	uint8_t utf8_string[ 64 ];
-
 	libcerror_error_t *error = NULL;
+	size_t utf16_string_size = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_copy_to_utf8_string(
+	result = libesedb_compression_get_utf16_string_size(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
-	          utf8_string,
-	          64,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1035,29 +2140,41 @@ int esedb_test_compression_copy_to_utf8_string(
 	 result,
 	 1 );
 
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 56 );
+
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          utf8_string,
-	          esedb_test_compression_7bit_uncompressed_utf8_string,
-	          sizeof( uint8_t ) * 56 );
+	result = libesedb_compression_get_utf16_string_size(
+	          esedb_test_compression_lzxpress_compressed_utf16_string,
+	          37,
+	          &utf16_string_size,
+	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 16 );
 
-/* TODO add test with LZXPRESS compressed string */
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libesedb_compression_copy_to_utf8_string(
+	result = libesedb_compression_get_utf16_string_size(
 	          NULL,
 	          50,
-	          utf8_string,
-	          64,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1072,11 +2189,10 @@ int esedb_test_compression_copy_to_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_copy_to_utf8_string(
+	result = libesedb_compression_get_utf16_string_size(
 	          esedb_test_compression_7bit_compressed_data,
 	          (size_t) SSIZE_MAX + 1,
-	          utf8_string,
-	          64,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1091,11 +2207,10 @@ int esedb_test_compression_copy_to_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_copy_to_utf8_string(
+	result = libesedb_compression_get_utf16_string_size(
 	          esedb_test_compression_7bit_compressed_data,
 	          0,
-	          utf8_string,
-	          64,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1110,11 +2225,10 @@ int esedb_test_compression_copy_to_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_copy_to_utf8_string(
+	result = libesedb_compression_get_utf16_string_size(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
 	          NULL,
-	          64,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1140,22 +2254,25 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_get_utf16_string_size function
+/* Tests the libesedb_compression_copy_uncompressed_data_to_utf16_string function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_get_utf16_string_size(
+int esedb_test_compression_copy_uncompressed_data_to_utf16_string(
      void )
 {
+	uint16_t utf16_string[ 64 ];
+
 	libcerror_error_t *error = NULL;
-	size_t utf16_string_size = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_get_utf16_string_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          50,
-	          &utf16_string_size,
+	result = libesedb_compression_copy_uncompressed_data_to_utf16_string(
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          0x10,
+	          utf16_string,
+	          64,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1163,41 +2280,28 @@ int esedb_test_compression_get_utf16_string_size(
 	 result,
 	 1 );
 
-	ESEDB_TEST_ASSERT_EQUAL_SIZE(
-	 "utf16_string_size",
-	 utf16_string_size,
-	 (size_t) 56 );
-
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-/* TODO add test with LZXPRESS compressed string */
-
-	/* Test error cases
-	 */
-	result = libesedb_compression_get_utf16_string_size(
-	          NULL,
-	          50,
-	          &utf16_string_size,
-	          &error );
+	result = memory_compare(
+	          utf16_string,
+	          esedb_test_compression_7bit_uncompressed_utf16_string,
+	          sizeof( uint16_t ) * 56 );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
+	 0 );
 
-	result = libesedb_compression_get_utf16_string_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          (size_t) SSIZE_MAX + 1,
-	          &utf16_string_size,
+	/* Test error cases
+	 */
+	result = libesedb_compression_copy_uncompressed_data_to_utf16_string(
+	          NULL,
+	          56,
+	          0x10,
+	          utf16_string,
+	          64,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1212,10 +2316,12 @@ int esedb_test_compression_get_utf16_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_get_utf16_string_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          0,
-	          &utf16_string_size,
+	result = libesedb_compression_copy_uncompressed_data_to_utf16_string(
+	          esedb_test_compression_7bit_uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0x10,
+	          utf16_string,
+	          64,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1230,10 +2336,12 @@ int esedb_test_compression_get_utf16_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_get_utf16_string_size(
-	          esedb_test_compression_7bit_compressed_data,
-	          50,
+	result = libesedb_compression_copy_uncompressed_data_to_utf16_string(
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56,
+	          0x10,
 	          NULL,
+	          64,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1298,7 +2406,31 @@ int esedb_test_compression_copy_to_utf16_string(
 	 result,
 	 0 );
 
-/* TODO add test with LZXPRESS compressed string */
+	result = libesedb_compression_copy_to_utf16_string(
+	          esedb_test_compression_lzxpress_compressed_utf16_string,
+	          37,
+	          utf16_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          esedb_test_compression_lzxpress_uncompressed_utf16_string,
+	          sizeof( uint16_t ) * 16 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	/* Test error cases
 	 */
@@ -1416,6 +2548,18 @@ int main(
 	 "libesedb_compression_7bit_decompress",
 	 esedb_test_compression_7bit_decompress );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_7bit_decompress_unaligned",
+	 esedb_test_compression_7bit_decompress_unaligned );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_7bit_decompress_get_utf8_string_size",
+	 esedb_test_compression_7bit_decompress_get_utf8_string_size );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_7bit_decompress_to_utf8_string",
+	 esedb_test_compression_7bit_decompress_to_utf8_string );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_lzxpress_decompress_get_size",
 	 esedb_test_compression_lzxpress_decompress_get_size );
@@ -1424,6 +2568,10 @@ int main(
 	 "libesedb_compression_lzxpress_decompress",
 	 esedb_test_compression_lzxpress_decompress );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_lzxpress_decompress_libfwnt",
+	 esedb_test_compression_lzxpress_decompress_libfwnt );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_decompress_get_size",
 	 esedb_test_compression_decompress_get_size );
@@ -1432,18 +2580,34 @@ int main(
 	 "libesedb_compression_decompress",
 	 esedb_test_compression_decompress );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_get_utf8_string_size_from_uncompressed_data",
+	 esedb_test_compression_get_utf8_string_size_from_uncompressed_data );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_get_utf8_string_size",
 	 esedb_test_compression_get_utf8_string_size );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_copy_uncompressed_data_to_utf8_string",
+	 esedb_test_compression_copy_uncompressed_data_to_utf8_string );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_copy_to_utf8_string",
 	 esedb_test_compression_copy_to_utf8_string );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_get_utf16_string_size_from_uncompressed_data",
+	 esedb_test_compression_get_utf16_string_size_from_uncompressed_data );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_get_utf16_string_size",
 	 esedb_test_compression_get_utf16_string_size );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_copy_uncompressed_data_to_utf16_string",
+	 esedb_test_compression_copy_uncompressed_data_to_utf16_string );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_copy_to_utf16_string",
 	 esedb_test_compression_copy_to_utf16_string );
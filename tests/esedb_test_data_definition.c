@@ -21,22 +21,285 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
+#include "esedb_test_libfcache.h"
+#include "esedb_test_libfdata.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
 #include "../libesedb/libesedb_data_definition.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+/* Tagged data types in the index format: 256, 258 with flags and 260
+ */
+uint8_t esedb_test_data_definition_tagged_data_types_index_data[ 22 ] = {
+	0x00, 0x01, 0x0c, 0x00, 0x02, 0x01, 0x0f, 0x40, 0x04, 0x01, 0x14, 0x00, 0x61, 0x62, 0x63, 0x01,
+	0x64, 0x65, 0x66, 0x67, 0x68, 0x69 };
+
+/* Tagged data types in the linear format: 256 and 258 with flags
+ */
+uint8_t esedb_test_data_definition_tagged_data_types_linear_data[ 13 ] = {
+	0x00, 0x01, 0x02, 0x00, 0x78, 0x79, 0x02, 0x01, 0x03, 0x80, 0x02, 0x7a, 0x77 };
+
+/* The fixed size columns test data contains 3 pages of 4096 bytes, with a leaf page (1)
+ * that contains 3 records of a table with 3 fixed size columns. The second record only
+ * contains column 1 and the data of the third record is truncated after column 1
+ */
+uint8_t esedb_test_data_definition_data[ 3 * 4096 ];
+
+uint8_t esedb_test_data_definition_record_data1[ 24 ] = {
+	0x03, 0x7f, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0xf6, 0xe5, 0xd4, 0xc3, 0xb2, 0xd1, 0x01 };
+
+uint8_t esedb_test_data_definition_record_data2[ 8 ] = {
+	0x01, 0x7f, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00 };
+
+uint8_t esedb_test_data_definition_record_data3[ 8 ] = {
+	0x03, 0x7f, 0x18, 0x00, 0x03, 0x00, 0x00, 0x00 };
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+/* Frees the IO handle, pages vector and pages cache of the fixed size columns test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_data_definition_free_test_data(
+     libbfio_handle_t **file_io_handle,
+     libesedb_io_handle_t **io_handle,
+     libfdata_vector_t **pages_vector,
+     libfcache_cache_t **pages_cache,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	if( *pages_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     pages_cache,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *pages_vector != NULL )
+	{
+		if( libfdata_vector_free(
+		     pages_vector,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *io_handle != NULL )
+	{
+		if( libesedb_io_handle_free(
+		     io_handle,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *file_io_handle != NULL )
+	{
+		if( esedb_test_close_file_io_handle(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Creates the IO handle, pages vector and pages cache of the fixed size columns test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_data_definition_initialize_test_data(
+     libbfio_handle_t **file_io_handle,
+     libesedb_io_handle_t **io_handle,
+     libfdata_vector_t **pages_vector,
+     libfcache_cache_t **pages_cache,
+     libcerror_error_t **error )
+{
+	uint8_t record_key1[ 5 ]         = { 0x7f, 0x80, 0x00, 0x00, 0x01 };
+	uint8_t record_key2[ 5 ]         = { 0x7f, 0x80, 0x00, 0x00, 0x02 };
+	uint8_t record_key3[ 5 ]         = { 0x7f, 0x80, 0x00, 0x00, 0x03 };
+
+	const uint8_t *record_keys[ 3 ]  = { record_key1, record_key2, record_key3 };
+	const uint8_t *records_data[ 3 ] = { esedb_test_data_definition_record_data1, esedb_test_data_definition_record_data2, esedb_test_data_definition_record_data3 };
+	size_t record_key_sizes[ 3 ]     = { 5, 5, 5 };
+	size_t records_data_sizes[ 3 ]   = { 24, 8, 8 };
+	int segment_index                = 0;
+
+	if( esedb_test_write_page(
+	     esedb_test_data_definition_data,
+	     3 * 4096,
+	     4096,
+	     1,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     0,
+	     0,
+	     record_keys,
+	     record_key_sizes,
+	     records_data,
+	     records_data_sizes,
+	     3,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_open_file_io_handle(
+	     file_io_handle,
+	     esedb_test_data_definition_data,
+	     3 * 4096,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libesedb_io_handle_initialize(
+	     io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( *io_handle )->format_revision = 0x0000000c;
+	( *io_handle )->page_size       = 4096;
+
+	if( libesedb_io_handle_set_pages_data_range(
+	     *io_handle,
+	     3 * 4096,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_vector_initialize(
+	     pages_vector,
+	     (size64_t) ( *io_handle )->page_size,
+	     (intptr_t *) *io_handle,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_vector_append_segment(
+	     *pages_vector,
+	     &segment_index,
+	     0,
+	     ( *io_handle )->pages_data_offset,
+	     ( *io_handle )->pages_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     pages_cache,
+	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	esedb_test_data_definition_free_test_data(
+	 file_io_handle,
+	 io_handle,
+	 pages_vector,
+	 pages_cache,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Creates a table definition with fixed size columns of specific sizes
+ * The column identifiers start at 1
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_data_definition_initialize_table_definition(
+     libesedb_table_definition_t **table_definition,
+     const uint32_t *column_sizes,
+     int number_of_columns,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *catalog_definition = NULL;
+	int column_index                                  = 0;
+
+	if( libesedb_catalog_definition_initialize(
+	     &catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	catalog_definition->type = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+
+	if( libesedb_table_definition_initialize(
+	     table_definition,
+	     catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	catalog_definition = NULL;
+
+	for( column_index = 0;
+	     column_index < number_of_columns;
+	     column_index++ )
+	{
+		if( libesedb_catalog_definition_initialize(
+		     &catalog_definition,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		catalog_definition->type       = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+		catalog_definition->identifier = (uint32_t) column_index + 1;
+		catalog_definition->size       = column_sizes[ column_index ];
+
+		if( libesedb_table_definition_append_column_catalog_definition(
+		     *table_definition,
+		     catalog_definition,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		catalog_definition = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &catalog_definition,
+		 NULL );
+	}
+	if( *table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 table_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Tests the libesedb_data_definition_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -360,22 +623,270 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_data_definition_read_long_value function
+/* Tests the libesedb_data_definition_get_tagged_data_type function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_data_definition_read_long_value(
+int esedb_test_data_definition_get_tagged_data_type(
      void )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error              = NULL;
+	libesedb_io_handle_t *io_handle       = NULL;
+	const uint8_t *tagged_data_type_data  = NULL;
+	size_t tagged_data_type_data_size     = 0;
+	uint8_t tagged_data_type_flags        = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version  = 0x620;
+	io_handle->format_revision = 0x0c;
+	io_handle->page_size       = 8192;
+
+	/* Test regular cases with the index format
+	 */
+	result = libesedb_data_definition_get_tagged_data_type(
+	          esedb_test_data_definition_tagged_data_types_index_data,
+	          22,
+	          io_handle,
+	          256,
+	          &tagged_data_type_flags,
+	          &tagged_data_type_data,
+	          &tagged_data_type_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "tagged_data_type_flags",
+	 tagged_data_type_flags,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "tagged_data_type_data_size",
+	 tagged_data_type_data_size,
+	 (size_t) 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "tagged_data_type_data",
+	 (intptr_t) tagged_data_type_data,
+	 (intptr_t) &( esedb_test_data_definition_tagged_data_types_index_data[ 12 ] ) );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_get_tagged_data_type(
+	          esedb_test_data_definition_tagged_data_types_index_data,
+	          22,
+	          io_handle,
+	          258,
+	          &tagged_data_type_flags,
+	          &tagged_data_type_data,
+	          &tagged_data_type_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "tagged_data_type_flags",
+	 tagged_data_type_flags,
+	 0x01 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "tagged_data_type_data_size",
+	 tagged_data_type_data_size,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "tagged_data_type_data",
+	 (intptr_t) tagged_data_type_data,
+	 (intptr_t) &( esedb_test_data_definition_tagged_data_types_index_data[ 16 ] ) );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_get_tagged_data_type(
+	          esedb_test_data_definition_tagged_data_types_index_data,
+	          22,
+	          io_handle,
+	          260,
+	          &tagged_data_type_flags,
+	          &tagged_data_type_data,
+	          &tagged_data_type_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "tagged_data_type_data_size",
+	 tagged_data_type_data_size,
+	 (size_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "tagged_data_type_data",
+	 (intptr_t) tagged_data_type_data,
+	 (intptr_t) &( esedb_test_data_definition_tagged_data_types_index_data[ 20 ] ) );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_get_tagged_data_type(
+	          esedb_test_data_definition_tagged_data_types_index_data,
+	          22,
+	          io_handle,
+	          257,
+	          &tagged_data_type_flags,
+	          &tagged_data_type_data,
+	          &tagged_data_type_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_get_tagged_data_type(
+	          esedb_test_data_definition_tagged_data_types_index_data,
+	          22,
+	          io_handle,
+	          300,
+	          &tagged_data_type_flags,
+	          &tagged_data_type_data,
+	          &tagged_data_type_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with the linear format
+	 */
+	io_handle->format_revision = 0x02;
+
+	result = libesedb_data_definition_get_tagged_data_type(
+	          esedb_test_data_definition_tagged_data_types_linear_data,
+	          13,
+	          io_handle,
+	          258,
+	          &tagged_data_type_flags,
+	          &tagged_data_type_data,
+	          &tagged_data_type_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "tagged_data_type_flags",
+	 tagged_data_type_flags,
+	 0x02 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "tagged_data_type_data_size",
+	 tagged_data_type_data_size,
+	 (size_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "tagged_data_type_data",
+	 (intptr_t) tagged_data_type_data,
+	 (intptr_t) &( esedb_test_data_definition_tagged_data_types_linear_data[ 11 ] ) );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_get_tagged_data_type(
+	          esedb_test_data_definition_tagged_data_types_linear_data,
+	          13,
+	          io_handle,
+	          257,
+	          &tagged_data_type_flags,
+	          &tagged_data_type_data,
+	          &tagged_data_type_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libesedb_data_definition_read_long_value(
-	          NULL,
-	          NULL,
+	io_handle->format_revision = 0x0c;
+
+	result = libesedb_data_definition_get_tagged_data_type(
 	          NULL,
+	          22,
+	          io_handle,
+	          256,
+	          &tagged_data_type_flags,
+	          &tagged_data_type_data,
+	          &tagged_data_type_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_tagged_data_type(
+	          esedb_test_data_definition_tagged_data_types_index_data,
+	          22,
 	          NULL,
+	          256,
+	          &tagged_data_type_flags,
+	          &tagged_data_type_data,
+	          &tagged_data_type_data_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -390,36 +901,797 @@ int esedb_test_data_definition_read_long_value(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = libesedb_data_definition_get_tagged_data_type(
+	          esedb_test_data_definition_tagged_data_types_index_data,
+	          22,
+	          io_handle,
+	          256,
+	          NULL,
+	          &tagged_data_type_data,
+	          &tagged_data_type_data_size,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-/* Tests the libesedb_data_definition_read_long_value_segment function
- * Returns 1 if successful or 0 if not
- */
-int esedb_test_data_definition_read_long_value_segment(
-     void )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Test error cases
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a tagged data type offsets size that exceeds the data size
 	 */
-	result = libesedb_data_definition_read_long_value_segment(
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          0,
-	          NULL,
+	result = libesedb_data_definition_get_tagged_data_type(
+	          esedb_test_data_definition_tagged_data_types_index_data,
+	          8,
+	          io_handle,
+	          256,
+	          &tagged_data_type_flags,
+	          &tagged_data_type_data,
+	          &tagged_data_type_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_data_definition_get_fixed_size_column_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_data_definition_get_fixed_size_column_offset(
+     void )
+{
+	uint32_t column_sizes[ 3 ]          = { 4, 8, 8 };
+	uint32_t template_column_sizes[ 2 ] = { 8, 4 };
+
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_table_definition_t *table_definition            = NULL;
+	libesedb_table_definition_t *template_table_definition   = NULL;
+	size_t column_offset                                     = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_data_definition_initialize_table_definition(
+	          &table_definition,
+	          column_sizes,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_data_definition_initialize_table_definition(
+	          &template_table_definition,
+	          template_column_sizes,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_data_definition_get_fixed_size_column_offset(
+	          table_definition,
+	          NULL,
+	          1,
+	          &column_catalog_definition,
+	          &column_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column_catalog_definition",
+	 column_catalog_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_catalog_definition->identifier",
+	 column_catalog_definition->identifier,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "column_offset",
+	 column_offset,
+	 (size_t) 4 );
+
+	result = libesedb_data_definition_get_fixed_size_column_offset(
+	          table_definition,
+	          NULL,
+	          2,
+	          &column_catalog_definition,
+	          &column_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column_catalog_definition",
+	 column_catalog_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_catalog_definition->identifier",
+	 column_catalog_definition->identifier,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "column_offset",
+	 column_offset,
+	 (size_t) 8 );
+
+	result = libesedb_data_definition_get_fixed_size_column_offset(
+	          table_definition,
+	          NULL,
+	          3,
+	          &column_catalog_definition,
+	          &column_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column_catalog_definition",
+	 column_catalog_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_catalog_definition->identifier",
+	 column_catalog_definition->identifier,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "column_offset",
+	 column_offset,
+	 (size_t) 16 );
+
+	/* Test a table that uses a template table, of which the fixed size columns
+	 * are defined by the template table
+	 */
+	result = libesedb_data_definition_get_fixed_size_column_offset(
+	          table_definition,
+	          template_table_definition,
+	          2,
+	          &column_catalog_definition,
+	          &column_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_catalog_definition->size",
+	 column_catalog_definition->size,
+	 4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "column_offset",
+	 column_offset,
+	 (size_t) 12 );
+
+	/* Test error cases
+	 */
+	result = libesedb_data_definition_get_fixed_size_column_offset(
+	          NULL,
+	          NULL,
+	          1,
+	          &column_catalog_definition,
+	          &column_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_fixed_size_column_offset(
+	          table_definition,
+	          NULL,
+	          0,
+	          &column_catalog_definition,
+	          &column_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_fixed_size_column_offset(
+	          table_definition,
+	          NULL,
+	          1,
+	          NULL,
+	          &column_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_fixed_size_column_offset(
+	          table_definition,
+	          NULL,
+	          1,
+	          &column_catalog_definition,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column is not a fixed size column
+	 */
+	result = libesedb_data_definition_get_fixed_size_column_offset(
+	          table_definition,
+	          NULL,
+	          128,
+	          &column_catalog_definition,
+	          &column_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column is not defined by the table
+	 */
+	result = libesedb_data_definition_get_fixed_size_column_offset(
+	          table_definition,
+	          NULL,
+	          4,
+	          &column_catalog_definition,
+	          &column_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_fixed_size_column_offset(
+	          table_definition,
+	          template_table_definition,
+	          3,
+	          &column_catalog_definition,
+	          &column_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_table_definition_free(
+	          &template_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template_table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &template_table_definition,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_data_definition_get_fixed_size_column_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_data_definition_get_fixed_size_column_data(
+     void )
+{
+	const uint8_t *column_data                  = NULL;
+	libbfio_handle_t *file_io_handle            = NULL;
+	libcerror_error_t *error                    = NULL;
+	libesedb_data_definition_t *data_definition = NULL;
+	libesedb_io_handle_t *io_handle             = NULL;
+	libfcache_cache_t *pages_cache              = NULL;
+	libfdata_vector_t *pages_vector             = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_data_definition_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_initialize(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The record data of the page values is stored after the 2 byte key size and the 5 byte key
+	 */
+	data_definition->page_offset      = 0;
+	data_definition->page_number      = 1;
+	data_definition->page_value_index = 1;
+	data_definition->data_offset      = 7;
+	data_definition->data_size        = 24;
+
+	/* Test regular cases
+	 */
+	result = libesedb_data_definition_get_fixed_size_column_data(
+	          data_definition,
+	          file_io_handle,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          3,
+	          16,
+	          8,
+	          &column_data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column_data",
+	 column_data );
+
+	result = memory_compare(
+	          column_data,
+	          &( esedb_test_data_definition_record_data1[ 16 ] ),
+	          8 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_data_definition_get_fixed_size_column_data(
+	          data_definition,
+	          file_io_handle,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          4,
+	          4,
+	          &column_data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "column_data[ 0 ]",
+	 column_data[ 0 ],
+	 1 );
+
+	/* Test a column that is NULL in the second record
+	 */
+	data_definition->page_value_index = 2;
+	data_definition->data_offset      = 38;
+	data_definition->data_size        = 8;
+
+	result = libesedb_data_definition_get_fixed_size_column_data(
+	          data_definition,
+	          file_io_handle,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          2,
+	          8,
+	          8,
+	          &column_data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_data_definition_get_fixed_size_column_data(
+	          NULL,
+	          file_io_handle,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          4,
+	          4,
+	          &column_data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_fixed_size_column_data(
+	          data_definition,
+	          file_io_handle,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          4,
+	          4,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column data exceeds the truncated record data of the third record
+	 */
+	data_definition->page_value_index = 3;
+	data_definition->data_offset      = 53;
+	data_definition->data_size        = 8;
+
+	result = libesedb_data_definition_get_fixed_size_column_data(
+	          data_definition,
+	          file_io_handle,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          2,
+	          8,
+	          8,
+	          &column_data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_data_definition_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	esedb_test_data_definition_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_data_definition_read_long_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_data_definition_read_long_value(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_data_definition_read_long_value(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_data_definition_read_long_value_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_data_definition_read_long_value_segment(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_data_definition_read_long_value_segment(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          NULL,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -480,6 +1752,20 @@ int main(
 	 "libesedb_data_definition_read_record",
 	 esedb_test_data_definition_read_record );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_data_definition_get_tagged_data_type",
+	 esedb_test_data_definition_get_tagged_data_type );
+
+	/* TODO: add tests for libesedb_data_definition_get_column_data */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_data_definition_get_fixed_size_column_offset",
+	 esedb_test_data_definition_get_fixed_size_column_offset );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_data_definition_get_fixed_size_column_data",
+	 esedb_test_data_definition_get_fixed_size_column_data );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_data_definition_read_long_value",
 	 esedb_test_data_definition_read_long_value );
@@ -20,7 +20,9 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -39,7 +41,15 @@
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/esedb_catalog_cache.h"
+#include "../libesedb/esedb_file_header.h"
+#include "../libesedb/libesedb_catalog.h"
+#include "../libesedb/libesedb_catalog_cache.h"
+#include "../libesedb/libesedb_checksum.h"
+#include "../libesedb/libesedb_definitions.h"
 #include "../libesedb/libesedb_file.h"
+#include "../libesedb/libesedb_file_header.h"
+#include "../libesedb/libesedb_table_definition.h"
 
 #if !defined( LIBESEDB_HAVE_BFIO )
 
@@ -1181,6 +1191,2585 @@ on_error:
 	return( 0 );
 }
 
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Catalog definition: table MSysObjects
+ */
+uint8_t esedb_test_file_table_definition_data[ 45 ] = {
+	0x08, 0x80, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x14, 0x00, 0x00, 0x00, 0xff, 0x00,
+	0x0b, 0x00, 0x4d, 0x53, 0x79, 0x73, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73 };
+
+/* Catalog definition: table MSysObjectsShadow
+ */
+uint8_t esedb_test_file_backup_table_definition_data[ 51 ] = {
+	0x08, 0x80, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x14, 0x00, 0x00, 0x00, 0xff, 0x00,
+	0x11, 0x00, 0x4d, 0x53, 0x79, 0x73, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x53, 0x68, 0x61,
+	0x64, 0x6f, 0x77 };
+
+/* Catalog definition: column ColumnName1
+ */
+uint8_t esedb_test_file_column_definition_data[ 45 ] = {
+	0x08, 0x80, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x14, 0x00, 0x00, 0x00, 0xff, 0x00,
+	0x0b, 0x00, 0x43, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x4e, 0x61, 0x6d, 0x65, 0x31 };
+
+/* The file test data contains a database file of 26 pages of 4096 bytes, with the file header
+ * and backup file header, an empty database root page (1), a catalog root page (4) and
+ * a backup catalog root page (24)
+ */
+uint8_t esedb_test_file_data[ 26 * 4096 ];
+
+/* The catalog cache test data contains a catalog cache header that matches the file test data
+ */
+uint8_t esedb_test_file_catalog_cache_data[ 72 ];
+
+/* Writes a file header into the file test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_file_write_file_header(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_file_write_file_header";
+	uint32_t checksum     = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < sizeof( esedb_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     sizeof( esedb_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_file_header_t *) data )->signature,
+	 0x89abcdefUL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_file_header_t *) data )->format_version,
+	 0x00000620UL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_file_header_t *) data )->file_type,
+	 LIBESEDB_FILE_TYPE_DATABASE );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_file_header_t *) data )->format_revision,
+	 0x0000000cUL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_file_header_t *) data )->page_size,
+	 4096 );
+
+	if( libesedb_checksum_calculate_little_endian_xor32(
+	     &checksum,
+	     &( data[ 4 ] ),
+	     sizeof( esedb_file_header_t ) - 4,
+	     0x89abcdefUL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_file_header_t *) data )->checksum,
+	 checksum );
+
+	return( 1 );
+}
+
+/* Writes the file test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_file_write_data(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t key1[ 2 ]                      = { 0x7f, 0x01 };
+	uint8_t key2[ 2 ]                      = { 0x7f, 0x02 };
+
+	const uint8_t *backup_values_data[ 2 ] = { NULL, NULL };
+	const uint8_t *keys[ 2 ]               = { key1, key2 };
+	const uint8_t *values_data[ 2 ]        = { NULL, NULL };
+	static char *function                  = "esedb_test_file_write_data";
+	size_t backup_values_data_sizes[ 2 ]   = { 51, 45 };
+	size_t key_sizes[ 2 ]                  = { 2, 2 };
+	size_t values_data_sizes[ 2 ]          = { 45, 45 };
+
+	values_data[ 0 ]        = esedb_test_file_table_definition_data;
+	values_data[ 1 ]        = esedb_test_file_column_definition_data;
+	backup_values_data[ 0 ] = esedb_test_file_backup_table_definition_data;
+	backup_values_data[ 1 ] = esedb_test_file_column_definition_data;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < ( 26 * 4096 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		return( -1 );
+	}
+	if( esedb_test_file_write_file_header(
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_file_write_file_header(
+	     &( data[ 4096 ] ),
+	     data_size - 4096,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     LIBESEDB_PAGE_NUMBER_DATABASE,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     0,
+	     0,
+	     NULL,
+	     NULL,
+	     NULL,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     LIBESEDB_PAGE_NUMBER_CATALOG,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     0,
+	     0,
+	     keys,
+	     key_sizes,
+	     values_data,
+	     values_data_sizes,
+	     2,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     0,
+	     0,
+	     keys,
+	     key_sizes,
+	     backup_values_data,
+	     backup_values_data_sizes,
+	     2,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a catalog cache header that matches the file test data into the catalog cache test data
+ * The header defines a single entry without entry data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_file_write_catalog_cache_data(
+     const uint8_t *file_data,
+     size_t file_data_size,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_file_write_catalog_cache_data";
+	uint32_t checksum     = 0;
+
+	if( file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file data.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_data_size < sizeof( esedb_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid file data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size != sizeof( esedb_catalog_cache_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( (esedb_catalog_cache_header_t *) data )->signature,
+	     esedb_catalog_cache_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->format_version,
+	 1 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->file_size,
+	 (uint64_t) file_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_data )->checksum,
+	 checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->file_header_checksum,
+	 checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->page_size,
+	 4096 );
+
+	if( memory_copy(
+	     ( (esedb_catalog_cache_header_t *) data )->database_time,
+	     ( (esedb_file_header_t *) file_data )->database_time,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database time.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( (esedb_catalog_cache_header_t *) data )->database_signature,
+	     ( (esedb_file_header_t *) file_data )->database_signature,
+	     28 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->number_of_entries,
+	 1 );
+
+	if( libesedb_checksum_calculate_little_endian_xor32(
+	     &checksum,
+	     &( data[ 12 ] ),
+	     data_size - 12,
+	     0x89abcdefUL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_catalog_cache_header_t *) data )->checksum,
+	 checksum );
+
+	return( 1 );
+}
+
+/* Tests the libesedb_file_use_backup_catalog function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_use_backup_catalog(
+     void )
+{
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_catalog_t *backup_catalog            = NULL;
+	libesedb_file_t *file                         = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	int number_of_tables                          = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_file_write_data(
+	          esedb_test_file_data,
+	          26 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_file_data,
+	          26 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_file_open_source(
+	          &file,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that opening the file does not read the backup catalog
+	 */
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file->catalog",
+	 ( (libesedb_internal_file_t *) file )->catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file->backup_catalog",
+	 ( (libesedb_internal_file_t *) file )->backup_catalog );
+
+	result = libesedb_file_get_number_of_tables(
+	          file,
+	          &number_of_tables,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_tables",
+	 number_of_tables,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file->backup_catalog",
+	 ( (libesedb_internal_file_t *) file )->backup_catalog );
+
+	/* Test regular cases
+	 */
+	result = libesedb_file_use_backup_catalog(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	backup_catalog = ( (libesedb_internal_file_t *) file )->backup_catalog;
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "backup_catalog",
+	 backup_catalog );
+
+	result = libesedb_catalog_get_table_definition_by_utf8_name(
+	          backup_catalog,
+	          (uint8_t *) "MSysObjectsShadow",
+	          17,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_get_number_of_tables(
+	          file,
+	          &number_of_tables,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_tables",
+	 number_of_tables,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the backup catalog is read only once
+	 */
+	result = libesedb_file_use_backup_catalog(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "file->backup_catalog",
+	 (intptr_t) ( (libesedb_internal_file_t *) file )->backup_catalog,
+	 (intptr_t) backup_catalog );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_use_backup_catalog(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_file_close_source(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		esedb_test_file_close_source(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_file_open_read function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_open_read(
+     void )
+{
+	libbfio_handle_t *catalog_cache_file_io_handle = NULL;
+	libbfio_handle_t *file_io_handle               = NULL;
+	libcerror_error_t *error                       = NULL;
+	libesedb_file_t *file                          = NULL;
+	libesedb_internal_file_t *internal_file        = NULL;
+	libesedb_table_definition_t *table_definition  = NULL;
+	int number_of_tables                           = 0;
+	int result                                     = 0;
+
+	/* Test that a catalog cache that cannot be read is ignored and the catalog is read from the file
+	 */
+	result = esedb_test_file_write_data(
+	          esedb_test_file_data,
+	          26 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_file_write_catalog_cache_data(
+	          esedb_test_file_data,
+	          26 * 4096,
+	          esedb_test_file_catalog_cache_data,
+	          72,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_file_data,
+	          26 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_initialize(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &catalog_cache_file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache_file_io_handle",
+	 catalog_cache_file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          catalog_cache_file_io_handle,
+	          esedb_test_file_catalog_cache_data,
+	          72,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_file = (libesedb_internal_file_t *) file;
+
+	/* The file takes over management of the catalog cache file IO handle
+	 */
+	internal_file->catalog_cache_file_io_handle = catalog_cache_file_io_handle;
+	catalog_cache_file_io_handle                = NULL;
+
+	result = libesedb_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file->catalog",
+	 internal_file->catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "internal_file->backup_catalog",
+	 internal_file->backup_catalog );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_file->use_backup_catalog",
+	 internal_file->use_backup_catalog,
+	 (uint8_t) 0 );
+
+	result = libesedb_catalog_get_table_definition_by_utf8_name(
+	          internal_file->catalog,
+	          (uint8_t *) "MSysObjects",
+	          11,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_file_close_source(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the backup catalog is read when the catalog cannot be read
+	 */
+	esedb_test_file_table_definition_data[ 0 ] = 0x04;
+
+	result = esedb_test_file_write_data(
+	          esedb_test_file_data,
+	          26 * 4096,
+	          &error );
+
+	esedb_test_file_table_definition_data[ 0 ] = 0x08;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_file_data,
+	          26 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_file_open_source(
+	          &file,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_file = (libesedb_internal_file_t *) file;
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "internal_file->catalog",
+	 internal_file->catalog );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file->backup_catalog",
+	 internal_file->backup_catalog );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_file->use_backup_catalog",
+	 internal_file->use_backup_catalog,
+	 (uint8_t) 1 );
+
+	result = libesedb_file_get_number_of_tables(
+	          file,
+	          &number_of_tables,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_tables",
+	 number_of_tables,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_table_definition_by_utf8_name(
+	          internal_file->backup_catalog,
+	          (uint8_t *) "MSysObjectsShadow",
+	          17,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_file_close_source(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where neither the catalog nor the backup catalog can be read
+	 */
+	esedb_test_file_table_definition_data[ 0 ]        = 0x04;
+	esedb_test_file_backup_table_definition_data[ 0 ] = 0x04;
+
+	result = esedb_test_file_write_data(
+	          esedb_test_file_data,
+	          26 * 4096,
+	          &error );
+
+	esedb_test_file_table_definition_data[ 0 ]        = 0x08;
+	esedb_test_file_backup_table_definition_data[ 0 ] = 0x08;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_file_data,
+	          26 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_file_open_source(
+	          &file,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		esedb_test_file_close_source(
+		 &file,
+		 NULL );
+	}
+	if( catalog_cache_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &catalog_cache_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_file_set_catalog_cache_filename function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_set_catalog_cache_filename(
+     void )
+{
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_file_t *file                         = NULL;
+	libesedb_internal_file_t *internal_file       = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_file_write_data(
+	          esedb_test_file_data,
+	          26 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_initialize(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_file = (libesedb_internal_file_t *) file;
+
+	/* Test regular cases
+	 */
+	result = libesedb_file_set_catalog_cache_filename(
+	          file,
+	          "esedb_test_missing/catalog.cache",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file->catalog_cache_file_io_handle",
+	 internal_file->catalog_cache_file_io_handle );
+
+	/* Test that setting the catalog cache filename again replaces the catalog cache file IO handle
+	 */
+	result = libesedb_file_set_catalog_cache_filename(
+	          file,
+	          "esedb_test_missing/catalog.cache",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file->catalog_cache_file_io_handle",
+	 internal_file->catalog_cache_file_io_handle );
+
+	/* Test that a missing catalog cache that cannot be written does not fail the open
+	 */
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_file_data,
+	          26 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file->catalog",
+	 internal_file->catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "internal_file->backup_catalog",
+	 internal_file->backup_catalog );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_file->use_backup_catalog",
+	 internal_file->use_backup_catalog,
+	 (uint8_t) 0 );
+
+	result = libesedb_catalog_get_table_definition_by_utf8_name(
+	          internal_file->catalog,
+	          (uint8_t *) "MSysObjects",
+	          11,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_set_catalog_cache_filename(
+	          NULL,
+	          "esedb_test_missing/catalog.cache",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_set_catalog_cache_filename(
+	          file,
+	          "esedb_test_missing/catalog.cache",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_file_close_source(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_initialize(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_set_catalog_cache_filename(
+	          file,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_file_free(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		esedb_test_file_close_source(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_file_read_backup_catalog function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_read_backup_catalog(
+     void )
+{
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_file_t *file                         = NULL;
+	libesedb_internal_file_t *internal_file       = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_file_write_data(
+	          esedb_test_file_data,
+	          26 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_file_data,
+	          26 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_file_open_source(
+	          &file,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_file = (libesedb_internal_file_t *) file;
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "internal_file->backup_catalog",
+	 internal_file->backup_catalog );
+
+	/* Test regular cases
+	 */
+	result = libesedb_file_read_backup_catalog(
+	          internal_file,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file->backup_catalog",
+	 internal_file->backup_catalog );
+
+	result = libesedb_catalog_get_table_definition_by_utf8_name(
+	          internal_file->backup_catalog,
+	          (uint8_t *) "MSysObjectsShadow",
+	          17,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_read_backup_catalog(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the backup catalog is already set
+	 */
+	result = libesedb_file_read_backup_catalog(
+	          internal_file,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_file_close_source(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		esedb_test_file_close_source(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_file_read_catalog_cache function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_read_catalog_cache(
+     void )
+{
+	libbfio_handle_t *catalog_cache_file_io_handle = NULL;
+	libbfio_handle_t *file_io_handle               = NULL;
+	libcerror_error_t *error                       = NULL;
+	libesedb_catalog_cache_t *catalog_cache        = NULL;
+	libesedb_file_t *file                          = NULL;
+	libesedb_file_header_t *file_header            = NULL;
+	libesedb_internal_file_t *internal_file        = NULL;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_file_write_data(
+	          esedb_test_file_data,
+	          26 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_file_data,
+	          26 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_file_open_source(
+	          &file,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_file = (libesedb_internal_file_t *) file;
+
+	result = libesedb_file_header_initialize(
+	          &file_header,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_header",
+	 file_header );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_header_read_data(
+	          file_header,
+	          esedb_test_file_data,
+	          sizeof( esedb_file_header_t ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_initialize(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_set_file_header_values(
+	          catalog_cache,
+	          file_header,
+	          26 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_header_free(
+	          &file_header,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file_header",
+	 file_header );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a missing catalog cache is not read
+	 */
+	result = libbfio_file_initialize(
+	          &catalog_cache_file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache_file_io_handle",
+	 catalog_cache_file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_set_name(
+	          catalog_cache_file_io_handle,
+	          "esedb_test_missing/catalog.cache",
+	          33,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_file->catalog_cache_file_io_handle = catalog_cache_file_io_handle;
+	catalog_cache_file_io_handle                = NULL;
+
+	result = libesedb_file_read_catalog_cache(
+	          internal_file,
+	          catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &( internal_file->catalog_cache_file_io_handle ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a catalog cache that does not match the file is not read
+	 */
+	result = esedb_test_file_write_catalog_cache_data(
+	          esedb_test_file_data,
+	          25 * 4096,
+	          esedb_test_file_catalog_cache_data,
+	          72,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &catalog_cache_file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache_file_io_handle",
+	 catalog_cache_file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          catalog_cache_file_io_handle,
+	          esedb_test_file_catalog_cache_data,
+	          72,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_file->catalog_cache_file_io_handle = catalog_cache_file_io_handle;
+	catalog_cache_file_io_handle                = NULL;
+
+	result = libesedb_file_read_catalog_cache(
+	          internal_file,
+	          catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_read_catalog_cache(
+	          NULL,
+	          catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_free(
+	          &( internal_file->catalog_cache_file_io_handle ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_read_catalog_cache(
+	          internal_file,
+	          catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_cache_free(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_file_close_source(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog_cache != NULL )
+	{
+		libesedb_catalog_cache_free(
+		 &catalog_cache,
+		 NULL );
+	}
+	if( file_header != NULL )
+	{
+		libesedb_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	if( catalog_cache_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &catalog_cache_file_io_handle,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		esedb_test_file_close_source(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_file_write_catalog_cache function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_write_catalog_cache(
+     void )
+{
+	uint8_t catalog_cache_data[ 1024 ];
+	libbfio_handle_t *catalog_cache_file_io_handle = NULL;
+	libbfio_handle_t *file_io_handle               = NULL;
+	libcerror_error_t *error                       = NULL;
+	libesedb_catalog_t *catalog                    = NULL;
+	libesedb_catalog_cache_t *catalog_cache        = NULL;
+	libesedb_file_t *file                          = NULL;
+	libesedb_file_header_t *file_header            = NULL;
+	libesedb_internal_file_t *internal_file        = NULL;
+	libesedb_table_definition_t *table_definition  = NULL;
+	size_t data_size                               = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_file_write_data(
+	          esedb_test_file_data,
+	          26 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_file_data,
+	          26 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_file_open_source(
+	          &file,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_file = (libesedb_internal_file_t *) file;
+
+	result = libesedb_file_header_initialize(
+	          &file_header,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_header",
+	 file_header );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_header_read_data(
+	          file_header,
+	          esedb_test_file_data,
+	          sizeof( esedb_file_header_t ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_initialize(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_set_file_header_values(
+	          catalog_cache,
+	          file_header,
+	          26 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_header_free(
+	          &file_header,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file_header",
+	 file_header );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_get_data_size(
+	          catalog_cache,
+	          internal_file->catalog,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_LESS_THAN_UINT64(
+	 "data_size",
+	 (uint64_t) data_size,
+	 (uint64_t) 1024 );
+
+	/* Test that a catalog cache that does not match the file is rewritten
+	 */
+	result = esedb_test_file_write_catalog_cache_data(
+	          esedb_test_file_data,
+	          25 * 4096,
+	          catalog_cache_data,
+	          72,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &catalog_cache_file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache_file_io_handle",
+	 catalog_cache_file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          catalog_cache_file_io_handle,
+	          catalog_cache_data,
+	          data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_file->catalog_cache_file_io_handle = catalog_cache_file_io_handle;
+	catalog_cache_file_io_handle                = NULL;
+
+	result = libesedb_file_write_catalog_cache(
+	          internal_file,
+	          catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          internal_file->io_handle,
+	          internal_file->pages_vector,
+	          internal_file->pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          internal_file->catalog_cache_file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_cache_read_file_io_handle(
+	          catalog_cache,
+	          catalog,
+	          internal_file->catalog_cache_file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          internal_file->catalog_cache_file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_table_definition_by_utf8_name(
+	          catalog,
+	          (uint8_t *) "MSysObjects",
+	          11,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &( internal_file->catalog_cache_file_io_handle ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the catalog cache is too small to be written
+	 */
+	result = libbfio_memory_range_initialize(
+	          &catalog_cache_file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_cache_file_io_handle",
+	 catalog_cache_file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          catalog_cache_file_io_handle,
+	          catalog_cache_data,
+	          72,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_file->catalog_cache_file_io_handle = catalog_cache_file_io_handle;
+	catalog_cache_file_io_handle                = NULL;
+
+	result = libesedb_file_write_catalog_cache(
+	          internal_file,
+	          catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_write_catalog_cache(
+	          NULL,
+	          catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_free(
+	          &( internal_file->catalog_cache_file_io_handle ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_write_catalog_cache(
+	          internal_file,
+	          catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_cache_free(
+	          &catalog_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog_cache",
+	 catalog_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_file_close_source(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( catalog_cache != NULL )
+	{
+		libesedb_catalog_cache_free(
+		 &catalog_cache,
+		 NULL );
+	}
+	if( file_header != NULL )
+	{
+		libesedb_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	if( catalog_cache_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &catalog_cache_file_io_handle,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		esedb_test_file_close_source(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1238,6 +3827,34 @@ int main(
 	 "libesedb_file_free",
 	 esedb_test_file_free );
 
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_file_use_backup_catalog",
+	 esedb_test_file_use_backup_catalog );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_file_open_read",
+	 esedb_test_file_open_read );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_file_set_catalog_cache_filename",
+	 esedb_test_file_set_catalog_cache_filename );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_file_read_backup_catalog",
+	 esedb_test_file_read_backup_catalog );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_file_read_catalog_cache",
+	 esedb_test_file_read_catalog_cache );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_file_write_catalog_cache",
+	 esedb_test_file_write_catalog_cache );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -1348,12 +3965,6 @@ int main(
 
 		/* TODO: add tests for libesedb_file_signal_abort */
 
-#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
-
-		/* TODO: add tests for libesedb_file_open_read */
-
-#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
-
 		/* TODO: add tests for libesedb_file_get_type */
 
 		/* TODO: add tests for libesedb_file_get_format_version */
@@ -0,0 +1,468 @@
+/*
+ * Library filter type test program
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_filter.h"
+
+/* Tests the libesedb_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_filter_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_filter_t *filter       = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libesedb_filter_initialize(
+	          &filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_free(
+	          &filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_filter_initialize(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	filter = (libesedb_filter_t *) 0x12345678UL;
+
+	result = libesedb_filter_initialize(
+	          &filter,
+	          &error );
+
+	filter = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_filter_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_filter_initialize(
+		          &filter,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( filter != NULL )
+			{
+				libesedb_filter_free(
+				 &filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "filter",
+			 filter );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_filter_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_filter_initialize(
+		          &filter,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( filter != NULL )
+			{
+				libesedb_filter_free(
+				 &filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "filter",
+			 filter );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libesedb_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result              = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_filter_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_filter_append_predicate and libesedb_filter_get_number_of_predicates functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_filter_append_predicate(
+     void )
+{
+	uint8_t value_data[ 8 ]   = { 0x00, 0x80, 0x3e, 0xd5, 0xde, 0xb1, 0x9d, 0x01 };
+
+	libcerror_error_t *error  = NULL;
+	libesedb_filter_t *filter = NULL;
+	int number_of_predicates  = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_filter_initialize(
+	          &filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_filter_append_predicate(
+	          filter,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL,
+	          value_data,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_filter_get_number_of_predicates(
+	          filter,
+	          &number_of_predicates,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_predicates",
+	 number_of_predicates,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_filter_append_predicate(
+	          NULL,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL,
+	          value_data,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_filter_append_predicate(
+	          filter,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL,
+	          NULL,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_filter_get_number_of_predicates(
+	          NULL,
+	          &number_of_predicates,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_filter_free(
+	          &filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libesedb_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_filter_initialize",
+	 esedb_test_filter_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_filter_free",
+	 esedb_test_filter_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_filter_append_predicate",
+	 esedb_test_filter_append_predicate );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -20,7 +20,9 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -560,3 +562,241 @@ int esedb_test_close_file_io_handle(
 	return( result );
 }
 
+
+/* Writes a page of a page tree into test data
+ * The page is written at the file offset of the page number, where page value 0,
+ * which contains the common page key, is left empty and the keys and data of
+ * page values 1 and onwards are stored without common key
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_write_page(
+     uint8_t *data,
+     size_t data_size,
+     uint32_t page_size,
+     uint32_t page_number,
+     uint32_t page_flags,
+     uint32_t previous_page_number,
+     uint32_t next_page_number,
+     const uint8_t **keys,
+     const size_t *key_sizes,
+     const uint8_t **values_data,
+     const size_t *values_data_sizes,
+     uint16_t number_of_values,
+     libcerror_error_t **error )
+{
+	uint8_t *page_data         = NULL;
+	static char *function      = "esedb_test_write_page";
+	size_t page_offset         = 0;
+	size_t page_tags_data_size = 0;
+	size_t value_offset        = 0;
+	size_t value_size          = 0;
+	uint16_t value_index       = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_size < 4096 )
+	 || ( page_size > 8192 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( ( (size_t) page_number + 2 ) > ( data_size / page_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_values > 0 )
+	 && ( ( keys == NULL )
+	  || ( key_sizes == NULL )
+	  || ( values_data == NULL )
+	  || ( values_data_sizes == NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page values.",
+		 function );
+
+		return( -1 );
+	}
+	page_offset         = ( (size_t) page_number + 1 ) * page_size;
+	page_data           = &( data[ page_offset ] );
+	page_tags_data_size = 4 * ( (size_t) number_of_values + 1 );
+
+	if( page_tags_data_size > ( page_size - 40 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     page_data,
+	     0,
+	     (size_t) page_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The page values are stored after the 40 byte page header, where page value 0 is empty
+	 */
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( ( keys[ value_index ] == NULL )
+		 && ( key_sizes[ value_index ] > 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid key: %" PRIu16 ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		if( ( values_data[ value_index ] == NULL )
+		 && ( values_data_sizes[ value_index ] > 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid value data: %" PRIu16 ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		value_size = 2 + key_sizes[ value_index ] + values_data_sizes[ value_index ];
+
+		if( ( key_sizes[ value_index ] > 0x1fff )
+		 || ( value_size > ( page_size - 40 - page_tags_data_size - value_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value: %" PRIu16 " size value out of bounds.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( page_data[ 40 + value_offset ] ),
+		 (uint16_t) key_sizes[ value_index ] );
+
+		if( key_sizes[ value_index ] > 0 )
+		{
+			if( memory_copy(
+			     &( page_data[ 40 + value_offset + 2 ] ),
+			     keys[ value_index ],
+			     key_sizes[ value_index ] ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy key: %" PRIu16 ".",
+				 function,
+				 value_index );
+
+				return( -1 );
+			}
+		}
+		if( values_data_sizes[ value_index ] > 0 )
+		{
+			if( memory_copy(
+			     &( page_data[ 40 + value_offset + 2 + key_sizes[ value_index ] ] ),
+			     values_data[ value_index ],
+			     values_data_sizes[ value_index ] ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy value data: %" PRIu16 ".",
+				 function,
+				 value_index );
+
+				return( -1 );
+			}
+		}
+		/* The page tags are stored in reverse order at the end of the page
+		 */
+		byte_stream_copy_from_uint16_little_endian(
+		 &( page_data[ page_size - ( 4 * ( value_index + 2 ) ) ] ),
+		 (uint16_t) value_size );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( page_data[ page_size - ( 4 * ( value_index + 2 ) ) + 2 ] ),
+		 (uint16_t) value_offset );
+
+		value_offset += value_size;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 4 ] ),
+	 page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 16 ] ),
+	 previous_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 20 ] ),
+	 next_page_number );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ 28 ] ),
+	 (uint16_t) ( page_size - 40 - page_tags_data_size - value_offset ) );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ 32 ] ),
+	 (uint16_t) value_offset );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ 34 ] ),
+	 number_of_values + 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 36 ] ),
+	 page_flags );
+
+	return( 1 );
+}
@@ -58,6 +58,21 @@ int esedb_test_close_file_io_handle(
      libbfio_handle_t **file_io_handle,
      libcerror_error_t **error );
 
+int esedb_test_write_page(
+     uint8_t *data,
+     size_t data_size,
+     uint32_t page_size,
+     uint32_t page_number,
+     uint32_t page_flags,
+     uint32_t previous_page_number,
+     uint32_t next_page_number,
+     const uint8_t **keys,
+     const size_t *key_sizes,
+     const uint8_t **values_data,
+     const size_t *values_data_sizes,
+     uint16_t number_of_values,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,903 @@
+/*
+ * Library hash table functions test program
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_hash_table.h"
+
+/* The name "MSysObjects" with a different case in codepage 1252, UTF-8 and UTF-16
+ * followed by U+00e9
+ */
+uint8_t esedb_test_hash_table_byte_stream[ 12 ] = {
+	'M', 'S', 'y', 's', 'O', 'b', 'j', 'e', 'c', 't', 's', 0xe9 };
+
+uint8_t esedb_test_hash_table_utf8_string[ 14 ] = {
+	'm', 's', 'y', 's', 'o', 'b', 'j', 'e', 'c', 't', 's', 0xc3, 0xa9, 0 };
+
+uint16_t esedb_test_hash_table_utf16_string[ 13 ] = {
+	'M', 'S', 'Y', 'S', 'O', 'B', 'J', 'E', 'C', 'T', 'S', 0x00e9, 0 };
+
+/* The name "MSysObjects" followed by U+00e8 in UTF-8
+ */
+uint8_t esedb_test_hash_table_other_utf8_string[ 14 ] = {
+	'M', 'S', 'y', 's', 'O', 'b', 'j', 'e', 'c', 't', 's', 0xc3, 0xa8, 0 };
+
+/* The name "MSysObjects" followed by U+0439 in UTF-16
+ */
+uint16_t esedb_test_hash_table_cyrillic_utf16_string[ 13 ] = {
+	'M', 'S', 'y', 's', 'O', 'b', 'j', 'e', 'c', 't', 's', 0x0439, 0 };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_hash_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_hash_table_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libesedb_hash_table_t *hash_table = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 4;
+	int number_of_memset_fail_tests   = 3;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libesedb_hash_table_initialize(
+	          &hash_table,
+	          100,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_table",
+	 hash_table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "hash_table->number_of_entries",
+	 hash_table->number_of_entries,
+	 256 );
+
+	result = libesedb_hash_table_free(
+	          &hash_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "hash_table",
+	 hash_table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_hash_table_initialize(
+	          NULL,
+	          100,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	hash_table = (libesedb_hash_table_t *) 0x12345678UL;
+
+	result = libesedb_hash_table_initialize(
+	          &hash_table,
+	          100,
+	          &error );
+
+	hash_table = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_hash_table_initialize(
+	          &hash_table,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_hash_table_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_hash_table_initialize(
+		          &hash_table,
+		          100,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( hash_table != NULL )
+			{
+				libesedb_hash_table_free(
+				 &hash_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "hash_table",
+			 hash_table );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_hash_table_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_hash_table_initialize(
+		          &hash_table,
+		          100,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( hash_table != NULL )
+			{
+				libesedb_hash_table_free(
+				 &hash_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "hash_table",
+			 hash_table );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_table != NULL )
+	{
+		libesedb_hash_table_free(
+		 &hash_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_hash_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_hash_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_hash_table_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_hash_table_insert_value and libesedb_hash_table_get_next_value_by_hash functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_hash_table_get_next_value_by_hash(
+     void )
+{
+	int values[ 3 ]                   = { 1, 2, 3 };
+
+	libcerror_error_t *error          = NULL;
+	libesedb_hash_table_t *hash_table = NULL;
+	intptr_t *value                   = NULL;
+	int entry_index                   = 0;
+	int result                        = 0;
+	int value_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_hash_table_initialize(
+	          &hash_table,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_table",
+	 hash_table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The hashes 0x00000012 and 0x00010012 map onto the same entry
+	 */
+	result = libesedb_hash_table_insert_value(
+	          hash_table,
+	          0x00000012UL,
+	          (intptr_t *) &( values[ 0 ] ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_hash_table_insert_value(
+	          hash_table,
+	          0x00010012UL,
+	          (intptr_t *) &( values[ 1 ] ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_hash_table_insert_value(
+	          hash_table,
+	          0x00000012UL,
+	          (intptr_t *) &( values[ 2 ] ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	entry_index = -1;
+
+	result = libesedb_hash_table_get_next_value_by_hash(
+	          hash_table,
+	          0x00000012UL,
+	          &entry_index,
+	          &value_index,
+	          &value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 (intptr_t) value,
+	 (intptr_t) &( values[ 0 ] ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_hash_table_get_next_value_by_hash(
+	          hash_table,
+	          0x00000012UL,
+	          &entry_index,
+	          &value_index,
+	          &value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 (intptr_t) value,
+	 (intptr_t) &( values[ 2 ] ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_hash_table_get_next_value_by_hash(
+	          hash_table,
+	          0x00000012UL,
+	          &entry_index,
+	          &value_index,
+	          &value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	entry_index = -1;
+
+	result = libesedb_hash_table_get_next_value_by_hash(
+	          hash_table,
+	          0x00000013UL,
+	          &entry_index,
+	          &value_index,
+	          &value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_hash_table_insert_value(
+	          hash_table,
+	          0x00000012UL,
+	          (intptr_t *) &( values[ 0 ] ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	entry_index = -1;
+
+	result = libesedb_hash_table_get_next_value_by_hash(
+	          NULL,
+	          0x00000012UL,
+	          &entry_index,
+	          &value_index,
+	          &value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_hash_table_get_next_value_by_hash(
+	          hash_table,
+	          0x00000012UL,
+	          NULL,
+	          &value_index,
+	          &value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_hash_table_get_next_value_by_hash(
+	          hash_table,
+	          0x00000012UL,
+	          &entry_index,
+	          NULL,
+	          &value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_hash_table_get_next_value_by_hash(
+	          hash_table,
+	          0x00000012UL,
+	          &entry_index,
+	          &value_index,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_hash_table_free(
+	          &hash_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "hash_table",
+	 hash_table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_table != NULL )
+	{
+		libesedb_hash_table_free(
+		 &hash_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_hash_table_get_name_hash_from_byte_stream, libesedb_hash_table_get_name_hash_from_utf8_string
+ * and libesedb_hash_table_get_name_hash_from_utf16_string functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_hash_table_get_name_hash(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t name_hash       = 0;
+	uint32_t utf16_name_hash = 0;
+	uint32_t utf8_name_hash  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_hash_table_get_name_hash_from_byte_stream(
+	          esedb_test_hash_table_byte_stream,
+	          12,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_hash_table_get_name_hash_from_utf8_string(
+	          esedb_test_hash_table_utf8_string,
+	          14,
+	          &utf8_name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "utf8_name_hash",
+	 utf8_name_hash,
+	 name_hash );
+
+	result = libesedb_hash_table_get_name_hash_from_utf16_string(
+	          esedb_test_hash_table_utf16_string,
+	          13,
+	          &utf16_name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "utf16_name_hash",
+	 utf16_name_hash,
+	 name_hash );
+
+	/* Test that different non-ASCII characters have a different hash
+	 */
+	result = libesedb_hash_table_get_name_hash_from_utf8_string(
+	          esedb_test_hash_table_other_utf8_string,
+	          14,
+	          &utf8_name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_UINT32(
+	 "utf8_name_hash",
+	 utf8_name_hash,
+	 name_hash );
+
+	/* Test that the byte stream is decoded using the codepage, in codepage 1251 0xe9 is U+0439
+	 */
+	result = libesedb_hash_table_get_name_hash_from_byte_stream(
+	          esedb_test_hash_table_byte_stream,
+	          12,
+	          LIBESEDB_CODEPAGE_WINDOWS_1251,
+	          &name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 utf16_name_hash );
+
+	result = libesedb_hash_table_get_name_hash_from_utf16_string(
+	          esedb_test_hash_table_cyrillic_utf16_string,
+	          13,
+	          &utf16_name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "utf16_name_hash",
+	 utf16_name_hash,
+	 name_hash );
+
+	/* Test error cases
+	 */
+	result = libesedb_hash_table_get_name_hash_from_byte_stream(
+	          NULL,
+	          12,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_hash_table_get_name_hash_from_byte_stream(
+	          esedb_test_hash_table_byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_hash_table_get_name_hash_from_utf8_string(
+	          esedb_test_hash_table_utf8_string,
+	          14,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_hash_table_get_name_hash_from_utf16_string(
+	          NULL,
+	          13,
+	          &name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_hash_table_initialize",
+	 esedb_test_hash_table_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_hash_table_free",
+	 esedb_test_hash_table_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_hash_table_get_next_value_by_hash",
+	 esedb_test_hash_table_get_next_value_by_hash );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_hash_table_get_name_hash",
+	 esedb_test_hash_table_get_name_hash );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,19 +21,33 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
+#include "esedb_test_libfcache.h"
+#include "esedb_test_libfdata.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_data_definition.h"
+#include "../libesedb/libesedb_definitions.h"
 #include "../libesedb/libesedb_index.h"
+#include "../libesedb/libesedb_index_cursor.h"
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_page_tree.h"
+#include "../libesedb/libesedb_page_tree_cursor.h"
+#include "../libesedb/libesedb_record.h"
+#include "../libesedb/libesedb_table_definition.h"
 
 /* Tests the libesedb_index_free function
  * Returns 1 if successful or 0 if not
@@ -75,6 +89,2240 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+/* The index test data contains 5 pages of 4096 bytes, with a branch root page (1)
+ * of 2 leaf pages (2 and 3). The data of the index values contains the key of the record
+ * in the table leaf root page (4). The records contain a single 32-bit column with
+ * the record number. The second table leaf root page (5) contains the same records
+ * with keys of which the second byte only differs in the high bit
+ */
+uint8_t esedb_test_index_data[ 7 * 4096 ];
+
+/* Writes the index test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_index_write_data(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t branch_key1[ 2 ]          = { 0x10, 0x81 };
+	uint8_t child_page_number1[ 4 ]   = { 0x02, 0x00, 0x00, 0x00 };
+	uint8_t child_page_number2[ 4 ]   = { 0x03, 0x00, 0x00, 0x00 };
+	uint8_t leaf_key1[ 2 ]            = { 0x10, 0x01 };
+	uint8_t leaf_key2[ 2 ]            = { 0x10, 0x05 };
+	uint8_t leaf_key3[ 2 ]            = { 0x10, 0x20 };
+	uint8_t leaf_key4[ 2 ]            = { 0x10, 0x81 };
+	uint8_t leaf_key5[ 2 ]            = { 0x10, 0x90 };
+	uint8_t leaf_key6[ 2 ]            = { 0x20, 0x00 };
+	uint8_t record_key1[ 5 ]          = { 0x7f, 0x80, 0x00, 0x00, 0x06 };
+	uint8_t record_key2[ 5 ]          = { 0x7f, 0x80, 0x00, 0x00, 0x05 };
+	uint8_t record_key3[ 5 ]          = { 0x7f, 0x80, 0x00, 0x00, 0x01 };
+	uint8_t record_key4[ 5 ]          = { 0x7f, 0x80, 0x00, 0x00, 0x04 };
+	uint8_t record_key5[ 5 ]          = { 0x7f, 0x80, 0x00, 0x00, 0x02 };
+	uint8_t record_key6[ 5 ]          = { 0x7f, 0x80, 0x00, 0x00, 0x03 };
+	uint8_t record_key7[ 5 ]          = { 0x7f, 0x00, 0x00, 0x00, 0x01 };
+	uint8_t record_key8[ 5 ]          = { 0x7f, 0x00, 0x00, 0x00, 0x02 };
+	uint8_t record_key9[ 5 ]          = { 0x7f, 0x00, 0x00, 0x00, 0x03 };
+	uint8_t record_key10[ 5 ]         = { 0x7f, 0x00, 0x00, 0x00, 0x04 };
+	uint8_t record_key11[ 5 ]         = { 0x7f, 0x00, 0x00, 0x00, 0x05 };
+	uint8_t record_key12[ 5 ]         = { 0x7f, 0x00, 0x00, 0x00, 0x06 };
+	uint8_t record_data1[ 8 ]         = { 0x01, 0x7f, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00 };
+	uint8_t record_data2[ 8 ]         = { 0x01, 0x7f, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00 };
+	uint8_t record_data3[ 8 ]         = { 0x01, 0x7f, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00 };
+	uint8_t record_data4[ 8 ]         = { 0x01, 0x7f, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00 };
+	uint8_t record_data5[ 8 ]         = { 0x01, 0x7f, 0x08, 0x00, 0x05, 0x00, 0x00, 0x00 };
+	uint8_t record_data6[ 8 ]         = { 0x01, 0x7f, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00 };
+
+	const uint8_t *branch_keys[ 2 ]   = { branch_key1, NULL };
+	const uint8_t *branch_values[ 2 ] = { child_page_number1, child_page_number2 };
+	const uint8_t *leaf_keys1[ 3 ]    = { leaf_key1, leaf_key2, leaf_key3 };
+	const uint8_t *leaf_keys2[ 3 ]    = { leaf_key4, leaf_key5, leaf_key6 };
+	const uint8_t *leaf_values1[ 3 ]  = { record_key1, record_key2, record_key3 };
+	const uint8_t *leaf_values2[ 3 ]  = { record_key4, record_key5, record_key6 };
+	const uint8_t *record_keys[ 6 ]   = { record_key3, record_key5, record_key6, record_key4, record_key2, record_key1 };
+	const uint8_t *record_keys2[ 6 ]  = { record_key7, record_key8, record_key9, record_key10, record_key11, record_key12 };
+	const uint8_t *records_data[ 6 ]  = { record_data1, record_data2, record_data3, record_data4, record_data5, record_data6 };
+	size_t branch_key_sizes[ 2 ]      = { 2, 0 };
+	size_t branch_values_sizes[ 2 ]   = { 4, 4 };
+	size_t leaf_key_sizes[ 3 ]        = { 2, 2, 2 };
+	size_t leaf_values_sizes[ 3 ]     = { 5, 5, 5 };
+	size_t record_key_sizes[ 6 ]      = { 5, 5, 5, 5, 5, 5 };
+	size_t records_data_sizes[ 6 ]    = { 8, 8, 8, 8, 8, 8 };
+
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     1,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_PARENT,
+	     0,
+	     0,
+	     branch_keys,
+	     branch_key_sizes,
+	     branch_values,
+	     branch_values_sizes,
+	     2,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     2,
+	     LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     0,
+	     3,
+	     leaf_keys1,
+	     leaf_key_sizes,
+	     leaf_values1,
+	     leaf_values_sizes,
+	     3,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     3,
+	     LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     2,
+	     0,
+	     leaf_keys2,
+	     leaf_key_sizes,
+	     leaf_values2,
+	     leaf_values_sizes,
+	     3,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     4,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     0,
+	     0,
+	     record_keys,
+	     record_key_sizes,
+	     records_data,
+	     records_data_sizes,
+	     6,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     5,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     0,
+	     0,
+	     record_keys2,
+	     record_key_sizes,
+	     records_data,
+	     records_data_sizes,
+	     6,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees the IO handle, pages vector and pages cache of the index test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_index_free_test_data(
+     libbfio_handle_t **file_io_handle,
+     libesedb_io_handle_t **io_handle,
+     libfdata_vector_t **pages_vector,
+     libfcache_cache_t **pages_cache,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	if( *pages_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     pages_cache,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *pages_vector != NULL )
+	{
+		if( libfdata_vector_free(
+		     pages_vector,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *io_handle != NULL )
+	{
+		if( libesedb_io_handle_free(
+		     io_handle,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *file_io_handle != NULL )
+	{
+		if( esedb_test_close_file_io_handle(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Creates the IO handle, pages vector and pages cache of the index test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_index_initialize_test_data(
+     libbfio_handle_t **file_io_handle,
+     libesedb_io_handle_t **io_handle,
+     libfdata_vector_t **pages_vector,
+     libfcache_cache_t **pages_cache,
+     libcerror_error_t **error )
+{
+	int segment_index = 0;
+
+	if( esedb_test_index_write_data(
+	     esedb_test_index_data,
+	     7 * 4096,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_open_file_io_handle(
+	     file_io_handle,
+	     esedb_test_index_data,
+	     7 * 4096,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libesedb_io_handle_initialize(
+	     io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( *io_handle )->format_revision = 0x0000000c;
+	( *io_handle )->page_size       = 4096;
+
+	if( libesedb_io_handle_set_pages_data_range(
+	     *io_handle,
+	     7 * 4096,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_vector_initialize(
+	     pages_vector,
+	     (size64_t) ( *io_handle )->page_size,
+	     (intptr_t *) *io_handle,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_vector_append_segment(
+	     *pages_vector,
+	     &segment_index,
+	     0,
+	     ( *io_handle )->pages_data_offset,
+	     ( *io_handle )->pages_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     pages_cache,
+	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	esedb_test_index_free_test_data(
+	 file_io_handle,
+	 io_handle,
+	 pages_vector,
+	 pages_cache,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves records from the index test data and checks their record numbers
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_get_records_with_entries(
+     libesedb_index_t *index,
+     int first_record_entry,
+     int number_of_records,
+     const uint32_t *expected_record_numbers )
+{
+	libesedb_record_t *records[ 6 ] = { NULL, NULL, NULL, NULL, NULL, NULL };
+
+	libcerror_error_t *error        = NULL;
+	uint32_t record_number          = 0;
+	int record_entry                = 0;
+	int result                      = 0;
+
+	result = libesedb_index_get_records(
+	          index,
+	          first_record_entry,
+	          records,
+	          number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The records are returned in index order
+	 */
+	for( record_entry = 0;
+	     record_entry < number_of_records;
+	     record_entry++ )
+	{
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "records[ record_entry ]",
+		 records[ record_entry ] );
+
+		result = libesedb_record_get_value_32bit(
+		          records[ record_entry ],
+		          0,
+		          &record_number,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "record_number",
+		 record_number,
+		 expected_record_numbers[ record_entry ] );
+
+		result = libesedb_record_free(
+		          &( records[ record_entry ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( record_entry = 0;
+	     record_entry < 6;
+	     record_entry++ )
+	{
+		if( records[ record_entry ] != NULL )
+		{
+			libesedb_record_free(
+			 &( records[ record_entry ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_get_record function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_get_record(
+     void )
+{
+	libesedb_catalog_definition_t index_catalog_definition;
+	libesedb_internal_index_t internal_index;
+
+	uint32_t expected_record_numbers[ 6 ]                    = { 6, 5, 1, 4, 2, 3 };
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition  = NULL;
+	libesedb_io_handle_t *io_handle                          = NULL;
+	libesedb_page_tree_t *index_page_tree                    = NULL;
+	libesedb_page_tree_t *table_page_tree                    = NULL;
+	libesedb_record_t *record                                = NULL;
+	libesedb_table_definition_t *table_definition            = NULL;
+	libfcache_cache_t *pages_cache                           = NULL;
+	libfcache_cache_t *table_values_cache                    = NULL;
+	libfdata_btree_t *table_values_tree                      = NULL;
+	libfdata_vector_t *pages_vector                          = NULL;
+	uint32_t record_number                                   = 0;
+	int record_entry                                         = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_index_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition->type                    = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+	table_catalog_definition->father_data_page_number = 4;
+
+	result = libesedb_table_definition_initialize(
+	          &table_definition,
+	          table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table definition now manages the table catalog definition
+	 */
+	table_catalog_definition = NULL;
+
+	result = libesedb_catalog_definition_initialize(
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	column_catalog_definition->type        = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+	column_catalog_definition->identifier  = 1;
+	column_catalog_definition->column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED;
+	column_catalog_definition->size        = 4;
+
+	result = libesedb_table_definition_append_column_catalog_definition(
+	          table_definition,
+	          column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table definition now manages the column catalog definition
+	 */
+	column_catalog_definition = NULL;
+
+	result = libesedb_page_tree_initialize(
+	          &index_page_tree,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          0,
+	          table_definition,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 &index_catalog_definition,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) );
+
+	memory_set(
+	 &internal_index,
+	 0,
+	 sizeof( libesedb_internal_index_t ) );
+
+	index_catalog_definition.father_data_page_number = 1;
+
+	internal_index.file_io_handle           = file_io_handle;
+	internal_index.io_handle                = io_handle;
+	internal_index.table_definition         = table_definition;
+	internal_index.index_catalog_definition = &index_catalog_definition;
+	internal_index.pages_vector             = pages_vector;
+	internal_index.pages_cache              = pages_cache;
+	internal_index.index_page_tree          = index_page_tree;
+
+	result = libesedb_page_tree_initialize(
+	          &table_page_tree,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          0,
+	          table_definition,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_btree_initialize(
+	          &table_values_tree,
+	          (intptr_t *) table_page_tree,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_btree_node_t *, int, off64_t, size64_t, uint32_t, intptr_t *, uint8_t, libcerror_error_t **)) &libesedb_page_tree_read_node,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_btree_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, intptr_t *, uint8_t, libcerror_error_t **)) &libesedb_page_tree_read_leaf_value,
+	          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_initialize(
+	          &table_values_cache,
+	          LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_VALUES,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_index.table_values_tree  = table_values_tree;
+	internal_index.table_values_cache = table_values_cache;
+
+	/* Test that the index values resolve to the records with the same key
+	 */
+	result = libfdata_btree_set_root_node(
+	          table_values_tree,
+	          0,
+	          3 * 4096,
+	          0,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( record_entry = 0;
+	     record_entry < 6;
+	     record_entry++ )
+	{
+		result = libesedb_index_get_record(
+		          (libesedb_index_t *) &internal_index,
+		          record_entry,
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_record_get_value_32bit(
+		          record,
+		          0,
+		          &record_number,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "record_number",
+		 record_number,
+		 expected_record_numbers[ record_entry ] );
+
+		result = libesedb_record_free(
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	/* Test that the index values resolve to the records with a key of which the second byte
+	 * only differs in the high bit
+	 */
+	result = libfdata_btree_set_root_node(
+	          table_values_tree,
+	          0,
+	          4 * 4096,
+	          0,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( record_entry = 0;
+	     record_entry < 6;
+	     record_entry++ )
+	{
+		result = libesedb_index_get_record(
+		          (libesedb_index_t *) &internal_index,
+		          record_entry,
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_record_get_value_32bit(
+		          record,
+		          0,
+		          &record_number,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "record_number",
+		 record_number,
+		 expected_record_numbers[ record_entry ] );
+
+		result = libesedb_record_free(
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	/* Test error cases
+	 */
+	result = libesedb_index_get_record(
+	          NULL,
+	          0,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	result = libesedb_index_get_record(
+	          (libesedb_index_t *) &internal_index,
+	          6,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	result = libesedb_index_get_record(
+	          (libesedb_index_t *) &internal_index,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &table_values_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_btree_free(
+	          &table_values_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_free(
+	          &table_page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_free(
+	          &index_page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_index_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( table_values_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &table_values_cache,
+		 NULL );
+	}
+	if( table_values_tree != NULL )
+	{
+		libfdata_btree_free(
+		 &table_values_tree,
+		 NULL );
+	}
+	if( table_page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &table_page_tree,
+		 NULL );
+	}
+	if( index_page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &index_page_tree,
+		 NULL );
+	}
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	esedb_test_index_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_index_get_records function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_get_records(
+     void )
+{
+	libesedb_catalog_definition_t index_catalog_definition;
+	libesedb_internal_index_t internal_index;
+
+	libesedb_record_t *records[ 2 ]                          = { NULL, NULL };
+	uint32_t expected_record_numbers[ 6 ]                    = { 6, 5, 1, 4, 2, 3 };
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition  = NULL;
+	libesedb_io_handle_t *io_handle                          = NULL;
+	libesedb_page_tree_t *index_page_tree                    = NULL;
+	libesedb_table_definition_t *table_definition            = NULL;
+	libfcache_cache_t *pages_cache                           = NULL;
+	libfdata_vector_t *pages_vector                          = NULL;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_index_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition->type                    = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+	table_catalog_definition->father_data_page_number = 4;
+
+	result = libesedb_table_definition_initialize(
+	          &table_definition,
+	          table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table definition now manages the table catalog definition
+	 */
+	table_catalog_definition = NULL;
+
+	result = libesedb_catalog_definition_initialize(
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	column_catalog_definition->type        = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+	column_catalog_definition->identifier  = 1;
+	column_catalog_definition->column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED;
+	column_catalog_definition->size        = 4;
+
+	result = libesedb_table_definition_append_column_catalog_definition(
+	          table_definition,
+	          column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table definition now manages the column catalog definition
+	 */
+	column_catalog_definition = NULL;
+
+	result = libesedb_page_tree_initialize(
+	          &index_page_tree,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          0,
+	          table_definition,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 &index_catalog_definition,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) );
+
+	memory_set(
+	 &internal_index,
+	 0,
+	 sizeof( libesedb_internal_index_t ) );
+
+	index_catalog_definition.father_data_page_number = 1;
+
+	internal_index.file_io_handle           = file_io_handle;
+	internal_index.io_handle                = io_handle;
+	internal_index.table_definition         = table_definition;
+	internal_index.index_catalog_definition = &index_catalog_definition;
+	internal_index.pages_vector             = pages_vector;
+	internal_index.pages_cache              = pages_cache;
+	internal_index.index_page_tree          = index_page_tree;
+
+	/* Test that the records of all the index values are returned in index order
+	 * while the record keys are not sorted in index order
+	 */
+	result = esedb_test_index_get_records_with_entries(
+	          (libesedb_index_t *) &internal_index,
+	          0,
+	          6,
+	          expected_record_numbers );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a batch that crosses the boundary of the index leaf pages
+	 */
+	result = esedb_test_index_get_records_with_entries(
+	          (libesedb_index_t *) &internal_index,
+	          2,
+	          2,
+	          &( expected_record_numbers[ 2 ] ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a batch that ends at the last index value
+	 */
+	result = esedb_test_index_get_records_with_entries(
+	          (libesedb_index_t *) &internal_index,
+	          3,
+	          3,
+	          &( expected_record_numbers[ 3 ] ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_index_get_records_with_entries(
+	          (libesedb_index_t *) &internal_index,
+	          5,
+	          1,
+	          &( expected_record_numbers[ 5 ] ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a batch that extends beyond the last index value
+	 */
+	result = libesedb_index_get_records(
+	          (libesedb_index_t *) &internal_index,
+	          5,
+	          records,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "records[ 0 ]",
+	 records[ 0 ] );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "records[ 1 ]",
+	 records[ 1 ] );
+
+	result = libesedb_index_get_records(
+	          (libesedb_index_t *) &internal_index,
+	          6,
+	          records,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "records[ 0 ]",
+	 records[ 0 ] );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_get_records(
+	          NULL,
+	          0,
+	          records,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_records(
+	          (libesedb_index_t *) &internal_index,
+	          -1,
+	          records,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_records(
+	          (libesedb_index_t *) &internal_index,
+	          0,
+	          NULL,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_records(
+	          (libesedb_index_t *) &internal_index,
+	          0,
+	          records,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_free(
+	          &index_page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_index_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &index_page_tree,
+		 NULL );
+	}
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	esedb_test_index_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Seeks an index value in the index test data and checks the index value that was sought
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_seek_with_key(
+     libesedb_index_t *index,
+     uint8_t *key_data,
+     size_t key_size,
+     int comparison_operator,
+     int expected_result,
+     uint32_t expected_page_number,
+     uint16_t expected_page_value_index )
+{
+	libcerror_error_t *error                                = NULL;
+	libesedb_index_cursor_t *index_cursor                   = NULL;
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	int result                                              = 0;
+
+	result = libesedb_index_seek(
+	          index,
+	          key_data,
+	          key_size,
+	          comparison_operator,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( expected_result == 0 )
+	{
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "index_cursor",
+		 index_cursor );
+
+		return( 1 );
+	}
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	/* The index cursor is positioned before the index value that was sought
+	 */
+	internal_index_cursor = (libesedb_internal_index_cursor_t *) index_cursor;
+
+	result = libesedb_page_tree_cursor_get_next_leaf_value(
+	          internal_index_cursor->page_tree_cursor,
+	          internal_index_cursor->internal_index->file_io_handle,
+	          internal_index_cursor->data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "data_definition->page_number",
+	 internal_index_cursor->data_definition->page_number,
+	 expected_page_number );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "data_definition->page_value_index",
+	 internal_index_cursor->data_definition->page_value_index,
+	 expected_page_value_index );
+
+	result = libesedb_index_cursor_close(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_cursor != NULL )
+	{
+		libesedb_index_cursor_close(
+		 &index_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_seek function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_seek(
+     void )
+{
+	libesedb_catalog_definition_t index_catalog_definition;
+	libesedb_internal_index_t internal_index;
+
+	uint8_t key_data_between[ 2 ]         = { 0x10, 0x10 };
+	uint8_t key_data_exact[ 2 ]           = { 0x10, 0x05 };
+	uint8_t key_data_high_bit[ 2 ]        = { 0x20, 0x80 };
+	uint8_t key_data_last[ 2 ]            = { 0x20, 0x00 };
+	uint8_t key_data_past_end[ 1 ]        = { 0x30 };
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libesedb_index_cursor_t *index_cursor = NULL;
+	libesedb_io_handle_t *io_handle       = NULL;
+	libfcache_cache_t *pages_cache        = NULL;
+	libfdata_vector_t *pages_vector       = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_index_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 &index_catalog_definition,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) );
+
+	memory_set(
+	 &internal_index,
+	 0,
+	 sizeof( libesedb_internal_index_t ) );
+
+	index_catalog_definition.father_data_page_number = 1;
+
+	internal_index.file_io_handle           = file_io_handle;
+	internal_index.io_handle                = io_handle;
+	internal_index.index_catalog_definition = &index_catalog_definition;
+	internal_index.pages_vector             = pages_vector;
+	internal_index.pages_cache              = pages_cache;
+
+	/* Test an exact match
+	 */
+	result = esedb_test_index_seek_with_key(
+	          (libesedb_index_t *) &internal_index,
+	          key_data_exact,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          1,
+	          2,
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_index_seek_with_key(
+	          (libesedb_index_t *) &internal_index,
+	          key_data_last,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          1,
+	          3,
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a key between 2 index values
+	 */
+	result = esedb_test_index_seek_with_key(
+	          (libesedb_index_t *) &internal_index,
+	          key_data_between,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          0,
+	          0,
+	          0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_index_seek_with_key(
+	          (libesedb_index_t *) &internal_index,
+	          key_data_between,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL,
+	          1,
+	          2,
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a key past the last index value
+	 */
+	result = esedb_test_index_seek_with_key(
+	          (libesedb_index_t *) &internal_index,
+	          key_data_past_end,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          0,
+	          0,
+	          0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_index_seek_with_key(
+	          (libesedb_index_t *) &internal_index,
+	          key_data_past_end,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL,
+	          0,
+	          0,
+	          0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_index_seek_with_key(
+	          (libesedb_index_t *) &internal_index,
+	          key_data_past_end,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL,
+	          1,
+	          3,
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a key that only differs from an index value in the high bit of a byte
+	 */
+	result = esedb_test_index_seek_with_key(
+	          (libesedb_index_t *) &internal_index,
+	          key_data_high_bit,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          0,
+	          0,
+	          0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_index_seek_with_key(
+	          (libesedb_index_t *) &internal_index,
+	          key_data_high_bit,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL,
+	          1,
+	          3,
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_seek(
+	          NULL,
+	          key_data_exact,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_seek(
+	          (libesedb_index_t *) &internal_index,
+	          key_data_exact,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_index_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_test_index_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Scans a range of index values in the index test data and checks the index values in the range
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_scan_range_with_keys(
+     libesedb_index_t *index,
+     uint8_t *start_key_data,
+     size_t start_key_size,
+     int start_comparison_operator,
+     uint8_t *end_key_data,
+     size_t end_key_size,
+     int end_comparison_operator,
+     int expected_result,
+     const uint32_t *expected_page_numbers,
+     const uint16_t *expected_page_value_indexes,
+     int expected_number_of_values )
+{
+	libcerror_error_t *error                                = NULL;
+	libesedb_index_cursor_t *index_cursor                   = NULL;
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	int number_of_values                                    = 0;
+	int result                                              = 0;
+
+	result = libesedb_index_scan_range(
+	          index,
+	          start_key_data,
+	          start_key_size,
+	          start_comparison_operator,
+	          end_key_data,
+	          end_key_size,
+	          end_comparison_operator,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( expected_result == 0 )
+	{
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "index_cursor",
+		 index_cursor );
+
+		return( 1 );
+	}
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	internal_index_cursor = (libesedb_internal_index_cursor_t *) index_cursor;
+
+	/* The index cursor is positioned before the first index value of the range
+	 */
+	do
+	{
+		result = libesedb_page_tree_cursor_get_next_leaf_value(
+		          internal_index_cursor->page_tree_cursor,
+		          internal_index_cursor->internal_index->file_io_handle,
+		          internal_index_cursor->data_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 0 )
+		{
+			break;
+		}
+		result = libesedb_index_cursor_is_within_range(
+		          internal_index_cursor,
+		          &error );
+
+		ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 0 )
+		{
+			break;
+		}
+		ESEDB_TEST_ASSERT_LESS_THAN_INT(
+		 "number_of_values",
+		 number_of_values,
+		 expected_number_of_values );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "data_definition->page_number",
+		 internal_index_cursor->data_definition->page_number,
+		 expected_page_numbers[ number_of_values ] );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT16(
+		 "data_definition->page_value_index",
+		 internal_index_cursor->data_definition->page_value_index,
+		 expected_page_value_indexes[ number_of_values ] );
+
+		number_of_values++;
+	}
+	while( result == 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 expected_number_of_values );
+
+	result = libesedb_index_cursor_close(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_cursor != NULL )
+	{
+		libesedb_index_cursor_close(
+		 &index_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_scan_range function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_scan_range(
+     void )
+{
+	libesedb_catalog_definition_t index_catalog_definition;
+	libesedb_internal_index_t internal_index;
+
+	uint32_t expected_page_numbers1[ 3 ]       = { 2, 2, 3 };
+	uint32_t expected_page_numbers2[ 1 ]       = { 2 };
+	uint32_t expected_page_numbers3[ 2 ]       = { 3, 3 };
+	uint32_t expected_page_numbers4[ 6 ]       = { 2, 2, 2, 3, 3, 3 };
+	uint16_t expected_page_value_indexes1[ 3 ] = { 2, 3, 1 };
+	uint16_t expected_page_value_indexes2[ 1 ] = { 1 };
+	uint16_t expected_page_value_indexes3[ 2 ] = { 2, 3 };
+	uint16_t expected_page_value_indexes4[ 6 ] = { 1, 2, 3, 1, 2, 3 };
+	uint8_t key_data1[ 2 ]                     = { 0x10, 0x01 };
+	uint8_t key_data2[ 2 ]                     = { 0x10, 0x05 };
+	uint8_t key_data3[ 2 ]                     = { 0x10, 0x20 };
+	uint8_t key_data4[ 2 ]                     = { 0x10, 0x81 };
+	uint8_t key_data5[ 2 ]                     = { 0x10, 0x90 };
+	uint8_t key_data6[ 2 ]                     = { 0x20, 0x00 };
+	uint8_t key_data_past_end[ 1 ]             = { 0x30 };
+	libbfio_handle_t *file_io_handle           = NULL;
+	libcerror_error_t *error                   = NULL;
+	libesedb_index_cursor_t *index_cursor      = NULL;
+	libesedb_io_handle_t *io_handle            = NULL;
+	libfcache_cache_t *pages_cache             = NULL;
+	libfdata_vector_t *pages_vector            = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_index_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 &index_catalog_definition,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) );
+
+	memory_set(
+	 &internal_index,
+	 0,
+	 sizeof( libesedb_internal_index_t ) );
+
+	index_catalog_definition.father_data_page_number = 1;
+
+	internal_index.file_io_handle           = file_io_handle;
+	internal_index.io_handle                = io_handle;
+	internal_index.index_catalog_definition = &index_catalog_definition;
+	internal_index.pages_vector             = pages_vector;
+	internal_index.pages_cache              = pages_cache;
+
+	/* Test a range with inclusive bounds that crosses leaf pages
+	 */
+	result = esedb_test_index_scan_range_with_keys(
+	          (libesedb_index_t *) &internal_index,
+	          key_data2,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL,
+	          key_data4,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL,
+	          1,
+	          expected_page_numbers1,
+	          expected_page_value_indexes1,
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a range with exclusive bounds
+	 */
+	result = esedb_test_index_scan_range_with_keys(
+	          (libesedb_index_t *) &internal_index,
+	          key_data1,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER,
+	          key_data4,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS,
+	          1,
+	          &( expected_page_numbers4[ 1 ] ),
+	          &( expected_page_value_indexes4[ 1 ] ),
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a range without a start key
+	 */
+	result = esedb_test_index_scan_range_with_keys(
+	          (libesedb_index_t *) &internal_index,
+	          NULL,
+	          0,
+	          0,
+	          key_data2,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS,
+	          1,
+	          expected_page_numbers2,
+	          expected_page_value_indexes2,
+	          1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a range without an end key
+	 */
+	result = esedb_test_index_scan_range_with_keys(
+	          (libesedb_index_t *) &internal_index,
+	          key_data5,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL,
+	          NULL,
+	          0,
+	          0,
+	          1,
+	          expected_page_numbers3,
+	          expected_page_value_indexes3,
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a range without bounds
+	 */
+	result = esedb_test_index_scan_range_with_keys(
+	          (libesedb_index_t *) &internal_index,
+	          NULL,
+	          0,
+	          0,
+	          NULL,
+	          0,
+	          0,
+	          1,
+	          expected_page_numbers4,
+	          expected_page_value_indexes4,
+	          6 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test an empty range between 2 adjacent index values
+	 */
+	result = esedb_test_index_scan_range_with_keys(
+	          (libesedb_index_t *) &internal_index,
+	          key_data2,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER,
+	          key_data3,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS,
+	          0,
+	          NULL,
+	          NULL,
+	          0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test an empty range where the start key is after the end key
+	 */
+	result = esedb_test_index_scan_range_with_keys(
+	          (libesedb_index_t *) &internal_index,
+	          key_data6,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL,
+	          key_data1,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL,
+	          0,
+	          NULL,
+	          NULL,
+	          0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test an empty range past the last index value
+	 */
+	result = esedb_test_index_scan_range_with_keys(
+	          (libesedb_index_t *) &internal_index,
+	          key_data_past_end,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL,
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          NULL,
+	          NULL,
+	          0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_scan_range(
+	          NULL,
+	          key_data1,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL,
+	          key_data6,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_scan_range(
+	          (libesedb_index_t *) &internal_index,
+	          key_data1,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS,
+	          key_data6,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_scan_range(
+	          (libesedb_index_t *) &internal_index,
+	          key_data1,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL,
+	          key_data6,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_index_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_test_index_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 NULL );
+
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -116,7 +2364,23 @@ int main(
 
 	/* TODO: add tests for libesedb_index_get_number_of_records */
 
-	/* TODO: add tests for libesedb_index_get_record */
+	ESEDB_TEST_RUN(
+	 "libesedb_index_get_record",
+	 esedb_test_index_get_record );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_get_records",
+	 esedb_test_index_get_records );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_seek",
+	 esedb_test_index_seek );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_scan_range",
+	 esedb_test_index_scan_range );
+
+	/* TODO: add tests for libesedb_index_get_record_by_index_value */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
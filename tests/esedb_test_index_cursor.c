@@ -0,0 +1,372 @@
+/*
+ * Library index_cursor type test program
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_index_cursor.h"
+
+/* Tests the libesedb_index_cursor_close function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_index_cursor_close(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_cursor_open function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_open(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_index_cursor_open(
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_cursor_next function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_next(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_index_cursor_next(
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_cursor_previous function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_previous(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_index_cursor_previous(
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_index_cursor_seek function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_seek(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_index_cursor_seek(
+	          NULL,
+	          NULL,
+	          0,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_cursor_set_range function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_set_range(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_index_cursor_set_range(
+	          NULL,
+	          NULL,
+	          0,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL,
+	          NULL,
+	          0,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_cursor_is_within_range function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_is_within_range(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_index_cursor_is_within_range(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_cursor_close",
+	 esedb_test_index_cursor_close );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_cursor_open",
+	 esedb_test_index_cursor_open );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_cursor_next",
+	 esedb_test_index_cursor_next );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_cursor_previous",
+	 esedb_test_index_cursor_previous );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_cursor_seek",
+	 esedb_test_index_cursor_seek );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_cursor_set_range",
+	 esedb_test_index_cursor_set_range );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_cursor_is_within_range",
+	 esedb_test_index_cursor_is_within_range );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -34,6 +34,7 @@
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_definitions.h"
 #include "../libesedb/libesedb_key.h"
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
@@ -429,6 +430,275 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_key_compare function with an index value and a seek value key
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_compare_index_value(
+     void )
+{
+	uint8_t high_bit_key_data[ 3 ] = { 0x7f, 0x81, 0x02 };
+	uint8_t low_bit_key_data[ 3 ]  = { 0x7f, 0x01, 0x02 };
+	uint8_t longer_key_data[ 4 ]   = { 0x7f, 0x81, 0x02, 0x03 };
+	uint8_t greater_key_data[ 2 ]  = { 0x7f, 0x90 };
+
+	libcerror_error_t *error   = NULL;
+	libesedb_key_t *first_key  = NULL;
+	libesedb_key_t *second_key = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_key_initialize(
+	          &first_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "first_key",
+	 first_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	first_key->type      = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+	first_key->data      = high_bit_key_data;
+	first_key->data_size = 3;
+
+	result = libesedb_key_initialize(
+	          &second_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "second_key",
+	 second_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an exact match with a leaf key
+	 */
+	second_key->type      = LIBESEDB_KEY_TYPE_LEAF;
+	second_key->data      = high_bit_key_data;
+	second_key->data_size = 3;
+
+	result = libesedb_key_compare(
+	          first_key,
+	          second_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_EQUAL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a leaf key that only differs in the high bit of the second byte,
+	 * which matches an index value key
+	 */
+	second_key->data      = low_bit_key_data;
+	second_key->data_size = 3;
+
+	result = libesedb_key_compare(
+	          first_key,
+	          second_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_EQUAL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a leaf key that only differs in the high bit of the second byte,
+	 * which does not match a seek value key
+	 */
+	first_key->type = LIBESEDB_KEY_TYPE_SEEK_VALUE;
+
+	result = libesedb_key_compare(
+	          first_key,
+	          second_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_GREATER );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	first_key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
+	/* Test a leaf key of which the index value key is a prefix
+	 */
+	second_key->data      = longer_key_data;
+	second_key->data_size = 4;
+
+	result = libesedb_key_compare(
+	          first_key,
+	          second_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_LESS );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an exact match with a branch key, the leaf value is in the next branch node
+	 */
+	second_key->type      = LIBESEDB_KEY_TYPE_BRANCH;
+	second_key->data      = high_bit_key_data;
+	second_key->data_size = 3;
+
+	result = libesedb_key_compare(
+	          first_key,
+	          second_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_GREATER );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a branch key that is greater than the index value key
+	 */
+	second_key->data      = greater_key_data;
+	second_key->data_size = 2;
+
+	result = libesedb_key_compare(
+	          first_key,
+	          second_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_EQUAL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an index value key that only differs in the high bit of the second byte
+	 */
+	second_key->type      = LIBESEDB_KEY_TYPE_LEAF;
+	second_key->data      = high_bit_key_data;
+	second_key->data_size = 3;
+
+	first_key->data      = low_bit_key_data;
+	first_key->data_size = 3;
+
+	result = libesedb_key_compare(
+	          first_key,
+	          second_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_LESS );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	second_key->data      = NULL;
+	second_key->data_size = 0;
+
+	result = libesedb_key_free(
+	          &second_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "second_key",
+	 second_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	first_key->data      = NULL;
+	first_key->data_size = 0;
+
+	result = libesedb_key_free(
+	          &first_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "first_key",
+	 first_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_key != NULL )
+	{
+		second_key->data      = NULL;
+		second_key->data_size = 0;
+
+		libesedb_key_free(
+		 &second_key,
+		 NULL );
+	}
+	if( first_key != NULL )
+	{
+		first_key->data      = NULL;
+		first_key->data_size = 0;
+
+		libesedb_key_free(
+		 &first_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -468,6 +738,10 @@ int main(
 
 #endif
 
+	ESEDB_TEST_RUN(
+	 "libesedb_key_compare_index_value",
+	 esedb_test_key_compare_index_value );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,1931 @@
+/*
+ * Library key_builder type test program
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_key_builder.h"
+
+/* Tests the libesedb_key_builder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_builder_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_key_builder_initialize(
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_key_builder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_builder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_key_builder_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_key_builder_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_builder_clear(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_key_builder_clear(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_key_builder_get_number_of_segments function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_builder_get_number_of_segments(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_key_builder_get_number_of_segments(
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_key_builder_get_key_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_builder_get_key_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_key_builder_get_key_size(
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_key_builder_get_key function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_builder_get_key(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_key_builder_get_key(
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_key_builder_append_integer_32bit function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_builder_append_integer_32bit(
+     void )
+{
+	uint8_t expected_key_data[ 10 ] = {
+		0x7f, 0x7f, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xfe };
+
+	uint8_t key_data[ 16 ];
+	uint8_t segment_flags[ 2 ] = {
+		0, LIBESEDB_KEY_SEGMENT_FLAG_DESCENDING };
+
+	libesedb_catalog_definition_t column_catalog_definition;
+	libesedb_internal_key_builder_t internal_key_builder;
+
+	libesedb_catalog_definition_t *segment_column_catalog_definitions[ 2 ] = {
+		&column_catalog_definition, &column_catalog_definition };
+
+	libcerror_error_t *error = NULL;
+	size_t key_size          = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &column_catalog_definition,
+	          0,
+	          sizeof( libesedb_catalog_definition_t ) ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          &internal_key_builder,
+	          0,
+	          sizeof( libesedb_internal_key_builder_t ) ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	column_catalog_definition.column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED;
+
+	internal_key_builder.number_of_segments                  = 2;
+	internal_key_builder.segment_column_catalog_definitions = segment_column_catalog_definitions;
+	internal_key_builder.segment_flags                       = segment_flags;
+
+	/* Test regular cases
+	 * -1 in an ascending segment followed by 1 in a descending segment
+	 */
+	result = libesedb_key_builder_append_integer_32bit(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          (uint32_t) -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_append_integer_32bit(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_get_key_size(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          &key_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key_size",
+	 key_size,
+	 (size_t) 10 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_get_key(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          key_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key_data,
+	          expected_key_data,
+	          10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_key_builder_append_integer_32bit(
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test append beyond the last key segment
+	 */
+	result = libesedb_key_builder_append_integer_32bit(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test append to a key segment of an unsupported column type
+	 */
+	internal_key_builder.segment_index = 0;
+
+	column_catalog_definition.column_type = LIBESEDB_COLUMN_TYPE_GUID;
+
+	result = libesedb_key_builder_append_integer_32bit(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 internal_key_builder.key_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_key_builder.key_data != NULL )
+	{
+		memory_free(
+		 internal_key_builder.key_data );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_key_builder_append_filetime function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_builder_append_filetime(
+     void )
+{
+	uint8_t expected_key_data[ 9 ] = {
+		0x7f, 0x81, 0xd0, 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc };
+
+	uint8_t expected_negative_date_time_key_data[ 9 ] = {
+		0x7f, 0x40, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+	uint8_t expected_positive_date_time_key_data[ 9 ] = {
+		0x7f, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	uint8_t key_data[ 16 ];
+	uint8_t segment_flags[ 1 ] = {
+		0 };
+
+	libesedb_catalog_definition_t column_catalog_definition;
+	libesedb_internal_key_builder_t internal_key_builder;
+
+	libesedb_catalog_definition_t *segment_column_catalog_definitions[ 1 ] = {
+		&column_catalog_definition };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &column_catalog_definition,
+	          0,
+	          sizeof( libesedb_catalog_definition_t ) ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          &internal_key_builder,
+	          0,
+	          sizeof( libesedb_internal_key_builder_t ) ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	column_catalog_definition.column_type = LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED;
+
+	internal_key_builder.number_of_segments                  = 1;
+	internal_key_builder.segment_column_catalog_definitions = segment_column_catalog_definitions;
+	internal_key_builder.segment_flags                       = segment_flags;
+
+	/* Test regular cases
+	 */
+	result = libesedb_key_builder_append_filetime(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          0x01d0123456789abcULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_get_key(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          key_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key_data,
+	          expected_key_data,
+	          9 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a date and time column where the bits of a negative floating-point value
+	 * are inverted and the sign bit of a positive floating-point value is set
+	 */
+	column_catalog_definition.column_type = LIBESEDB_COLUMN_TYPE_DATE_TIME;
+
+	result = libesedb_key_builder_clear(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_append_filetime(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          0xbff0000000000000ULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_get_key(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          key_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key_data,
+	          expected_negative_date_time_key_data,
+	          9 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_key_builder_clear(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_append_filetime(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          0x3ff0000000000000ULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_get_key(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          key_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key_data,
+	          expected_positive_date_time_key_data,
+	          9 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_key_builder_append_filetime(
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 internal_key_builder.key_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_key_builder.key_data != NULL )
+	{
+		memory_free(
+		 internal_key_builder.key_data );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_key_builder_append_guid function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_builder_append_guid(
+     void )
+{
+	uint8_t expected_key_data[ 17 ] = {
+		0x7f, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x08, 0x09, 0x06, 0x07, 0x04, 0x05, 0x00, 0x01, 0x02,
+		0x03 };
+
+	uint8_t guid_data[ 16 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+	uint8_t key_data[ 32 ];
+	uint8_t segment_flags[ 1 ] = {
+		0 };
+
+	libesedb_catalog_definition_t column_catalog_definition;
+	libesedb_internal_key_builder_t internal_key_builder;
+
+	libesedb_catalog_definition_t *segment_column_catalog_definitions[ 1 ] = {
+		&column_catalog_definition };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &column_catalog_definition,
+	          0,
+	          sizeof( libesedb_catalog_definition_t ) ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          &internal_key_builder,
+	          0,
+	          sizeof( libesedb_internal_key_builder_t ) ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	column_catalog_definition.column_type = LIBESEDB_COLUMN_TYPE_GUID;
+
+	internal_key_builder.number_of_segments                  = 1;
+	internal_key_builder.segment_column_catalog_definitions = segment_column_catalog_definitions;
+	internal_key_builder.segment_flags                       = segment_flags;
+
+	/* Test regular cases
+	 */
+	result = libesedb_key_builder_append_guid(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          guid_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_get_key(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          key_data,
+	          32,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key_data,
+	          expected_key_data,
+	          17 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	internal_key_builder.segment_index = 0;
+
+	result = libesedb_key_builder_append_guid(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          guid_data,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 internal_key_builder.key_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_key_builder.key_data != NULL )
+	{
+		memory_free(
+		 internal_key_builder.key_data );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_key_builder_append_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_builder_append_utf8_string(
+     void )
+{
+	uint8_t expected_key_data[ 5 ] = {
+		0x7f, 'K', 'E', 'Y', '1' };
+
+	uint8_t key_data[ 16 ];
+	uint8_t segment_flags[ 1 ] = {
+		0 };
+
+	libesedb_catalog_definition_t column_catalog_definition;
+	libesedb_internal_key_builder_t internal_key_builder;
+
+	libesedb_catalog_definition_t *segment_column_catalog_definitions[ 1 ] = {
+		&column_catalog_definition };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &column_catalog_definition,
+	          0,
+	          sizeof( libesedb_catalog_definition_t ) ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          &internal_key_builder,
+	          0,
+	          sizeof( libesedb_internal_key_builder_t ) ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	column_catalog_definition.column_type = LIBESEDB_COLUMN_TYPE_TEXT;
+	column_catalog_definition.codepage    = 1252;
+
+	internal_key_builder.ascii_codepage                      = 1252;
+	internal_key_builder.number_of_segments                  = 1;
+	internal_key_builder.segment_column_catalog_definitions = segment_column_catalog_definitions;
+	internal_key_builder.segment_flags                       = segment_flags;
+
+	/* Test regular cases
+	 */
+	result = libesedb_key_builder_append_utf8_string(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          (uint8_t *) "Key1",
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_get_key(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          key_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key_data,
+	          expected_key_data,
+	          5 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_key_builder_append_utf8_string(
+	          NULL,
+	          (uint8_t *) "Key1",
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test append to a key segment of an Unicode text column
+	 */
+	internal_key_builder.segment_index = 0;
+
+	column_catalog_definition.codepage = 1200;
+
+	result = libesedb_key_builder_append_utf8_string(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          (uint8_t *) "Key1",
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 internal_key_builder.key_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_key_builder.key_data != NULL )
+	{
+		memory_free(
+		 internal_key_builder.key_data );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_key_builder_append_null function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_builder_append_null(
+     void )
+{
+	uint8_t expected_key_data[ 2 ] = {
+		0x00, 0xff };
+
+	uint8_t key_data[ 16 ];
+	uint8_t segment_flags[ 2 ] = {
+		0, LIBESEDB_KEY_SEGMENT_FLAG_DESCENDING };
+
+	libesedb_catalog_definition_t column_catalog_definition;
+	libesedb_internal_key_builder_t internal_key_builder;
+
+	libesedb_catalog_definition_t *segment_column_catalog_definitions[ 2 ] = {
+		&column_catalog_definition, &column_catalog_definition };
+
+	libcerror_error_t *error = NULL;
+	size_t key_size          = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &column_catalog_definition,
+	          0,
+	          sizeof( libesedb_catalog_definition_t ) ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          &internal_key_builder,
+	          0,
+	          sizeof( libesedb_internal_key_builder_t ) ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	column_catalog_definition.column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED;
+
+	internal_key_builder.number_of_segments                  = 2;
+	internal_key_builder.segment_column_catalog_definitions = segment_column_catalog_definitions;
+	internal_key_builder.segment_flags                       = segment_flags;
+
+	/* Test regular cases
+	 * NULL in an ascending segment followed by NULL in a descending segment
+	 */
+	result = libesedb_key_builder_append_null(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_append_null(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_get_key_size(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          &key_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key_size",
+	 key_size,
+	 (size_t) 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_get_key(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          key_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key_data,
+	          expected_key_data,
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_key_builder_append_null(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test append beyond the last key segment
+	 */
+	result = libesedb_key_builder_append_null(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 internal_key_builder.key_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_key_builder.key_data != NULL )
+	{
+		memory_free(
+		 internal_key_builder.key_data );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_key_builder_append_boolean function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_builder_append_boolean(
+     void )
+{
+	uint8_t expected_key_data[ 4 ] = {
+		0x7f, 0xff, 0x80, 0xff };
+
+	uint8_t key_data[ 16 ];
+	uint8_t segment_flags[ 2 ] = {
+		0, LIBESEDB_KEY_SEGMENT_FLAG_DESCENDING };
+
+	libesedb_catalog_definition_t column_catalog_definition;
+	libesedb_internal_key_builder_t internal_key_builder;
+
+	libesedb_catalog_definition_t *segment_column_catalog_definitions[ 2 ] = {
+		&column_catalog_definition, &column_catalog_definition };
+
+	libcerror_error_t *error = NULL;
+	size_t key_size          = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &column_catalog_definition,
+	          0,
+	          sizeof( libesedb_catalog_definition_t ) ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          &internal_key_builder,
+	          0,
+	          sizeof( libesedb_internal_key_builder_t ) ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	column_catalog_definition.column_type = LIBESEDB_COLUMN_TYPE_BOOLEAN;
+
+	internal_key_builder.number_of_segments                  = 2;
+	internal_key_builder.segment_column_catalog_definitions = segment_column_catalog_definitions;
+	internal_key_builder.segment_flags                       = segment_flags;
+
+	/* Test regular cases
+	 * true in an ascending segment followed by false in a descending segment
+	 */
+	result = libesedb_key_builder_append_boolean(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_append_boolean(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_get_key_size(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          &key_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key_size",
+	 key_size,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_get_key(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          key_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key_data,
+	          expected_key_data,
+	          4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_key_builder_append_boolean(
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test append beyond the last key segment
+	 */
+	result = libesedb_key_builder_append_boolean(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test append to a key segment of an unsupported column type
+	 */
+	internal_key_builder.segment_index = 0;
+
+	column_catalog_definition.column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED;
+
+	result = libesedb_key_builder_append_boolean(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 internal_key_builder.key_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_key_builder.key_data != NULL )
+	{
+		memory_free(
+		 internal_key_builder.key_data );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_key_builder_append_integer_64bit function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_builder_append_integer_64bit(
+     void )
+{
+	uint8_t expected_key_data[ 18 ] = {
+		0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe };
+
+	uint8_t key_data[ 16 ];
+	uint8_t segment_flags[ 2 ] = {
+		0, LIBESEDB_KEY_SEGMENT_FLAG_DESCENDING };
+
+	libesedb_catalog_definition_t column_catalog_definition;
+	libesedb_internal_key_builder_t internal_key_builder;
+
+	libesedb_catalog_definition_t *segment_column_catalog_definitions[ 2 ] = {
+		&column_catalog_definition, &column_catalog_definition };
+
+	libcerror_error_t *error = NULL;
+	size_t key_size          = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &column_catalog_definition,
+	          0,
+	          sizeof( libesedb_catalog_definition_t ) ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          &internal_key_builder,
+	          0,
+	          sizeof( libesedb_internal_key_builder_t ) ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	column_catalog_definition.column_type = LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED;
+
+	internal_key_builder.number_of_segments                  = 2;
+	internal_key_builder.segment_column_catalog_definitions = segment_column_catalog_definitions;
+	internal_key_builder.segment_flags                       = segment_flags;
+
+	/* Test regular cases
+	 * -2 in an ascending segment followed by 1 in a descending segment
+	 */
+	result = libesedb_key_builder_append_integer_64bit(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          (uint64_t) -2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_append_integer_64bit(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_get_key_size(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          &key_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key_size",
+	 key_size,
+	 (size_t) 18 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_get_key(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          key_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key_data,
+	          expected_key_data,
+	          18 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_key_builder_append_integer_64bit(
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test append beyond the last key segment
+	 */
+	result = libesedb_key_builder_append_integer_64bit(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test append to a key segment of an unsupported column type
+	 */
+	internal_key_builder.segment_index = 0;
+
+	column_catalog_definition.column_type = LIBESEDB_COLUMN_TYPE_GUID;
+
+	result = libesedb_key_builder_append_integer_64bit(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 internal_key_builder.key_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_key_builder.key_data != NULL )
+	{
+		memory_free(
+		 internal_key_builder.key_data );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_key_builder_append_normalized_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_builder_append_normalized_data(
+     void )
+{
+	uint8_t expected_key_data[ 5 ] = {
+		0x7f, 0x12, 0x34, 0xbf, 0x40 };
+
+	uint8_t key_data[ 16 ];
+	uint8_t segment_flags[ 3 ] = {
+		0, LIBESEDB_KEY_SEGMENT_FLAG_DESCENDING, 0 };
+	uint8_t normalized_data[ 2 ] = {
+		0x12, 0x34 };
+
+	libesedb_catalog_definition_t column_catalog_definition;
+	libesedb_internal_key_builder_t internal_key_builder;
+
+	libesedb_catalog_definition_t *segment_column_catalog_definitions[ 3 ] = {
+		&column_catalog_definition, &column_catalog_definition, &column_catalog_definition };
+
+	libcerror_error_t *error = NULL;
+	size_t key_size          = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &column_catalog_definition,
+	          0,
+	          sizeof( libesedb_catalog_definition_t ) ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          &internal_key_builder,
+	          0,
+	          sizeof( libesedb_internal_key_builder_t ) ) != NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	column_catalog_definition.column_type = LIBESEDB_COLUMN_TYPE_BINARY_DATA;
+
+	internal_key_builder.number_of_segments                  = 3;
+	internal_key_builder.segment_column_catalog_definitions = segment_column_catalog_definitions;
+	internal_key_builder.segment_flags                       = segment_flags;
+
+	/* Test regular cases
+	 * data in an ascending segment followed by empty data in a descending and an ascending segment
+	 */
+	result = libesedb_key_builder_append_normalized_data(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          normalized_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_append_normalized_data(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          normalized_data,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_append_normalized_data(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          normalized_data,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_get_key_size(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          &key_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key_size",
+	 key_size,
+	 (size_t) 5 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_builder_get_key(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          key_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key_data,
+	          expected_key_data,
+	          5 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_key_builder_append_normalized_data(
+	          NULL,
+	          normalized_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_key_builder_append_normalized_data(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          NULL,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test append beyond the last key segment
+	 */
+	result = libesedb_key_builder_append_normalized_data(
+	          (libesedb_key_builder_t *) &internal_key_builder,
+	          normalized_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 internal_key_builder.key_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_key_builder.key_data != NULL )
+	{
+		memory_free(
+		 internal_key_builder.key_data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_key_builder_initialize",
+	 esedb_test_key_builder_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_key_builder_free",
+	 esedb_test_key_builder_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_key_builder_clear",
+	 esedb_test_key_builder_clear );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_key_builder_get_number_of_segments",
+	 esedb_test_key_builder_get_number_of_segments );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_key_builder_get_key_size",
+	 esedb_test_key_builder_get_key_size );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_key_builder_get_key",
+	 esedb_test_key_builder_get_key );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_key_builder_append_integer_32bit",
+	 esedb_test_key_builder_append_integer_32bit );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_key_builder_append_filetime",
+	 esedb_test_key_builder_append_filetime );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_key_builder_append_guid",
+	 esedb_test_key_builder_append_guid );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_key_builder_append_utf8_string",
+	 esedb_test_key_builder_append_utf8_string );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_key_builder_append_null",
+	 esedb_test_key_builder_append_null );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_key_builder_append_boolean",
+	 esedb_test_key_builder_append_boolean );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_key_builder_append_integer_64bit",
+	 esedb_test_key_builder_append_integer_64bit );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_key_builder_append_normalized_data",
+	 esedb_test_key_builder_append_normalized_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
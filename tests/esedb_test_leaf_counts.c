@@ -0,0 +1,1080 @@
+/*
+ * Library leaf_counts type testing program
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_leaf_counts.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_leaf_counts_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_leaf_counts_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libesedb_leaf_counts_t *leaf_counts = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 1;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test leaf_counts initialization
+	 */
+	result = libesedb_leaf_counts_initialize(
+	          &leaf_counts,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "leaf_counts",
+	 leaf_counts );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_leaf_counts_free(
+	          &leaf_counts,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "leaf_counts",
+	 leaf_counts );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_leaf_counts_initialize(
+	          NULL,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	leaf_counts = (libesedb_leaf_counts_t *) 0x12345678UL;
+
+	result = libesedb_leaf_counts_initialize(
+	          &leaf_counts,
+	          1,
+	          &error );
+
+	leaf_counts = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_leaf_counts_initialize(
+	          &leaf_counts,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_leaf_counts_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_leaf_counts_initialize(
+		          &leaf_counts,
+		          1,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( leaf_counts != NULL )
+			{
+				libesedb_leaf_counts_free(
+				 &leaf_counts,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "leaf_counts",
+			 leaf_counts );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_leaf_counts_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_leaf_counts_initialize(
+		          &leaf_counts,
+		          1,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( leaf_counts != NULL )
+			{
+				libesedb_leaf_counts_free(
+				 &leaf_counts,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "leaf_counts",
+			 leaf_counts );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( leaf_counts != NULL )
+	{
+		libesedb_leaf_counts_free(
+		 &leaf_counts,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_leaf_counts_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_leaf_counts_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_leaf_counts_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_leaf_counts_get_number_of_leaf_values function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_leaf_counts_get_number_of_leaf_values(
+     void )
+{
+	uint32_t child_page_numbers[ 3 ]               = { 6, 7, 8 };
+	libesedb_leaf_counts_t *child_leaf_counts[ 3 ] = { NULL, NULL, NULL };
+	int cumulative_number_of_leaf_values[ 3 ]      = { 2, 2, 5 };
+
+	libcerror_error_t *error                       = NULL;
+	libesedb_leaf_counts_t *leaf_counts            = NULL;
+	int number_of_leaf_values                      = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_leaf_counts_initialize(
+	          &leaf_counts,
+	          5,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "leaf_counts",
+	 leaf_counts );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	leaf_counts->is_leaf_page          = 1;
+	leaf_counts->number_of_leaf_values = 3;
+
+	result = libesedb_leaf_counts_get_number_of_leaf_values(
+	          leaf_counts,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &number_of_leaf_values,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 3 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	leaf_counts->is_leaf_page                     = 0;
+	leaf_counts->number_of_leaf_values            = 0;
+	leaf_counts->number_of_entries                = 3;
+	leaf_counts->number_of_counted_entries        = 3;
+	leaf_counts->child_page_numbers               = child_page_numbers;
+	leaf_counts->child_leaf_counts                = child_leaf_counts;
+	leaf_counts->cumulative_number_of_leaf_values = cumulative_number_of_leaf_values;
+
+	result = libesedb_leaf_counts_get_number_of_leaf_values(
+	          leaf_counts,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &number_of_leaf_values,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 5 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_leaf_counts_get_number_of_leaf_values(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &number_of_leaf_values,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_leaf_counts_get_number_of_leaf_values(
+	          leaf_counts,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	leaf_counts->number_of_entries                = 0;
+	leaf_counts->child_page_numbers               = NULL;
+	leaf_counts->child_leaf_counts                = NULL;
+	leaf_counts->cumulative_number_of_leaf_values = NULL;
+
+	result = libesedb_leaf_counts_free(
+	          &leaf_counts,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "leaf_counts",
+	 leaf_counts );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( leaf_counts != NULL )
+	{
+		leaf_counts->number_of_entries                = 0;
+		leaf_counts->child_page_numbers               = NULL;
+		leaf_counts->child_leaf_counts                = NULL;
+		leaf_counts->cumulative_number_of_leaf_values = NULL;
+
+		libesedb_leaf_counts_free(
+		 &leaf_counts,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_leaf_counts_get_entry_by_leaf_value_index function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_leaf_counts_get_entry_by_leaf_value_index(
+     void )
+{
+	uint32_t child_page_numbers[ 3 ]               = { 6, 7, 8 };
+	libesedb_leaf_counts_t *child_leaf_counts[ 3 ] = { NULL, NULL, NULL };
+	int cumulative_number_of_leaf_values[ 3 ]      = { 2, 2, 5 };
+
+	libcerror_error_t *error                       = NULL;
+	libesedb_leaf_counts_t *leaf_counts            = NULL;
+	int entry_index                                = 0;
+	int entry_leaf_value_index                     = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_leaf_counts_initialize(
+	          &leaf_counts,
+	          5,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "leaf_counts",
+	 leaf_counts );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	leaf_counts->number_of_entries                = 3;
+	leaf_counts->number_of_counted_entries        = 3;
+	leaf_counts->child_page_numbers               = child_page_numbers;
+	leaf_counts->child_leaf_counts                = child_leaf_counts;
+	leaf_counts->cumulative_number_of_leaf_values = cumulative_number_of_leaf_values;
+
+	/* Test regular cases
+	 */
+	result = libesedb_leaf_counts_get_entry_by_leaf_value_index(
+	          leaf_counts,
+	          NULL,
+	          NULL,
+	          NULL,
+	          1,
+	          &entry_index,
+	          &entry_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_leaf_value_index",
+	 entry_leaf_value_index,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Entry 1 does not contain leaf values and is skipped
+	 */
+	result = libesedb_leaf_counts_get_entry_by_leaf_value_index(
+	          leaf_counts,
+	          NULL,
+	          NULL,
+	          NULL,
+	          2,
+	          &entry_index,
+	          &entry_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_leaf_value_index",
+	 entry_leaf_value_index,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_leaf_counts_get_entry_by_leaf_value_index(
+	          leaf_counts,
+	          NULL,
+	          NULL,
+	          NULL,
+	          4,
+	          &entry_index,
+	          &entry_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_leaf_value_index",
+	 entry_leaf_value_index,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_leaf_counts_get_entry_by_leaf_value_index(
+	          leaf_counts,
+	          NULL,
+	          NULL,
+	          NULL,
+	          5,
+	          &entry_index,
+	          &entry_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_leaf_counts_get_entry_by_leaf_value_index(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &entry_index,
+	          &entry_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_leaf_counts_get_entry_by_leaf_value_index(
+	          leaf_counts,
+	          NULL,
+	          NULL,
+	          NULL,
+	          -1,
+	          &entry_index,
+	          &entry_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_leaf_counts_get_entry_by_leaf_value_index(
+	          leaf_counts,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          NULL,
+	          &entry_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_leaf_counts_get_entry_by_leaf_value_index(
+	          leaf_counts,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &entry_index,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	leaf_counts->is_leaf_page = 1;
+
+	result = libesedb_leaf_counts_get_entry_by_leaf_value_index(
+	          leaf_counts,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &entry_index,
+	          &entry_leaf_value_index,
+	          &error );
+
+	leaf_counts->is_leaf_page = 0;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	leaf_counts->number_of_entries                = 0;
+	leaf_counts->child_page_numbers               = NULL;
+	leaf_counts->child_leaf_counts                = NULL;
+	leaf_counts->cumulative_number_of_leaf_values = NULL;
+
+	result = libesedb_leaf_counts_free(
+	          &leaf_counts,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "leaf_counts",
+	 leaf_counts );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( leaf_counts != NULL )
+	{
+		leaf_counts->number_of_entries                = 0;
+		leaf_counts->child_page_numbers               = NULL;
+		leaf_counts->child_leaf_counts                = NULL;
+		leaf_counts->cumulative_number_of_leaf_values = NULL;
+
+		libesedb_leaf_counts_free(
+		 &leaf_counts,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_leaf_counts_get_entry_by_leaf_value_index function
+ * at the boundaries of the child entries
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_leaf_counts_get_entry_by_leaf_value_index_boundaries(
+     void )
+{
+	uint32_t child_page_numbers[ 4 ]               = { 6, 7, 8, 9 };
+	libesedb_leaf_counts_t *child_leaf_counts[ 4 ] = { NULL, NULL, NULL, NULL };
+	int cumulative_number_of_leaf_values[ 4 ]      = { 4, 7, 7, 10 };
+
+	/* The leaf value index and the expected entry index and entry leaf value index
+	 */
+	int expected_values[ 8 ][ 3 ]                  = {
+		{ 0, 0, 0 },
+		{ 3, 0, 3 },
+		{ 4, 1, 0 },
+		{ 6, 1, 2 },
+		{ 7, 3, 0 },
+		{ 9, 3, 2 },
+		{ 5, 1, 1 },
+		{ 1, 0, 1 } };
+
+	libcerror_error_t *error                       = NULL;
+	libesedb_leaf_counts_t *leaf_counts            = NULL;
+	int entry_index                                = 0;
+	int entry_leaf_value_index                     = 0;
+	int result                                     = 0;
+	int value_index                                = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_leaf_counts_initialize(
+	          &leaf_counts,
+	          5,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "leaf_counts",
+	 leaf_counts );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	leaf_counts->number_of_entries                = 4;
+	leaf_counts->number_of_counted_entries        = 4;
+	leaf_counts->child_page_numbers               = child_page_numbers;
+	leaf_counts->child_leaf_counts                = child_leaf_counts;
+	leaf_counts->cumulative_number_of_leaf_values = cumulative_number_of_leaf_values;
+
+	/* Test the first and last leaf value of every child entry
+	 * and the boundaries between the child entries, where entry 2
+	 * does not contain leaf values
+	 */
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		entry_index            = -1;
+		entry_leaf_value_index = -1;
+
+		result = libesedb_leaf_counts_get_entry_by_leaf_value_index(
+		          leaf_counts,
+		          NULL,
+		          NULL,
+		          NULL,
+		          expected_values[ value_index ][ 0 ],
+		          &entry_index,
+		          &entry_leaf_value_index,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "entry_index",
+		 entry_index,
+		 expected_values[ value_index ][ 1 ] );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "entry_leaf_value_index",
+		 entry_leaf_value_index,
+		 expected_values[ value_index ][ 2 ] );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test leaf value indexes past the end of the last child entry
+	 */
+	result = libesedb_leaf_counts_get_entry_by_leaf_value_index(
+	          leaf_counts,
+	          NULL,
+	          NULL,
+	          NULL,
+	          10,
+	          &entry_index,
+	          &entry_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_leaf_counts_get_entry_by_leaf_value_index(
+	          leaf_counts,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0x7fffffffL,
+	          &entry_index,
+	          &entry_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a single child entry
+	 */
+	leaf_counts->number_of_entries         = 1;
+	leaf_counts->number_of_counted_entries = 1;
+
+	result = libesedb_leaf_counts_get_entry_by_leaf_value_index(
+	          leaf_counts,
+	          NULL,
+	          NULL,
+	          NULL,
+	          3,
+	          &entry_index,
+	          &entry_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_leaf_value_index",
+	 entry_leaf_value_index,
+	 3 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_leaf_counts_get_entry_by_leaf_value_index(
+	          leaf_counts,
+	          NULL,
+	          NULL,
+	          NULL,
+	          4,
+	          &entry_index,
+	          &entry_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	leaf_counts->number_of_entries                = 0;
+	leaf_counts->child_page_numbers               = NULL;
+	leaf_counts->child_leaf_counts                = NULL;
+	leaf_counts->cumulative_number_of_leaf_values = NULL;
+
+	result = libesedb_leaf_counts_free(
+	          &leaf_counts,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "leaf_counts",
+	 leaf_counts );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( leaf_counts != NULL )
+	{
+		leaf_counts->number_of_entries                = 0;
+		leaf_counts->child_page_numbers               = NULL;
+		leaf_counts->child_leaf_counts                = NULL;
+		leaf_counts->cumulative_number_of_leaf_values = NULL;
+
+		libesedb_leaf_counts_free(
+		 &leaf_counts,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_leaf_counts_initialize",
+	 esedb_test_leaf_counts_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_leaf_counts_free",
+	 esedb_test_leaf_counts_free );
+
+	/* TODO: add tests for libesedb_leaf_counts_read_page */
+
+	/* TODO: add tests for libesedb_leaf_counts_count_next_entry */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_leaf_counts_get_number_of_leaf_values",
+	 esedb_test_leaf_counts_get_number_of_leaf_values );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_leaf_counts_get_entry_by_leaf_value_index",
+	 esedb_test_leaf_counts_get_entry_by_leaf_value_index );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_leaf_counts_get_entry_by_leaf_value_index_boundaries",
+	 esedb_test_leaf_counts_get_entry_by_leaf_value_index_boundaries );
+
+	/* TODO: add tests for libesedb_leaf_counts_get_leaf_value_by_index */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,19 +21,28 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
+#include "esedb_test_libfcache.h"
+#include "esedb_test_libfdata.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_io_handle.h"
 #include "../libesedb/libesedb_long_value.h"
+#include "../libesedb/libesedb_page.h"
 
 /* Tests the libesedb_long_value_free function
  * Returns 1 if successful or 0 if not
@@ -75,6 +84,3234 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+/* The long values test data contains 4 pages of 4096 bytes, with a branch root page (1)
+ * of 2 leaf pages (2 and 3). Long value 1 consists of 3 segments, of which the last
+ * is stored in the second leaf page, and long value 2 has a gap in its segment offsets
+ */
+uint8_t esedb_test_long_value_data[ 5 * 4096 ];
+
+uint8_t esedb_test_long_value_key1[ 4 ] = { 0x01, 0x00, 0x00, 0x00 };
+uint8_t esedb_test_long_value_key2[ 4 ] = { 0x02, 0x00, 0x00, 0x00 };
+uint8_t esedb_test_long_value_key3[ 4 ] = { 0x03, 0x00, 0x00, 0x00 };
+
+/* Writes the long values test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_long_value_write_data(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t branch_key1[ 8 ]          = { 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14 };
+	uint8_t child_page_number1[ 4 ]   = { 0x02, 0x00, 0x00, 0x00 };
+	uint8_t child_page_number2[ 4 ]   = { 0x03, 0x00, 0x00, 0x00 };
+	uint8_t leaf_key1[ 4 ]            = { 0x00, 0x00, 0x00, 0x01 };
+	uint8_t leaf_key2[ 8 ]            = { 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00 };
+	uint8_t leaf_key3[ 8 ]            = { 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a };
+	uint8_t leaf_key4[ 8 ]            = { 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14 };
+	uint8_t leaf_key5[ 4 ]            = { 0x00, 0x00, 0x00, 0x02 };
+	uint8_t leaf_key6[ 8 ]            = { 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00 };
+	uint8_t leaf_key7[ 8 ]            = { 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08 };
+	uint8_t long_value_data1[ 8 ]     = { 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00 };
+	uint8_t long_value_data2[ 8 ]     = { 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 };
+
+	const uint8_t *branch_keys[ 2 ]   = { branch_key1, NULL };
+	const uint8_t *branch_values[ 2 ] = { child_page_number1, child_page_number2 };
+	const uint8_t *leaf_keys1[ 3 ]    = { leaf_key1, leaf_key2, leaf_key3 };
+	const uint8_t *leaf_keys2[ 4 ]    = { leaf_key4, leaf_key5, leaf_key6, leaf_key7 };
+	const uint8_t *leaf_values1[ 3 ]  = { long_value_data1, (uint8_t *) "0123456789", (uint8_t *) "abcdefghij" };
+	const uint8_t *leaf_values2[ 4 ]  = { (uint8_t *) "ABCDEF", long_value_data2, (uint8_t *) "wxyz", (uint8_t *) "WXYZ" };
+	size_t branch_key_sizes[ 2 ]      = { 8, 0 };
+	size_t branch_values_sizes[ 2 ]   = { 4, 4 };
+	size_t leaf_key_sizes1[ 3 ]       = { 4, 8, 8 };
+	size_t leaf_key_sizes2[ 4 ]       = { 8, 4, 8, 8 };
+	size_t leaf_values_sizes1[ 3 ]    = { 8, 10, 10 };
+	size_t leaf_values_sizes2[ 4 ]    = { 6, 8, 4, 4 };
+
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     1,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_PARENT,
+	     0,
+	     0,
+	     branch_keys,
+	     branch_key_sizes,
+	     branch_values,
+	     branch_values_sizes,
+	     2,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     2,
+	     LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     0,
+	     3,
+	     leaf_keys1,
+	     leaf_key_sizes1,
+	     leaf_values1,
+	     leaf_values_sizes1,
+	     3,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     3,
+	     LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     2,
+	     0,
+	     leaf_keys2,
+	     leaf_key_sizes2,
+	     leaf_values2,
+	     leaf_values_sizes2,
+	     4,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees the IO handle, pages vector, pages cache and column catalog definition of the long values test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_long_value_free_test_data(
+     libbfio_handle_t **file_io_handle,
+     libesedb_io_handle_t **io_handle,
+     libfdata_vector_t **pages_vector,
+     libfcache_cache_t **pages_cache,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	if( *column_catalog_definition != NULL )
+	{
+		if( libesedb_catalog_definition_free(
+		     column_catalog_definition,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *pages_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     pages_cache,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *pages_vector != NULL )
+	{
+		if( libfdata_vector_free(
+		     pages_vector,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *io_handle != NULL )
+	{
+		if( libesedb_io_handle_free(
+		     io_handle,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *file_io_handle != NULL )
+	{
+		if( esedb_test_close_file_io_handle(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Creates the IO handle, pages vector, pages cache and column catalog definition of the long values test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_long_value_initialize_test_data(
+     libbfio_handle_t **file_io_handle,
+     libesedb_io_handle_t **io_handle,
+     libfdata_vector_t **pages_vector,
+     libfcache_cache_t **pages_cache,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error )
+{
+	int segment_index = 0;
+
+	if( esedb_test_long_value_write_data(
+	     esedb_test_long_value_data,
+	     5 * 4096,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_open_file_io_handle(
+	     file_io_handle,
+	     esedb_test_long_value_data,
+	     5 * 4096,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libesedb_io_handle_initialize(
+	     io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( *io_handle )->format_revision = 0x0000000c;
+	( *io_handle )->page_size       = 4096;
+
+	if( libesedb_io_handle_set_pages_data_range(
+	     *io_handle,
+	     5 * 4096,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_vector_initialize(
+	     pages_vector,
+	     (size64_t) ( *io_handle )->page_size,
+	     (intptr_t *) *io_handle,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_vector_append_segment(
+	     *pages_vector,
+	     &segment_index,
+	     0,
+	     ( *io_handle )->pages_data_offset,
+	     ( *io_handle )->pages_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     pages_cache,
+	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libesedb_catalog_definition_initialize(
+	     column_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	esedb_test_long_value_free_test_data(
+	 file_io_handle,
+	 io_handle,
+	 pages_vector,
+	 pages_cache,
+	 column_catalog_definition,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libesedb_long_value_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_initialize(
+     void )
+{
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_io_handle_t *io_handle                          = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	libfcache_cache_t *pages_cache                           = NULL;
+	libfdata_vector_t *pages_vector                          = NULL;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_long_value_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key1,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_long_value_initialize(
+	          NULL,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key1,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	long_value = (libesedb_long_value_t *) 0x12345678UL;
+
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key1,
+	          4,
+	          &error );
+
+	long_value = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          NULL,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key1,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          NULL,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key1,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_long_value_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	esedb_test_long_value_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 &column_catalog_definition,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_seek_first_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_seek_first_segment(
+     void )
+{
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_io_handle_t *io_handle                          = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	libfcache_cache_t *pages_cache                           = NULL;
+	libfdata_vector_t *pages_vector                          = NULL;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_long_value_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key1,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_seek_first_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->next_segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->next_segment_offset,
+	 (int64_t) 0 );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a long value that is not stored in the long values tree
+	 */
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key3,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_seek_first_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_long_value_seek_first_segment(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = esedb_test_long_value_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	esedb_test_long_value_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 &column_catalog_definition,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_read_next_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_read_next_segment(
+     void )
+{
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_io_handle_t *io_handle                          = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	libfcache_cache_t *pages_cache                           = NULL;
+	libfdata_vector_t *pages_vector                          = NULL;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_long_value_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key1,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_seek_first_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_read_next_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_offset,
+	 (int64_t) 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "long_value->segment_data_size",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_data_size,
+	 (size_t) 10 );
+
+	result = libesedb_long_value_read_next_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_offset,
+	 (int64_t) 10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "long_value->segment_data_size",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_data_size,
+	 (size_t) 10 );
+
+	/* Test a segment that is stored in the next leaf page
+	 */
+	result = libesedb_long_value_read_next_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_offset,
+	 (int64_t) 20 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "long_value->segment_data_size",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_data_size,
+	 (size_t) 6 );
+
+	result = libesedb_long_value_read_next_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the cursor remains positioned after the last segment
+	 */
+	result = libesedb_long_value_read_next_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->next_segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->next_segment_offset,
+	 (int64_t) 26 );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a long value with a gap in the segment offsets, where the segments after the gap are ignored
+	 */
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key2,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_seek_first_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_read_next_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_offset,
+	 (int64_t) 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "long_value->segment_data_size",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_data_size,
+	 (size_t) 4 );
+
+	result = libesedb_long_value_read_next_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_long_value_read_next_segment(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = esedb_test_long_value_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	esedb_test_long_value_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 &column_catalog_definition,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_seek_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_seek_segment(
+     void )
+{
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_io_handle_t *io_handle                          = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	libfcache_cache_t *pages_cache                           = NULL;
+	libfdata_vector_t *pages_vector                          = NULL;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_long_value_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key1,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an offset at the start of the first segment
+	 */
+	result = libesedb_long_value_seek_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_offset,
+	 (int64_t) 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "long_value->segment_data_size",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_data_size,
+	 (size_t) 10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->next_segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->next_segment_offset,
+	 (int64_t) 10 );
+
+	/* Test an offset inside the second segment
+	 */
+	result = libesedb_long_value_seek_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          15,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_offset,
+	 (int64_t) 10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "long_value->segment_data_size",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_data_size,
+	 (size_t) 10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->next_segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->next_segment_offset,
+	 (int64_t) 20 );
+
+	/* Test an offset on the boundary of the first and second segment
+	 */
+	result = libesedb_long_value_seek_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          10,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_offset,
+	 (int64_t) 10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "long_value->segment_data_size",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_data_size,
+	 (size_t) 10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->next_segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->next_segment_offset,
+	 (int64_t) 20 );
+
+	/* Test an offset in the last segment, which is stored in the next leaf page
+	 */
+	result = libesedb_long_value_seek_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          20,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_offset,
+	 (int64_t) 20 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "long_value->segment_data_size",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_data_size,
+	 (size_t) 6 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->next_segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->next_segment_offset,
+	 (int64_t) 26 );
+
+	/* Test an offset beyond the end of the data, which positions on the last segment
+	 */
+	result = libesedb_long_value_seek_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          100,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_offset,
+	 (int64_t) 20 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "long_value->segment_data_size",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_data_size,
+	 (size_t) 6 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->next_segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->next_segment_offset,
+	 (int64_t) 26 );
+
+	/* Test error cases
+	 */
+	result = libesedb_long_value_seek_segment(
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_seek_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an offset in the gap in the segment offsets of the second long value, which positions on the preceding segment
+	 */
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key2,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_seek_segment(
+	          (libesedb_internal_long_value_t *) long_value,
+	          5,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_offset,
+	 (int64_t) 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "long_value->segment_data_size",
+	 ( (libesedb_internal_long_value_t *) long_value )->segment_data_size,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "long_value->next_segment_offset",
+	 ( (libesedb_internal_long_value_t *) long_value )->next_segment_offset,
+	 (int64_t) 4 );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = esedb_test_long_value_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	esedb_test_long_value_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 &column_catalog_definition,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_read_data_segments_list function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_read_data_segments_list(
+     void )
+{
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_io_handle_t *io_handle                          = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	libfcache_cache_t *pages_cache                           = NULL;
+	libfdata_vector_t *pages_vector                          = NULL;
+	size64_t data_size                                       = 0;
+	int number_of_data_segments                              = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_long_value_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key1,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_read_data_segments_list(
+	          (libesedb_internal_long_value_t *) long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_get_number_of_elements(
+	          ( (libesedb_internal_long_value_t *) long_value )->data_segments_list,
+	          &number_of_data_segments,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_data_segments",
+	 number_of_data_segments,
+	 3 );
+
+	result = libfdata_list_get_size(
+	          ( (libesedb_internal_long_value_t *) long_value )->data_segments_list,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 data_size,
+	 (uint64_t) 26 );
+
+	/* Test that the data segments list is read only once
+	 */
+	result = libesedb_long_value_read_data_segments_list(
+	          (libesedb_internal_long_value_t *) long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a long value with a gap in the segment offsets
+	 */
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key2,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_read_data_segments_list(
+	          (libesedb_internal_long_value_t *) long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_get_number_of_elements(
+	          ( (libesedb_internal_long_value_t *) long_value )->data_segments_list,
+	          &number_of_data_segments,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_data_segments",
+	 number_of_data_segments,
+	 1 );
+
+	result = libfdata_list_get_size(
+	          ( (libesedb_internal_long_value_t *) long_value )->data_segments_list,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 data_size,
+	 (uint64_t) 4 );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key3,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_read_data_segments_list(
+	          (libesedb_internal_long_value_t *) long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value->data_segments_list",
+	 ( (libesedb_internal_long_value_t *) long_value )->data_segments_list );
+
+	result = libesedb_long_value_read_data_segments_list(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = esedb_test_long_value_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	esedb_test_long_value_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 &column_catalog_definition,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_get_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_get_data_size(
+     void )
+{
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_io_handle_t *io_handle                          = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	libfcache_cache_t *pages_cache                           = NULL;
+	libfdata_vector_t *pages_vector                          = NULL;
+	uint8_t data[ 64 ];
+	size64_t data_size                                       = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_long_value_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key1,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_get_data_size(
+	          long_value,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 data_size,
+	 (uint64_t) 26 );
+
+	result = libesedb_long_value_get_data(
+	          long_value,
+	          data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "0123456789abcdefghijABCDEF",
+	          26 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a long value with a gap in the segment offsets
+	 */
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key2,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_get_data_size(
+	          long_value,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 data_size,
+	 (uint64_t) 4 );
+
+	/* Test error cases
+	 */
+	result = libesedb_long_value_get_data_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_get_data_size(
+	          long_value,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = esedb_test_long_value_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	esedb_test_long_value_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 &column_catalog_definition,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_read_buffer(
+     void )
+{
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_io_handle_t *io_handle                          = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	libfcache_cache_t *pages_cache                           = NULL;
+	libfdata_vector_t *pages_vector                          = NULL;
+	uint8_t data[ 64 ];
+	off64_t offset                                           = 0;
+	ssize_t read_count                                       = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_long_value_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key1,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read that starts inside the first segment and ends in the second segment
+	 */
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          5,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 5 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              data,
+	              10,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 10 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "56789abcde",
+	          10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a sequential read that continues in the segment that is stored in the next leaf page
+	 */
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              data,
+	              8,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "fghijABC",
+	          8 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read that is truncated at the end of the data
+	 */
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              data,
+	              64,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 3 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "DEF",
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              data,
+	              64,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read of all segments
+	 */
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              data,
+	              64,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 26 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "0123456789abcdefghijABCDEF",
+	          26 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a long value with a gap in the segment offsets, where the data after the gap is not read
+	 */
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key2,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              data,
+	              64,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "wxyz",
+	          4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          8,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 8 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              data,
+	              4,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libesedb_long_value_read_buffer(
+	              NULL,
+	              data,
+	              64,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              NULL,
+	              64,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              data,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = esedb_test_long_value_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	esedb_test_long_value_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 &column_catalog_definition,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_read_buffer_at_offset(
+     void )
+{
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_io_handle_t *io_handle                          = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	libfcache_cache_t *pages_cache                           = NULL;
+	libfdata_vector_t *pages_vector                          = NULL;
+	uint8_t data[ 64 ];
+	off64_t offset                                           = 0;
+	ssize_t read_count                                       = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_long_value_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key1,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read inside the second segment
+	 */
+	read_count = libesedb_long_value_read_buffer_at_offset(
+	              long_value,
+	              data,
+	              4,
+	              12,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "cdef",
+	          4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_long_value_get_offset(
+	          long_value,
+	          &offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 16 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read that starts on the boundary of the first and second segment
+	 */
+	read_count = libesedb_long_value_read_buffer_at_offset(
+	              long_value,
+	              data,
+	              10,
+	              10,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 10 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "abcdefghij",
+	          10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_long_value_get_offset(
+	          long_value,
+	          &offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 20 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read that starts before the current offset and ends in the segment that is stored in the next leaf page
+	 */
+	read_count = libesedb_long_value_read_buffer_at_offset(
+	              long_value,
+	              data,
+	              16,
+	              6,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "6789abcdefghijAB",
+	          16 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read that is truncated at the end of the data
+	 */
+	read_count = libesedb_long_value_read_buffer_at_offset(
+	              long_value,
+	              data,
+	              8,
+	              22,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "CDEF",
+	          4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read at the end of the data
+	 */
+	read_count = libesedb_long_value_read_buffer_at_offset(
+	              long_value,
+	              data,
+	              8,
+	              26,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read beyond the end of the data
+	 */
+	read_count = libesedb_long_value_read_buffer_at_offset(
+	              long_value,
+	              data,
+	              8,
+	              100,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libesedb_long_value_read_buffer_at_offset(
+	              NULL,
+	              data,
+	              8,
+	              0,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libesedb_long_value_read_buffer_at_offset(
+	              long_value,
+	              NULL,
+	              8,
+	              0,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libesedb_long_value_read_buffer_at_offset(
+	              long_value,
+	              data,
+	              8,
+	              -1,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = esedb_test_long_value_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	esedb_test_long_value_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 &column_catalog_definition,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_seek_offset(
+     void )
+{
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_io_handle_t *io_handle                          = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	libfcache_cache_t *pages_cache                           = NULL;
+	libfdata_vector_t *pages_vector                          = NULL;
+	uint8_t data[ 64 ];
+	off64_t offset                                           = 0;
+	ssize_t read_count                                       = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_long_value_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          esedb_test_long_value_key1,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          0,
+	          SEEK_END,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 26 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          -6,
+	          SEEK_CUR,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 20 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              data,
+	              6,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 6 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "ABCDEF",
+	          6 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a seek past the end of the data
+	 */
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          100,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 100 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              data,
+	              6,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          10,
+	          SEEK_END,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 36 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              data,
+	              6,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the data can be read after a seek past the end of the data
+	 */
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              data,
+	              4,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "0123",
+	          4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	offset = libesedb_long_value_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          -1,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          0,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = esedb_test_long_value_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	esedb_test_long_value_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 &column_catalog_definition,
+	 NULL );
+
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -94,7 +3331,9 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
-	/* TODO: add tests for libesedb_long_value_initialize */
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_initialize",
+	 esedb_test_long_value_initialize );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
@@ -104,7 +3343,25 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
-	/* TODO: add tests for libesedb_long_value_get_data_size */
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_seek_first_segment",
+	 esedb_test_long_value_seek_first_segment );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_read_next_segment",
+	 esedb_test_long_value_read_next_segment );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_seek_segment",
+	 esedb_test_long_value_seek_segment );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_read_data_segments_list",
+	 esedb_test_long_value_read_data_segments_list );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_get_data_size",
+	 esedb_test_long_value_get_data_size );
 
 	/* TODO: add tests for libesedb_long_value_get_data */
 
@@ -124,6 +3381,20 @@ int main(
 
 	/* TODO: add tests for libesedb_long_value_get_utf16_string */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_read_buffer",
+	 esedb_test_long_value_read_buffer );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_read_buffer_at_offset",
+	 esedb_test_long_value_read_buffer_at_offset );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_long_value_seek_offset",
+	 esedb_test_long_value_seek_offset );
+
+	/* TODO: add tests for libesedb_long_value_get_offset */
+
 	/* TODO: add tests for libesedb_long_value_get_number_of_segments */
 
 	/* TODO: add tests for libesedb_long_value_get_segment_data */
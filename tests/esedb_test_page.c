@@ -1551,6 +1551,544 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_page_read_header_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_read_header_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libesedb_io_handle_t *io_handle  = NULL;
+	libesedb_page_t *page            = NULL;
+	uint8_t *page_data               = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_revision = 0x0000000c;
+	io_handle->page_size       = 4096;
+
+	result = libesedb_page_initialize(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_page_data1,
+	          4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_read_header_file_io_handle(
+	          page,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page->data",
+	 page->data );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page_data = page->data;
+
+	/* Test if the page data is reused
+	 */
+	result = libesedb_page_read_header_file_io_handle(
+	          page,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page->data == page_data",
+	 (int) ( page->data == page_data ),
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_read_header_file_io_handle(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_read_header_file_io_handle(
+	          page,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	page->data_size = 2048;
+
+	result = libesedb_page_read_header_file_io_handle(
+	          page,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	page->data_size = 4096;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_free(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_get_number_of_live_values_from_tags function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_get_number_of_live_values_from_tags(
+     void )
+{
+	uint8_t page_data[ 4096 ];
+
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	libesedb_page_t *page           = NULL;
+	void *memcpy_result             = NULL;
+	uint16_t number_of_values       = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	memcpy_result = memory_copy(
+	                 page_data,
+	                 esedb_test_page_data1,
+	                 4096 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	/* Add a defunct page tag 2 with offset: 32 and size: 4
+	 */
+	page_data[ 4084 ] = 0x04;
+	page_data[ 4085 ] = 0x00;
+	page_data[ 4086 ] = 0x20;
+	page_data[ 4087 ] = 0x40;
+
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_revision = 0x0000000c;
+	io_handle->page_size       = 4096;
+
+	result = libesedb_page_initialize(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_header_read_data(
+	          page->header,
+	          io_handle,
+	          page_data,
+	          4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page->data      = page_data;
+	page->data_size = 4096;
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_get_number_of_live_values_from_tags(
+	          page,
+	          io_handle,
+	          &number_of_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "number_of_values",
+	 number_of_values,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Page tag 1 is in use and page tag 2 is defunct
+	 */
+	page->header->available_page_tag = 3;
+
+	result = libesedb_page_get_number_of_live_values_from_tags(
+	          page,
+	          io_handle,
+	          &number_of_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "number_of_values",
+	 number_of_values,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_get_number_of_live_values_from_tags(
+	          NULL,
+	          io_handle,
+	          &number_of_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_get_number_of_live_values_from_tags(
+	          page,
+	          NULL,
+	          &number_of_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_get_number_of_live_values_from_tags(
+	          page,
+	          io_handle,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	page->header->available_page_tag = 2000;
+
+	result = libesedb_page_get_number_of_live_values_from_tags(
+	          page,
+	          io_handle,
+	          &number_of_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	page->data      = NULL;
+	page->data_size = 0;
+
+	result = libesedb_page_free(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page != NULL )
+	{
+		page->data = NULL;
+
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libesedb_page_get_previous_page_number function
  * Returns 1 if successful or 0 if not
  */
@@ -2064,6 +2602,14 @@ int main(
 	 "libesedb_page_read_file_io_handle",
 	 esedb_test_page_read_file_io_handle );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_page_read_header_file_io_handle",
+	 esedb_test_page_read_header_file_io_handle );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_get_number_of_live_values_from_tags",
+	 esedb_test_page_get_number_of_live_values_from_tags );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize test
@@ -579,10 +579,10 @@ int main(
 	 "libesedb_page_tree_read_page",
 	 esedb_test_page_tree_read_page );
 
-	/* TODO: add tests for libesedb_page_tree_get_number_of_leaf_values_from_page */
-
 	/* TODO: add tests for libesedb_page_tree_get_number_of_leaf_values */
 
+	/* TODO: add tests for libesedb_page_tree_get_leaf_value_by_index */
+
 	ESEDB_TEST_RUN(
 	 "libesedb_page_tree_read_node",
 	 esedb_test_page_tree_read_node );
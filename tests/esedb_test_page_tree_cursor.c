@@ -0,0 +1,4712 @@
+/*
+ * Library page_tree_cursor type testing program
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_libfcache.h"
+#include "esedb_test_libfdata.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_data_definition.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_key.h"
+#include "../libesedb/libesedb_page.h"
+#include "../libesedb/libesedb_page_tree_cursor.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* The page tree test data contains 8 pages of 4096 bytes, with a branch root page (1)
+ * of 2 leaf pages (2 and 3), a separate leaf root page (4), a second branch root
+ * page (5) of the same leaf pages and a branch root page (6) of 2 empty leaf pages
+ * (7 and 8) of which the previous and next page numbers form a cycle
+ */
+uint8_t esedb_test_page_tree_cursor_data[ 10 * 4096 ];
+
+/* Writes the page tree test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_page_tree_cursor_write_data(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t branch_key1[ 2 ]                = { 0x10, 0x81 };
+	uint8_t child_page_number1[ 4 ]         = { 0x02, 0x00, 0x00, 0x00 };
+	uint8_t child_page_number2[ 4 ]         = { 0x03, 0x00, 0x00, 0x00 };
+	uint8_t child_page_number3[ 4 ]         = { 0x07, 0x00, 0x00, 0x00 };
+	uint8_t leaf_key1[ 2 ]                  = { 0x10, 0x01 };
+	uint8_t leaf_key2[ 2 ]                  = { 0x10, 0x05 };
+	uint8_t leaf_key3[ 2 ]                  = { 0x10, 0x20 };
+	uint8_t leaf_key4[ 2 ]                  = { 0x10, 0x81 };
+	uint8_t leaf_key5[ 2 ]                  = { 0x10, 0x90 };
+	uint8_t leaf_key6[ 2 ]                  = { 0x20, 0x00 };
+	uint8_t leaf_data[ 1 ]                  = { 0xff };
+
+	const uint8_t *branch_keys[ 2 ]         = { branch_key1, NULL };
+	const uint8_t *branch_values[ 2 ]       = { child_page_number1, child_page_number2 };
+	const uint8_t *cycle_branch_keys[ 1 ]   = { NULL };
+	const uint8_t *cycle_branch_values[ 1 ] = { child_page_number3 };
+	const uint8_t *leaf_keys1[ 3 ]          = { leaf_key1, leaf_key2, leaf_key3 };
+	const uint8_t *leaf_keys2[ 3 ]          = { leaf_key4, leaf_key5, leaf_key6 };
+	const uint8_t *leaf_keys3[ 2 ]          = { leaf_key1, leaf_key6 };
+	const uint8_t *leaf_values[ 3 ]         = { leaf_data, leaf_data, leaf_data };
+	size_t branch_key_sizes[ 2 ]            = { 2, 0 };
+	size_t branch_values_sizes[ 2 ]         = { 4, 4 };
+	size_t cycle_branch_key_sizes[ 1 ]      = { 0 };
+	size_t leaf_key_sizes[ 3 ]              = { 2, 2, 2 };
+	size_t leaf_values_sizes[ 3 ]           = { 1, 1, 1 };
+
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     1,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_PARENT,
+	     0,
+	     0,
+	     branch_keys,
+	     branch_key_sizes,
+	     branch_values,
+	     branch_values_sizes,
+	     2,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     2,
+	     LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     0,
+	     3,
+	     leaf_keys1,
+	     leaf_key_sizes,
+	     leaf_values,
+	     leaf_values_sizes,
+	     3,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     3,
+	     LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     2,
+	     0,
+	     leaf_keys2,
+	     leaf_key_sizes,
+	     leaf_values,
+	     leaf_values_sizes,
+	     3,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     4,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     0,
+	     0,
+	     leaf_keys3,
+	     leaf_key_sizes,
+	     leaf_values,
+	     leaf_values_sizes,
+	     2,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     5,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_PARENT,
+	     0,
+	     0,
+	     branch_keys,
+	     branch_key_sizes,
+	     branch_values,
+	     branch_values_sizes,
+	     2,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     6,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_PARENT,
+	     0,
+	     0,
+	     cycle_branch_keys,
+	     cycle_branch_key_sizes,
+	     cycle_branch_values,
+	     branch_values_sizes,
+	     1,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     7,
+	     LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     8,
+	     8,
+	     NULL,
+	     NULL,
+	     NULL,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     8,
+	     LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     7,
+	     7,
+	     NULL,
+	     NULL,
+	     NULL,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees the IO handle, pages vector and pages cache of the page tree test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_page_tree_cursor_free_test_data(
+     libbfio_handle_t **file_io_handle,
+     libesedb_io_handle_t **io_handle,
+     libfdata_vector_t **pages_vector,
+     libfcache_cache_t **pages_cache,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	if( *pages_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     pages_cache,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *pages_vector != NULL )
+	{
+		if( libfdata_vector_free(
+		     pages_vector,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *io_handle != NULL )
+	{
+		if( libesedb_io_handle_free(
+		     io_handle,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *file_io_handle != NULL )
+	{
+		if( esedb_test_close_file_io_handle(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Creates the IO handle, pages vector and pages cache of the page tree test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_page_tree_cursor_initialize_test_data(
+     libbfio_handle_t **file_io_handle,
+     libesedb_io_handle_t **io_handle,
+     libfdata_vector_t **pages_vector,
+     libfcache_cache_t **pages_cache,
+     libcerror_error_t **error )
+{
+	int segment_index = 0;
+
+	if( esedb_test_page_tree_cursor_write_data(
+	     esedb_test_page_tree_cursor_data,
+	     10 * 4096,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_open_file_io_handle(
+	     file_io_handle,
+	     esedb_test_page_tree_cursor_data,
+	     10 * 4096,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libesedb_io_handle_initialize(
+	     io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( *io_handle )->format_revision = 0x0000000c;
+	( *io_handle )->page_size       = 4096;
+
+	if( libesedb_io_handle_set_pages_data_range(
+	     *io_handle,
+	     10 * 4096,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_vector_initialize(
+	     pages_vector,
+	     (size64_t) ( *io_handle )->page_size,
+	     (intptr_t *) *io_handle,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_vector_append_segment(
+	     *pages_vector,
+	     &segment_index,
+	     0,
+	     ( *io_handle )->pages_data_offset,
+	     ( *io_handle )->pages_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     pages_cache,
+	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	esedb_test_page_tree_cursor_free_test_data(
+	 file_io_handle,
+	 io_handle,
+	 pages_vector,
+	 pages_cache,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Seeks a leaf value in the page tree test data and checks the leaf value that was sought
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+     libesedb_page_tree_cursor_t *page_tree_cursor,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *key_data,
+     size_t key_size,
+     int comparison_operator,
+     int expected_result,
+     uint32_t expected_page_number,
+     uint16_t expected_page_value_index )
+{
+	libcerror_error_t *error                    = NULL;
+	libesedb_data_definition_t *data_definition = NULL;
+	libesedb_key_t *key                         = NULL;
+	int result                                  = 0;
+
+	result = libesedb_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_set_data(
+	          key,
+	          key_data,
+	          key_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	key->type = LIBESEDB_KEY_TYPE_SEEK_VALUE;
+
+	result = libesedb_data_definition_initialize(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_seek_leaf_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          comparison_operator,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The cursor is positioned before the leaf value that was sought
+	 */
+	if( expected_result == 1 )
+	{
+		result = libesedb_page_tree_cursor_get_next_leaf_value(
+		          page_tree_cursor,
+		          file_io_handle,
+		          data_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "data_definition->page_number",
+		 data_definition->page_number,
+		 expected_page_number );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT16(
+		 "data_definition->page_value_index",
+		 data_definition->page_value_index,
+		 expected_page_value_index );
+	}
+	else
+	{
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "page_tree_cursor->page_number",
+		 page_tree_cursor->page_number,
+		 0 );
+	}
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_initialize(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	int result                                    = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 1;
+	int number_of_memset_fail_tests               = 1;
+	int test_number                               = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test page_tree_cursor initialization
+	 */
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_initialize(
+	          NULL,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	page_tree_cursor = (libesedb_page_tree_cursor_t *) 0x12345678UL;
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          1,
+	          &error );
+
+	page_tree_cursor = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          NULL,
+	          NULL,
+	          NULL,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_page_tree_cursor_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_page_tree_cursor_initialize(
+		          &page_tree_cursor,
+		          io_handle,
+		          NULL,
+		          NULL,
+		          1,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( page_tree_cursor != NULL )
+			{
+				libesedb_page_tree_cursor_free(
+				 &page_tree_cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "page_tree_cursor",
+			 page_tree_cursor );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_page_tree_cursor_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_page_tree_cursor_initialize(
+		          &page_tree_cursor,
+		          io_handle,
+		          NULL,
+		          NULL,
+		          1,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( page_tree_cursor != NULL )
+			{
+				libesedb_page_tree_cursor_free(
+				 &page_tree_cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "page_tree_cursor",
+			 page_tree_cursor );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_get_page function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_get_page(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_page_t *page                         = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->page_size        = 4096;
+	io_handle->last_page_number = 4;
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_get_page(
+	          NULL,
+	          NULL,
+	          1,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_get_page(
+	          page_tree_cursor,
+	          NULL,
+	          0,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_get_page(
+	          page_tree_cursor,
+	          NULL,
+	          5,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_get_page(
+	          page_tree_cursor,
+	          NULL,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_get_branch_page function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_get_branch_page(
+     void )
+{
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_page_t *branch_page                  = NULL;
+	libesedb_page_t *page                         = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	libfcache_cache_t *branch_pages_cache         = NULL;
+	libfcache_cache_t *pages_cache                = NULL;
+	libfdata_vector_t *pages_vector               = NULL;
+	uint8_t leaf_key[ 2 ]                         = { 0x10, 0x90 };
+	uint32_t page_flags                           = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_cursor_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Use a branch pages cache of 2 entries so that branch pages 1 and 5 map onto the same cache entry
+	 */
+	result = libfcache_cache_initialize(
+	          &branch_pages_cache,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->branch_pages_cache = branch_pages_cache;
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          5,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_tree_cursor_get_branch_page(
+	          page_tree_cursor,
+	          1,
+	          &branch_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that leaf pages are not stored in the branch pages cache
+	 */
+	result = libesedb_page_tree_cursor_get_page(
+	          page_tree_cursor,
+	          file_io_handle,
+	          4,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_branch_page(
+	          page_tree_cursor,
+	          4,
+	          &branch_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_page(
+	          page_tree_cursor,
+	          file_io_handle,
+	          3,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_branch_page(
+	          page_tree_cursor,
+	          3,
+	          &branch_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a branch page is stored in the branch pages cache
+	 */
+	result = libesedb_page_tree_cursor_get_page(
+	          page_tree_cursor,
+	          file_io_handle,
+	          1,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_branch_page(
+	          page_tree_cursor,
+	          1,
+	          &branch_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "branch_page",
+	 (int) ( branch_page == page ),
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "branch_page->page_number",
+	 branch_page->page_number,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that branch page 5 replaces branch page 1 in the cache entry they share
+	 */
+	result = libesedb_page_tree_cursor_get_page(
+	          page_tree_cursor,
+	          file_io_handle,
+	          5,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_branch_page(
+	          page_tree_cursor,
+	          5,
+	          &branch_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "branch_page->page_number",
+	 branch_page->page_number,
+	 5 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_branch_page(
+	          page_tree_cursor,
+	          1,
+	          &branch_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the replaced branch page 1 is retrieved again
+	 */
+	result = libesedb_page_tree_cursor_get_page(
+	          page_tree_cursor,
+	          file_io_handle,
+	          1,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page->page_number",
+	 page->page_number,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_get_flags(
+	          page,
+	          &page_flags,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page_flags",
+	 page_flags,
+	 ( LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_PARENT ) );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_branch_page(
+	          page_tree_cursor,
+	          5,
+	          &branch_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a seek descends through branch page 5 after it was replaced
+	 */
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          leaf_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          1,
+	          3,
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_get_branch_page(
+	          NULL,
+	          1,
+	          &branch_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_get_branch_page(
+	          page_tree_cursor,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->branch_pages_cache = NULL;
+
+	result = libfcache_cache_free(
+	          &branch_pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_tree_cursor_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		io_handle->branch_pages_cache = NULL;
+	}
+	if( branch_pages_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &branch_pages_cache,
+		 NULL );
+	}
+	esedb_test_page_tree_cursor_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_cache_branch_page function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_cache_branch_page(
+     void )
+{
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_page_t *branch_page                  = NULL;
+	libesedb_page_t *page                         = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	libfcache_cache_t *branch_pages_cache         = NULL;
+	libfcache_cache_t *pages_cache                = NULL;
+	libfdata_vector_t *pages_vector               = NULL;
+	uint16_t number_of_branch_page_values         = 0;
+	uint16_t number_of_page_values                = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_cursor_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_initialize(
+	          &branch_pages_cache,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->branch_pages_cache = branch_pages_cache;
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_get_element_value_by_index(
+	          pages_vector,
+	          (intptr_t *) file_io_handle,
+	          (libfdata_cache_t *) pages_cache,
+	          0,
+	          (intptr_t **) &page,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_get_number_of_values(
+	          page,
+	          &number_of_page_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	branch_page = page;
+
+	result = libesedb_page_tree_cursor_cache_branch_page(
+	          page_tree_cursor,
+	          1,
+	          &branch_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "branch_page",
+	 branch_page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The branch page is a copy of the page in the pages cache
+	 */
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "branch_page",
+	 (int) ( branch_page != page ),
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "branch_page->page_number",
+	 branch_page->page_number,
+	 1 );
+
+	result = libesedb_page_get_number_of_values(
+	          branch_page,
+	          &number_of_branch_page_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "number_of_branch_page_values",
+	 number_of_branch_page_values,
+	 number_of_page_values );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page = NULL;
+
+	result = libesedb_page_tree_cursor_get_branch_page(
+	          page_tree_cursor,
+	          1,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page",
+	 (int) ( page == branch_page ),
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_cache_branch_page(
+	          NULL,
+	          1,
+	          &branch_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_cache_branch_page(
+	          page_tree_cursor,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	page = NULL;
+
+	result = libesedb_page_tree_cursor_cache_branch_page(
+	          page_tree_cursor,
+	          1,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->branch_pages_cache = NULL;
+
+	result = libfcache_cache_free(
+	          &branch_pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_tree_cursor_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		io_handle->branch_pages_cache = NULL;
+	}
+	if( branch_pages_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &branch_pages_cache,
+		 NULL );
+	}
+	esedb_test_page_tree_cursor_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_get_child_page_number function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_get_child_page_number(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	uint32_t child_page_number = 0;
+	int result                 = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_get_child_page_number(
+	          NULL,
+	          NULL,
+	          1,
+	          &child_page_number,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_get_outer_leaf_page_number function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_get_outer_leaf_page_number(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	uint32_t leaf_page_number = 0;
+	int result                = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_get_outer_leaf_page_number(
+	          NULL,
+	          NULL,
+	          0,
+	          &leaf_page_number,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_read_leaf_page_header function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_read_leaf_page_header(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_read_leaf_page_header(
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_get_leaf_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_get_leaf_value(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_get_leaf_value(
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_get_next_leaf_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_get_next_leaf_value(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libesedb_data_definition_t *data_definition   = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_initialize(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_get_next_leaf_value(
+	          NULL,
+	          NULL,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_get_next_leaf_value(
+	          page_tree_cursor,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a root page number that exceeds the last page number
+	 */
+	result = libesedb_page_tree_cursor_get_next_leaf_value(
+	          page_tree_cursor,
+	          NULL,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_get_next_leaf_value function on the leaf page chain of the page tree test data
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_get_next_leaf_value_page_chain(
+     void )
+{
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_data_definition_t *data_definition   = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	libfcache_cache_t *pages_cache                = NULL;
+	libfdata_vector_t *pages_vector               = NULL;
+	int leaf_value_index                          = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_cursor_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_initialize(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the leaf values of both leaf pages are retrieved, starting with the first leaf page
+	 */
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( leaf_value_index = 0;
+	     leaf_value_index < 6;
+	     leaf_value_index++ )
+	{
+		result = libesedb_page_tree_cursor_get_next_leaf_value(
+		          page_tree_cursor,
+		          file_io_handle,
+		          data_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	/* Test that there is no leaf value after the last leaf value
+	 */
+	result = libesedb_page_tree_cursor_get_next_leaf_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases with a leaf page chain of which the next page numbers form a cycle
+	 */
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          6,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_next_leaf_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_tree_cursor_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	esedb_test_page_tree_cursor_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_get_previous_leaf_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_get_previous_leaf_value(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libesedb_data_definition_t *data_definition   = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_initialize(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_get_previous_leaf_value(
+	          NULL,
+	          NULL,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_get_previous_leaf_value(
+	          page_tree_cursor,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a root page number that exceeds the last page number
+	 */
+	result = libesedb_page_tree_cursor_get_previous_leaf_value(
+	          page_tree_cursor,
+	          NULL,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_get_previous_leaf_value function on the leaf page chain of the page tree test data
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_get_previous_leaf_value_page_chain(
+     void )
+{
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_data_definition_t *data_definition   = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	libfcache_cache_t *pages_cache                = NULL;
+	libfdata_vector_t *pages_vector               = NULL;
+	int leaf_value_index                          = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_cursor_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_initialize(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the leaf values of both leaf pages are retrieved, starting with the last leaf page
+	 */
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( leaf_value_index = 0;
+	     leaf_value_index < 6;
+	     leaf_value_index++ )
+	{
+		result = libesedb_page_tree_cursor_get_previous_leaf_value(
+		          page_tree_cursor,
+		          file_io_handle,
+		          data_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	/* Test that there is no leaf value before the first leaf value
+	 */
+	result = libesedb_page_tree_cursor_get_previous_leaf_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases with a leaf page chain of which the previous page numbers form a cycle
+	 */
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          6,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_previous_leaf_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_tree_cursor_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	esedb_test_page_tree_cursor_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_get_number_of_leaf_values function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_get_number_of_leaf_values(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	int number_of_leaf_values = 0;
+	int result                = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_get_number_of_leaf_values(
+	          NULL,
+	          NULL,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_get_key function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_get_key(
+     void )
+{
+	uint8_t branch_key[ 2 ]                       = { 0x10, 0x81 };
+	uint8_t last_key[ 2 ]                         = { 0x20, 0x00 };
+	uint8_t leaf_key[ 2 ]                         = { 0x10, 0x05 };
+
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_key_t *key                           = NULL;
+	libesedb_page_t *page                         = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	libfcache_cache_t *pages_cache                = NULL;
+	libfdata_vector_t *pages_vector               = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_cursor_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* Test the key of a page value of a leaf page
+	 */
+	result = libesedb_page_tree_cursor_get_page(
+	          page_tree_cursor,
+	          file_io_handle,
+	          2,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	result = libesedb_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_key(
+	          page_tree_cursor,
+	          page,
+	          2,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key->data_size",
+	 key->data_size,
+	 (size_t) 2 );
+
+	result = memory_compare(
+	          key->data,
+	          leaf_key,
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the key of the last page value of a leaf page
+	 */
+	result = libesedb_page_tree_cursor_get_page(
+	          page_tree_cursor,
+	          file_io_handle,
+	          3,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	result = libesedb_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_key(
+	          page_tree_cursor,
+	          page,
+	          3,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key->data_size",
+	 key->data_size,
+	 (size_t) 2 );
+
+	result = memory_compare(
+	          key->data,
+	          last_key,
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the key of a page value of a branch page
+	 */
+	result = libesedb_page_tree_cursor_get_page(
+	          page_tree_cursor,
+	          file_io_handle,
+	          1,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	result = libesedb_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_key(
+	          page_tree_cursor,
+	          page,
+	          1,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key->data_size",
+	 key->data_size,
+	 (size_t) 2 );
+
+	result = memory_compare(
+	          key->data,
+	          branch_key,
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test the empty key of the last page value of a branch page
+	 */
+	result = libesedb_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_key(
+	          page_tree_cursor,
+	          page,
+	          2,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key->data_size",
+	 key->data_size,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_get_key(
+	          NULL,
+	          page,
+	          1,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_get_key(
+	          page_tree_cursor,
+	          page,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_get_key(
+	          page_tree_cursor,
+	          NULL,
+	          1,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the page value index is out of bounds
+	 */
+	result = libesedb_page_tree_cursor_get_key(
+	          page_tree_cursor,
+	          page,
+	          3,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_tree_cursor_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	esedb_test_page_tree_cursor_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_get_leaf_value_key function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_get_leaf_value_key(
+     void )
+{
+	uint8_t between_pages_key[ 2 ]                = { 0x10, 0x30 };
+	uint8_t first_key[ 2 ]                        = { 0x10, 0x01 };
+	uint8_t last_key[ 2 ]                         = { 0x20, 0x00 };
+	uint8_t next_page_key[ 2 ]                    = { 0x10, 0x81 };
+
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_key_t *key                           = NULL;
+	libesedb_data_definition_t *data_definition   = NULL;
+	libesedb_key_t *seek_key                      = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	libfcache_cache_t *pages_cache                = NULL;
+	libfdata_vector_t *pages_vector               = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_cursor_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_initialize(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* Test the key of the first leaf value
+	 */
+	result = libesedb_key_initialize(
+	          &seek_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	seek_key->type = LIBESEDB_KEY_TYPE_SEEK_VALUE;
+
+	result = libesedb_key_set_data(
+	          seek_key,
+	          first_key,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_seek_leaf_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          seek_key,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_next_leaf_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_leaf_value_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key->data_size",
+	 key->data_size,
+	 (size_t) 2 );
+
+	result = memory_compare(
+	          key->data,
+	          first_key,
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_free(
+	          &seek_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the key of the leaf value that follows a key between two leaf pages
+	 */
+	result = libesedb_key_initialize(
+	          &seek_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	seek_key->type = LIBESEDB_KEY_TYPE_SEEK_VALUE;
+
+	result = libesedb_key_set_data(
+	          seek_key,
+	          between_pages_key,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_seek_leaf_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          seek_key,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_next_leaf_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_leaf_value_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key->data_size",
+	 key->data_size,
+	 (size_t) 2 );
+
+	result = memory_compare(
+	          key->data,
+	          next_page_key,
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_free(
+	          &seek_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the key of the last leaf value after a sequential read
+	 */
+	result = libesedb_key_initialize(
+	          &seek_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	seek_key->type = LIBESEDB_KEY_TYPE_SEEK_VALUE;
+
+	result = libesedb_key_set_data(
+	          seek_key,
+	          next_page_key,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_seek_leaf_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          seek_key,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_next_leaf_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_free(
+	          &seek_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_next_leaf_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_next_leaf_value(
+	          page_tree_cursor,
+	          file_io_handle,
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_leaf_value_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key->data_size",
+	 key->data_size,
+	 (size_t) 2 );
+
+	result = memory_compare(
+	          key->data,
+	          last_key,
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_get_leaf_value_key(
+	          NULL,
+	          file_io_handle,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_cursor_get_leaf_value_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_tree_cursor_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( seek_key != NULL )
+	{
+		libesedb_key_free(
+		 &seek_key,
+		 NULL );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	esedb_test_page_tree_cursor_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_cursor_seek_leaf_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_cursor_seek_leaf_value(
+     void )
+{
+	uint8_t before_first_key[ 1 ]                 = { 0x05 };
+	uint8_t between_keys_key[ 2 ]                 = { 0x10, 0x10 };
+	uint8_t between_pages_key[ 2 ]                = { 0x10, 0x30 };
+	uint8_t branch_key[ 2 ]                       = { 0x10, 0x81 };
+	uint8_t exact_key[ 2 ]                        = { 0x10, 0x05 };
+	uint8_t first_key[ 2 ]                        = { 0x10, 0x01 };
+	uint8_t last_key[ 2 ]                         = { 0x20, 0x00 };
+	uint8_t past_last_key[ 1 ]                    = { 0x30 };
+
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_page_tree_cursor_t *page_tree_cursor = NULL;
+	libfcache_cache_t *pages_cache                = NULL;
+	libfdata_vector_t *pages_vector               = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_cursor_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_cursor_initialize(
+	          &page_tree_cursor,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an exact hit
+	 */
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          exact_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          1,
+	          2,
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          first_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          1,
+	          2,
+	          1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test an exact hit on the key of the branch page value, which refers to the next leaf page
+	 */
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          branch_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          1,
+	          3,
+	          1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          branch_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS,
+	          1,
+	          2,
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          branch_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL,
+	          1,
+	          3,
+	          1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a key between two keys of leaf values
+	 */
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          between_keys_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          0,
+	          0,
+	          0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          between_keys_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL,
+	          1,
+	          2,
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          between_keys_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL,
+	          1,
+	          2,
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a key between the last key of a leaf page and the first key of the next leaf page
+	 */
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          between_pages_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL,
+	          1,
+	          3,
+	          1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          between_pages_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS,
+	          1,
+	          2,
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          exact_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER,
+	          1,
+	          2,
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a key before the first leaf value
+	 */
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          before_first_key,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS,
+	          0,
+	          0,
+	          0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          before_first_key,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER,
+	          1,
+	          2,
+	          1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a key past the last leaf value
+	 */
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          past_last_key,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          0,
+	          0,
+	          0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          past_last_key,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL,
+	          0,
+	          0,
+	          0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          last_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER,
+	          0,
+	          0,
+	          0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          past_last_key,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS,
+	          1,
+	          3,
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test keys that only differ in the high bit of the second byte, where the leaf
+	 * root page contains the key 0x10 0x01 but not the key 0x10 0x81
+	 */
+	page_tree_cursor->root_page_number = 4;
+
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          branch_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          0,
+	          0,
+	          0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          branch_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER_OR_EQUAL,
+	          1,
+	          4,
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          branch_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_LESS_OR_EQUAL,
+	          1,
+	          4,
+	          1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_page_tree_cursor_seek_leaf_value_with_key(
+	          page_tree_cursor,
+	          file_io_handle,
+	          first_key,
+	          2,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          1,
+	          4,
+	          1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_cursor_seek_leaf_value(
+	          NULL,
+	          NULL,
+	          NULL,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_cursor_free(
+	          &page_tree_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_cursor",
+	 page_tree_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_tree_cursor_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &pages_vector,
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree_cursor != NULL )
+	{
+		libesedb_page_tree_cursor_free(
+		 &page_tree_cursor,
+		 NULL );
+	}
+	esedb_test_page_tree_cursor_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &pages_vector,
+	 &pages_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_initialize",
+	 esedb_test_page_tree_cursor_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_free",
+	 esedb_test_page_tree_cursor_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_get_page",
+	 esedb_test_page_tree_cursor_get_page );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_get_branch_page",
+	 esedb_test_page_tree_cursor_get_branch_page );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_cache_branch_page",
+	 esedb_test_page_tree_cursor_cache_branch_page );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_get_child_page_number",
+	 esedb_test_page_tree_cursor_get_child_page_number );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_get_outer_leaf_page_number",
+	 esedb_test_page_tree_cursor_get_outer_leaf_page_number );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_read_leaf_page_header",
+	 esedb_test_page_tree_cursor_read_leaf_page_header );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_get_leaf_value",
+	 esedb_test_page_tree_cursor_get_leaf_value );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_get_next_leaf_value",
+	 esedb_test_page_tree_cursor_get_next_leaf_value );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_get_next_leaf_value",
+	 esedb_test_page_tree_cursor_get_next_leaf_value_page_chain );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_get_previous_leaf_value",
+	 esedb_test_page_tree_cursor_get_previous_leaf_value );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_get_previous_leaf_value",
+	 esedb_test_page_tree_cursor_get_previous_leaf_value_page_chain );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_get_key",
+	 esedb_test_page_tree_cursor_get_key );
+
+	/* TODO: add tests for libesedb_page_tree_cursor_compare_key */
+
+	/* TODO: add tests for libesedb_page_tree_cursor_get_lower_bound_page_value_index */
+
+	/* TODO: add tests for libesedb_page_tree_cursor_compare_leaf_value_key */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_get_leaf_value_key",
+	 esedb_test_page_tree_cursor_get_leaf_value_key );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_seek_leaf_value",
+	 esedb_test_page_tree_cursor_seek_leaf_value );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_cursor_get_number_of_leaf_values",
+	 esedb_test_page_tree_cursor_get_number_of_leaf_values );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,616 @@
+/*
+ * Library predicate type test program
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_predicate.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_predicate_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_predicate_initialize(
+     void )
+{
+	uint8_t value_data[ 4 ]         = { 0x01, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error        = NULL;
+	libesedb_predicate_t *predicate = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libesedb_predicate_initialize(
+	          &predicate,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "predicate",
+	 predicate );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_predicate_free(
+	          &predicate,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "predicate",
+	 predicate );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_predicate_initialize(
+	          NULL,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	predicate = (libesedb_predicate_t *) 0x12345678UL;
+
+	result = libesedb_predicate_initialize(
+	          &predicate,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          value_data,
+	          4,
+	          &error );
+
+	predicate = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_predicate_initialize(
+	          &predicate,
+	          1,
+	          -1,
+	          value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_predicate_initialize(
+	          &predicate,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          NULL,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_predicate_initialize(
+	          &predicate,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+	          value_data,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_predicate_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_predicate_initialize(
+		          &predicate,
+		          1,
+		          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+		          value_data,
+		          4,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( predicate != NULL )
+			{
+				libesedb_predicate_free(
+				 &predicate,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "predicate",
+			 predicate );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_predicate_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_predicate_initialize(
+		          &predicate,
+		          1,
+		          LIBESEDB_COMPARISON_OPERATOR_EQUAL,
+		          value_data,
+		          4,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( predicate != NULL )
+			{
+				libesedb_predicate_free(
+				 &predicate,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "predicate",
+			 predicate );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( predicate != NULL )
+	{
+		libesedb_predicate_free(
+		 &predicate,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_predicate_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_predicate_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_predicate_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_predicate_compare_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_predicate_compare_data(
+     void )
+{
+	uint8_t binary_data[ 3 ]         = { 'a', 'b', 'c' };
+	uint8_t negative_data[ 4 ]       = { 0xfe, 0xff, 0xff, 0xff };
+	uint8_t positive_data[ 4 ]       = { 0x02, 0x00, 0x00, 0x00 };
+	uint8_t value_data[ 4 ]          = { 0x01, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error         = NULL;
+	libesedb_predicate_t *predicate  = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_predicate_initialize(
+	          &predicate,
+	          1,
+	          LIBESEDB_COMPARISON_OPERATOR_GREATER,
+	          value_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "predicate",
+	 predicate );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_predicate_compare_data(
+	          predicate,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          positive_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* -2 is less than 1 as a signed integer
+	 */
+	result = libesedb_predicate_compare_data(
+	          predicate,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          negative_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* 0xfffffffe is greater than 1 as an unsigned integer
+	 */
+	result = libesedb_predicate_compare_data(
+	          predicate,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED,
+	          negative_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Binary data is compared byte-wise
+	 */
+	result = libesedb_predicate_compare_data(
+	          predicate,
+	          LIBESEDB_COLUMN_TYPE_BINARY_DATA,
+	          binary_data,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A column without data never matches
+	 */
+	result = libesedb_predicate_compare_data(
+	          predicate,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_predicate_compare_data(
+	          NULL,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          positive_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_predicate_compare_data(
+	          predicate,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED,
+	          positive_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_predicate_compare_data(
+	          predicate,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          positive_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_predicate_free(
+	          &predicate,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "predicate",
+	 predicate );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( predicate != NULL )
+	{
+		libesedb_predicate_free(
+		 &predicate,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_predicate_initialize",
+	 esedb_test_predicate_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_predicate_free",
+	 esedb_test_predicate_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_predicate_compare_data",
+	 esedb_test_predicate_compare_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,33 +21,2187 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_libcdata.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
+#include "esedb_test_libfvalue.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_io_handle.h"
 #include "../libesedb/libesedb_record.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+uint8_t esedb_test_record_7bit_compressed_data[ 50 ] = {
+	0x10, 0xd2, 0xa2, 0x0e, 0x04, 0x42, 0xbd, 0x82, 0xf2, 0x31, 0x3a, 0x5d, 0x36, 0xb7, 0xc3, 0x70,
+	0x78, 0xd9, 0xfd, 0xb2, 0x96, 0xe5, 0xf7, 0xb4, 0x9a, 0x5c, 0x96, 0x93, 0xcb, 0xa0, 0x34, 0xbd,
+	0xdc, 0x9e, 0xbf, 0xac, 0x65, 0xb9, 0xfe, 0xed, 0x26, 0x97, 0xdd, 0xa0, 0x34, 0xbd, 0xdc, 0x9e,
+	0xa7, 0x00 };
+
+uint8_t esedb_test_record_7bit_uncompressed_utf8_string[ 56 ] = {
+	0x52, 0x45, 0x3a, 0x20, 0x20, 0x28, 0x2f, 0x41, 0x72, 0x63, 0x68, 0x69, 0x65, 0x66, 0x6d, 0x61,
+	0x70, 0x70, 0x65, 0x6e, 0x2f, 0x56, 0x65, 0x72, 0x77, 0x69, 0x6a, 0x64, 0x65, 0x72, 0x64, 0x65,
+	0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x2f, 0x56, 0x65, 0x72, 0x7a, 0x6f, 0x6e, 0x64, 0x65, 0x6e,
+	0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x29, 0x00 };
+
+/* The UTF-16 little-endian string: LZXPRESS string compressed in LZXpress
+ * including leading byte 0x18 and uncompressed data size 0x001e
+ */
+uint8_t esedb_test_record_lzxpress_compressed_utf16_string[ 37 ] = {
+	0x18, 0x1e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x5a, 0x00, 0x58, 0x00, 0x50, 0x00, 0x52,
+	0x00, 0x45, 0x00, 0x53, 0x00, 0x53, 0x00, 0x20, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69,
+	0x00, 0x6e, 0x00, 0x67, 0x00 };
+
+uint16_t esedb_test_record_lzxpress_uncompressed_utf16_string[ 16 ] = {
+	0x4c, 0x5a, 0x58, 0x50, 0x52, 0x45, 0x53, 0x53, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00 };
 
 /* Tests the libesedb_record_free function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_record_free(
+int esedb_test_record_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_record_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Appends a column catalog definition to the table definition
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_record_append_column(
+     libesedb_table_definition_t *table_definition,
+     uint32_t column_identifier,
+     uint32_t column_type,
+     const char *name,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	size_t name_size                                         = 0;
+
+	if( libesedb_catalog_definition_initialize(
+	     &column_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	column_catalog_definition->type        = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+	column_catalog_definition->identifier  = column_identifier;
+	column_catalog_definition->column_type = column_type;
+	column_catalog_definition->codepage    = 1252;
+
+	name_size = narrow_string_length(
+	             name );
+
+	column_catalog_definition->name = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * name_size );
+
+	if( column_catalog_definition->name == NULL )
+	{
+		goto on_error;
+	}
+	column_catalog_definition->name_size = name_size;
+
+	if( memory_copy(
+	     column_catalog_definition->name,
+	     name,
+	     name_size ) == NULL )
+	{
+		goto on_error;
+	}
+	if( libesedb_table_definition_append_column_catalog_definition(
+	     table_definition,
+	     column_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a text record value with specific data and data flags to the values array
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_record_append_value(
+     libcdata_array_t *values_array,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t data_flags,
+     libcerror_error_t **error )
+{
+	libfvalue_data_handle_t *value_data_handle = NULL;
+	libfvalue_value_t *record_value            = NULL;
+	int entry_index                            = 0;
+
+	if( libfvalue_data_handle_initialize(
+	     &value_data_handle,
+	     NULL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfvalue_data_handle_set_data(
+	     value_data_handle,
+	     data,
+	     data_size,
+	     1252,
+	     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfvalue_data_handle_set_data_flags(
+	     value_data_handle,
+	     data_flags,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfvalue_value_type_initialize_with_data_handle(
+	     &record_value,
+	     LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM,
+	     value_data_handle,
+	     LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	value_data_handle = NULL;
+
+	if( libcdata_array_append_entry(
+	     values_array,
+	     &entry_index,
+	     (intptr_t *) record_value,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record_value != NULL )
+	{
+		libfvalue_value_free(
+		 &record_value,
+		 NULL );
+	}
+	if( value_data_handle != NULL )
+	{
+		libfvalue_data_handle_free(
+		 &value_data_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a record of a table definition with the values of a values array
+ * The record takes over management of the values array
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_record_initialize_with_values(
+     libesedb_record_t **record,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libcdata_array_t **values_array,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	static char *function                       = "esedb_test_record_initialize_with_values";
+
+	internal_record = memory_allocate_structure(
+	                   libesedb_internal_record_t );
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_record,
+	     0,
+	     sizeof( libesedb_internal_record_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record.",
+		 function );
+
+		memory_free(
+		 internal_record );
+
+		return( -1 );
+	}
+	internal_record->table_definition          = table_definition;
+	internal_record->template_table_definition = template_table_definition;
+	internal_record->values_array              = *values_array;
+	internal_record->decompressed_value_entry  = -1;
+
+	*values_array = NULL;
+	*record       = (libesedb_record_t *) internal_record;
+
+	return( 1 );
+}
+
+/* Creates a table definition without columns
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_record_initialize_table_definition(
+     libesedb_table_definition_t **table_definition,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *table_catalog_definition = NULL;
+
+	if( libesedb_catalog_definition_initialize(
+	     &table_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	table_catalog_definition->type = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+
+	if( libesedb_table_definition_initialize(
+	     table_definition,
+	     table_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates the table definition and a record with a 7-bit compressed text value
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_record_initialize_test_data(
+     libesedb_record_t **record,
+     libesedb_table_definition_t **table_definition,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *values_array = NULL;
+
+	if( esedb_test_record_initialize_table_definition(
+	     table_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_record_append_column(
+	     *table_definition,
+	     256,
+	     LIBESEDB_COLUMN_TYPE_LARGE_TEXT,
+	     "Subject",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &values_array,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_record_append_value(
+	     values_array,
+	     esedb_test_record_7bit_compressed_data,
+	     50,
+	     LIBESEDB_VALUE_FLAG_COMPRESSED,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_record_initialize_with_values(
+	     record,
+	     *table_definition,
+	     NULL,
+	     &values_array,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( values_array != NULL )
+	{
+		libcdata_array_free(
+		 &values_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
+		 NULL );
+	}
+	if( *table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 table_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates the template table definition, the table definition and a record with named columns
+ * The template table defines the columns "Identifier" and "Name" and the table the columns
+ * "Column128", "Column1305286" and "Name", where "Column128" and "Column1305286" have the same name hash
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_record_initialize_column_test_data(
+     libesedb_record_t **record,
+     libesedb_table_definition_t **template_table_definition,
+     libesedb_table_definition_t **table_definition,
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *values_array = NULL;
+	int value_index                = 0;
+
+	if( esedb_test_record_initialize_table_definition(
+	     template_table_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_record_append_column(
+	     *template_table_definition,
+	     1,
+	     LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED,
+	     "Identifier",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_record_append_column(
+	     *template_table_definition,
+	     2,
+	     LIBESEDB_COLUMN_TYPE_TEXT,
+	     "Name",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_record_initialize_table_definition(
+	     table_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_record_append_column(
+	     *table_definition,
+	     256,
+	     LIBESEDB_COLUMN_TYPE_TEXT,
+	     "Column128",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_record_append_column(
+	     *table_definition,
+	     257,
+	     LIBESEDB_COLUMN_TYPE_TEXT,
+	     "Column1305286",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_record_append_column(
+	     *table_definition,
+	     258,
+	     LIBESEDB_COLUMN_TYPE_TEXT,
+	     "Name",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &values_array,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		if( esedb_test_record_append_value(
+		     values_array,
+		     esedb_test_record_7bit_uncompressed_utf8_string,
+		     56,
+		     0,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( esedb_test_record_initialize_with_values(
+	     record,
+	     *table_definition,
+	     *template_table_definition,
+	     &values_array,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( (libesedb_internal_record_t *) *record )->io_handle = io_handle;
+
+	return( 1 );
+
+on_error:
+	if( values_array != NULL )
+	{
+		libcdata_array_free(
+		 &values_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
+		 NULL );
+	}
+	if( *table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 table_definition,
+		 NULL );
+	}
+	if( *template_table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 template_table_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libesedb_record_get_value_entry_by_column_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_get_value_entry_by_column_identifier(
+     void )
+{
+	libcerror_error_t *error                               = NULL;
+	libesedb_internal_record_t *internal_record            = NULL;
+	libesedb_io_handle_t *io_handle                        = NULL;
+	libesedb_record_t *record                              = NULL;
+	libesedb_table_definition_t *table_definition          = NULL;
+	libesedb_table_definition_t *template_table_definition = NULL;
+	int result                                             = 0;
+	int value_entry                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_record_initialize_column_test_data(
+	          &record,
+	          &template_table_definition,
+	          &table_definition,
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record = (libesedb_internal_record_t *) record;
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_get_value_entry_by_column_identifier(
+	          record,
+	          1,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_entry",
+	 value_entry,
+	 0 );
+
+	result = libesedb_record_get_value_entry_by_column_identifier(
+	          record,
+	          2,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_entry",
+	 value_entry,
+	 1 );
+
+	result = libesedb_record_get_value_entry_by_column_identifier(
+	          record,
+	          256,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_entry",
+	 value_entry,
+	 2 );
+
+	result = libesedb_record_get_value_entry_by_column_identifier(
+	          record,
+	          257,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_entry",
+	 value_entry,
+	 3 );
+
+	result = libesedb_record_get_value_entry_by_column_identifier(
+	          record,
+	          258,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_entry",
+	 value_entry,
+	 4 );
+
+	/* Test that a column that is not defined is not found
+	 */
+	result = libesedb_record_get_value_entry_by_column_identifier(
+	          record,
+	          3,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_get_value_entry_by_column_identifier(
+	          NULL,
+	          1,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_record->io_handle = NULL;
+
+	result = libesedb_record_get_value_entry_by_column_identifier(
+	          record,
+	          1,
+	          &value_entry,
+	          &error );
+
+	internal_record->io_handle = io_handle;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_record->table_definition = NULL;
+
+	result = libesedb_record_get_value_entry_by_column_identifier(
+	          record,
+	          1,
+	          &value_entry,
+	          &error );
+
+	internal_record->table_definition = table_definition;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_value_entry_by_column_identifier(
+	          record,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_definition",
+	 table_definition );
+
+	result = libesedb_table_definition_free(
+	          &template_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "template_table_definition",
+	 template_table_definition );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( template_table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &template_table_definition,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_get_value_entry_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_get_value_entry_by_utf8_name(
+     void )
+{
+	libcerror_error_t *error                               = NULL;
+	libesedb_internal_record_t *internal_record            = NULL;
+	libesedb_io_handle_t *io_handle                        = NULL;
+	libesedb_record_t *record                              = NULL;
+	libesedb_table_definition_t *table_definition          = NULL;
+	libesedb_table_definition_t *template_table_definition = NULL;
+	int result                                             = 0;
+	int value_entry                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_record_initialize_column_test_data(
+	          &record,
+	          &template_table_definition,
+	          &table_definition,
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record = (libesedb_internal_record_t *) record;
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_get_value_entry_by_utf8_name(
+	          record,
+	          (uint8_t *) "Identifier",
+	          10,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_entry",
+	 value_entry,
+	 0 );
+
+	/* Test that the template table column precedes the table column with the same name
+	 */
+	result = libesedb_record_get_value_entry_by_utf8_name(
+	          record,
+	          (uint8_t *) "Name",
+	          4,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_entry",
+	 value_entry,
+	 1 );
+
+	result = libesedb_record_get_value_entry_by_utf8_name(
+	          record,
+	          (uint8_t *) "Column128",
+	          9,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_entry",
+	 value_entry,
+	 2 );
+
+	/* Test that a column with a different name and the same name hash is not returned
+	 */
+	result = libesedb_record_get_value_entry_by_utf8_name(
+	          record,
+	          (uint8_t *) "Column1305286",
+	          13,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_entry",
+	 value_entry,
+	 3 );
+
+	/* Test that a column that is not defined is not found
+	 */
+	result = libesedb_record_get_value_entry_by_utf8_name(
+	          record,
+	          (uint8_t *) "Missing",
+	          7,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_get_value_entry_by_utf8_name(
+	          NULL,
+	          (uint8_t *) "Name",
+	          4,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_record->io_handle = NULL;
+
+	result = libesedb_record_get_value_entry_by_utf8_name(
+	          record,
+	          (uint8_t *) "Name",
+	          4,
+	          &value_entry,
+	          &error );
+
+	internal_record->io_handle = io_handle;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_record->table_definition = NULL;
+
+	result = libesedb_record_get_value_entry_by_utf8_name(
+	          record,
+	          (uint8_t *) "Name",
+	          4,
+	          &value_entry,
+	          &error );
+
+	internal_record->table_definition = table_definition;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_value_entry_by_utf8_name(
+	          record,
+	          NULL,
+	          4,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_value_entry_by_utf8_name(
+	          record,
+	          (uint8_t *) "Name",
+	          4,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_definition",
+	 table_definition );
+
+	result = libesedb_table_definition_free(
+	          &template_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "template_table_definition",
+	 template_table_definition );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( template_table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &template_table_definition,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_get_value_entry_by_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_get_value_entry_by_utf16_name(
+     void )
+{
+	uint16_t utf16_identifier[ 11 ]                        = { 'I', 'd', 'e', 'n', 't', 'i', 'f', 'i', 'e', 'r', 0 };
+	uint16_t utf16_name[ 5 ]                               = { 'N', 'a', 'm', 'e', 0 };
+	uint16_t utf16_column128[ 10 ]                         = { 'C', 'o', 'l', 'u', 'm', 'n', '1', '2', '8', 0 };
+	uint16_t utf16_column1305286[ 14 ]                     = { 'C', 'o', 'l', 'u', 'm', 'n', '1', '3', '0', '5', '2', '8', '6', 0 };
+	uint16_t utf16_missing[ 8 ]                            = { 'M', 'i', 's', 's', 'i', 'n', 'g', 0 };
+
+	libcerror_error_t *error                               = NULL;
+	libesedb_internal_record_t *internal_record            = NULL;
+	libesedb_io_handle_t *io_handle                        = NULL;
+	libesedb_record_t *record                              = NULL;
+	libesedb_table_definition_t *table_definition          = NULL;
+	libesedb_table_definition_t *template_table_definition = NULL;
+	int result                                             = 0;
+	int value_entry                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_record_initialize_column_test_data(
+	          &record,
+	          &template_table_definition,
+	          &table_definition,
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record = (libesedb_internal_record_t *) record;
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_get_value_entry_by_utf16_name(
+	          record,
+	          utf16_identifier,
+	          10,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_entry",
+	 value_entry,
+	 0 );
+
+	/* Test that the template table column precedes the table column with the same name
+	 */
+	result = libesedb_record_get_value_entry_by_utf16_name(
+	          record,
+	          utf16_name,
+	          4,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_entry",
+	 value_entry,
+	 1 );
+
+	result = libesedb_record_get_value_entry_by_utf16_name(
+	          record,
+	          utf16_column128,
+	          9,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_entry",
+	 value_entry,
+	 2 );
+
+	/* Test that a column with a different name and the same name hash is not returned
+	 */
+	result = libesedb_record_get_value_entry_by_utf16_name(
+	          record,
+	          utf16_column1305286,
+	          13,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_entry",
+	 value_entry,
+	 3 );
+
+	/* Test that a column that is not defined is not found
+	 */
+	result = libesedb_record_get_value_entry_by_utf16_name(
+	          record,
+	          utf16_missing,
+	          7,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_get_value_entry_by_utf16_name(
+	          NULL,
+	          utf16_name,
+	          4,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_record->io_handle = NULL;
+
+	result = libesedb_record_get_value_entry_by_utf16_name(
+	          record,
+	          utf16_name,
+	          4,
+	          &value_entry,
+	          &error );
+
+	internal_record->io_handle = io_handle;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_record->table_definition = NULL;
+
+	result = libesedb_record_get_value_entry_by_utf16_name(
+	          record,
+	          utf16_name,
+	          4,
+	          &value_entry,
+	          &error );
+
+	internal_record->table_definition = table_definition;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_value_entry_by_utf16_name(
+	          record,
+	          NULL,
+	          4,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_value_entry_by_utf16_name(
+	          record,
+	          utf16_name,
+	          4,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_definition",
+	 table_definition );
+
+	result = libesedb_table_definition_free(
+	          &template_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "template_table_definition",
+	 template_table_definition );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( template_table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &template_table_definition,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_get_value_utf8_string_size and libesedb_record_get_value_utf8_string functions
+ * with a 7-bit compressed value
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_get_value_utf8_string_7bit_compressed(
+     void )
+{
+	uint8_t utf8_string[ 56 ];
+
+	libcerror_error_t *error                      = NULL;
+	libesedb_internal_record_t *internal_record   = NULL;
+	libesedb_record_t *record                     = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	size_t utf16_string_size                      = 0;
+	size_t utf8_string_size                       = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_record_initialize_test_data(
+	          &record,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record = (libesedb_internal_record_t *) record;
+
+	/* Test regular cases
+	 * The 7-bit compressed value is converted directly into an UTF-8 string
+	 * without retaining the decompressed value data
+	 */
+	result = libesedb_record_get_value_utf8_string_size(
+	          record,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "internal_record->decompressed_value_data",
+	 internal_record->decompressed_value_data );
+
+	result = libesedb_record_get_value_utf8_string(
+	          record,
+	          0,
+	          utf8_string,
+	          56,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          esedb_test_record_7bit_uncompressed_utf8_string,
+	          56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "internal_record->decompressed_value_data",
+	 internal_record->decompressed_value_data );
+
+	/* The UTF-16 string functions retain the decompressed value data
+	 */
+	result = libesedb_record_get_value_utf16_string_size(
+	          record,
+	          0,
+	          &utf16_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_record->decompressed_value_data",
+	 internal_record->decompressed_value_data );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_get_value_utf8_string_size(
+	          NULL,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_value_utf8_string(
+	          NULL,
+	          0,
+	          utf8_string,
+	          56,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_definition",
+	 table_definition );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_get_decompressed_value_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_get_decompressed_value_data(
      void )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	uint16_t utf16_string[ 16 ];
+
+	libcerror_error_t *error                      = NULL;
+	libesedb_internal_record_t *internal_record   = NULL;
+	libesedb_record_t *record                     = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	libfvalue_value_t *record_value               = NULL;
+	const uint8_t *decompressed_data              = NULL;
+	const uint8_t *retained_data                  = NULL;
+	size_t decompressed_data_size                 = 0;
+	size_t utf16_string_size                      = 0;
+	uint8_t leading_byte                          = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 * Value 0 contains the 7-bit compressed value and value 1 the LZXPRESS compressed value
+	 */
+	result = esedb_test_record_initialize_test_data(
+	          &record,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record = (libesedb_internal_record_t *) record;
+
+	result = esedb_test_record_append_column(
+	          table_definition,
+	          257,
+	          LIBESEDB_COLUMN_TYPE_LARGE_TEXT,
+	          "Body",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_record_append_value(
+	          internal_record->values_array,
+	          esedb_test_record_lzxpress_compressed_utf16_string,
+	          37,
+	          LIBESEDB_VALUE_FLAG_COMPRESSED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_entry_by_index(
+	          internal_record->values_array,
+	          0,
+	          (intptr_t **) &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * 7-bit compressed data is only decompressed when requested
+	 */
+	result = libesedb_record_get_decompressed_value_data(
+	          internal_record,
+	          0,
+	          record_value,
+	          &decompressed_data,
+	          &decompressed_data_size,
+	          &leading_byte,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "internal_record->decompressed_value_data",
+	 internal_record->decompressed_value_data );
+
+	result = libesedb_record_get_decompressed_value_data(
+	          internal_record,
+	          0,
+	          record_value,
+	          &decompressed_data,
+	          &decompressed_data_size,
+	          &leading_byte,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "decompressed_data_size",
+	 decompressed_data_size,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "leading_byte",
+	 leading_byte,
+	 (uint8_t) 0x10 );
+
+	result = memory_compare(
+	          decompressed_data,
+	          esedb_test_record_7bit_uncompressed_utf8_string,
+	          56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_record->decompressed_value_entry",
+	 internal_record->decompressed_value_entry,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "internal_record->decompressed_value_data",
+	 (intptr_t) internal_record->decompressed_value_data,
+	 (intptr_t) decompressed_data );
+
+	/* The retained decompressed data is returned without accessing the record value
+	 */
+	retained_data = decompressed_data;
+
+	result = libesedb_record_get_decompressed_value_data(
+	          internal_record,
+	          0,
+	          NULL,
+	          &decompressed_data,
+	          &decompressed_data_size,
+	          &leading_byte,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "decompressed_data",
+	 (intptr_t) decompressed_data,
+	 (intptr_t) retained_data );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "decompressed_data_size",
+	 decompressed_data_size,
+	 (size_t) 56 );
+
+	/* Retrieving the UTF-16 string size of another value replaces the retained decompressed data
+	 */
+	result = libesedb_record_get_value_utf16_string_size(
+	          record,
+	          1,
+	          &utf16_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 16 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_record->decompressed_value_entry",
+	 internal_record->decompressed_value_entry,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_record->decompressed_value_data_size",
+	 internal_record->decompressed_value_data_size,
+	 (size_t) 30 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_record->decompressed_value_leading_byte",
+	 internal_record->decompressed_value_leading_byte,
+	 (uint8_t) 0x18 );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "internal_record->decompressed_value_data",
+	 (intptr_t) internal_record->decompressed_value_data,
+	 (intptr_t) retained_data );
+
+	/* Retrieving the UTF-16 string of the same value does not decompress the value again
+	 * since new decompressed data is allocated before the retained data is freed
+	 */
+	retained_data = internal_record->decompressed_value_data;
+
+	result = libesedb_record_get_value_utf16_string(
+	          record,
+	          1,
+	          utf16_string,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          esedb_test_record_lzxpress_uncompressed_utf16_string,
+	          sizeof( uint16_t ) * 16 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "internal_record->decompressed_value_data",
+	 (intptr_t) internal_record->decompressed_value_data,
+	 (intptr_t) retained_data );
 
 	/* Test error cases
 	 */
-	result = libesedb_record_free(
+	result = libesedb_record_get_decompressed_value_data(
+	          NULL,
+	          0,
+	          record_value,
+	          &decompressed_data,
+	          &decompressed_data_size,
+	          &leading_byte,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_decompressed_value_data(
+	          internal_record,
+	          0,
+	          record_value,
+	          NULL,
+	          &decompressed_data_size,
+	          &leading_byte,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_decompressed_value_data(
+	          internal_record,
+	          0,
+	          record_value,
+	          &decompressed_data,
+	          NULL,
+	          &leading_byte,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_decompressed_value_data(
+	          internal_record,
+	          0,
+	          record_value,
+	          &decompressed_data,
+	          &decompressed_data_size,
 	          NULL,
+	          1,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -62,6 +2216,43 @@ int esedb_test_record_free(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 * The record frees the retained decompressed data
+	 */
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_definition",
+	 table_definition );
+
 	return( 1 );
 
 on_error:
@@ -70,11 +2261,21 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
-
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -120,6 +2321,18 @@ int main(
 
 	/* TODO: add tests for libesedb_record_get_utf16_column_name */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_record_get_value_entry_by_column_identifier",
+	 esedb_test_record_get_value_entry_by_column_identifier );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_get_value_entry_by_utf8_name",
+	 esedb_test_record_get_value_entry_by_utf8_name );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_get_value_entry_by_utf16_name",
+	 esedb_test_record_get_value_entry_by_utf16_name );
+
 	/* TODO: add tests for libesedb_record_get_value */
 
 	/* TODO: add tests for libesedb_record_get_value_data_size */
@@ -144,9 +2357,13 @@ int main(
 
 	/* TODO: add tests for libesedb_record_get_value_floating_point_64bit */
 
-	/* TODO: add tests for libesedb_record_get_value_utf8_string_size */
+	ESEDB_TEST_RUN(
+	 "libesedb_record_get_decompressed_value_data",
+	 esedb_test_record_get_decompressed_value_data );
 
-	/* TODO: add tests for libesedb_record_get_value_utf8_string */
+	ESEDB_TEST_RUN(
+	 "libesedb_record_get_value_utf8_string",
+	 esedb_test_record_get_value_utf8_string_7bit_compressed );
 
 	/* TODO: add tests for libesedb_record_get_value_utf16_string_size */
 
@@ -160,8 +2377,6 @@ int main(
 
 	/* TODO: add tests for libesedb_record_is_multi_value */
 
-	/* TODO: add tests for libesedb_record_get_long_value_data_segments_list */
-
 	/* TODO: add tests for libesedb_record_get_long_value */
 
 	/* TODO: add tests for libesedb_record_get_multi_value */
@@ -21,19 +21,27 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_io_handle.h"
 #include "../libesedb/libesedb_table.h"
+#include "../libesedb/libesedb_table_definition.h"
 
 /* Tests the libesedb_table_free function
  * Returns 1 if successful or 0 if not
@@ -75,6 +83,4214 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+/* The table test data contains 3 pages of 4096 bytes, with a leaf root page (1)
+ * that contains 3 records. The table has 8 fixed size columns, where column 8
+ * is defined as a 32-bit integer with a data size of 2. The second record only
+ * contains column 1, the other columns of this record are NULL
+ */
+uint8_t esedb_test_table_data[ 3 * 4096 ];
+
+uint8_t esedb_test_table_record_key1[ 5 ] = {
+	0x7f, 0x80, 0x00, 0x00, 0x01 };
+
+uint8_t esedb_test_table_record_key2[ 5 ] = {
+	0x7f, 0x80, 0x00, 0x00, 0x03 };
+
+uint8_t esedb_test_table_record_key3[ 5 ] = {
+	0x7f, 0x80, 0x00, 0x00, 0x05 };
+
+uint8_t esedb_test_table_record_data1[ 44 ] = {
+	0x08, 0x7f, 0x2c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x07, 0xf6, 0xe5, 0xd4, 0xc3, 0xb2, 0xd1, 0x01, 0x00, 0x00, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x40, 0xfe, 0xff, 0xff, 0xff, 0x07, 0x00, 0x08, 0x00 };
+
+uint8_t esedb_test_table_record_data2[ 8 ] = {
+	0x01, 0x7f, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00 };
+
+uint8_t esedb_test_table_record_data3[ 44 ] = {
+	0x08, 0x7f, 0x2c, 0x00, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xe0, 0x3f, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0a, 0x00 };
+
+/* Writes the table test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_table_write_data(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *record_keys[ 3 ]  = { esedb_test_table_record_key1, esedb_test_table_record_key2, esedb_test_table_record_key3 };
+	const uint8_t *records_data[ 3 ] = { esedb_test_table_record_data1, esedb_test_table_record_data2, esedb_test_table_record_data3 };
+	size_t record_key_sizes[ 3 ]     = { 5, 5, 5 };
+	size_t records_data_sizes[ 3 ]   = { 44, 8, 44 };
+
+	if( esedb_test_write_page(
+	     data,
+	     data_size,
+	     4096,
+	     1,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     0,
+	     0,
+	     record_keys,
+	     record_key_sizes,
+	     records_data,
+	     records_data_sizes,
+	     3,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a column catalog definition to the table definition
+ * The name is optional and can be NULL
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_table_append_column(
+     libesedb_table_definition_t *table_definition,
+     uint32_t column_identifier,
+     uint32_t column_type,
+     uint32_t column_size,
+     const char *name,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	size_t name_size                                         = 0;
+
+	if( libesedb_catalog_definition_initialize(
+	     &column_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	column_catalog_definition->type        = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+	column_catalog_definition->identifier  = column_identifier;
+	column_catalog_definition->column_type = column_type;
+	column_catalog_definition->size        = column_size;
+	column_catalog_definition->codepage    = 1252;
+
+	if( name != NULL )
+	{
+		name_size = narrow_string_length(
+		             name );
+
+		column_catalog_definition->name = (uint8_t *) memory_allocate(
+		                                               sizeof( uint8_t ) * name_size );
+
+		if( column_catalog_definition->name == NULL )
+		{
+			goto on_error;
+		}
+		column_catalog_definition->name_size = name_size;
+
+		if( memory_copy(
+		     column_catalog_definition->name,
+		     name,
+		     name_size ) == NULL )
+		{
+			goto on_error;
+		}
+	}
+	if( libesedb_table_definition_append_column_catalog_definition(
+	     table_definition,
+	     column_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees the table, table definition and IO handle of the table test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_table_free_test_data(
+     libbfio_handle_t **file_io_handle,
+     libesedb_io_handle_t **io_handle,
+     libesedb_table_definition_t **table_definition,
+     libesedb_table_t **table,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	if( *table != NULL )
+	{
+		if( libesedb_table_free(
+		     table,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *table_definition != NULL )
+	{
+		if( libesedb_table_definition_free(
+		     table_definition,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *io_handle != NULL )
+	{
+		if( libesedb_io_handle_free(
+		     io_handle,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *file_io_handle != NULL )
+	{
+		if( esedb_test_close_file_io_handle(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Creates the table, table definition and IO handle of the table test data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_table_initialize_test_data(
+     libbfio_handle_t **file_io_handle,
+     libesedb_io_handle_t **io_handle,
+     libesedb_table_definition_t **table_definition,
+     libesedb_table_t **table,
+     libcerror_error_t **error )
+{
+	uint32_t column_sizes[ 8 ]                              = { 4, 8, 8, 4, 8, 4, 2, 2 };
+	uint32_t column_types[ 8 ]                              = {
+		LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED,
+		LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED,
+		LIBESEDB_COLUMN_TYPE_DATE_TIME,
+		LIBESEDB_COLUMN_TYPE_FLOAT_32BIT,
+		LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT,
+		LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+		LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED,
+		LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED };
+
+	libesedb_catalog_definition_t *table_catalog_definition = NULL;
+	uint32_t column_index                                   = 0;
+
+	if( esedb_test_table_write_data(
+	     esedb_test_table_data,
+	     3 * 4096,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_open_file_io_handle(
+	     file_io_handle,
+	     esedb_test_table_data,
+	     3 * 4096,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libesedb_io_handle_initialize(
+	     io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( *io_handle )->format_revision = 0x0000000c;
+	( *io_handle )->page_size       = 4096;
+
+	if( libesedb_io_handle_set_pages_data_range(
+	     *io_handle,
+	     3 * 4096,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libesedb_catalog_definition_initialize(
+	     &table_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	table_catalog_definition->type                    = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+	table_catalog_definition->father_data_page_number = 1;
+
+	if( libesedb_table_definition_initialize(
+	     table_definition,
+	     table_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The table definition now manages the table catalog definition
+	 */
+	table_catalog_definition = NULL;
+
+	for( column_index = 0;
+	     column_index < 8;
+	     column_index++ )
+	{
+		if( esedb_test_table_append_column(
+		     *table_definition,
+		     column_index + 1,
+		     column_types[ column_index ],
+		     column_sizes[ column_index ],
+		     NULL,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libesedb_table_initialize(
+	     table,
+	     *file_io_handle,
+	     *io_handle,
+	     *table_definition,
+	     NULL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	esedb_test_table_free_test_data(
+	 file_io_handle,
+	 io_handle,
+	 table_definition,
+	 table,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libesedb_table_get_column_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_column_by_utf8_name(
+     void )
+{
+	libbfio_handle_t *file_io_handle                        = NULL;
+	libcerror_error_t *error                                = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition = NULL;
+	libesedb_column_t *column                               = NULL;
+	libesedb_io_handle_t *io_handle                         = NULL;
+	libesedb_table_definition_t *table_definition           = NULL;
+	libesedb_table_definition_t *template_table_definition  = NULL;
+	libesedb_table_t *table                                 = NULL;
+	uint32_t column_identifier                              = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_table_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_table_append_column(
+	          table_definition,
+	          256,
+	          LIBESEDB_COLUMN_TYPE_TEXT,
+	          0,
+	          "Column128",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_table_append_column(
+	          table_definition,
+	          257,
+	          LIBESEDB_COLUMN_TYPE_TEXT,
+	          0,
+	          "Column1305286",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_table_append_column(
+	          table_definition,
+	          258,
+	          LIBESEDB_COLUMN_TYPE_TEXT,
+	          0,
+	          "Name",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_catalog_definition",
+	 table_catalog_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition->type = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+
+	result = libesedb_table_definition_initialize(
+	          &template_table_definition,
+	          table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "template_table_definition",
+	 template_table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The template table definition now manages the table catalog definition
+	 */
+	table_catalog_definition = NULL;
+
+	result = esedb_test_table_append_column(
+	          template_table_definition,
+	          1,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED,
+	          4,
+	          "Identifier",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_table_append_column(
+	          template_table_definition,
+	          2,
+	          LIBESEDB_COLUMN_TYPE_TEXT,
+	          0,
+	          "Name",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Recreate the table with the template table definition
+	 */
+	result = libesedb_table_free(
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table",
+	 table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_initialize(
+	          &table,
+	          file_io_handle,
+	          io_handle,
+	          table_definition,
+	          template_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table",
+	 table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          (uint8_t *) "Identifier",
+	          10,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column",
+	 column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_identifier(
+	          column,
+	          &column_identifier,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_identifier",
+	 column_identifier,
+	 (uint32_t) 1 );
+
+	result = libesedb_column_free(
+	          &column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          (uint8_t *) "Column128",
+	          9,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column",
+	 column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_identifier(
+	          column,
+	          &column_identifier,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_identifier",
+	 column_identifier,
+	 (uint32_t) 256 );
+
+	result = libesedb_column_free(
+	          &column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the template table column precedes the table column with the same name
+	 */
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          (uint8_t *) "Name",
+	          4,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column",
+	 column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_identifier(
+	          column,
+	          &column_identifier,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_identifier",
+	 column_identifier,
+	 (uint32_t) 2 );
+
+	result = libesedb_column_free(
+	          &column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          (uint8_t *) "Name",
+	          4,
+	          &column,
+	          LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column",
+	 column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_identifier(
+	          column,
+	          &column_identifier,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_identifier",
+	 column_identifier,
+	 (uint32_t) 258 );
+
+	result = libesedb_column_free(
+	          &column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          (uint8_t *) "Identifier",
+	          10,
+	          &column,
+	          LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "column",
+	 column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a column with a different name and the same name hash is not returned
+	 */
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          (uint8_t *) "Column1305286",
+	          13,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column",
+	 column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_identifier(
+	          column,
+	          &column_identifier,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_identifier",
+	 column_identifier,
+	 (uint32_t) 257 );
+
+	result = libesedb_column_free(
+	          &column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a column that is not defined is not found
+	 */
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          (uint8_t *) "Missing",
+	          7,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "column",
+	 column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_column_by_utf8_name(
+	          NULL,
+	          (uint8_t *) "Name",
+	          4,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          NULL,
+	          4,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          (uint8_t *) "Name",
+	          4,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	column = (libesedb_column_t *) 0x12345678UL;
+
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          (uint8_t *) "Name",
+	          4,
+	          &column,
+	          0,
+	          &error );
+
+	column = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          (uint8_t *) "Name",
+	          4,
+	          &column,
+	          0xfe,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_table_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_free(
+	          &template_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "template_table_definition",
+	 template_table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	esedb_test_table_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &table_definition,
+	 &table,
+	 NULL );
+
+	if( template_table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &template_table_definition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_column_by_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_column_by_utf16_name(
+     void )
+{
+	uint16_t utf16_identifier[ 11 ]                         = { 'I', 'd', 'e', 'n', 't', 'i', 'f', 'i', 'e', 'r', 0 };
+	uint16_t utf16_name[ 5 ]                                = { 'N', 'a', 'm', 'e', 0 };
+	uint16_t utf16_column128[ 10 ]                          = { 'C', 'o', 'l', 'u', 'm', 'n', '1', '2', '8', 0 };
+	uint16_t utf16_column1305286[ 14 ]                      = { 'C', 'o', 'l', 'u', 'm', 'n', '1', '3', '0', '5', '2', '8', '6', 0 };
+	uint16_t utf16_missing[ 8 ]                             = { 'M', 'i', 's', 's', 'i', 'n', 'g', 0 };
+
+	libbfio_handle_t *file_io_handle                        = NULL;
+	libcerror_error_t *error                                = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition = NULL;
+	libesedb_column_t *column                               = NULL;
+	libesedb_io_handle_t *io_handle                         = NULL;
+	libesedb_table_definition_t *table_definition           = NULL;
+	libesedb_table_definition_t *template_table_definition  = NULL;
+	libesedb_table_t *table                                 = NULL;
+	uint32_t column_identifier                              = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_table_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_table_append_column(
+	          table_definition,
+	          256,
+	          LIBESEDB_COLUMN_TYPE_TEXT,
+	          0,
+	          "Column128",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_table_append_column(
+	          table_definition,
+	          257,
+	          LIBESEDB_COLUMN_TYPE_TEXT,
+	          0,
+	          "Column1305286",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_table_append_column(
+	          table_definition,
+	          258,
+	          LIBESEDB_COLUMN_TYPE_TEXT,
+	          0,
+	          "Name",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_catalog_definition",
+	 table_catalog_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition->type = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+
+	result = libesedb_table_definition_initialize(
+	          &template_table_definition,
+	          table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "template_table_definition",
+	 template_table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The template table definition now manages the table catalog definition
+	 */
+	table_catalog_definition = NULL;
+
+	result = esedb_test_table_append_column(
+	          template_table_definition,
+	          1,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED,
+	          4,
+	          "Identifier",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_table_append_column(
+	          template_table_definition,
+	          2,
+	          LIBESEDB_COLUMN_TYPE_TEXT,
+	          0,
+	          "Name",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Recreate the table with the template table definition
+	 */
+	result = libesedb_table_free(
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table",
+	 table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_initialize(
+	          &table,
+	          file_io_handle,
+	          io_handle,
+	          table_definition,
+	          template_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table",
+	 table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          utf16_identifier,
+	          10,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column",
+	 column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_identifier(
+	          column,
+	          &column_identifier,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_identifier",
+	 column_identifier,
+	 (uint32_t) 1 );
+
+	result = libesedb_column_free(
+	          &column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          utf16_column128,
+	          9,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column",
+	 column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_identifier(
+	          column,
+	          &column_identifier,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_identifier",
+	 column_identifier,
+	 (uint32_t) 256 );
+
+	result = libesedb_column_free(
+	          &column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the template table column precedes the table column with the same name
+	 */
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          utf16_name,
+	          4,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column",
+	 column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_identifier(
+	          column,
+	          &column_identifier,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_identifier",
+	 column_identifier,
+	 (uint32_t) 2 );
+
+	result = libesedb_column_free(
+	          &column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          utf16_name,
+	          4,
+	          &column,
+	          LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column",
+	 column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_identifier(
+	          column,
+	          &column_identifier,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_identifier",
+	 column_identifier,
+	 (uint32_t) 258 );
+
+	result = libesedb_column_free(
+	          &column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          utf16_identifier,
+	          10,
+	          &column,
+	          LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "column",
+	 column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a column with a different name and the same name hash is not returned
+	 */
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          utf16_column1305286,
+	          13,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column",
+	 column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_identifier(
+	          column,
+	          &column_identifier,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_identifier",
+	 column_identifier,
+	 (uint32_t) 257 );
+
+	result = libesedb_column_free(
+	          &column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a column that is not defined is not found
+	 */
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          utf16_missing,
+	          7,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "column",
+	 column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_column_by_utf16_name(
+	          NULL,
+	          utf16_name,
+	          4,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          NULL,
+	          4,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          utf16_name,
+	          4,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	column = (libesedb_column_t *) 0x12345678UL;
+
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          utf16_name,
+	          4,
+	          &column,
+	          0,
+	          &error );
+
+	column = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          utf16_name,
+	          4,
+	          &column,
+	          0xfe,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_table_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_free(
+	          &template_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "template_table_definition",
+	 template_table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	esedb_test_table_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &table_definition,
+	 &table,
+	 NULL );
+
+	if( template_table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &template_table_definition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_record_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_record_by_key(
+     void )
+{
+	uint8_t before_first_key[ 5 ]                 = { 0x7f, 0x80, 0x00, 0x00, 0x00 };
+	uint8_t between_keys_key[ 5 ]                 = { 0x7f, 0x80, 0x00, 0x00, 0x02 };
+	uint8_t past_last_key[ 5 ]                    = { 0x7f, 0x80, 0x00, 0x00, 0x07 };
+	uint8_t prefix_key[ 4 ]                       = { 0x7f, 0x80, 0x00, 0x00 };
+
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_record_t *record                     = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	libesedb_table_t *table                       = NULL;
+	uint32_t value_32bit                          = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_table_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_record_by_key(
+	          table,
+	          esedb_test_table_record_key2,
+	          5,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	result = libesedb_record_get_value_32bit(
+	          record,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 2 );
+
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_record_by_key(
+	          table,
+	          esedb_test_table_record_key1,
+	          5,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	result = libesedb_record_get_value_32bit(
+	          record,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 1 );
+
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_record_by_key(
+	          table,
+	          esedb_test_table_record_key3,
+	          5,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	result = libesedb_record_get_value_32bit(
+	          record,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 3 );
+
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a key between the keys of two records
+	 */
+	result = libesedb_table_get_record_by_key(
+	          table,
+	          between_keys_key,
+	          5,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	/* Test keys before the first and after the last record
+	 */
+	result = libesedb_table_get_record_by_key(
+	          table,
+	          before_first_key,
+	          5,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	result = libesedb_table_get_record_by_key(
+	          table,
+	          past_last_key,
+	          5,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	/* Test a key that is a prefix of the keys of the records
+	 */
+	result = libesedb_table_get_record_by_key(
+	          table,
+	          prefix_key,
+	          4,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_record_by_key(
+	          NULL,
+	          esedb_test_table_record_key1,
+	          5,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_by_key(
+	          table,
+	          NULL,
+	          5,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_by_key(
+	          table,
+	          esedb_test_table_record_key1,
+	          0,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_by_key(
+	          table,
+	          esedb_test_table_record_key1,
+	          (size_t) SSIZE_MAX + 1,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_by_key(
+	          table,
+	          esedb_test_table_record_key1,
+	          5,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record = (libesedb_record_t *) 0x12345678UL;
+
+	result = libesedb_table_get_record_by_key(
+	          table,
+	          esedb_test_table_record_key1,
+	          5,
+	          &record,
+	          &error );
+
+	record = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_table_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	esedb_test_table_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &table_definition,
+	 &table,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_record_value_32bit function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_record_value_32bit(
+     void )
+{
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	libesedb_table_t *table                       = NULL;
+	uint32_t value_32bit                          = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_table_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_record_value_32bit(
+	          table,
+	          0,
+	          1,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 1 );
+
+	result = libesedb_table_get_record_value_32bit(
+	          table,
+	          2,
+	          1,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 3 );
+
+	result = libesedb_table_get_record_value_32bit(
+	          table,
+	          0,
+	          6,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0xfffffffeUL );
+
+	result = libesedb_table_get_record_value_32bit(
+	          table,
+	          2,
+	          6,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 6 );
+
+	/* Test a column that is NULL in the second record
+	 */
+	result = libesedb_table_get_record_value_32bit(
+	          table,
+	          1,
+	          6,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_record_value_32bit(
+	          NULL,
+	          0,
+	          1,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_value_32bit(
+	          table,
+	          0,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column type is not a 32-bit integer
+	 */
+	result = libesedb_table_get_record_value_32bit(
+	          table,
+	          0,
+	          2,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column data size is not 4
+	 */
+	result = libesedb_table_get_record_value_32bit(
+	          table,
+	          0,
+	          8,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column is not defined by the table
+	 */
+	result = libesedb_table_get_record_value_32bit(
+	          table,
+	          0,
+	          9,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column is not a fixed size column
+	 */
+	result = libesedb_table_get_record_value_32bit(
+	          table,
+	          0,
+	          128,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the record entry is out of bounds
+	 */
+	result = libesedb_table_get_record_value_32bit(
+	          table,
+	          3,
+	          1,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_value_32bit(
+	          table,
+	          -1,
+	          1,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_table_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_test_table_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &table_definition,
+	 &table,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_record_value_64bit function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_record_value_64bit(
+     void )
+{
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	libesedb_table_t *table                       = NULL;
+	uint64_t value_64bit                          = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_table_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_record_value_64bit(
+	          table,
+	          0,
+	          2,
+	          &value_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x0000000100000002ULL );
+
+	result = libesedb_table_get_record_value_64bit(
+	          table,
+	          2,
+	          2,
+	          &value_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	result = libesedb_table_get_record_value_64bit(
+	          table,
+	          0,
+	          3,
+	          &value_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x01d1b2c3d4e5f607ULL );
+
+	/* Test a column that is NULL in the second record
+	 */
+	result = libesedb_table_get_record_value_64bit(
+	          table,
+	          1,
+	          2,
+	          &value_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_record_value_64bit(
+	          NULL,
+	          0,
+	          2,
+	          &value_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_value_64bit(
+	          table,
+	          0,
+	          2,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column type is not a 64-bit integer
+	 */
+	result = libesedb_table_get_record_value_64bit(
+	          table,
+	          0,
+	          1,
+	          &value_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column is not defined by the table
+	 */
+	result = libesedb_table_get_record_value_64bit(
+	          table,
+	          0,
+	          9,
+	          &value_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the record entry is out of bounds
+	 */
+	result = libesedb_table_get_record_value_64bit(
+	          table,
+	          3,
+	          2,
+	          &value_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_table_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_test_table_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &table_definition,
+	 &table,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_record_value_filetime function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_record_value_filetime(
+     void )
+{
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	libesedb_table_t *table                       = NULL;
+	uint64_t value_64bit                          = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_table_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_record_value_filetime(
+	          table,
+	          0,
+	          3,
+	          &value_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x01d1b2c3d4e5f607ULL );
+
+	result = libesedb_table_get_record_value_filetime(
+	          table,
+	          2,
+	          3,
+	          &value_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x01c0000000000000ULL );
+
+	/* Test a column that is NULL in the second record
+	 */
+	result = libesedb_table_get_record_value_filetime(
+	          table,
+	          1,
+	          3,
+	          &value_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_record_value_filetime(
+	          NULL,
+	          0,
+	          3,
+	          &value_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_value_filetime(
+	          table,
+	          0,
+	          3,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column type is not a date and time
+	 */
+	result = libesedb_table_get_record_value_filetime(
+	          table,
+	          0,
+	          2,
+	          &value_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column is not defined by the table
+	 */
+	result = libesedb_table_get_record_value_filetime(
+	          table,
+	          0,
+	          9,
+	          &value_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the record entry is out of bounds
+	 */
+	result = libesedb_table_get_record_value_filetime(
+	          table,
+	          3,
+	          3,
+	          &value_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_table_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_test_table_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &table_definition,
+	 &table,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_record_value_floating_point_32bit function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_record_value_floating_point_32bit(
+     void )
+{
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	libesedb_table_t *table                       = NULL;
+	float value_floating_point_32bit              = 0.0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_table_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_record_value_floating_point_32bit(
+	          table,
+	          0,
+	          4,
+	          &value_floating_point_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_FLOAT(
+	 "value_floating_point_32bit",
+	 value_floating_point_32bit,
+	 1.5 );
+
+	result = libesedb_table_get_record_value_floating_point_32bit(
+	          table,
+	          2,
+	          4,
+	          &value_floating_point_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_FLOAT(
+	 "value_floating_point_32bit",
+	 value_floating_point_32bit,
+	 -0.5 );
+
+	/* Test a column that is NULL in the second record
+	 */
+	result = libesedb_table_get_record_value_floating_point_32bit(
+	          table,
+	          1,
+	          4,
+	          &value_floating_point_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_record_value_floating_point_32bit(
+	          NULL,
+	          0,
+	          4,
+	          &value_floating_point_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_value_floating_point_32bit(
+	          table,
+	          0,
+	          4,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column type is not a 32-bit floating point
+	 */
+	result = libesedb_table_get_record_value_floating_point_32bit(
+	          table,
+	          0,
+	          5,
+	          &value_floating_point_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column is not defined by the table
+	 */
+	result = libesedb_table_get_record_value_floating_point_32bit(
+	          table,
+	          0,
+	          9,
+	          &value_floating_point_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the record entry is out of bounds
+	 */
+	result = libesedb_table_get_record_value_floating_point_32bit(
+	          table,
+	          3,
+	          4,
+	          &value_floating_point_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_table_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_test_table_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &table_definition,
+	 &table,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_record_value_floating_point_64bit function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_record_value_floating_point_64bit(
+     void )
+{
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	libesedb_table_t *table                       = NULL;
+	double value_floating_point_64bit             = 0.0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_table_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_record_value_floating_point_64bit(
+	          table,
+	          0,
+	          5,
+	          &value_floating_point_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_FLOAT(
+	 "value_floating_point_64bit",
+	 value_floating_point_64bit,
+	 2.25 );
+
+	result = libesedb_table_get_record_value_floating_point_64bit(
+	          table,
+	          2,
+	          5,
+	          &value_floating_point_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_FLOAT(
+	 "value_floating_point_64bit",
+	 value_floating_point_64bit,
+	 0.5 );
+
+	/* Test a column that is NULL in the second record
+	 */
+	result = libesedb_table_get_record_value_floating_point_64bit(
+	          table,
+	          1,
+	          5,
+	          &value_floating_point_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_record_value_floating_point_64bit(
+	          NULL,
+	          0,
+	          5,
+	          &value_floating_point_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_value_floating_point_64bit(
+	          table,
+	          0,
+	          5,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column type is not a 64-bit floating point
+	 */
+	result = libesedb_table_get_record_value_floating_point_64bit(
+	          table,
+	          0,
+	          4,
+	          &value_floating_point_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column is not defined by the table
+	 */
+	result = libesedb_table_get_record_value_floating_point_64bit(
+	          table,
+	          0,
+	          9,
+	          &value_floating_point_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the record entry is out of bounds
+	 */
+	result = libesedb_table_get_record_value_floating_point_64bit(
+	          table,
+	          3,
+	          5,
+	          &value_floating_point_64bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_table_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_test_table_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &table_definition,
+	 &table,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_records_values_32bit function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_records_values_32bit(
+     void )
+{
+	uint32_t values_32bit[ 3 ];
+	uint8_t value_is_set[ 3 ];
+
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	libesedb_table_t *table                       = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_table_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_records_values_32bit(
+	          table,
+	          1,
+	          0,
+	          3,
+	          values_32bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "values_32bit[ 0 ]",
+	 values_32bit[ 0 ],
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "value_is_set[ 0 ]",
+	 value_is_set[ 0 ],
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "values_32bit[ 1 ]",
+	 values_32bit[ 1 ],
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "value_is_set[ 1 ]",
+	 value_is_set[ 1 ],
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "values_32bit[ 2 ]",
+	 values_32bit[ 2 ],
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "value_is_set[ 2 ]",
+	 value_is_set[ 2 ],
+	 1 );
+
+	/* Test a column that is NULL in the second record
+	 */
+	result = libesedb_table_get_records_values_32bit(
+	          table,
+	          6,
+	          0,
+	          3,
+	          values_32bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "values_32bit[ 0 ]",
+	 values_32bit[ 0 ],
+	 (uint32_t) 0xfffffffeUL );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "value_is_set[ 0 ]",
+	 value_is_set[ 0 ],
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "values_32bit[ 1 ]",
+	 values_32bit[ 1 ],
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "value_is_set[ 1 ]",
+	 value_is_set[ 1 ],
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "values_32bit[ 2 ]",
+	 values_32bit[ 2 ],
+	 6 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "value_is_set[ 2 ]",
+	 value_is_set[ 2 ],
+	 1 );
+
+	result = libesedb_table_get_records_values_32bit(
+	          table,
+	          6,
+	          1,
+	          2,
+	          values_32bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "values_32bit[ 0 ]",
+	 values_32bit[ 0 ],
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "value_is_set[ 0 ]",
+	 value_is_set[ 0 ],
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "values_32bit[ 1 ]",
+	 values_32bit[ 1 ],
+	 6 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "value_is_set[ 1 ]",
+	 value_is_set[ 1 ],
+	 1 );
+
+	result = libesedb_table_get_records_values_32bit(
+	          table,
+	          1,
+	          0,
+	          0,
+	          values_32bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_records_values_32bit(
+	          NULL,
+	          1,
+	          0,
+	          3,
+	          values_32bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_records_values_32bit(
+	          table,
+	          1,
+	          -1,
+	          3,
+	          values_32bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_records_values_32bit(
+	          table,
+	          1,
+	          0,
+	          -1,
+	          values_32bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_records_values_32bit(
+	          table,
+	          1,
+	          0,
+	          3,
+	          NULL,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_records_values_32bit(
+	          table,
+	          1,
+	          0,
+	          3,
+	          values_32bit,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column type is not a 32-bit integer
+	 */
+	result = libesedb_table_get_records_values_32bit(
+	          table,
+	          2,
+	          0,
+	          3,
+	          values_32bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column data size is not 4
+	 */
+	result = libesedb_table_get_records_values_32bit(
+	          table,
+	          8,
+	          0,
+	          3,
+	          values_32bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column is not defined by the table
+	 */
+	result = libesedb_table_get_records_values_32bit(
+	          table,
+	          9,
+	          0,
+	          3,
+	          values_32bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the range of records exceeds the number of records
+	 */
+	result = libesedb_table_get_records_values_32bit(
+	          table,
+	          1,
+	          1,
+	          3,
+	          values_32bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_records_values_32bit(
+	          table,
+	          1,
+	          3,
+	          1,
+	          values_32bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_table_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_test_table_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &table_definition,
+	 &table,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_records_values_64bit function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_records_values_64bit(
+     void )
+{
+	uint64_t values_64bit[ 3 ];
+	uint8_t value_is_set[ 3 ];
+
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	libesedb_table_t *table                       = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_table_initialize_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_records_values_64bit(
+	          table,
+	          2,
+	          0,
+	          3,
+	          values_64bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "values_64bit[ 0 ]",
+	 values_64bit[ 0 ],
+	 (uint64_t) 0x0000000100000002ULL );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "value_is_set[ 0 ]",
+	 value_is_set[ 0 ],
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "values_64bit[ 1 ]",
+	 values_64bit[ 1 ],
+	 (uint64_t) 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "value_is_set[ 1 ]",
+	 value_is_set[ 1 ],
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "values_64bit[ 2 ]",
+	 values_64bit[ 2 ],
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "value_is_set[ 2 ]",
+	 value_is_set[ 2 ],
+	 1 );
+
+	result = libesedb_table_get_records_values_64bit(
+	          table,
+	          3,
+	          1,
+	          2,
+	          values_64bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "values_64bit[ 0 ]",
+	 values_64bit[ 0 ],
+	 (uint64_t) 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "value_is_set[ 0 ]",
+	 value_is_set[ 0 ],
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "values_64bit[ 1 ]",
+	 values_64bit[ 1 ],
+	 (uint64_t) 0x01c0000000000000ULL );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "value_is_set[ 1 ]",
+	 value_is_set[ 1 ],
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_records_values_64bit(
+	          NULL,
+	          2,
+	          0,
+	          3,
+	          values_64bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_records_values_64bit(
+	          table,
+	          2,
+	          -1,
+	          3,
+	          values_64bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_records_values_64bit(
+	          table,
+	          2,
+	          0,
+	          -1,
+	          values_64bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_records_values_64bit(
+	          table,
+	          2,
+	          0,
+	          3,
+	          NULL,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_records_values_64bit(
+	          table,
+	          2,
+	          0,
+	          3,
+	          values_64bit,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column type is not a 64-bit integer
+	 */
+	result = libesedb_table_get_records_values_64bit(
+	          table,
+	          1,
+	          0,
+	          3,
+	          values_64bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column is not defined by the table
+	 */
+	result = libesedb_table_get_records_values_64bit(
+	          table,
+	          9,
+	          0,
+	          3,
+	          values_64bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the range of records exceeds the number of records
+	 */
+	result = libesedb_table_get_records_values_64bit(
+	          table,
+	          2,
+	          2,
+	          2,
+	          values_64bit,
+	          value_is_set,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_table_free_test_data(
+	          &file_io_handle,
+	          &io_handle,
+	          &table_definition,
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_test_table_free_test_data(
+	 &file_io_handle,
+	 &io_handle,
+	 &table_definition,
+	 &table,
+	 NULL );
+
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -126,6 +4342,14 @@ int main(
 
 	/* TODO: add tests for libesedb_table_get_column */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_table_get_column_by_utf8_name",
+	 esedb_test_table_get_column_by_utf8_name );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_get_column_by_utf16_name",
+	 esedb_test_table_get_column_by_utf16_name );
+
 	/* TODO: add tests for libesedb_table_get_number_of_indexes */
 
 	/* TODO: add tests for libesedb_table_get_index */
@@ -134,6 +4358,40 @@ int main(
 
 	/* TODO: add tests for libesedb_table_get_record */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_table_get_record_by_key",
+	 esedb_test_table_get_record_by_key );
+
+	/* TODO: add tests for libesedb_table_get_next_record_by_filter */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_get_record_value_32bit",
+	 esedb_test_table_get_record_value_32bit );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_get_record_value_64bit",
+	 esedb_test_table_get_record_value_64bit );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_get_record_value_filetime",
+	 esedb_test_table_get_record_value_filetime );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_get_record_value_floating_point_32bit",
+	 esedb_test_table_get_record_value_floating_point_32bit );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_get_record_value_floating_point_64bit",
+	 esedb_test_table_get_record_value_floating_point_64bit );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_get_records_values_32bit",
+	 esedb_test_table_get_records_values_32bit );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_get_records_values_64bit",
+	 esedb_test_table_get_records_values_64bit );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,6 +34,8 @@
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
 #include "../libesedb/libesedb_table_definition.h"
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
@@ -75,6 +78,395 @@ on_error:
 	return( 0 );
 }
 
+/* Appends a column catalog definition with a specific name to the table definition
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_table_definition_append_column(
+     libesedb_table_definition_t *table_definition,
+     uint32_t column_identifier,
+     const uint8_t *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+
+	if( libesedb_catalog_definition_initialize(
+	     &column_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	column_catalog_definition->type        = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+	column_catalog_definition->identifier  = column_identifier;
+	column_catalog_definition->column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED;
+	column_catalog_definition->size        = 4;
+
+	column_catalog_definition->name = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * name_size );
+
+	if( column_catalog_definition->name == NULL )
+	{
+		goto on_error;
+	}
+	column_catalog_definition->name_size = name_size;
+
+	if( memory_copy(
+	     column_catalog_definition->name,
+	     name,
+	     name_size ) == NULL )
+	{
+		goto on_error;
+	}
+	if( libesedb_table_definition_append_column_catalog_definition(
+	     table_definition,
+	     column_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libesedb_table_definition_get_column_by_utf8_name and
+ * libesedb_table_definition_get_column_by_utf16_name functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_definition_get_column_by_name(
+     void )
+{
+	uint8_t column_name1[ 4 ]                                = { 'C', 'a', 'f', 0xe9 };
+	uint8_t column_name2[ 4 ]                                = { 'C', 'a', 'f', 0xe8 };
+	uint8_t utf8_name1[ 5 ]                                  = { 'C', 'a', 'f', 0xc3, 0xa9 };
+	uint8_t utf8_name2[ 5 ]                                  = { 'C', 'a', 'f', 0xc3, 0xa8 };
+	uint8_t utf8_name3[ 5 ]                                  = { 'C', 'a', 'f', 0xc3, 0xaa };
+	uint16_t utf16_name1[ 4 ]                                = { 'C', 'a', 'f', 0x00e9 };
+	uint16_t utf16_name2[ 4 ]                                = { 'C', 'a', 'f', 0x00e8 };
+
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition  = NULL;
+	libesedb_table_definition_t *table_definition            = NULL;
+	int column_index                                         = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_catalog_definition_initialize(
+	          &table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition->type = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+
+	result = libesedb_table_definition_initialize(
+	          &table_definition,
+	          table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition = NULL;
+
+	/* The column names are stored in codepage 1252
+	 */
+	result = esedb_test_table_definition_append_column(
+	          table_definition,
+	          1,
+	          column_name1,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_table_definition_append_column(
+	          table_definition,
+	          2,
+	          column_name2,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_definition_get_column_by_utf8_name(
+	          table_definition,
+	          utf8_name1,
+	          5,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &column_index,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "column_index",
+	 column_index,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column_catalog_definition",
+	 column_catalog_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_catalog_definition->identifier",
+	 column_catalog_definition->identifier,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_get_column_by_utf8_name(
+	          table_definition,
+	          utf8_name2,
+	          5,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &column_index,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "column_index",
+	 column_index,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_catalog_definition->identifier",
+	 column_catalog_definition->identifier,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_get_column_by_utf8_name(
+	          table_definition,
+	          utf8_name3,
+	          5,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &column_index,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_get_column_by_utf16_name(
+	          table_definition,
+	          utf16_name1,
+	          4,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &column_index,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "column_index",
+	 column_index,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_catalog_definition->identifier",
+	 column_catalog_definition->identifier,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_get_column_by_utf16_name(
+	          table_definition,
+	          utf16_name2,
+	          4,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &column_index,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "column_index",
+	 column_index,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "column_catalog_definition->identifier",
+	 column_catalog_definition->identifier,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a lookup with a different codepage, in which 0xe9 is a different character
+	 */
+	result = libesedb_table_definition_get_column_by_utf8_name(
+	          table_definition,
+	          utf8_name1,
+	          5,
+	          LIBESEDB_CODEPAGE_WINDOWS_1251,
+	          &column_index,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_definition_get_column_by_utf8_name(
+	          NULL,
+	          utf8_name1,
+	          5,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &column_index,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_definition_get_column_by_utf16_name(
+	          table_definition,
+	          NULL,
+	          4,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &column_index,
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -100,6 +492,8 @@ int main(
 	 "libesedb_table_definition_free",
 	 esedb_test_table_definition_free );
 
+	/* TODO: add tests for libesedb_table_definition_empty */
+
 	/* TODO: add tests for libesedb_table_definition_set_long_value_catalog_definition */
 
 	/* TODO: add tests for libesedb_table_definition_set_callback_catalog_definition */
@@ -108,6 +502,16 @@ int main(
 
 	/* TODO: add tests for libesedb_table_definition_append_index_catalog_definition */
 
+	/* TODO: add tests for libesedb_table_definition_get_column_catalog_definition_by_identifier */
+
+	/* TODO: add tests for libesedb_table_definition_build_column_hash_tables */
+
+	/* TODO: add tests for libesedb_table_definition_get_column_by_identifier */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_definition_get_column_by_name",
+	 esedb_test_table_definition_get_column_by_name );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,492 @@
+/*
+ * Library UTF-8 string functions test program
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_utf8_string.h"
+
+/* The sequence: "Test string" U+00e9 U+20ac U+1f600 followed by an end of string character
+ */
+uint8_t esedb_test_utf8_string_utf16_stream[ 34 ] = {
+	0x54, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74, 0x00, 0x20, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00,
+	0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0xe9, 0x00, 0xac, 0x20, 0x3d, 0xd8, 0x00, 0xde, 0x00, 0x00,
+	0x41, 0x00 };
+
+uint8_t esedb_test_utf8_string_utf8_string[ 21 ] = {
+	0x54, 0x65, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0xc3, 0xa9, 0xe2, 0x82, 0xac,
+	0xf0, 0x9f, 0x98, 0x80, 0x00 };
+
+/* The sequence: "Te" followed by an unpaired low surrogate
+ */
+uint8_t esedb_test_utf8_string_unpaired_surrogate_utf16_stream[ 6 ] = {
+	0x54, 0x00, 0x65, 0x00, 0x00, 0xdc };
+
+/* The sequence: byte order mark followed by "Te"
+ */
+uint8_t esedb_test_utf8_string_byte_order_mark_utf16_stream[ 6 ] = {
+	0xff, 0xfe, 0x54, 0x00, 0x65, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_utf8_string_size_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_utf8_string_size_from_utf16_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_utf8_string_size_from_utf16_stream(
+	          esedb_test_utf8_string_utf16_stream,
+	          34,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 21 );
+
+	/* Test stream without end of string character
+	 */
+	result = libesedb_utf8_string_size_from_utf16_stream(
+	          esedb_test_utf8_string_utf16_stream,
+	          22,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 12 );
+
+	/* Test unsupported streams
+	 */
+	result = libesedb_utf8_string_size_from_utf16_stream(
+	          esedb_test_utf8_string_unpaired_surrogate_utf16_stream,
+	          6,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_utf8_string_size_from_utf16_stream(
+	          esedb_test_utf8_string_byte_order_mark_utf16_stream,
+	          6,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_utf8_string_size_from_utf16_stream(
+	          esedb_test_utf8_string_utf16_stream,
+	          33,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_utf8_string_size_from_utf16_stream(
+	          NULL,
+	          34,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_utf8_string_size_from_utf16_stream(
+	          esedb_test_utf8_string_utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_utf8_string_size_from_utf16_stream(
+	          esedb_test_utf8_string_utf16_stream,
+	          34,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_utf8_string_copy_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_utf8_string_copy_from_utf16_stream(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          32,
+	          esedb_test_utf8_string_utf16_stream,
+	          34,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          esedb_test_utf8_string_utf8_string,
+	          21 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test stream without end of string character
+	 */
+	result = libesedb_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          12,
+	          esedb_test_utf8_string_utf16_stream,
+	          22,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "Test string",
+	          12 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test unsupported streams
+	 */
+	result = libesedb_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          32,
+	          esedb_test_utf8_string_unpaired_surrogate_utf16_stream,
+	          6,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          32,
+	          esedb_test_utf8_string_byte_order_mark_utf16_stream,
+	          6,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_utf8_string_copy_from_utf16_stream(
+	          NULL,
+	          32,
+	          esedb_test_utf8_string_utf16_stream,
+	          34,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          esedb_test_utf8_string_utf16_stream,
+	          34,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          32,
+	          NULL,
+	          34,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          32,
+	          esedb_test_utf8_string_utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          20,
+	          esedb_test_utf8_string_utf16_stream,
+	          34,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          11,
+	          esedb_test_utf8_string_utf16_stream,
+	          22,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_utf8_string_size_from_utf16_stream",
+	 esedb_test_utf8_string_size_from_utf16_stream );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_utf8_string_copy_from_utf16_stream",
+	 esedb_test_utf8_string_copy_from_utf16_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,214 @@
+#!/usr/bin/env python
+#
+# Python-bindings long value type test script
+#
+# Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This software is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This software is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this software.  If not, see <http://www.gnu.org/licenses/>.
+
+import argparse
+import os
+import sys
+import unittest
+
+import pyesedb
+
+
+class LongValueTypeTests(unittest.TestCase):
+  """Tests the long value type."""
+
+  def _GetLongValue(self, esedb_file):
+    """Retrieves the first long value with data of the file.
+
+    Args:
+      esedb_file (pyesedb.file): file.
+
+    Returns:
+      pyesedb.long_value: long value or None if not available.
+    """
+    for table in esedb_file.tables:
+      for record in table.records:
+        for value_entry in range(0, record.number_of_values):
+          if not record.is_long_value(value_entry):
+            continue
+
+          long_value = record.get_value_data_as_long_value(value_entry)
+          if long_value and long_value.size > 0:
+            return long_value
+
+    return None
+
+  def test_read_buffer(self):
+    """Tests the read_buffer function."""
+    if not unittest.source:
+      return
+
+    esedb_file = pyesedb.file()
+
+    esedb_file.open(unittest.source)
+
+    long_value = self._GetLongValue(esedb_file)
+    if not long_value:
+      esedb_file.close()
+      return
+
+    data_size = long_value.get_size()
+    data = long_value.get_data()
+
+    # Test a read of all the data.
+    long_value.seek_offset(0, os.SEEK_SET)
+
+    self.assertEqual(long_value.read_buffer(), data)
+
+    # Test a read of part of the data.
+    read_size = min(data_size, 4096)
+
+    long_value.seek_offset(0, os.SEEK_SET)
+
+    self.assertEqual(long_value.read_buffer(size=read_size), data[:read_size])
+
+    # Test a read at the end of the data.
+    long_value.seek_offset(0, os.SEEK_END)
+
+    self.assertEqual(long_value.read_buffer(size=4096), b"")
+
+    # Test a read beyond the end of the data.
+    long_value.seek_offset(data_size + 512, os.SEEK_SET)
+
+    self.assertEqual(long_value.read_buffer(size=4096), b"")
+
+    with self.assertRaises(ValueError):
+      long_value.read_buffer(size=-1)
+
+    esedb_file.close()
+
+  def test_read_buffer_at_offset(self):
+    """Tests the read_buffer_at_offset function."""
+    if not unittest.source:
+      return
+
+    esedb_file = pyesedb.file()
+
+    esedb_file.open(unittest.source)
+
+    long_value = self._GetLongValue(esedb_file)
+    if not long_value:
+      esedb_file.close()
+      return
+
+    data_size = long_value.get_size()
+    data = long_value.get_data()
+
+    # Test a read inside the data.
+    read_offset = data_size // 2
+    read_size = min(data_size - read_offset, 4096)
+
+    self.assertEqual(
+        long_value.read_buffer_at_offset(read_size, read_offset),
+        data[read_offset:read_offset + read_size])
+
+    self.assertEqual(long_value.get_offset(), read_offset + read_size)
+
+    # Test a read that is truncated at the end of the data.
+    self.assertEqual(
+        long_value.read_buffer_at_offset(4096, read_offset),
+        data[read_offset:read_offset + 4096])
+
+    # Test a read at and beyond the end of the data.
+    self.assertEqual(long_value.read_buffer_at_offset(4096, data_size), b"")
+
+    self.assertEqual(
+        long_value.read_buffer_at_offset(4096, data_size + 512), b"")
+
+    with self.assertRaises(ValueError):
+      long_value.read_buffer_at_offset(-1, 0)
+
+    with self.assertRaises(ValueError):
+      long_value.read_buffer_at_offset(16, -1)
+
+    esedb_file.close()
+
+  def test_read_seek_tell(self):
+    """Tests the file-like object read, seek and tell functions."""
+    if not unittest.source:
+      return
+
+    esedb_file = pyesedb.file()
+
+    esedb_file.open(unittest.source)
+
+    long_value = self._GetLongValue(esedb_file)
+    if not long_value:
+      esedb_file.close()
+      return
+
+    data_size = long_value.get_size()
+    data = long_value.get_data()
+
+    self.assertEqual(long_value.tell(), 0)
+
+    # Test a sequential read of the data in parts.
+    read_data = b""
+    read_buffer = long_value.read(1000)
+    while read_buffer:
+      read_data += read_buffer
+      read_buffer = long_value.read(1000)
+
+    self.assertEqual(read_data, data)
+    self.assertEqual(long_value.tell(), data_size)
+
+    # Test the different whence values.
+    long_value.seek(data_size // 2)
+    self.assertEqual(long_value.tell(), data_size // 2)
+
+    self.assertEqual(long_value.read(), data[data_size // 2:])
+
+    long_value.seek(-1, os.SEEK_END)
+    self.assertEqual(long_value.tell(), data_size - 1)
+
+    self.assertEqual(long_value.read(16), data[-1:])
+
+    long_value.seek(-1, os.SEEK_CUR)
+    self.assertEqual(long_value.tell(), data_size - 1)
+
+    # Test a seek beyond the end of the data.
+    long_value.seek(data_size + 512)
+    self.assertEqual(long_value.tell(), data_size + 512)
+
+    self.assertEqual(long_value.read(16), b"")
+
+    with self.assertRaises(IOError):
+      long_value.seek(-1, os.SEEK_SET)
+
+    with self.assertRaises(IOError):
+      long_value.seek(0, 99)
+
+    esedb_file.close()
+
+
+if __name__ == "__main__":
+  argument_parser = argparse.ArgumentParser()
+
+  argument_parser.add_argument(
+      "source", nargs="?", action="store", metavar="PATH",
+      default=None, help="path of the source file.")
+
+  options, unknown_options = argument_parser.parse_known_args()
+  unknown_options.insert(0, sys.argv[0])
+
+  setattr(unittest, "source", options.source)
+
+  unittest.main(argv=unknown_options, verbosity=2)
@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "catalog catalog_definition checksum column column_type compression data_definition data_segment database error file_header index io_handle key long_value multi_value notify page page_header page_tree page_tree_value page_value record table root_page_header space_tree_value table_definition"
+$LibraryTests = "catalog catalog_cache catalog_definition checksum column column_type compression data_definition data_segment database error file_header filter hash_table index index_cursor io_handle key key_builder leaf_counts long_value multi_value notify page page_header page_tree page_tree_cursor page_tree_value page_value predicate record table root_page_header space_tree_value table_cursor table_definition utf8_string"
 $LibraryTestsWithInput = "file support"
 
 $InputGlob = "*"
@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="catalog catalog_definition checksum column column_type compression data_definition data_segment database error file_header index io_handle key long_value multi_value notify page page_header page_tree page_tree_value page_value record table root_page_header space_tree_value table_definition";
+LIBRARY_TESTS="catalog catalog_cache catalog_definition checksum column column_type compression data_definition data_segment database error file_header filter hash_table index index_cursor io_handle key key_builder leaf_counts long_value multi_value notify page page_header page_tree page_tree_cursor page_tree_value page_value predicate record table root_page_header space_tree_value table_cursor table_definition utf8_string";
 LIBRARY_TESTS_WITH_INPUT="file support";
 OPTION_SETS="";
 